@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# these info log entries depend on wall clock time
+WALL_CLOCK_INFO = ['Total real seconds',
+                   'Events per real second',
+                   'Sim units per real second']
+
+def log_files(settings, path=''):
+  # finds the paths of the output file settings of all logs (e.g., message_log,
+  #  rate_log, and channel_log)
+  paths = []
+  if isinstance(settings, dict):
+    items = settings.items()
+  elif isinstance(settings, list):
+    items = enumerate(settings)
+  else:
+    return paths
+  for key, value in items:
+    sub = '{0}/{1}'.format(path, key)
+    if (str(key).endswith('_log') and isinstance(value, dict) and
+        'file' in value):
+      paths.append(sub + '/file')
+    else:
+      paths.extend(log_files(value, sub))
+  return paths
+
+def run(supersim, config_file):
+  # write every log to a temporary file
+  with open(config_file, 'r') as fd:
+    settings = json.load(fd)
+  logs = {}
+  for path in log_files(settings) + ['/simulator/info_log/file']:
+    logs[path] = tempfile.mkstemp()[1]
+
+  # progress printing depends on wall clock time, disable it
+  cmd = [supersim, config_file, '/simulator/print_progress=bool=false']
+  for path, filename in sorted(logs.items()):
+    cmd.append('{0}=string={1}'.format(path, filename))
+  proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+  assert proc.returncode == 0, ('{0} return code was non-zero: {1}'
+                                .format(supersim, proc.returncode))
+
+  # read all log files, drop the wall clock entries of the info log
+  contents = {}
+  for path, filename in logs.items():
+    with open(filename, 'rb') as fd:
+      content = fd.read()
+    os.remove(filename)
+    if path == '/simulator/info_log/file':
+      lines = content.decode('utf-8').splitlines(True)
+      content = ''.join(line for line in lines
+                        if line.split(',')[0] not in WALL_CLOCK_INFO)
+    contents[path] = content
+  return proc.stdout.decode('utf-8'), contents
+
+def main(args):
+  # check if binaries exist
+  assert os.path.exists(args.checked)
+  assert os.path.exists(args.fast)
+  assert os.path.exists(args.config_file)
+
+  # run both binaries
+  print('running simulations')
+  checked_out, checked_logs = run(args.checked, args.config_file)
+  fast_out, fast_logs = run(args.fast, args.config_file)
+  print('done')
+
+  # compare the logs
+  error = False
+  if checked_out != fast_out:
+    error = True
+    print('  output differs')
+  for path in sorted(checked_logs):
+    if checked_logs[path] != fast_logs[path]:
+      error = True
+      print('  {0} differs'.format(path))
+  if not error:
+    print('  logs are identical')
+
+  return -1 if error else 0
+
+if __name__ == '__main__':
+  ap = argparse.ArgumentParser()
+  ap.add_argument('config_file', type=str,
+                  help='config file to run and compare')
+  ap.add_argument('-c', '--checked', type=str,
+                  default='./bazel-bin/supersim',
+                  help='supersim binary with all invariant checks')
+  ap.add_argument('-f', '--fast', type=str,
+                  default='./bazel-bin/supersim_fast',
+                  help='supersim binary with hot and expensive checks removed')
+  args = ap.parse_args()
+  sys.exit(main(args))
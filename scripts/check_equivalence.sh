@@ -0,0 +1,5 @@
+#!/bin/bash
+
+set -e
+
+./check_equivalence -c ./supersim -f ./supersim_fast $1
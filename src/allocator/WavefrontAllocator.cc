@@ -18,6 +18,7 @@
 
 #include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
+#include "util/invariant.h"
 
 WavefrontAllocator::WavefrontAllocator(const std::string& _name,
                                        const Component* _parent,
@@ -84,26 +85,28 @@ void WavefrontAllocator::allocate() {
     u32 line = (startingLine_ + rOffset) % rows_;
     for (u32 col = 0; col < cols_; col++) {
       // check if the col has already been given a grant
-      if (colGrants_.at(col)) {
+      if (colGrants_[col]) {
         continue;
       }
 
       // derive the resource
       u32 row = toRow(line, col);
+      CHECK_HOT(row < rows_);
 
       // check if the row has already been given a grant
-      if (rowGrants_.at(row)) {
+      if (rowGrants_[row]) {
         continue;
       }
 
       // convert from resource/client to index
       u32 index = toIndex(row, col);
+      CHECK_HOT(index < requests_.size());
 
       // allocate if requested
-      if (*(requests_.at(index))) {
-        *(grants_.at(index)) = true;
-        colGrants_.at(col) = true;
-        rowGrants_.at(row) = true;
+      if (*(requests_[index])) {
+        *(grants_[index]) = true;
+        colGrants_[col] = true;
+        rowGrants_[row] = true;
       }
     }
   }
@@ -136,13 +139,13 @@ u32 WavefrontAllocator::toIndex(u32 _row, u32 _col) const {
   u32 line = (_row + _col) % rows_;
   u32 base = line * cols_;
   u32 index = base + _col;
-  assert(index < cols_ * rows_);  // REMOVE ME
+  CHECK_HOT(index < cols_ * rows_);
   return index;
 }
 
 u32 WavefrontAllocator::toRow(u32 _line, u32 _col) const {
   u32 row = (_col > _line) ? (_line + rows_ - _col) : (_line - _col);
-  assert(row < rows_);  // REMOVE ME
+  CHECK_HOT(row < rows_);
   return row;
 }
 
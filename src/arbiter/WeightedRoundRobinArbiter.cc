@@ -0,0 +1,109 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arbiter/WeightedRoundRobinArbiter.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "metadata/TrafficClassMetadataHandler.h"
+#include "util/invariant.h"
+
+WeightedRoundRobinArbiter::WeightedRoundRobinArbiter(
+    const std::string& _name, const Component* _parent, u32 _size,
+    nlohmann::json _settings)
+    : Arbiter(_name, _parent, _size, _settings),
+      currentClass_(0),
+      lastWinner_(U32_MAX),
+      lastClass_(U32_MAX),
+      refill_(false) {
+  assert(_settings.contains("weights") && _settings["weights"].is_array());
+  assert(_settings["weights"].size() > 0);
+  for (u32 cls = 0; cls < _settings["weights"].size(); cls++) {
+    u32 weight = _settings["weights"][cls].get<u32>();
+    assert(weight > 0);
+    weights_.push_back(weight);
+  }
+  credits_ = weights_;
+  nextClient_.resize(weights_.size(), 0);
+}
+
+WeightedRoundRobinArbiter::~WeightedRoundRobinArbiter() {}
+
+void WeightedRoundRobinArbiter::latch() {
+  if (lastWinner_ == U32_MAX) {
+    return;
+  }
+  u32 cls = lastClass_;
+
+  // start a new round if needed
+  if (refill_) {
+    credits_ = weights_;
+  }
+
+  // consume a credit, move to the next class when exhausted
+  credits_.at(cls)--;
+  nextClient_.at(cls) = (lastWinner_ + 1) % size_;
+  if (credits_.at(cls) > 0) {
+    currentClass_ = cls;
+  } else {
+    currentClass_ = (cls + 1) % weights_.size();
+  }
+  lastWinner_ = U32_MAX;
+}
+
+u32 WeightedRoundRobinArbiter::arbitrate() {
+  // a new round starts when no requesting class has credits remaining
+  refill_ = true;
+  for (u32 client = 0; client < size_; client++) {
+    if (*requests_[client]) {
+      u32 cls = TrafficClassMetadataHandler::trafficClass(*metadatas_[client]);
+      CHECK_HOT(cls < weights_.size());
+      if (credits_[cls] > 0) {
+        refill_ = false;
+        break;
+      }
+    }
+  }
+
+  // find the first class with credits, round robin within the class
+  u32 winner = U32_MAX;
+  u32 numClasses = weights_.size();
+  for (u32 c = 0; c < numClasses && winner == U32_MAX; c++) {
+    u32 cls = (currentClass_ + c) % numClasses;
+    u32 credits = refill_ ? weights_[cls] : credits_[cls];
+    if (credits == 0) {
+      continue;
+    }
+    for (u32 i = 0; i < size_; i++) {
+      u32 client = (nextClient_[cls] + i) % size_;
+      if ((*requests_[client]) &&
+          (TrafficClassMetadataHandler::trafficClass(*metadatas_[client]) ==
+           cls)) {
+        winner = client;
+        lastClass_ = cls;
+        break;
+      }
+    }
+  }
+
+  if (winner != U32_MAX) {
+    *grants_[winner] = true;
+  }
+  lastWinner_ = winner;
+  return winner;
+}
+
+registerWithObjectFactory("weighted_round_robin", Arbiter,
+                          WeightedRoundRobinArbiter, ARBITER_ARGS);
@@ -0,0 +1,50 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ARBITER_WEIGHTEDROUNDROBINARBITER_H_
+#define ARBITER_WEIGHTEDROUNDROBINARBITER_H_
+
+#include <string>
+#include <vector>
+
+#include "arbiter/Arbiter.h"
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+// weighted round robin (WRR) across traffic classes as encoded by the
+//  "traffic_class" metadata handler. each class receives "weights[class]"
+//  grants per round, clients within a class are served round robin.
+class WeightedRoundRobinArbiter : public Arbiter {
+ public:
+  WeightedRoundRobinArbiter(const std::string& _name, const Component* _parent,
+                            u32 _size, nlohmann::json _settings);
+  ~WeightedRoundRobinArbiter();
+
+  void latch() override;
+  u32 arbitrate() override;
+
+ private:
+  std::vector<u32> weights_;
+  std::vector<u32> credits_;
+  std::vector<u32> nextClient_;
+  u32 currentClass_;
+
+  // state of the last arbitration, committed in latch()
+  u32 lastWinner_;
+  u32 lastClass_;
+  bool refill_;
+};
+
+#endif  // ARBITER_WEIGHTEDROUNDROBINARBITER_H_
@@ -0,0 +1,116 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "arbiter/WeightedRoundRobinArbiter.h"
+
+#include <string>
+#include <vector>
+
+#include "arbiter/Arbiter.h"
+#include "arbiter/Arbiter_TESTLIB.h"
+#include "gtest/gtest.h"
+#include "metadata/TrafficClassMetadataHandler.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+
+TEST(WeightedRoundRobinArbiter, dist) {
+  TestSetup testSetup(1, 1, 1, 1, 123);
+
+  for (u32 numClasses = 1; numClasses <= 4; numClasses++) {
+    for (u32 size = numClasses; size <= 32; size += 3) {
+      bool* request = new bool[size];
+      u64* metadata = new u64[size];
+      bool* grant = new bool[size];
+      u32* count = new u32[size];
+
+      // class weights are 1, 2, 3, ...
+      nlohmann::json arbSettings;
+      u32 totalWeight = 0;
+      for (u32 cls = 0; cls < numClasses; cls++) {
+        arbSettings["weights"][cls] = cls + 1;
+        totalWeight += cls + 1;
+      }
+
+      std::vector<u32> classSize(numClasses, 0);
+      for (u32 idx = 0; idx < size; idx++) {
+        u32 cls = idx % numClasses;
+        classSize.at(cls)++;
+        request[idx] = true;
+        metadata[idx] = TrafficClassMetadataHandler::encode(cls, idx);
+        count[idx] = 0;
+      }
+
+      Arbiter* arb =
+          new WeightedRoundRobinArbiter("Arb", nullptr, size, arbSettings);
+      assert(arb->size() == size);
+      for (u32 idx = 0; idx < size; idx++) {
+        arb->setRequest(idx, &request[idx]);
+        arb->setMetadata(idx, &metadata[idx]);
+        arb->setGrant(idx, &grant[idx]);
+      }
+
+      const u32 ROUNDS = 1000 * totalWeight * size;
+      for (u32 round = 0; round < ROUNDS; round++) {
+        memset(grant, false, size);
+        arb->arbitrate();
+        ASSERT_EQ(hotCount(grant, size), 1u);
+        count[winnerId(grant, size)]++;
+
+        // non-latched arbitrations must not change the result
+        if (gSim->rnd.nextBool()) {
+          memset(grant, false, size);
+          arb->arbitrate();
+          ASSERT_EQ(hotCount(grant, size), 1u);
+        }
+        arb->latch();
+      }
+
+      // each class gets its weighted share, split evenly among its clients
+      for (u32 idx = 0; idx < size; idx++) {
+        u32 cls = idx % numClasses;
+        f64 expected = (f64)ROUNDS * (cls + 1) / totalWeight / classSize[cls];
+        ASSERT_NEAR(count[idx], expected, 1.0);
+      }
+
+      // a single requesting class receives all grants
+      for (u32 idx = 0; idx < size; idx++) {
+        request[idx] = (idx % numClasses) == (numClasses - 1);
+      }
+      for (u32 round = 0; round < 100; round++) {
+        memset(grant, false, size);
+        arb->arbitrate();
+        ASSERT_EQ(hotCount(grant, size), 1u);
+        ASSERT_TRUE(request[winnerId(grant, size)]);
+        arb->latch();
+      }
+
+      // zero requests input test
+      for (u32 idx = 0; idx < size; idx++) {
+        request[idx] = false;
+      }
+      memset(grant, false, size);
+      ASSERT_EQ(arb->arbitrate(), U32_MAX);
+      ASSERT_EQ(hotCount(grant, size), 0u);
+      arb->latch();
+
+      // cleanup
+      delete[] request;
+      delete[] metadata;
+      delete[] grant;
+      delete[] count;
+      delete arb;
+    }
+  }
+}
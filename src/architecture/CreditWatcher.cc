@@ -17,3 +17,10 @@
 CreditWatcher::CreditWatcher() {}
 
 CreditWatcher::~CreditWatcher() {}
+
+void CreditWatcher::initSharedCredits(u32 _firstVcIdx, u32 _numVcs,
+                                      u32 _reserved, u32 _shared) {
+  for (u32 vcIdx = _firstVcIdx; vcIdx < _firstVcIdx + _numVcs; vcIdx++) {
+    initCredits(vcIdx, _reserved + _shared);
+  }
+}
@@ -28,6 +28,13 @@ class CreditWatcher {
   virtual ~CreditWatcher();
 
   virtual void initCredits(u32 _vcIdx, u32 _credits) = 0;
+
+  // this makes _numVcs contiguous VCs starting at _firstVcIdx share a single
+  //  downstream buffer. each VC has _reserved credits of its own and all VCs
+  //  draw from a pool of _shared credits. the default treats each VC as
+  //  owning its reserved credits plus the whole pool.
+  virtual void initSharedCredits(u32 _firstVcIdx, u32 _numVcs, u32 _reserved,
+                                 u32 _shared);
   virtual void incrementCredit(u32 _vcIdx) = 0;
   virtual void decrementCredit(u32 _vcIdx) = 0;
 };
@@ -17,10 +17,11 @@
 #include <cassert>
 
 #include "event/Simulator.h"
+#include "util/invariant.h"
 
 Crossbar::Crossbar(const std::string& _name, const Component* _parent,
-                   u32 _numInputs, u32 _numOutputs, Simulator::Clock _clock,
-                   nlohmann::json _settings)
+                   u32 _numInputs, u32 _numOutputs,
+                   const ClockDomain* _clock, nlohmann::json _settings)
     : Component(_name, _parent),
       clock_(_clock),
       latency_(_settings["latency"].get<u32>()),
@@ -31,6 +32,16 @@ Crossbar::Crossbar(const std::string& _name, const Component* _parent,
   std::pair<u32, FlitReceiver*> def(U32_MAX, nullptr);
   receivers_.resize(numOutputs_, def);
   nextTime_ = U64_MAX;
+
+  // a new slot can be filled in the cycle the oldest one is sent
+  slots_.resize(latency_ + 1);
+  for (Slot& slot : slots_) {
+    slot.flits.resize(numOutputs_, nullptr);
+    slot.outputs.reserve(numOutputs_);
+  }
+  headSlot_ = 0;
+  tailSlot_ = 0;
+  usedSlots_ = 0;
 }
 
 Crossbar::~Crossbar() {}
@@ -51,46 +62,55 @@ void Crossbar::setReceiver(u32 _destId, FlitReceiver* _receiver,
 
 void Crossbar::inject(Flit* _flit, u32 _srcId, u32 _destId) {
   // 'srcId' is not being used, but is available for debugging
-  assert(_srcId < numInputs_);
+  CHECK_HOT(_srcId < numInputs_);
 
   // determine if this is a new cycle
-  u64 nextTime = gSim->futureCycle(clock_, 1);
+  u64 nextTime = clock_->futureCycle(1);
   if (nextTime_ != nextTime) {
     nextTime_ = nextTime;
 
-    // push in a new map
-    destMaps_.push_front(std::vector<Flit*>(numOutputs_, nullptr));
+    // claim the next slot in the ring
+    CHECK_HOT(usedSlots_ < slots_.size());
+    if (usedSlots_ > 0) {
+      headSlot_ = (headSlot_ + 1) % slots_.size();
+    }
+    usedSlots_++;
 
-    // schedule an event for the new map
-    addEvent(gSim->futureCycle(clock_, latency_), 1, nullptr, 0);
+    // schedule an event for the new slot
+    addEvent(clock_->futureCycle(latency_), 1, nullptr, 0);
   }
 
-  std::vector<Flit*>& map = destMaps_.front();
+  Slot& slot = slots_[headSlot_];
+  CHECK_HOT(_destId < numOutputs_);
   // check to ensure the output has not been double booked
-  assert(map.at(_destId) == nullptr);
+  CHECK_HOT(slot.flits[_destId] == nullptr);
   // map in the info
-  map.at(_destId) = _flit;
+  slot.flits[_destId] = _flit;
+  slot.outputs.push_back(_destId);
 }
 
 void Crossbar::processEvent(void* _event, s32 _type) {
-  assert(gSim->epsilon() == 1);
-  assert(destMaps_.size() >= 1);
-
-  // pull out the next map
-  assert(destMaps_.empty() == false);
-  std::vector<Flit*>& map = destMaps_.back();
-
-  // send all flits
-  for (u32 i = 0; i < map.size(); i++) {
-    if (map.at(i)) {
-      u32 port = receivers_.at(i).first;
-      assert(port != U32_MAX);
-      FlitReceiver* receiver = receivers_.at(i).second;
-      assert(receiver != nullptr);
-      receiver->receiveFlit(port, map.at(i));
-    }
+  CHECK_HOT(gSim->epsilon() == 1);
+  CHECK_HOT(usedSlots_ >= 1);
+
+  // pull out the oldest slot
+  Slot& slot = slots_[tailSlot_];
+
+  // send all flits, only visiting the outputs that have one
+  for (u32 output : slot.outputs) {
+    Flit* flit = slot.flits[output];
+    slot.flits[output] = nullptr;
+    u32 port = receivers_[output].first;
+    CHECK_HOT(port != U32_MAX);
+    FlitReceiver* receiver = receivers_[output].second;
+    CHECK_HOT(receiver != nullptr);
+    receiver->receiveFlit(port, flit);
   }
+  slot.outputs.clear();
 
-  // pop the map
-  destMaps_.pop_back();
+  // release the slot
+  usedSlots_--;
+  if (usedSlots_ > 0) {
+    tailSlot_ = (tailSlot_ + 1) % slots_.size();
+  }
 }
@@ -15,11 +15,11 @@
 #ifndef ARCHITECTURE_CROSSBAR_H_
 #define ARCHITECTURE_CROSSBAR_H_
 
-#include <list>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
@@ -29,7 +29,8 @@
 class Crossbar : public Component {
  public:
   Crossbar(const std::string& _name, const Component* _parent, u32 _numInputs,
-           u32 _numOutputs, Simulator::Clock _clock, nlohmann::json _settings);
+           u32 _numOutputs, const ClockDomain* _clock,
+           nlohmann::json _settings);
   ~Crossbar();
   u32 numInputs() const;
   u32 numOutputs() const;
@@ -39,13 +40,22 @@ class Crossbar : public Component {
   void processEvent(void* _event, s32 _type) override;
 
  private:
-  const Simulator::Clock clock_;
+  const ClockDomain* clock_;
   const u64 latency_;
   const u32 numInputs_;
   const u32 numOutputs_;
   std::vector<std::pair<u32, FlitReceiver*>> receivers_;
   u64 nextTime_;
-  std::list<std::vector<Flit*>> destMaps_;
+
+  // each cycle of injections fills one slot of a preallocated ring
+  struct Slot {
+    std::vector<Flit*> flits;  // indexed by output
+    std::vector<u32> outputs;  // outputs with a flit
+  };
+  std::vector<Slot> slots_;
+  u32 headSlot_;  // the slot being filled
+  u32 tailSlot_;  // the next slot to be sent
+  u32 usedSlots_;
 };
 
 #endif  // ARCHITECTURE_CROSSBAR_H_
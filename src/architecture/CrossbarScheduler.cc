@@ -14,11 +14,14 @@
  */
 #include "architecture/CrossbarScheduler.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
 #include <cstring>
 
 #include "allocator/Allocator.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 static bool warningIssued = false;
 
@@ -30,7 +33,7 @@ CrossbarScheduler::CrossbarScheduler(const std::string& _name,
                                      const Component* _parent, u32 _numClients,
                                      u32 _totalVcs, u32 _crossbarPorts,
                                      u32 _globalVcOffset,
-                                     Simulator::Clock _clock,
+                                     const ClockDomain* _clock,
                                      nlohmann::json _settings)
     : Component(_name, _parent),
       numClients_(_numClients),
@@ -69,6 +72,8 @@ CrossbarScheduler::CrossbarScheduler(const std::string& _name,
   // create the credit counters
   credits_.resize(totalVcs_, 0);
   maxCredits_.resize(totalVcs_, 0);
+  creditPools_.resize(totalVcs_, U32_MAX);
+  sharedHeld_.resize(totalVcs_, 0);
 
   // create arrays for allocator inputs and outputs
   requests_ = new bool[crossbarPorts_ * numClients_];
@@ -78,6 +83,8 @@ CrossbarScheduler::CrossbarScheduler(const std::string& _name,
 
   // create arrays for handling port locks
   anyRequests_.resize(crossbarPorts_, false);
+  nonspecRequests_.resize(crossbarPorts_, false);
+  specRequests_ = 0;
   portLocks_.resize(crossbarPorts_, U32_MAX);
 
   // create the allocator
@@ -123,14 +130,61 @@ void CrossbarScheduler::setClient(u32 _id, Client* _client) {
 
 void CrossbarScheduler::request(u32 _client, u32 _port, u32 _vcIdx,
                                 Flit* _flit) {
-  assert(gSim->epsilon() >= 1);
-  assert(_client < numClients_);
-  assert(clientRequestPorts_[_client] == U32_MAX);
-  assert(clientRequestVcs_[_client] == U32_MAX);
-  assert(clientRequestFlits_[_client] == nullptr);
-  assert(_vcIdx < totalVcs_);
-  assert(_port < crossbarPorts_);
+  CHECK_HOT(gSim->epsilon() >= 1);
+  CHECK_HOT(_client < numClients_);
+  CHECK_HOT(clientRequestPorts_[_client] == U32_MAX);
+  CHECK_HOT(clientRequestVcs_[_client] == U32_MAX);
+  CHECK_HOT(clientRequestFlits_[_client] == nullptr);
+  CHECK_HOT(_vcIdx < totalVcs_);
+  CHECK_HOT(_port < crossbarPorts_);
+  setRequest(_client, _port, _vcIdx, _flit);
+}
+
+void CrossbarScheduler::requestSpeculative(u32 _client, u32 _port,
+                                           Flit* _flit) {
+  CHECK_HOT(gSim->epsilon() >= 1);
+  CHECK_HOT(_client < numClients_);
+  CHECK_HOT(clientRequestPorts_[_client] == U32_MAX);
+  CHECK_HOT(clientRequestFlits_[_client] == nullptr);
+  CHECK_HOT(_flit->isHead());
+  CHECK_HOT(_port < crossbarPorts_);
+  specRequests_++;
+  setRequest(_client, _port, U32_MAX, _flit);
+}
+
+void CrossbarScheduler::cancelSpeculative(u32 _client, u32 _port) {
+  CHECK_HOT(_port < crossbarPorts_);
+  if (portLocks_[_port] == _client) {
+    portLocks_[_port] = U32_MAX;
+  }
+}
 
+bool CrossbarScheduler::canSend(u32 _vcIdx, const Flit* _flit) const {
+  CHECK_HOT(_vcIdx < totalVcs_);
+  if (fullPacket_) {
+    // packet-buffer flow control
+    if (_flit->isHead()) {
+      u32 packetSize = _flit->packet()->numFlits();
+      CHECK_HOT(maxAvailableCredits(_vcIdx) >= packetSize);  // large enough
+      // a VC sharing a pool must fit a packet in its own credits, otherwise
+      //  it relies on the pool and escape VCs are no longer deadlock free
+      if (creditPools_[_vcIdx] != U32_MAX &&
+          packetSize > maxCredits_[_vcIdx]) {
+        fprintf(stderr, "%u flit packet exceeds the %u reserved credits\n",
+                packetSize, maxCredits_[_vcIdx]);
+        assert(false);
+      }
+      return availableCredits(_vcIdx) >= packetSize;
+    }
+    return true;
+  } else {
+    // flit-buffer flow control
+    return availableCredits(_vcIdx) > 0;
+  }
+}
+
+void CrossbarScheduler::setRequest(u32 _client, u32 _port, u32 _vcIdx,
+                                   const Flit* _flit) {
   // set request
   clientRequestPorts_[_client] = _port;
   clientRequestVcs_[_client] = _vcIdx;
@@ -143,7 +197,7 @@ void CrossbarScheduler::request(u32 _client, u32 _port, u32 _vcIdx,
   // upgrade event
   if (eventAction_ == EventAction::NONE) {
     eventAction_ = EventAction::RUNALLOC;
-    addEvent(gSim->futureCycle(clock_, 1), 0, nullptr, 0);
+    addEvent(clock_->futureCycle(1), 0, nullptr, 0);
   } else if (eventAction_ == EventAction::CREDITS) {
     eventAction_ = EventAction::RUNALLOC;
   }
@@ -151,13 +205,37 @@ void CrossbarScheduler::request(u32 _client, u32 _port, u32 _vcIdx,
 
 void CrossbarScheduler::initCredits(u32 _vcIdx, u32 _credits) {
   assert(_vcIdx < totalVcs_);
+  assert(creditPools_[_vcIdx] == U32_MAX);
   credits_[_vcIdx] = _credits;
   maxCredits_[_vcIdx] = _credits;
 }
 
+void CrossbarScheduler::initSharedCredits(u32 _firstVcIdx, u32 _numVcs,
+                                          u32 _reserved, u32 _shared) {
+  assert(_numVcs > 0);
+  assert(_firstVcIdx + _numVcs <= totalVcs_);
+  assert(_reserved > 0);  // each VC must always be able to make progress
+  assert(_shared != U32_MAX);
+  // without packet locks, packets on several VCs of the port could interleave
+  //  and together spend more pool credits than their heads checked for
+  if (!packetLock_) {
+    fprintf(stderr, "shared credit pools require packet_lock\n");
+    assert(false);
+  }
+  u32 pool = poolCredits_.size();
+  poolCredits_.push_back(_shared);
+  maxPoolCredits_.push_back(_shared);
+  for (u32 vcIdx = _firstVcIdx; vcIdx < _firstVcIdx + _numVcs; vcIdx++) {
+    assert(creditPools_[vcIdx] == U32_MAX);
+    creditPools_[vcIdx] = pool;
+    credits_[vcIdx] = _reserved;
+    maxCredits_[vcIdx] = _reserved;
+  }
+}
+
 void CrossbarScheduler::incrementCredit(u32 _vcIdx) {
-  assert(gSim->epsilon() >= 1);
-  assert(_vcIdx < totalVcs_);
+  CHECK_HOT(gSim->epsilon() >= 1);
+  CHECK_HOT(_vcIdx < totalVcs_);
 
   // add increment value to VC
   incrCredits_[_vcIdx]++;
@@ -165,36 +243,52 @@ void CrossbarScheduler::incrementCredit(u32 _vcIdx) {
   // upgrade event
   if (eventAction_ == EventAction::NONE) {
     eventAction_ = EventAction::CREDITS;
-    addEvent(gSim->futureCycle(clock_, 1), 0, nullptr, 0);
+    addEvent(clock_->futureCycle(1), 0, nullptr, 0);
   }
 }
 
 void CrossbarScheduler::decrementCredit(u32 _vcIdx) {
-  assert(_vcIdx < totalVcs_);
-
-  // decrement the credit count
-  assert(credits_[_vcIdx] > 0);
-  credits_[_vcIdx]--;
+  CHECK_HOT(_vcIdx < totalVcs_);
+
+  // decrement the credit count, using the pool once the VC's own are gone
+  if (credits_[_vcIdx] > 0) {
+    credits_[_vcIdx]--;
+  } else {
+    u32 pool = creditPools_[_vcIdx];
+    CHECK_HOT(pool != U32_MAX);
+    CHECK_HOT(poolCredits_[pool] > 0);
+    poolCredits_[pool]--;
+    sharedHeld_[_vcIdx]++;
+  }
 }
 
 u32 CrossbarScheduler::getCreditCount(u32 _vcIdx) const {
-  assert(_vcIdx < totalVcs_);
-  return credits_[_vcIdx];
+  CHECK_HOT(_vcIdx < totalVcs_);
+  return availableCredits(_vcIdx);
 }
 
 void CrossbarScheduler::processEvent(void* _event, s32 _type) {
-  assert(gSim->epsilon() == 0);
-  assert(eventAction_ != EventAction::NONE);
+  CHECK_HOT(gSim->epsilon() == 0);
+  CHECK_HOT(eventAction_ != EventAction::NONE);
 
   // apply all credit incrementations needed
   for (auto it = incrCredits_.cbegin(); it != incrCredits_.cend(); ++it) {
     u32 vc = it->first;
     u32 incr = it->second;
-    assert(vc < totalVcs_);
+    CHECK_HOT(vc < totalVcs_);
+    u32 pool = creditPools_[vc];
+    if (pool != U32_MAX) {
+      u32 shared = std::min(incr, sharedHeld_[vc]);
+      sharedHeld_[vc] -= shared;
+      poolCredits_[pool] += shared;
+      CHECK_HOT(poolCredits_[pool] <= maxPoolCredits_[pool]);
+      incr -= shared;
+    }
     credits_[vc] += incr;
-    assert(credits_[vc] <= maxCredits_[vc]);
+    CHECK_HOT(credits_[vc] <= maxCredits_[vc]);
   }
   incrCredits_.clear();
+  CHECK_EXPENSIVE(creditsValid());
 
   // if required, run the allocator
   if (eventAction_ == EventAction::RUNALLOC) {
@@ -206,25 +300,29 @@ void CrossbarScheduler::processEvent(void* _event, s32 _type) {
         u32 vc = clientRequestVcs_[c];
         u64 idx = index(c, port);
 
-        if (fullPacket_) {
-          // packet-buffer flow control
-          const Flit* flit = clientRequestFlits_[c];
-          if (flit->isHead()) {
-            u32 packetSize = flit->packet()->numFlits();
-            assert(maxCredits_[vc] >= packetSize);  // buffer is large enough
-            if (requests_[idx] && credits_[vc] < packetSize) {
-              requests_[idx] = false;
-            }
-          }
-        } else {
-          // flit-buffer flow control
-          if (requests_[idx] && credits_[vc] == 0) {
-            requests_[idx] = false;
-          }
+        // speculative requests don't know their VC yet
+        if (vc != U32_MAX && requests_[idx] &&
+            !canSend(vc, clientRequestFlits_[c])) {
+          requests_[idx] = false;
+        }
+        if (vc != U32_MAX && requests_[idx]) {
+          nonspecRequests_[port] = true;
         }
       }
     }
 
+    // speculative requests only get ports that no one else wants
+    if (specRequests_ > 0) {
+      for (u32 c = 0; c < numClients_; c++) {
+        u32 port = clientRequestPorts_[c];
+        if (port != U32_MAX && clientRequestVcs_[c] == U32_MAX &&
+            nonspecRequests_[port]) {
+          requests_[index(c, port)] = false;
+        }
+      }
+      specRequests_ = 0;
+    }
+
     if (packetLock_) {
       // perform the lock request filtering algorithm
       for (u32 p = 0; p < crossbarPorts_; p++) {
@@ -255,9 +353,10 @@ void CrossbarScheduler::processEvent(void* _event, s32 _type) {
       }
     }
 
-    // clear the any request vector
+    // clear the any request vectors
     for (u32 p = 0; p < crossbarPorts_; p++) {
       anyRequests_[p] = false;
+      nonspecRequests_[p] = false;
     }
 
     // clear the grants (must do before allocate() call)
@@ -265,6 +364,7 @@ void CrossbarScheduler::processEvent(void* _event, s32 _type) {
 
     // run the allocator
     allocator_->allocate();
+    CHECK_EXPENSIVE(grantsValid());
 
     // deliver responses, reset requests, if required lock ports
     for (u32 c = 0; c < numClients_; c++) {
@@ -280,7 +380,7 @@ void CrossbarScheduler::processEvent(void* _event, s32 _type) {
         u32 granted = U32_MAX;
         if (grants_[idx]) {
           granted = port;
-          assert(credits_[vc] > 0);
+          CHECK_HOT(vc == U32_MAX || availableCredits(vc) > 0);
 
           // if needed, lock the port
           if (packetLock_) {
@@ -303,3 +403,57 @@ u64 CrossbarScheduler::index(u64 _client, u64 _port) const {
   // this indexing contiguously places resources
   return (crossbarPorts_ * _client) + _port;
 }
+
+u32 CrossbarScheduler::availableCredits(u32 _vcIdx) const {
+  u32 pool = creditPools_[_vcIdx];
+  if (pool == U32_MAX) {
+    return credits_[_vcIdx];
+  }
+  return credits_[_vcIdx] + poolCredits_[pool];
+}
+
+u32 CrossbarScheduler::maxAvailableCredits(u32 _vcIdx) const {
+  u32 pool = creditPools_[_vcIdx];
+  if (pool == U32_MAX) {
+    return maxCredits_[_vcIdx];
+  }
+  return maxCredits_[_vcIdx] + maxPoolCredits_[pool];
+}
+
+bool CrossbarScheduler::creditsValid() const {
+  for (u32 vc = 0; vc < totalVcs_; vc++) {
+    if (credits_[vc] > maxCredits_[vc]) {
+      return false;
+    }
+    // a VC only holds pool credits after spending all of its own
+    if (sharedHeld_[vc] > 0 && credits_[vc] > 0) {
+      return false;
+    }
+  }
+  for (u32 pool = 0; pool < poolCredits_.size(); pool++) {
+    if (poolCredits_[pool] > maxPoolCredits_[pool]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CrossbarScheduler::grantsValid() const {
+  // each grant must match a request and each port is granted at most once
+  for (u32 p = 0; p < crossbarPorts_; p++) {
+    u32 grants = 0;
+    for (u32 c = 0; c < numClients_; c++) {
+      u64 idx = index(c, p);
+      if (grants_[idx]) {
+        if (!requests_[idx]) {
+          return false;
+        }
+        grants++;
+      }
+    }
+    if (grants > 1) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -21,6 +21,7 @@
 
 #include "allocator/Allocator.h"
 #include "architecture/CreditWatcher.h"
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
@@ -47,7 +48,7 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   // constructor and destructor
   CrossbarScheduler(const std::string& _name, const Component* _parent,
                     u32 _numClients, u32 _totalVcs, u32 _crossbarPorts,
-                    u32 _globalVcOffset, Simulator::Clock _clock,
+                    u32 _globalVcOffset, const ClockDomain* _clock,
                     nlohmann::json _settings);
   ~CrossbarScheduler();
 
@@ -62,8 +63,22 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   // requests to send a flit to a VC
   void request(u32 _client, u32 _port, u32 _vcIdx, Flit* _flit);
 
+  /*
+   * Speculative requests are for head flits that are still in VC allocation.
+   *  They don't check credits and lose to all non-speculative requests for
+   *  the same port. The response gives U32_MAX as the VC. A client that gets
+   *  a grant but can't use it (no VC or no credits) must cancel it.
+   */
+  void requestSpeculative(u32 _client, u32 _port, Flit* _flit);
+  void cancelSpeculative(u32 _client, u32 _port);
+
+  // this returns true if the VC has enough credits for the flit
+  bool canSend(u32 _vcIdx, const Flit* _flit) const;
+
   // credit counts
   void initCredits(u32 _vcIdx, u32 _credits) override;
+  void initSharedCredits(u32 _firstVcIdx, u32 _numVcs, u32 _reserved,
+                         u32 _shared) override;
   void incrementCredit(u32 _vcIdx) override;
   void decrementCredit(u32 _vcIdx) override;
   u32 getCreditCount(u32 _vcIdx) const;
@@ -76,7 +91,7 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   const u32 totalVcs_;
   const u32 crossbarPorts_;
   const u32 globalVcOffset_;
-  const Simulator::Clock clock_;
+  const ClockDomain* clock_;
 
   std::vector<Client*> clients_;
   std::vector<u32> clientRequestPorts_;
@@ -87,11 +102,20 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   std::vector<u32> maxCredits_;
   std::unordered_map<u32, u32> incrCredits_;
 
+  // shared credit pools, VCs spend their own credits before the pool's and
+  //  credits return to the pool before the VC's own
+  std::vector<u32> creditPools_;  // pool of each VC, U32_MAX when unshared
+  std::vector<u32> sharedHeld_;   // pool credits held by each VC
+  std::vector<u32> poolCredits_;
+  std::vector<u32> maxPoolCredits_;
+
   bool* requests_;
   u64* metadatas_;
   bool* grants_;
 
   std::vector<bool> anyRequests_;  // someone has requested port
+  std::vector<bool> nonspecRequests_;  // port has non-speculative requests
+  u32 specRequests_;
   std::vector<u32> portLocks_;     // output port locks
 
   Allocator* allocator_;
@@ -103,8 +127,18 @@ class CrossbarScheduler : public Component, public CreditWatcher {
   enum class EventAction : u8 { NONE = 0, CREDITS = 1, RUNALLOC = 2 };
   EventAction eventAction_;
 
+  void setRequest(u32 _client, u32 _port, u32 _vcIdx, const Flit* _flit);
+
   // this creates an index for requests_, metadatas_, vcs_, and grants_
   u64 index(u64 _client, u64 _port) const;
+
+  // these include the credits of the VC's pool, if any
+  u32 availableCredits(u32 _vcIdx) const;
+  u32 maxAvailableCredits(u32 _vcIdx) const;
+
+  // these are expensive consistency checks (see util/invariant.h)
+  bool creditsValid() const;
+  bool grantsValid() const;
 };
 
 #endif  // ARCHITECTURE_CROSSBARSCHEDULER_H_
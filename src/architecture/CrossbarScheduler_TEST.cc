@@ -180,9 +180,9 @@ TEST(CrossbarScheduler, basic) {
           schSettings["full_packet"] = std::get<0>(style);
           schSettings["packet_lock"] = std::get<1>(style);
           schSettings["idle_unlock"] = std::get<2>(style);
-          CrossbarScheduler* xbarSch =
-              new CrossbarScheduler("XbarSch", nullptr, C, V, P, 0,
-                                    Simulator::Clock::ROUTER, schSettings);
+          CrossbarScheduler* xbarSch = new CrossbarScheduler(
+              "XbarSch", nullptr, C, V, P, 0,
+              gSim->clockDomain(Simulator::Clock::ROUTER), schSettings);
           assert(xbarSch->numClients() == C);
           assert(xbarSch->totalVcs() == V);
           assert(xbarSch->crossbarPorts() == P);
@@ -210,3 +210,168 @@ TEST(CrossbarScheduler, basic) {
     }
   }
 }
+
+TEST(CrossbarScheduler, sharedCredits) {
+  const u32 ALLOCS_PER_CLIENT = 100;
+  const u32 C = 6;
+  const u32 P = 3;
+  const u32 Vd = 4;
+  const u32 V = P * Vd;
+  const u32 RESERVED = 1;
+  const u32 SHARED = 5;
+
+  for (bool fullPacket : {true, false}) {
+    // setup
+    TestSetup testSetup(12, 12, 12, 12, 0x1234567890abcdf);
+    nlohmann::json arbSettings;
+    arbSettings["type"] = "random";
+    nlohmann::json allocSettings;
+    allocSettings["type"] = "r_separable";
+    allocSettings["resource_arbiter"] = arbSettings;
+    allocSettings["slip_latch"] = true;
+    nlohmann::json schSettings;
+    schSettings["allocator"] = allocSettings;
+    schSettings["full_packet"] = fullPacket;
+    schSettings["packet_lock"] = true;
+    schSettings["idle_unlock"] = false;
+
+    // own credits are spent before the pool's
+    CrossbarScheduler* xbarSch = new CrossbarScheduler(
+        "XbarSch", nullptr, C, V, P, 0,
+        gSim->clockDomain(Simulator::Clock::ROUTER), schSettings);
+    for (u32 p = 0; p < P; p++) {
+      xbarSch->initSharedCredits(p * Vd, Vd, RESERVED, SHARED);
+    }
+    xbarSch->decrementCredit(0);
+    ASSERT_EQ(xbarSch->getCreditCount(0), SHARED);
+    ASSERT_EQ(xbarSch->getCreditCount(1), RESERVED + SHARED);
+    xbarSch->decrementCredit(0);
+    ASSERT_EQ(xbarSch->getCreditCount(0), SHARED - 1);
+    ASSERT_EQ(xbarSch->getCreditCount(1), RESERVED + SHARED - 1);
+    ASSERT_EQ(xbarSch->getCreditCount(Vd), RESERVED + SHARED);
+    delete xbarSch;
+
+    // run clients against the pools
+    xbarSch = new CrossbarScheduler(
+        "XbarSch", nullptr, C, V, P, 0,
+        gSim->clockDomain(Simulator::Clock::ROUTER), schSettings);
+    for (u32 p = 0; p < P; p++) {
+      xbarSch->initSharedCredits(p * Vd, Vd, RESERVED, SHARED);
+    }
+    std::vector<CrossbarSchedulerTestClient*> clients(C);
+    for (u32 c = 0; c < C; c++) {
+      clients[c] = new CrossbarSchedulerTestClient(
+          c, xbarSch, V, P, Simulator::Clock::ROUTER, ALLOCS_PER_CLIENT);
+    }
+    gSim->initialize();
+    gSim->simulate();
+
+    // all credits have returned to their owners
+    for (u32 v = 0; v < V; v++) {
+      ASSERT_EQ(xbarSch->getCreditCount(v), RESERVED + SHARED);
+    }
+
+    // tear down
+    delete xbarSch;
+    for (u32 c = 0; c < C; c++) {
+      delete clients[c];
+    }
+  }
+}
+
+class SpeculativeTestClient : public CrossbarScheduler::Client,
+                              public Component {
+ public:
+  SpeculativeTestClient(u32 _id, CrossbarScheduler* _xbarSch, u32 _port,
+                        u32 _vcIdx)
+      : Component("SpecClient_" + std::to_string(_id), nullptr),
+        id_(_id),
+        xbarSch_(_xbarSch),
+        port_(_port),
+        vcIdx_(_vcIdx),
+        grantedPort_(U32_MAX),
+        grantedVcIdx_(0) {
+    xbarSch_->setClient(id_, this);
+    packet_ = new Packet(0, 1, nullptr);
+    flit_ = new Flit(0, true, true, packet_);
+    packet_->setFlit(0, flit_);
+    packet_->setMetadata(0);
+    addEvent(gSim->time(), 1, nullptr, 0);
+  }
+
+  ~SpeculativeTestClient() {
+    delete packet_;
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    if (vcIdx_ == U32_MAX) {
+      xbarSch_->requestSpeculative(id_, port_, flit_);
+    } else {
+      xbarSch_->request(id_, port_, vcIdx_, flit_);
+    }
+  }
+
+  void crossbarSchedulerResponse(u32 _port, u32 _vcIdx) override {
+    grantedPort_ = _port;
+    grantedVcIdx_ = _vcIdx;
+  }
+
+  u32 grantedPort() const {
+    return grantedPort_;
+  }
+
+  u32 grantedVcIdx() const {
+    return grantedVcIdx_;
+  }
+
+ private:
+  u32 id_;
+  CrossbarScheduler* xbarSch_;
+  u32 port_;
+  u32 vcIdx_;
+  Packet* packet_;
+  Flit* flit_;
+  u32 grantedPort_;
+  u32 grantedVcIdx_;
+};
+
+TEST(CrossbarScheduler, speculative) {
+  // client 0 is non-speculative on VC 0, clients 1 and 2 are speculative
+  //  {credits on VC 0, expected grant of client 0, 1, 2}
+  std::vector<std::tuple<u32, bool, bool, bool>> cases = {
+      std::make_tuple(1, true, false, true),
+      std::make_tuple(0, false, true, true)};
+
+  for (auto c : cases) {
+    TestSetup testSetup(12, 12, 12, 12, 0x1234567890abcdf);
+    nlohmann::json arbSettings;
+    arbSettings["type"] = "random";
+    nlohmann::json allocSettings;
+    allocSettings["type"] = "r_separable";
+    allocSettings["resource_arbiter"] = arbSettings;
+    allocSettings["slip_latch"] = true;
+    nlohmann::json schSettings;
+    schSettings["allocator"] = allocSettings;
+    schSettings["full_packet"] = false;
+    schSettings["packet_lock"] = false;
+    schSettings["idle_unlock"] = false;
+    CrossbarScheduler* xbarSch = new CrossbarScheduler(
+        "XbarSch", nullptr, 3, 2, 2, 0,
+        gSim->clockDomain(Simulator::Clock::ROUTER), schSettings);
+    xbarSch->initCredits(0, std::get<0>(c));
+    xbarSch->initCredits(1, 0);  // speculative requests ignore credits
+
+    // clients 0 and 1 want port 0, client 2 wants port 1
+    SpeculativeTestClient client0(0, xbarSch, 0, 0);
+    SpeculativeTestClient client1(1, xbarSch, 0, U32_MAX);
+    SpeculativeTestClient client2(2, xbarSch, 1, U32_MAX);
+    gSim->initialize();
+    gSim->simulate();
+
+    ASSERT_EQ(client0.grantedPort() == 0, std::get<1>(c));
+    ASSERT_EQ(client1.grantedPort() == 0, std::get<2>(c));
+    ASSERT_EQ(client2.grantedPort() == 1, std::get<3>(c));
+    ASSERT_EQ(client2.grantedVcIdx(), U32_MAX);
+    delete xbarSch;
+  }
+}
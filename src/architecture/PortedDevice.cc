@@ -16,7 +16,7 @@
 
 #include <cassert>
 
-PortedDevice::PortedDevice(u32 _id, const std::vector<u32>& _address,
+PortedDevice::PortedDevice(u32 _id, const Address& _address,
                            u32 _numPorts, u32 _numVcs)
     : id_(_id), address_(_address), numPorts_(_numPorts), numVcs_(_numVcs) {}
 
@@ -26,7 +26,7 @@ u32 PortedDevice::id() const {
   return id_;
 }
 
-const std::vector<u32>& PortedDevice::address() const {
+const Address& PortedDevice::address() const {
   return address_;
 }
 
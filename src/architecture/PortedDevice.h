@@ -19,15 +19,16 @@
 
 #include "network/Channel.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 
 class PortedDevice {
  public:
-  PortedDevice(u32 _id, const std::vector<u32>& _address, u32 _numPorts,
+  PortedDevice(u32 _id, const Address& _address, u32 _numPorts,
                u32 _numVcs);
   virtual ~PortedDevice();
 
   u32 id() const;
-  const std::vector<u32>& address() const;
+  const Address& address() const;
 
   u32 numPorts() const;
   u32 numVcs() const;
@@ -42,7 +43,7 @@ class PortedDevice {
 
  protected:
   const u32 id_;
-  const std::vector<u32> address_;
+  const Address address_;
   const u32 numPorts_;
   const u32 numVcs_;
 };
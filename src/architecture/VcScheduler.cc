@@ -18,6 +18,7 @@
 #include <cstring>
 
 #include "allocator/Allocator.h"
+#include "util/invariant.h"
 
 VcScheduler::Client::Client() {}
 
@@ -27,7 +28,8 @@ const s32 kAllocEvent = 123;
 
 VcScheduler::VcScheduler(const std::string& _name, const Component* _parent,
                          u32 _numClients, u32 _totalVcs,
-                         Simulator::Clock _clock, nlohmann::json _settings)
+                         const ClockDomain* _clock,
+                         nlohmann::json _settings)
     : Component(_name, _parent),
       numClients_(_numClients),
       totalVcs_(_totalVcs),
@@ -86,9 +88,9 @@ void VcScheduler::setClient(u32 _id, Client* _client) {
 }
 
 void VcScheduler::request(u32 _client, u32 _vcIdx, u64 _metadata) {
-  assert(gSim->epsilon() >= 1);
-  assert(_client < numClients_);
-  assert(_vcIdx < totalVcs_);
+  CHECK_HOT(gSim->epsilon() >= 1);
+  CHECK_HOT(_client < numClients_);
+  CHECK_HOT(_vcIdx < totalVcs_);
 
   // set the request
   u64 idx = index(_client, _vcIdx);
@@ -99,19 +101,19 @@ void VcScheduler::request(u32 _client, u32 _vcIdx, u64 _metadata) {
   // ensure there is an event set to perform scheduling
   if (!allocEventSet_) {
     allocEventSet_ = true;
-    addEvent(gSim->futureCycle(clock_, 1), 0, nullptr, kAllocEvent);
+    addEvent(clock_->futureCycle(1), 0, nullptr, kAllocEvent);
   }
 }
 
 void VcScheduler::releaseVc(u32 _vcIdx) {
-  assert(gSim->epsilon() >= 1);
-  assert(vcTaken_.at(_vcIdx) == true);
+  CHECK_HOT(gSim->epsilon() >= 1);
+  CHECK_HOT(vcTaken_.at(_vcIdx) == true);
   vcTaken_.at(_vcIdx) = false;
 }
 
 void VcScheduler::processEvent(void* _event, s32 _type) {
-  assert(_type == kAllocEvent);
-  assert(gSim->epsilon() == 0);
+  CHECK_HOT(_type == kAllocEvent);
+  CHECK_HOT(gSim->epsilon() == 0);
   allocEventSet_ = false;
 
   // check VC availability, mask out unavailable VC requests
@@ -141,12 +143,12 @@ void VcScheduler::processEvent(void* _event, s32 _type) {
         u64 idx = index(c, v);
 
         // multiple grants to the same client? BAD
-        assert(!((granted != U32_MAX) && (grants_[idx])));
+        CHECK_HOT(!((granted != U32_MAX) && (grants_[idx])));
 
         // check for granted
         if ((granted == U32_MAX) && (grants_[idx])) {
           granted = v;
-          assert(vcTaken_[v] == false);
+          CHECK_HOT(vcTaken_[v] == false);
           vcTaken_[v] = true;
         }
         requests_[idx] = false;
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "allocator/Allocator.h"
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
@@ -41,8 +42,8 @@ class VcScheduler : public Component {
 
   // constructor and destructor
   VcScheduler(const std::string& _name, const Component* _parent,
-              u32 _numClients, u32 _totalVcs, Simulator::Clock _clock,
-              nlohmann::json _settings);
+              u32 _numClients, u32 _totalVcs,
+              const ClockDomain* _clock, nlohmann::json _settings);
   ~VcScheduler();
 
   // constant attributes
@@ -62,7 +63,7 @@ class VcScheduler : public Component {
  private:
   const u32 numClients_;
   const u32 totalVcs_;
-  const Simulator::Clock clock_;
+  const ClockDomain* clock_;
 
   std::vector<Client*> clients_;
   std::vector<bool> clientRequested_;
@@ -203,7 +203,8 @@ TEST(VcScheduler, basic) {
         nlohmann::json schSettings;
         schSettings["allocator"] = allocSettings;
         VcScheduler* vcSch = new VcScheduler(
-            "VcSch", nullptr, C, V, Simulator::Clock::ROUTER, schSettings);
+            "VcSch", nullptr, C, V,
+            gSim->clockDomain(Simulator::Clock::ROUTER), schSettings);
         assert(vcSch->numClients() == C);
         assert(vcSch->totalVcs() == V);
 
@@ -268,7 +269,8 @@ TEST(VcScheduler, dist) {
       nlohmann::json schSettings;
       schSettings["allocator"] = allocSettings;
       VcScheduler* vcSch = new VcScheduler(
-          "VcSch", nullptr, C, V, Simulator::Clock::ROUTER, schSettings);
+          "VcSch", nullptr, C, V, gSim->clockDomain(Simulator::Clock::ROUTER),
+          schSettings);
       assert(vcSch->numClients() == C);
       assert(vcSch->totalVcs() == V);
 
@@ -37,6 +37,9 @@ BufferOccupancy::BufferOccupancy(const std::string& _name,
   u32 totalVcs = numPorts_ * numVcs_;
   normalizationDivisors_.resize(totalVcs, 0);
   outstandingFlits_.resize(totalVcs, 0);
+  vcStatus_.resize(totalVcs * 2, 0.0);
+  portStatus_.resize(numPorts_ * 2, 0.0);
+  portDirty_.resize(numPorts_, false);
 
   // phantom is an optional setting
   phantom_ = false;
@@ -74,6 +77,7 @@ void BufferOccupancy::initCredits(u32 _vcIdx, u32 _credits) {
   }
 
   normalizationDivisors_.at(_vcIdx) = _credits;
+  updateVcStatus(_vcIdx);
 }
 
 void BufferOccupancy::incrementCredit(u32 _vcIdx) {
@@ -189,6 +193,12 @@ f64 BufferOccupancy::computeStatus(u32 _inputPort, u32 _inputVc,
   }
 }
 
+f64 BufferOccupancy::computePortStatus(u32 _inputPort, u32 _inputVc,
+                                       u32 _outputPort) const {
+  return portAverageStatus(_outputPort,
+                           mode_ == BufferOccupancy::Mode::kPortNorm);
+}
+
 BufferOccupancy::Mode BufferOccupancy::parseMode(const std::string& _mode) {
   if (_mode == "normalized_vc") {
     return BufferOccupancy::Mode::kVcNorm;
@@ -221,6 +231,7 @@ void BufferOccupancy::createEvent(u32 _vcIdx, s32 _type) {
 
 void BufferOccupancy::performIncrementCredit(u32 _vcIdx) {
   outstandingFlits_.at(_vcIdx)--;
+  updateVcStatus(_vcIdx);
 }
 
 void BufferOccupancy::performDecrementCredit(u32 _vcIdx) {
@@ -235,36 +246,55 @@ void BufferOccupancy::performDecrementCredit(u32 _vcIdx) {
     u64 time = gSim->futureCycle(Simulator::Clock::CHANNEL, windowLength);
     addEvent(time, gSim->epsilon(), reinterpret_cast<void*>(_vcIdx), PHANTOM);
   }
+  updateVcStatus(_vcIdx);
 }
 
 void BufferOccupancy::performDecrementWindow(u32 _vcIdx) {
   assert(phantom_);
   assert(windows_.at(_vcIdx) > 0);
   windows_.at(_vcIdx)--;
+  updateVcStatus(_vcIdx);
+}
+
+void BufferOccupancy::updateVcStatus(u32 _vcIdx) {
+  f64 status = outstandingFlits_.at(_vcIdx);
+  if (phantom_) {
+    status = std::max(0.0, status - (windows_.at(_vcIdx) * valueCoeff_));
+  }
+  vcStatus_.at(_vcIdx * 2 + 0) = status;
+
+  // absolute modes don't require a divisor
+  s64 divisor = normalizationDivisors_.at(_vcIdx);
+  vcStatus_.at(_vcIdx * 2 + 1) = (divisor > 0) ? status / divisor : 0.0;
+
+  u32 port, vc;
+  device_->vcIndexInv(_vcIdx, &port, &vc);
+  portDirty_.at(port) = true;
 }
 
 f64 BufferOccupancy::vcStatus(u32 _outputPort, u32 _outputVc,
                               bool _normalize) const {
   // return this VC's status
   u32 vcIdx = device_->vcIndex(_outputPort, _outputVc);
-  f64 status = outstandingFlits_.at(vcIdx);
-  if (phantom_) {
-    status = std::max(0.0, status - (windows_.at(vcIdx) * valueCoeff_));
-  }
-  if (_normalize) {
-    assert(normalizationDivisors_.at(vcIdx) > 0);
-    status /= normalizationDivisors_.at(vcIdx);
-  }
-  return status;
+  assert(!_normalize || normalizationDivisors_.at(vcIdx) > 0);
+  return vcStatus_[vcIdx * 2 + (_normalize ? 1 : 0)];
 }
 
 f64 BufferOccupancy::portAverageStatus(u32 _outputPort, bool _normalize) const {
   // return the average status of all VCs in this port (normalized)
-  f64 status = 0.0;
-  for (u32 vc = 0; vc < numVcs_; vc++) {
-    status += vcStatus(_outputPort, vc, _normalize);
+  if (portDirty_.at(_outputPort)) {
+    portDirty_.at(_outputPort) = false;
+    f64 absolute = 0.0;
+    f64 normalized = 0.0;
+    for (u32 vc = 0; vc < numVcs_; vc++) {
+      u32 vcIdx = device_->vcIndex(_outputPort, vc);
+      absolute += vcStatus_[vcIdx * 2 + 0];
+      normalized += vcStatus_[vcIdx * 2 + 1];
+    }
+    portStatus_[_outputPort * 2 + 0] = absolute / numVcs_;
+    portStatus_[_outputPort * 2 + 1] = normalized / numVcs_;
   }
-  return status / numVcs_;
+  return portStatus_[_outputPort * 2 + (_normalize ? 1 : 0)];
 }
 
 registerWithObjectFactory("buffer_occupancy", CongestionSensor, BufferOccupancy,
@@ -45,6 +45,8 @@ class BufferOccupancy : public CongestionSensor {
   // see CongestionSensor::computeStatus
   f64 computeStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                     u32 _outputVc) const override;
+  f64 computePortStatus(u32 _inputPort, u32 _inputVc,
+                        u32 _outputPort) const override;
 
  private:
   enum class Mode {
@@ -64,6 +66,7 @@ class BufferOccupancy : public CongestionSensor {
   void performIncrementCredit(u32 _vcIdx);
   void performDecrementCredit(u32 _vcIdx);
   void performDecrementWindow(u32 _vcIdx);
+  void updateVcStatus(u32 _vcIdx);
 
   f64 vcStatus(u32 _outputPort, u32 _outputVc, bool _normalize) const;
   f64 portAverageStatus(u32 _outputPort, bool _normalize) const;
@@ -80,6 +83,13 @@ class BufferOccupancy : public CongestionSensor {
   f64 valueCoeff_;
   f64 lengthCoeff_;
   std::vector<u32> windows_;
+
+  // status values are cached so that queries are array reads. VC values are
+  //  refreshed when a VC changes, port averages are recomputed on the first
+  //  query after one of the port's VCs changes. [index * 2 + normalize]
+  std::vector<f64> vcStatus_;
+  mutable std::vector<f64> portStatus_;
+  mutable std::vector<bool> portDirty_;
 };
 
 #endif  // CONGESTION_BUFFEROCCUPANCY_H_
@@ -329,6 +329,65 @@ TEST(BufferOccupancy, absPort) {
   gSim->simulate();
 }
 
+TEST(BufferOccupancy, portCache) {
+  TestSetup test(1, 1, 1, 1, 1234);
+
+  const bool debug = false;
+  const u32 numPorts = 3;
+  const u32 numVcs = 4;
+  const u32 latency = 1;
+  const u32 granularity = 0;
+
+  nlohmann::json routerSettings;
+  CongestionTestRouter router("Router", nullptr, nullptr, 0, std::vector<u32>(),
+                              numPorts, numVcs, nullptr, routerSettings);
+  router.setDebug(debug);
+
+  nlohmann::json sensorSettings;
+  sensorSettings["latency"] = latency;
+  sensorSettings["granularity"] = granularity;
+  sensorSettings["mode"] = "absolute_port";
+  sensorSettings["minimum"] = 0;
+  sensorSettings["offset"] = 0;
+  BufferOccupancy sensor("CongestionSensor", &router, &router, sensorSettings);
+  sensor.setDebug(debug);
+
+  for (u32 port = 0; port < numPorts; port++) {
+    for (u32 vc = 0; vc < numVcs; vc++) {
+      sensor.initCredits(router.vcIndex(port, vc), 10);
+    }
+  }
+
+  CreditHandler crediter("CreditHandler", nullptr, &sensor, &router);
+  crediter.setDebug(debug);
+
+  StatusCheck check("StatusCheck", nullptr, &sensor);
+  check.setDebug(debug);
+
+  // each credit change must invalidate the cached port average that was
+  //  read in the cycle before it
+  const u32 port = 1;
+  u64 time = 1000;
+  u32 outstanding = 0;
+  for (u32 step = 0; step < 4 * numVcs; step++) {
+    f64 exp = (f64)outstanding / numVcs;
+    check.setEvent(time, 0, 0, 0, port, U32_MAX, exp);
+    check.setEvent(time, 0, 0, 0, port, step % numVcs, exp);
+    check.setEvent(time, 0, 0, 0, port + 1, U32_MAX, 0.0);
+
+    bool decr = step < 2 * numVcs;
+    crediter.setEvent(port, step % numVcs, time, 1,
+                      decr ? CreditHandler::Type::DECR :
+                      CreditHandler::Type::INCR);
+    outstanding = decr ? outstanding + 1 : outstanding - 1;
+    time++;
+  }
+  check.setEvent(time, 0, 0, 0, port, U32_MAX, 0.0);
+
+  gSim->initialize();
+  gSim->simulate();
+}
+
 TEST(BufferOccupancy, phantomNormVc) {
   const bool debug = false;
   const u32 numPorts = 1;
@@ -68,17 +68,33 @@ f64 CongestionSensor::status(u32 _inputPort, u32 _inputVc, u32 _outputPort,
 
   // gather value from subclass
   f64 value = computeStatus(_inputPort, _inputVc, _outputPort, _outputVc);
+  return finalizeStatus(value);
+}
+
+f64 CongestionSensor::portStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort) const {
+  assert(gSim->epsilon() == 0);
+  assert(resolution() == CongestionSensor::Resolution::kPort);
 
+  // gather value from subclass
+  f64 value = computePortStatus(_inputPort, _inputVc, _outputPort);
+  return finalizeStatus(value);
+}
+
+f64 CongestionSensor::computePortStatus(u32 _inputPort, u32 _inputVc,
+                                        u32 _outputPort) const {
+  return computeStatus(_inputPort, _inputVc, _outputPort, 0);
+}
+
+f64 CongestionSensor::finalizeStatus(f64 _value) const {
   // check bounds
-  assert(value >= 0.0);
+  assert(_value >= 0.0);
 
   // apply granularization
   if (granularity_ > 0) {
-    value = std::round(value * granularity_) / granularity_;
+    _value = std::round(_value * granularity_) / granularity_;
   }
 
   // apply offset and minimum constraints
-  value = offset_ + std::max(minimum_, value);
-
-  return value;
+  return offset_ + std::max(minimum_, _value);
 }
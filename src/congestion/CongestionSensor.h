@@ -54,6 +54,11 @@ class CongestionSensor : public Component, public CreditWatcher {
   f64 status(u32 _inputPort, u32 _inputVc, u32 _outputPort,
              u32 _outputVc) const;  // (must be epsilon >= 1)
 
+  // this returns the congestion status of an output port as a whole. It is
+  //  only valid for port resolution sensors, which report this same value for
+  //  every VC of the port.  (must be epsilon >= 1)
+  f64 portStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort) const;
+
   // must tell your style and mode
   virtual Style style() const = 0;
   virtual Resolution resolution() const = 0;
@@ -64,11 +69,19 @@ class CongestionSensor : public Component, public CreditWatcher {
   virtual f64 computeStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                             u32 _outputVc) const = 0;
 
+  // this yields the port status, by default computeStatus() of the port's
+  //  first VC. Subclasses may override this to skip the per-VC lookup.
+  virtual f64 computePortStatus(u32 _inputPort, u32 _inputVc,
+                                u32 _outputPort) const;
+
   PortedDevice* device_;
   const u32 numPorts_;
   const u32 numVcs_;
 
  private:
+  // this applies the granularity, minimum, and offset to a status value
+  f64 finalizeStatus(f64 _value) const;
+
   const u32 granularity_;
   const f64 minimum_;
   const f64 offset_;
@@ -25,7 +25,7 @@
 
 CongestionTestRouter::CongestionTestRouter(
     const std::string& _name, const Component* _parent, Network* _network,
-    u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
+    u32 _id, const Address& _address, u32 _numPorts, u32 _numVcs,
     MetadataHandler* _metadataHandler, nlohmann::json _settings)
     : Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
              _metadataHandler, _settings),
@@ -133,8 +133,14 @@ void StatusCheck::setEvent(u64 _time, u8 _epsilon, u32 _inputPort, u32 _inputVc,
 
 void StatusCheck::processEvent(void* _event, s32 _type) {
   Event* evt = reinterpret_cast<Event*>(_event);
-  f64 sts = congestionSensor_->status(evt->inputPort, evt->inputVc,
-                                      evt->outputPort, evt->outputVc);
+  f64 sts;
+  if (evt->outputVc == U32_MAX) {
+    sts = congestionSensor_->portStatus(evt->inputPort, evt->inputVc,
+                                        evt->outputPort);
+  } else {
+    sts = congestionSensor_->status(evt->inputPort, evt->inputVc,
+                                    evt->outputPort, evt->outputVc);
+  }
   if (sts - evt->exp > 0.002) {
     printf("sts=%f exp=%f\n", sts, evt->exp);
   }
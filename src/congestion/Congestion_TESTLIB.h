@@ -27,6 +27,7 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "types/Address.h"
 
 // this is a test class for implementing an router API for congestion status
 //  tests
@@ -34,7 +35,7 @@ class CongestionTestRouter : public Router {
  public:
   CongestionTestRouter(const std::string& _name, const Component* _parent,
                        Network* _network, u32 _id,
-                       const std::vector<u32>& _address, u32 _numPorts,
+                       const Address& _address, u32 _numPorts,
                        u32 _numVcs, MetadataHandler* _metadataHandler,
                        nlohmann::json _settings);
   ~CongestionTestRouter();
@@ -91,6 +92,7 @@ class StatusCheck : public Component {
               CongestionSensor* _congestionSensor);
   ~StatusCheck();
 
+  // an '_outputVc' of U32_MAX checks CongestionSensor::portStatus()
   void setEvent(u64 _time, u8 _epsilon, u32 _inputPort, u32 _inputVc,
                 u32 _outputPort, u32 _outputVc, f64 _expected);
   void processEvent(void* _event, s32 _type) override;
@@ -0,0 +1,127 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "event/ClockDomain.h"
+
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "util/invariant.h"
+
+ClockDomain::ClockDomain(u64 _cycleTime)
+    : cycleTime_(_cycleTime), anchorTime_(0), anchorCycle_(0),
+      preAnchorEdge_(0), memoTime_(0), memoEdge_(0), memoCycle_(0) {
+  assert(cycleTime_ > 0);
+}
+
+ClockDomain::~ClockDomain() {}
+
+u64 ClockDomain::cycleTime() const {
+  return cycleTime_;
+}
+
+void ClockDomain::setCycleTime(u64 _time, u64 _cycleTime) {
+  assert(_cycleTime > 0);
+
+  // a change that hasn't taken effect yet is simply replaced
+  if (_time < anchorTime_) {
+    cycleTime_ = _cycleTime;
+    memoTime_ = anchorTime_;
+    memoEdge_ = anchorTime_;
+    memoCycle_ = anchorCycle_;
+    return;
+  }
+
+  // the new clock starts on the next edge of the old clock
+  findEdge(_time);
+  if (memoEdge_ == _time) {
+    preAnchorEdge_ = (memoCycle_ > 0) ? memoEdge_ - cycleTime_ : 0;
+    anchorTime_ = memoEdge_;
+    anchorCycle_ = memoCycle_;
+  } else {
+    preAnchorEdge_ = memoEdge_;
+    anchorTime_ = memoEdge_ + cycleTime_;
+    anchorCycle_ = memoCycle_ + 1;
+  }
+  cycleTime_ = _cycleTime;
+
+  // restart the memo at the anchor
+  memoTime_ = anchorTime_;
+  memoEdge_ = anchorTime_;
+  memoCycle_ = anchorCycle_;
+}
+
+u64 ClockDomain::cycle(u64 _time) const {
+  findEdge(_time);
+  return memoCycle_;
+}
+
+bool ClockDomain::isCycle(u64 _time) const {
+  findEdge(_time);
+  return memoEdge_ == _time;
+}
+
+u64 ClockDomain::futureCycle(u64 _time, u32 _cycles) const {
+  CHECK_HOT(_cycles > 0);
+  findEdge(_time);
+  if (_time < anchorTime_) {
+    // the first edge after the last old edge is the anchor
+    return anchorTime_ + (u64)(_cycles - 1) * cycleTime_;
+  }
+  return memoEdge_ + (u64)_cycles * cycleTime_;
+}
+
+u64 ClockDomain::cycle() const {
+  return cycle(gSim->time());
+}
+
+bool ClockDomain::isCycle() const {
+  return isCycle(gSim->time());
+}
+
+u64 ClockDomain::futureCycle(u32 _cycles) const {
+  return futureCycle(gSim->time(), _cycles);
+}
+
+void ClockDomain::findEdge(u64 _time) const {
+  if (_time == memoTime_) {
+    return;
+  }
+  memoTime_ = _time;
+
+  // times between a cycle time change and the new anchor use the old edge
+  if (_time < anchorTime_) {
+    memoEdge_ = preAnchorEdge_;
+    memoCycle_ = anchorCycle_ - 1;
+    return;
+  }
+
+  // the common cases are within the memo's cycle or the one after it
+  if (_time >= memoEdge_ && memoEdge_ >= anchorTime_) {
+    u64 delta = _time - memoEdge_;
+    if (delta < cycleTime_) {
+      return;
+    }
+    if (delta < 2 * cycleTime_) {
+      memoEdge_ += cycleTime_;
+      memoCycle_++;
+      return;
+    }
+  }
+
+  // otherwise compute the edge directly
+  u64 cycles = (_time - anchorTime_) / cycleTime_;
+  memoEdge_ = anchorTime_ + cycles * cycleTime_;
+  memoCycle_ = anchorCycle_ + cycles;
+}
@@ -0,0 +1,66 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef EVENT_CLOCKDOMAIN_H_
+#define EVENT_CLOCKDOMAIN_H_
+
+#include "prim/prim.h"
+
+/*
+ * This is a clock with its own cycle time. Components hold a pointer to the
+ *  domain they are clocked by, thus components can run at different
+ *  frequencies and a domain's frequency can change while simulating (DVFS).
+ *
+ * Edge computations remember the last edge found. Simulation time moves
+ *  forward in small steps, thus nearly all queries are answered with a
+ *  comparison and an addition instead of a division.
+ *
+ * A cycle time change takes effect on the next edge of the old clock (or
+ *  immediately when on an edge). Cycle counts continue across changes.
+ */
+class ClockDomain {
+ public:
+  explicit ClockDomain(u64 _cycleTime);
+  ~ClockDomain();
+
+  u64 cycleTime() const;
+  void setCycleTime(u64 _time, u64 _cycleTime);
+
+  // these operate on the given time
+  u64 cycle(u64 _time) const;
+  bool isCycle(u64 _time) const;
+  u64 futureCycle(u64 _time, u32 _cycles) const;
+
+  // these operate on the current simulation time
+  u64 cycle() const;
+  bool isCycle() const;
+  u64 futureCycle(u32 _cycles) const;
+
+ private:
+  // this sets the memo to the last edge at or before the time
+  void findEdge(u64 _time) const;
+
+  u64 cycleTime_;
+
+  // edges at or after the anchor are 'anchorTime_ + k * cycleTime_'
+  u64 anchorTime_;
+  u64 anchorCycle_;
+  u64 preAnchorEdge_;  // the last edge before the anchor
+
+  mutable u64 memoTime_;
+  mutable u64 memoEdge_;
+  mutable u64 memoCycle_;
+};
+
+#endif  // EVENT_CLOCKDOMAIN_H_
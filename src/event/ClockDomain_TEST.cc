@@ -0,0 +1,68 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "event/ClockDomain.h"
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(ClockDomain, fixed) {
+  ClockDomain clock(7);
+  ASSERT_EQ(clock.cycleTime(), 7u);
+
+  // monotonic queries use the memo, the others compute directly
+  const u64 times[] = {0, 1, 6, 7, 8, 13, 14, 100, 3, 700, 701};
+  for (u64 time : times) {
+    ASSERT_EQ(clock.cycle(time), time / 7);
+    ASSERT_EQ(clock.isCycle(time), time % 7 == 0);
+    for (u32 cycles = 1; cycles < 4; cycles++) {
+      ASSERT_EQ(clock.futureCycle(time, cycles), (time / 7 + cycles) * 7);
+    }
+  }
+}
+
+TEST(ClockDomain, change) {
+  ClockDomain clock(10);
+  ASSERT_EQ(clock.futureCycle(23, 1), 30u);
+
+  // a change between edges takes effect on the next old edge
+  clock.setCycleTime(23, 4);
+  ASSERT_EQ(clock.cycleTime(), 4u);
+  ASSERT_EQ(clock.cycle(25), 2u);
+  ASSERT_FALSE(clock.isCycle(25));
+  ASSERT_EQ(clock.futureCycle(25, 1), 30u);
+  ASSERT_EQ(clock.futureCycle(25, 2), 34u);
+  ASSERT_TRUE(clock.isCycle(30));
+  ASSERT_EQ(clock.cycle(30), 3u);
+  ASSERT_EQ(clock.cycle(33), 3u);
+  ASSERT_TRUE(clock.isCycle(34));
+  ASSERT_EQ(clock.cycle(34), 4u);
+  ASSERT_EQ(clock.futureCycle(34, 1), 38u);
+  ASSERT_EQ(clock.cycle(74), 14u);
+
+  // a change on an edge takes effect immediately
+  clock.setCycleTime(74, 9);
+  ASSERT_TRUE(clock.isCycle(74));
+  ASSERT_EQ(clock.futureCycle(74, 1), 83u);
+  ASSERT_EQ(clock.futureCycle(75, 1), 83u);
+  ASSERT_EQ(clock.cycle(83), 15u);
+  ASSERT_FALSE(clock.isCycle(78));
+
+  // a pending change is replaced
+  clock.setCycleTime(84, 5);
+  clock.setCycleTime(85, 2);
+  ASSERT_EQ(clock.futureCycle(85, 1), 92u);
+  ASSERT_EQ(clock.futureCycle(92, 1), 94u);
+  ASSERT_EQ(clock.cycle(94), 17u);
+}
@@ -22,6 +22,7 @@
 #include <utility>
 
 #include "network/Network.h"
+#include "util/invariant.h"
 #include "workload/Application.h"
 #include "workload/Workload.h"
 
@@ -32,10 +33,10 @@ Simulator::Simulator(nlohmann::json _settings)
       time_(0),
       epsilon_(0),
       quit_(false),
-      channelCycleTime_(_settings["channel_cycle_time"].get<u64>()),
-      routerCycleTime_(_settings["router_cycle_time"].get<u64>()),
-      interfaceCycleTime_(_settings["interface_cycle_time"].get<u64>()),
-      terminalCycleTime_(_settings["terminal_cycle_time"].get<u64>()),
+      clocks_{ClockDomain(_settings["channel_cycle_time"].get<u64>()),
+              ClockDomain(_settings["router_cycle_time"].get<u64>()),
+              ClockDomain(_settings["interface_cycle_time"].get<u64>()),
+              ClockDomain(_settings["terminal_cycle_time"].get<u64>())},
       initial_(true),
       initialized_(false),
       running_(false),
@@ -48,10 +49,6 @@ Simulator::Simulator(nlohmann::json _settings)
   assert(!_settings["interface_cycle_time"].is_null());
   assert(!_settings["terminal_cycle_time"].is_null());
   assert(!_settings["random_seed"].is_null());
-  assert(channelCycleTime_ > 0);
-  assert(routerCycleTime_ > 0);
-  assert(interfaceCycleTime_ > 0);
-  assert(terminalCycleTime_ > 0);
   assert(printInterval_ > 0);
 
   rnd.seed(_settings["random_seed"].get<u64>());
@@ -209,37 +206,28 @@ u8 Simulator::epsilon() const {
   return epsilon_;
 }
 
+ClockDomain* Simulator::clockDomain(Simulator::Clock _clock) {
+  return &clocks_[static_cast<u8>(_clock)];
+}
+
+const ClockDomain* Simulator::clockDomain(Simulator::Clock _clock) const {
+  return &clocks_[static_cast<u8>(_clock)];
+}
+
 u64 Simulator::cycleTime(Simulator::Clock _clock) const {
-  switch (_clock) {
-    case Simulator::Clock::CHANNEL:
-      return channelCycleTime_;
-    case Simulator::Clock::ROUTER:
-      return routerCycleTime_;
-    case Simulator::Clock::INTERFACE:
-      return interfaceCycleTime_;
-    case Simulator::Clock::TERMINAL:
-      return terminalCycleTime_;
-    default:
-      assert(false);
-  }
+  return clocks_[static_cast<u8>(_clock)].cycleTime();
 }
 
 u64 Simulator::cycle(Simulator::Clock _clock) const {
-  return time_ / cycleTime(_clock);
+  return clocks_[static_cast<u8>(_clock)].cycle(time_);
 }
 
 bool Simulator::isCycle(Clock _clock) const {
-  return time_ % cycleTime(_clock) == 0;
+  return clocks_[static_cast<u8>(_clock)].isCycle(time_);
 }
 
 u64 Simulator::futureCycle(Simulator::Clock _clock, u32 _cycles) const {
-  assert(_cycles > 0);
-
-  u64 cycleTimeV = cycleTime(_clock);
-  u64 time = gSim->time();
-  time = time / cycleTimeV;
-  time = (time + (u64)_cycles) * cycleTimeV;
-  return time;
+  return clocks_[static_cast<u8>(_clock)].futureCycle(time_, _cycles);
 }
 
 void Simulator::setNetwork(Network* _network) {
@@ -15,6 +15,7 @@
 #ifndef EVENT_SIMULATOR_H_
 #define EVENT_SIMULATOR_H_
 
+#include "event/ClockDomain.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "rnd/Random.h"
@@ -52,6 +53,10 @@ class Simulator {
     TERMINAL = 3
   };
 
+  // these are the default clock domains
+  ClockDomain* clockDomain(Clock _clock);
+  const ClockDomain* clockDomain(Clock _clock) const;
+
   u64 cycleTime(Clock _clock) const;
   u64 cycle(Clock _clock) const;
   bool isCycle(Clock _clock) const;
@@ -77,10 +82,7 @@ class Simulator {
   bool quit_;
 
  private:
-  const u64 channelCycleTime_;
-  const u64 routerCycleTime_;
-  const u64 interfaceCycleTime_;
-  const u64 terminalCycleTime_;
+  ClockDomain clocks_[4];
 
   bool initial_;
   bool initialized_;
@@ -14,7 +14,7 @@
  */
 #include "event/VectorQueue.h"
 
-#include <cassert>
+#include "util/invariant.h"
 
 VectorQueue::VectorQueue(nlohmann::json _settings) : Simulator(_settings) {}
 
@@ -22,9 +22,9 @@ VectorQueue::~VectorQueue() {}
 
 void VectorQueue::addEvent(u64 _time, u8 _epsilon, Component* _component,
                            void* _event, s32 _type) {
-  assert((_time > time_) ||                              // future by time
-         ((_time == time_) && (_epsilon > epsilon_)) ||  // future by epsilon
-         (initial()));                                   // has not yet run
+  CHECK_HOT((_time > time_) ||                              // future by time
+            ((_time == time_) && (_epsilon > epsilon_)) ||  // future by epsilon
+            (initial()));                                   // has not yet run
 
   // create a bundle object
   VectorQueue::EventBundle bundle;
@@ -20,7 +20,7 @@
 
 Interface::Interface(const std::string& _name, const Component* _parent,
                      Network* _network, u32 _id,
-                     const std::vector<u32>& _address, u32 _numPorts,
+                     const Address& _address, u32 _numPorts,
                      u32 _numVcs, MetadataHandler* _metadataHandler,
                      nlohmann::json _settings)
     : Component(_name, _parent),
@@ -33,7 +33,7 @@ Interface::~Interface() {}
 
 Interface* Interface::create(const std::string& _name, const Component* _parent,
                              Network* _network, u32 _id,
-                             const std::vector<u32>& _address, u32 _numPorts,
+                             const Address& _address, u32 _numPorts,
                              u32 _numVcs, MetadataHandler* _metadataHandler,
                              nlohmann::json _settings) {
   // retrieve the type
@@ -25,6 +25,7 @@
 #include "network/Channel.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "types/CreditReceiver.h"
 #include "types/CreditSender.h"
 #include "types/FlitReceiver.h"
@@ -37,7 +38,7 @@ class MessageReassembler;
 
 #define INTERFACE_ARGS                                 \
   const std::string&, const Component*, Network*, u32, \
-      const std::vector<u32>&, u32, u32, MetadataHandler*, nlohmann::json
+      const Address&, u32, u32, MetadataHandler*, nlohmann::json
 
 class Interface : public Component,
                   public PortedDevice,
@@ -48,7 +49,7 @@ class Interface : public Component,
                   public MessageReceiver {
  public:
   Interface(const std::string& _name, const Component* _parent,
-            Network* _network, u32 _id, const std::vector<u32>& _address,
+            Network* _network, u32 _id, const Address& _address,
             u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
             nlohmann::json _settings);
   virtual ~Interface();
@@ -75,6 +76,10 @@ class Interface : public Component,
   // occupancy level of particular output VCs.
   virtual u32 occupancy(u32 _port, u32 _vc) const = 0;
 
+  // this must be implemented so that an InjectionAlgorithm can ask about the
+  // amount of credits in use at the downstream buffer of particular output VCs.
+  virtual u32 downstreamOccupancy(u32 _port, u32 _vc) const = 0;
+
  protected:
   Network* network_;
 
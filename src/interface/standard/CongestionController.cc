@@ -0,0 +1,104 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/CongestionController.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+
+namespace Standard {
+
+CongestionController::CongestionController(const std::string& _name,
+                                           const Component* _parent,
+                                           nlohmann::json _settings)
+    : Component(_name, _parent),
+      minWindow_(_settings["min_window"].get<f64>()),
+      maxWindow_(_settings["max_window"].get<f64>()),
+      initialWindow_(_settings["initial_window"].get<f64>()) {
+  assert(minWindow_ > 0.0);
+  assert(maxWindow_ >= minWindow_);
+  assert(initialWindow_ >= minWindow_);
+  assert(initialWindow_ <= maxWindow_);
+}
+
+CongestionController::~CongestionController() {}
+
+CongestionController* CongestionController::create(const std::string& _name,
+                                                   const Component* _parent,
+                                                   nlohmann::json _settings) {
+  // retrieve the algorithm
+  const std::string& algorithm = _settings["algorithm"].get<std::string>();
+
+  // attempt to create the congestion controller
+  CongestionController* cc =
+      factory::ObjectFactory<CongestionController,
+                             CONGESTIONCONTROLLER_ARGS>::create(algorithm,
+                                                                _name, _parent,
+                                                                _settings);
+
+  // check that the factory had this algorithm
+  if (cc == nullptr) {
+    fprintf(stderr, "unknown congestion control algorithm: %s\n",
+            algorithm.c_str());
+    assert(false);
+  }
+  return cc;
+}
+
+bool CongestionController::admissible(u32 _flow, u32 _flits) {
+  const Flow& f = flow(_flow);
+  return (f.outstanding == 0) || (f.outstanding + _flits <= f.window);
+}
+
+void CongestionController::messageSent(u32 _flow, u32 _flits) {
+  Flow& f = flow(_flow);
+  f.outstanding += _flits;
+}
+
+void CongestionController::messageAcknowledged(u32 _flow, u32 _flits,
+                                               bool _marked, u64 _rtt) {
+  Flow& f = flow(_flow);
+  assert(f.outstanding >= _flits);
+  f.outstanding -= _flits;
+
+  // compute and bound the new window
+  f64 window = computeWindow(_flow, f.window, _flits, _marked, _rtt);
+  if (window < minWindow_) {
+    window = minWindow_;
+  } else if (window > maxWindow_) {
+    window = maxWindow_;
+  }
+  dbgprintf("flow=%u flits=%u marked=%u rtt=%lu window=%f->%f", _flow, _flits,
+            _marked, _rtt, f.window, window);
+  f.window = window;
+}
+
+f64 CongestionController::window(u32 _flow) {
+  return flow(_flow).window;
+}
+
+u32 CongestionController::outstanding(u32 _flow) {
+  return flow(_flow).outstanding;
+}
+
+CongestionController::Flow& CongestionController::flow(u32 _flow) {
+  auto it = flows_.find(_flow);
+  if (it == flows_.end()) {
+    it = flows_.insert({_flow, {initialWindow_, 0}}).first;
+  }
+  return it->second;
+}
+
+}  // namespace Standard
@@ -0,0 +1,81 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INTERFACE_STANDARD_CONGESTIONCONTROLLER_H_
+#define INTERFACE_STANDARD_CONGESTIONCONTROLLER_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+#define CONGESTIONCONTROLLER_ARGS \
+  const std::string&, const Component*, nlohmann::json
+
+namespace Standard {
+
+/*
+ * This is an endpoint congestion controller that limits the amount of
+ *  outstanding (unacknowledged) flits per flow to a congestion window. A flow
+ *  is identified by the destination interface. Subclasses implement the window
+ *  adjustment upon each acknowledgement.
+ */
+class CongestionController : public Component {
+ public:
+  CongestionController(const std::string& _name, const Component* _parent,
+                       nlohmann::json _settings);
+  virtual ~CongestionController();
+
+  // this is a congestion controller factory
+  static CongestionController* create(CONGESTIONCONTROLLER_ARGS);
+
+  // returns true if a message of the specified size can be sent on the flow,
+  //  a single message is always admissible on an idle flow
+  bool admissible(u32 _flow, u32 _flits);
+
+  // this is called when a message is sent on the flow
+  void messageSent(u32 _flow, u32 _flits);
+
+  // this is called when the acknowledgement for a message is received, the
+  //  round trip time is in interface cycles
+  void messageAcknowledged(u32 _flow, u32 _flits, bool _marked, u64 _rtt);
+
+  f64 window(u32 _flow);
+  u32 outstanding(u32 _flow);
+
+ protected:
+  // subclasses must compute the new window of the flow
+  virtual f64 computeWindow(u32 _flow, f64 _window, u32 _flits, bool _marked,
+                            u64 _rtt) = 0;
+
+  const f64 minWindow_;
+  const f64 maxWindow_;
+
+ private:
+  struct Flow {
+    f64 window;
+    u32 outstanding;
+  };
+
+  Flow& flow(u32 _flow);
+
+  const f64 initialWindow_;
+  std::unordered_map<u32, Flow> flows_;
+};
+
+}  // namespace Standard
+
+#endif  // INTERFACE_STANDARD_CONGESTIONCONTROLLER_H_
@@ -0,0 +1,67 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/DelayController.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+
+namespace Standard {
+
+DelayController::DelayController(const std::string& _name,
+                                 const Component* _parent,
+                                 nlohmann::json _settings)
+    : CongestionController(_name, _parent, _settings),
+      targetDelay_(_settings["target_delay"].get<f64>()),
+      additiveIncrease_(_settings["additive_increase"].get<f64>()),
+      beta_(_settings["beta"].get<f64>()),
+      maxDecrease_(_settings["max_decrease"].get<f64>()) {
+  assert(targetDelay_ > 0.0);
+  assert(additiveIncrease_ > 0.0);
+  assert(beta_ > 0.0);
+  assert(maxDecrease_ > 0.0 && maxDecrease_ < 1.0);
+}
+
+DelayController::~DelayController() {}
+
+f64 DelayController::computeWindow(u32 _flow, f64 _window, u32 _flits,
+                                   bool _marked, u64 _rtt) {
+  (void)_marked;  // unused
+
+  f64 rtt = (f64)_rtt;
+  if (rtt < targetDelay_) {
+    // additive increase, 'additive_increase' flits per window
+    return _window + additiveIncrease_ * _flits / _window;
+  }
+
+  // multiplicative decrease, at most once per round trip time
+  u64 now = gSim->time();
+  u64 rttTime = _rtt * gSim->cycleTime(Simulator::Clock::INTERFACE);
+  auto it = lastDecrease_.find(_flow);
+  if ((it == lastDecrease_.end()) || (now >= it->second + rttTime)) {
+    lastDecrease_[_flow] = now;
+    f64 decrease =
+        std::min(beta_ * (rtt - targetDelay_) / rtt, maxDecrease_);
+    return _window * (1.0 - decrease);
+  }
+  return _window;
+}
+
+}  // namespace Standard
+
+registerWithObjectFactory("delay", Standard::CongestionController,
+                          Standard::DelayController, CONGESTIONCONTROLLER_ARGS);
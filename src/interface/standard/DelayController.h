@@ -0,0 +1,53 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INTERFACE_STANDARD_DELAYCONTROLLER_H_
+#define INTERFACE_STANDARD_DELAYCONTROLLER_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "interface/standard/CongestionController.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+namespace Standard {
+
+/*
+ * This is a delay based (Swift-like) congestion controller. Acknowledgements
+ *  with a round trip time below the target delay grow the window additively.
+ *  Otherwise the window shrinks proportionally to the excess delay, bounded by
+ *  the maximum decrease, at most once per round trip time.
+ */
+class DelayController : public CongestionController {
+ public:
+  DelayController(const std::string& _name, const Component* _parent,
+                  nlohmann::json _settings);
+  ~DelayController();
+
+ protected:
+  f64 computeWindow(u32 _flow, f64 _window, u32 _flits, bool _marked,
+                    u64 _rtt) override;
+
+ private:
+  const f64 targetDelay_;
+  const f64 additiveIncrease_;
+  const f64 beta_;
+  const f64 maxDecrease_;
+  std::unordered_map<u32, u64> lastDecrease_;
+};
+
+}  // namespace Standard
+
+#endif  // INTERFACE_STANDARD_DELAYCONTROLLER_H_
@@ -0,0 +1,59 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/DelayController.h"
+
+#include "gtest/gtest.h"
+#include "interface/standard/CongestionController.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+
+TEST(DelayController, window) {
+  TestSetup testSetup(1, 1, 1, 1, 123);
+
+  nlohmann::json settings;
+  settings["algorithm"] = "delay";
+  settings["initial_window"] = 10.0;
+  settings["min_window"] = 2.0;
+  settings["max_window"] = 20.0;
+  settings["target_delay"] = 100.0;
+  settings["additive_increase"] = 2.0;
+  settings["beta"] = 0.5;
+  settings["max_decrease"] = 0.3;
+  Standard::CongestionController* cc =
+      Standard::CongestionController::create("CC", nullptr, settings);
+
+  // delay below target grows the window
+  cc->messageSent(0, 5);
+  cc->messageAcknowledged(0, 5, false, 50);
+  ASSERT_DOUBLE_EQ(cc->window(0), 11.0);
+
+  // delay above target shrinks the window proportionally to the excess
+  cc->messageSent(0, 5);
+  cc->messageAcknowledged(0, 5, false, 200);
+  ASSERT_DOUBLE_EQ(cc->window(0), 11.0 * (1.0 - 0.5 * 100.0 / 200.0));
+
+  // decreases happen at most once per round trip time
+  cc->messageSent(0, 5);
+  cc->messageAcknowledged(0, 5, false, 200);
+  ASSERT_DOUBLE_EQ(cc->window(0), 11.0 * 0.75);
+
+  // marks are ignored, the decrease is bounded by the maximum
+  cc->messageSent(1, 5);
+  cc->messageAcknowledged(1, 5, true, 100000);
+  ASSERT_DOUBLE_EQ(cc->window(1), 7.0);
+
+  delete cc;
+}
@@ -0,0 +1,64 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/EcnController.h"
+
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+
+namespace Standard {
+
+EcnController::EcnController(const std::string& _name,
+                             const Component* _parent, nlohmann::json _settings)
+    : CongestionController(_name, _parent, _settings),
+      gain_(_settings["gain"].get<f64>()),
+      additiveIncrease_(_settings["additive_increase"].get<f64>()) {
+  assert(gain_ > 0.0 && gain_ <= 1.0);
+  assert(additiveIncrease_ > 0.0);
+}
+
+EcnController::~EcnController() {}
+
+f64 EcnController::computeWindow(u32 _flow, f64 _window, u32 _flits,
+                                 bool _marked, u64 _rtt) {
+  auto it = states_.find(_flow);
+  if (it == states_.end()) {
+    it = states_.insert({_flow, {1.0, 0}}).first;
+  }
+  State& state = it->second;
+
+  // update the marked fraction estimate
+  state.alpha = (1.0 - gain_) * state.alpha + gain_ * (_marked ? 1.0 : 0.0);
+
+  if (!_marked) {
+    // additive increase, 'additive_increase' flits per window
+    return _window + additiveIncrease_ * _flits / _window;
+  }
+
+  // multiplicative decrease, at most once per round trip time
+  u64 now = gSim->time();
+  u64 rttTime = _rtt * gSim->cycleTime(Simulator::Clock::INTERFACE);
+  if ((state.lastDecrease == 0) || (now >= state.lastDecrease + rttTime)) {
+    state.lastDecrease = now;
+    return _window * (1.0 - state.alpha / 2.0);
+  }
+  return _window;
+}
+
+}  // namespace Standard
+
+registerWithObjectFactory("ecn", Standard::CongestionController,
+                          Standard::EcnController, CONGESTIONCONTROLLER_ARGS);
@@ -0,0 +1,56 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef INTERFACE_STANDARD_ECNCONTROLLER_H_
+#define INTERFACE_STANDARD_ECNCONTROLLER_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "interface/standard/CongestionController.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+namespace Standard {
+
+/*
+ * This is an ECN style (DCTCP-like) congestion controller. It keeps a moving
+ *  average (alpha) of the fraction of marked acknowledgements. Unmarked
+ *  acknowledgements grow the window additively, marked acknowledgements shrink
+ *  the window by alpha/2 at most once per round trip time.
+ */
+class EcnController : public CongestionController {
+ public:
+  EcnController(const std::string& _name, const Component* _parent,
+                nlohmann::json _settings);
+  ~EcnController();
+
+ protected:
+  f64 computeWindow(u32 _flow, f64 _window, u32 _flits, bool _marked,
+                    u64 _rtt) override;
+
+ private:
+  struct State {
+    f64 alpha;
+    u64 lastDecrease;
+  };
+
+  const f64 gain_;
+  const f64 additiveIncrease_;
+  std::unordered_map<u32, State> states_;
+};
+
+}  // namespace Standard
+
+#endif  // INTERFACE_STANDARD_ECNCONTROLLER_H_
@@ -0,0 +1,72 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/EcnController.h"
+
+#include "gtest/gtest.h"
+#include "interface/standard/CongestionController.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+
+TEST(EcnController, window) {
+  TestSetup testSetup(1, 1, 1, 1, 123);
+
+  nlohmann::json settings;
+  settings["algorithm"] = "ecn";
+  settings["initial_window"] = 8.0;
+  settings["min_window"] = 1.0;
+  settings["max_window"] = 16.0;
+  settings["gain"] = 0.5;
+  settings["additive_increase"] = 1.0;
+  Standard::CongestionController* cc =
+      Standard::CongestionController::create("CC", nullptr, settings);
+
+  // a single message is always admissible on an idle flow
+  ASSERT_TRUE(cc->admissible(3, 100));
+  ASSERT_TRUE(cc->admissible(3, 8));
+  cc->messageSent(3, 8);
+  ASSERT_EQ(cc->outstanding(3), 8u);
+  ASSERT_FALSE(cc->admissible(3, 1));
+  ASSERT_TRUE(cc->admissible(4, 1));
+
+  // unmarked acknowledgements grow the window by one flit per window
+  cc->messageAcknowledged(3, 8, false, 10);
+  ASSERT_EQ(cc->outstanding(3), 0u);
+  ASSERT_DOUBLE_EQ(cc->window(3), 9.0);
+
+  // alpha is now 0.5, a marked acknowledgement sets it to 0.75
+  cc->messageSent(3, 4);
+  cc->messageAcknowledged(3, 4, true, 10);
+  ASSERT_DOUBLE_EQ(cc->window(3), 9.0 * (1.0 - 0.75 / 2.0));
+
+  // the window is bounded by the minimum
+  for (u32 i = 0; i < 100; i++) {
+    cc->messageSent(3, 1);
+    cc->messageAcknowledged(3, 1, true, 0);
+  }
+  ASSERT_DOUBLE_EQ(cc->window(3), 1.0);
+
+  // and the maximum
+  for (u32 i = 0; i < 1000; i++) {
+    cc->messageSent(3, 1);
+    cc->messageAcknowledged(3, 1, false, 0);
+  }
+  ASSERT_DOUBLE_EQ(cc->window(3), 16.0);
+
+  // other flows are unaffected
+  ASSERT_DOUBLE_EQ(cc->window(4), 8.0);
+
+  delete cc;
+}
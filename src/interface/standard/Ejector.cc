@@ -14,9 +14,8 @@
  */
 #include "interface/standard/Ejector.h"
 
-#include <cassert>
-
 #include "interface/standard/Interface.h"
+#include "util/invariant.h"
 
 namespace Standard {
 
@@ -30,7 +29,7 @@ Ejector::~Ejector() {}
 void Ejector::receiveFlit(u32 _port, Flit* _flit) {
   // this is overkill checking!
   u64 nextTime = gSim->futureCycle(Simulator::Clock::CHANNEL, 1);
-  assert((lastSetTime_ != nextTime) || (lastSetTime_ == U32_MAX));
+  CHECK_HOT((lastSetTime_ != nextTime) || (lastSetTime_ == U32_MAX));
   interface_->sendFlit(portId_, _flit);
 
   // send flit using the interface
@@ -16,25 +16,29 @@
 
 #include <cassert>
 #include <utility>
+#include <vector>
 
 #include "architecture/util.h"
 #include "factory/ObjectFactory.h"
+#include "interface/standard/CongestionController.h"
 #include "interface/standard/Ejector.h"
 #include "interface/standard/MessageReassembler.h"
 #include "interface/standard/OutputQueue.h"
 #include "interface/standard/PacketReassembler.h"
 #include "network/Network.h"
 #include "types/MessageOwner.h"
+#include "util/invariant.h"
 #include "workload/Application.h"
 
 // event types
 #define INJECT_MESSAGE (0x45)
+#define PROCESS_ACK (0xAC)
 
 namespace Standard {
 
 Interface::Interface(const std::string& _name, const Component* _parent,
                      Network* _network, u32 _id,
-                     const std::vector<u32>& _address, u32 _numPorts,
+                     const Address& _address, u32 _numPorts,
                      u32 _numVcs, MetadataHandler* _metadataHandler,
                      nlohmann::json _settings)
     : ::Interface(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
@@ -66,6 +70,13 @@ Interface::Interface(const std::string& _name, const Component* _parent,
     assert(false);
   }
 
+  // this must match the "input_queue_reserved" setting of the routers
+  initCreditsReserved_ = 0;
+  if (_settings.contains("init_credits_reserved")) {
+    initCreditsReserved_ = _settings["init_credits_reserved"].get<u32>();
+    assert(initCreditsReserved_ > 0);
+  }
+
   // create the injection algorithm
   u32 numPcs = network_->numPcs();
   injectionAlgorithms_.resize(numPcs, nullptr);
@@ -88,13 +99,14 @@ Interface::Interface(const std::string& _name, const Component* _parent,
         "CrossbarScheduler_" + std::to_string(port);
     crossbarSchedulers_.at(port) = new CrossbarScheduler(
         crossbarSchedulerName, this, numVcs_, numVcs_, 1, port * numVcs_,
-        Simulator::Clock::CHANNEL, _settings["crossbar_scheduler"]);
+        gSim->clockDomain(Simulator::Clock::CHANNEL),
+        _settings["crossbar_scheduler"]);
 
     // crossbar
     std::string crossbarName = "Crossbar_" + std::to_string(port);
-    crossbars_.at(port) =
-        new Crossbar(crossbarName, this, numVcs_, 1, Simulator::Clock::CHANNEL,
-                     _settings["crossbar"]);
+    crossbars_.at(port) = new Crossbar(
+        crossbarName, this, numVcs_, 1,
+        gSim->clockDomain(Simulator::Clock::CHANNEL), _settings["crossbar"]);
 
     // ejector
     std::string ejectorName = "Ejector_" + std::to_string(port);
@@ -130,6 +142,17 @@ Interface::Interface(const std::string& _name, const Component* _parent,
   // allocate slots for I/O channels
   inputChannels_.resize(numPorts_, nullptr);
   outputChannels_.resize(numPorts_, nullptr);
+
+  // create the optional congestion controller
+  congestionController_ = nullptr;
+  ackLatency_ = 0;
+  if (_settings.contains("congestion_control") &&
+      !_settings["congestion_control"].is_null()) {
+    congestionController_ = CongestionController::create(
+        "CongestionController", this, _settings["congestion_control"]);
+    ackLatency_ = _settings["congestion_control"]["ack_latency"].get<u32>();
+    assert(ackLatency_ > 0);
+  }
 }
 
 Interface::~Interface() {
@@ -147,6 +170,7 @@ Interface::~Interface() {
     }
   }
   delete messageReassembler_;
+  delete congestionController_;
 }
 
 void Interface::setInputChannel(u32 _port, Channel* _channel) {
@@ -173,6 +197,7 @@ Channel* Interface::getOutputChannel(u32 _port) const {
 
 void Interface::initialize() {
   // init credits
+  maxCredits_.resize(outputChannels_.size(), 0);
   for (u32 ch = 0; ch < outputChannels_.size(); ch++) {
     assert(outputChannels_.at(ch)->latency());
     // compute tailored queue depth for donwstream channel
@@ -182,6 +207,16 @@ void Interface::initialize() {
       credits = computeTailoredBufferLength(inputQueueMult_, inputQueueMin_,
                                             inputQueueMax_, channelLatency);
     }
+    if (initCreditsReserved_ > 0) {
+      // the downstream VCs share one buffer
+      assert(initCreditsReserved_ <= credits);
+      u32 shared = (credits - initCreditsReserved_) * numVcs_;
+      crossbarSchedulers_.at(ch)->initSharedCredits(
+          0, numVcs_, initCreditsReserved_, shared);
+      maxCredits_.at(ch) = initCreditsReserved_ + shared;
+      continue;
+    }
+    maxCredits_.at(ch) = credits;
     for (u32 vc = 0; vc < numVcs_; vc++) {
       // initialize the credit count in the CrossbarScheduler
       crossbarSchedulers_.at(ch)->initCredits(vc, credits);
@@ -195,7 +230,8 @@ void Interface::receiveMessage(Message* _message) {
 
   u64 now = gSim->time();
 
-  // mark all flit send times
+  // mark all flit send times, latency includes time held by the congestion
+  //  controller
   for (u32 p = 0; p < _message->numPackets(); p++) {
     Packet* packet = _message->packet(p);
     packetArrival(packet);  // inform the base class of arrival
@@ -205,42 +241,60 @@ void Interface::receiveMessage(Message* _message) {
     }
   }
 
-  // retrieve the protocol class of the message
-  u32 pc = _message->getProtocolClass();
-  assert(pc < network_->numPcs());
-
-  // process the message
-  InjectionAlgorithm* inj = injectionAlgorithms_.at(pc);
-  inj->processMessage(_message);
+  // multicast messages have no single flow to control
+  assert(congestionController_ == nullptr ||
+         _message->getMulticastGroup() == U32_MAX);
+
+  // hold the message if the congestion controller doesn't admit it
+  if (congestionController_ != nullptr) {
+    u32 flow = _message->getDestinationId();
+    std::queue<Message*>& pending = pendingMessages_[flow];
+    if ((!pending.empty()) ||
+        (!congestionController_->admissible(flow, _message->numFlits()))) {
+      dbgprintf("holding message for flow %u", flow);
+      pending.push(_message);
+      return;
+    }
+  }
 
-  // create an event to inject the message into the queues
-  assert(gSim->epsilon() == 0);
-  addEvent(gSim->time(), 1, _message, INJECT_MESSAGE);
+  admitMessage(_message);
 }
 
 void Interface::injectingPacket(Packet* _packet, u32 _port, u32 _vc) {
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
+
   // update credit counts
   u32 vcIdx = vcIndex(_port, _vc);
-  assert(queueOccupancy_.at(vcIdx) < U32_MAX - _packet->numFlits());
-  dbgprintf("INJ (%u,%u) %u+%u=%u", _port, _vc, queueOccupancy_.at(vcIdx),
+  CHECK_HOT(queueOccupancy_[vcIdx] < U32_MAX - _packet->numFlits());
+  dbgprintf("INJ (%u,%u) %u+%u=%u", _port, _vc, queueOccupancy_[vcIdx],
             _packet->numFlits(),
-            queueOccupancy_.at(vcIdx) + _packet->numFlits());
-  queueOccupancy_.at(vcIdx) += _packet->numFlits();
+            queueOccupancy_[vcIdx] + _packet->numFlits());
+  queueOccupancy_[vcIdx] += _packet->numFlits();
 
   // store the information about the injection decision
-  assert(injectionInfo_.find(_packet) == injectionInfo_.end());
+  CHECK_HOT(injectionInfo_.find(_packet) == injectionInfo_.end());
   injectionInfo_.insert(std::make_pair(_packet, std::make_tuple(_port, _vc)));
 }
 
 u32 Interface::occupancy(u32 _port, u32 _vc) const {
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
   u32 vcIdx = vcIndex(_port, _vc);
-  return queueOccupancy_.at(vcIdx);
+  return queueOccupancy_[vcIdx];
+}
+
+u32 Interface::downstreamOccupancy(u32 _port, u32 _vc) const {
+  CHECK_HOT(_port < numPorts_);
+  u32 credits = crossbarSchedulers_[_port]->getCreditCount(_vc);
+  CHECK_HOT(credits <= maxCredits_[_port]);
+  return maxCredits_[_port] - credits;
 }
 
 void Interface::sendFlit(u32 _port, Flit* _flit) {
-  assert(_port < numPorts_);
-  assert(outputChannels_.at(_port)->getNextFlit() == nullptr);
-  outputChannels_.at(_port)->setNextFlit(_flit);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(outputChannels_[_port]->getNextFlit() == nullptr);
+  outputChannels_[_port]->setNextFlit(_flit);
 
   // inform the base class of departure
   if (_flit->isHead()) {
@@ -249,89 +303,165 @@ void Interface::sendFlit(u32 _port, Flit* _flit) {
 
   // check source is correct
   u32 src = _flit->packet()->message()->getSourceId();
-  assert(src == id_);
+  CHECK_HOT(src == id_);
 }
 
 void Interface::receiveFlit(u32 _port, Flit* _flit) {
-  assert(_port < numPorts_);
-  assert(_flit != nullptr);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_flit != nullptr);
 
   // send a credit back
   sendCredit(_port, _flit->getVc());
 
   // check destination is correct
-  u32 dest = _flit->packet()->message()->getDestinationId();
-  assert(dest == id_);
+  CHECK_HOT(_flit->packet()->message()->getDestinationId() == id_ ||
+            _flit->packet()->message()->getMulticastGroup() != U32_MAX);
 
   // mark the receive time
   _flit->setReceiveTime(gSim->time());
 
   // process flit, attempt to create packet
+  CHECK_HOT(_flit->getVc() < numVcs_);
   u32 vcIdx = vcIndex(_port, _flit->getVc());
-  Packet* packet = packetReassemblers_.at(vcIdx)->receiveFlit(_flit);
+  Packet* packet = packetReassemblers_[vcIdx]->receiveFlit(_flit);
   // if a packet was completed, process it
   if (packet) {
+    // multicast packets are given to this interface's copy of the message
+    if (packet->message()->getMulticastGroup() != U32_MAX) {
+      packet = receiveMulticastPacket(packet);
+    } else if (network_->sourceRouted(
+        packet->message()->getProtocolClass())) {
+      // the path belongs to the network's SourceRoutes, not the packet
+      packet->setRoutingExtension(nullptr);
+    }
+
     // process packet, attempt to create message
     Message* message = messageReassembler_->receivePacket(packet);
     if (message) {
+      if (message->multicastOrigin() != nullptr) {
+        multicastCopies_.erase(message->multicastOrigin());
+      }
+      if (congestionController_ != nullptr) {
+        sendAck(message);
+      }
       messageReceiver()->receiveMessage(message);
     }
   }
 }
 
 void Interface::sendCredit(u32 _port, u32 _vc) {
-  assert(_port < numPorts_);
-  assert(_vc < numVcs_);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
 
   // send credit
-  Credit* credit = inputChannels_.at(_port)->getNextCredit();
+  Credit* credit = inputChannels_[_port]->getNextCredit();
   if (credit == nullptr) {
     credit = new Credit(numVcs_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    inputChannels_[_port]->setNextCredit(credit);
   }
   credit->putNum(_vc);
 }
 
 void Interface::receiveCredit(u32 _port, Credit* _credit) {
-  assert(_port < numPorts_);
+  CHECK_HOT(_port < numPorts_);
   while (_credit->more()) {
     u32 vc = _credit->getNum();
-    crossbarSchedulers_.at(_port)->incrementCredit(vc);
+    crossbarSchedulers_[_port]->incrementCredit(vc);
   }
   delete _credit;
 }
 
 void Interface::incrementCredit(u32 _port, u32 _vc) {
-  assert(_port < numPorts_);
-  assert(_vc < numVcs_);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
   u32 vcIdx = vcIndex(_port, _vc);
-  dbgprintf("DEC (%u,%u) %u-1=%u", _port, _vc, queueOccupancy_.at(vcIdx), 1,
-            queueOccupancy_.at(vcIdx) - 1);
-  assert(queueOccupancy_.at(vcIdx) > 0);
-  queueOccupancy_.at(vcIdx)--;
+  dbgprintf("DEC (%u,%u) %u-1=%u", _port, _vc, queueOccupancy_[vcIdx], 1,
+            queueOccupancy_[vcIdx] - 1);
+  CHECK_HOT(queueOccupancy_[vcIdx] > 0);
+  queueOccupancy_[vcIdx]--;
+}
+
+void Interface::receiveAck(u32 _flow, const Message* _message,
+                           bool _marked) {
+  assert(congestionController_ != nullptr);
+  auto it = admitTimes_.find(_message);
+  assert(it != admitTimes_.end());
+  Ack* ack = new Ack({_flow, _message->numFlits(), _marked, it->second});
+  admitTimes_.erase(it);
+  addEvent(gSim->futureCycle(Simulator::Clock::INTERFACE, ackLatency_), 0, ack,
+           PROCESS_ACK);
 }
 
 void Interface::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case INJECT_MESSAGE:
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       injectMessage(reinterpret_cast<Message*>(_event));
       break;
 
+    case PROCESS_ACK:
+      CHECK_HOT(gSim->epsilon() == 0);
+      processAck(reinterpret_cast<Ack*>(_event));
+      break;
+
     default:
       assert(false);
   }
 }
 
+void Interface::admitMessage(Message* _message) {
+  assert(gSim->epsilon() == 0);
+
+  // retrieve the protocol class of the message
+  u32 pc = _message->getProtocolClass();
+  assert(pc < network_->numPcs());
+
+  // process the message, multicast and source routed messages use the first
+  //  VC of the protocol class as the routers pick VCs by hop count
+  if (_message->getMulticastGroup() == U32_MAX && network_->sourceRouted(pc)) {
+    SourceRoutes* sourceRoutes = network_->sourceRoutes(pc);
+    for (u32 p = 0; p < _message->numPackets(); p++) {
+      const std::vector<u32>* path = sourceRoutes->route(
+          id_, _message->getDestinationId());
+      assert(path->size() <= network_->pcVcs(pc).numVcs);
+      Packet* packet = _message->packet(p);
+      packet->setRoutingExtension(
+          const_cast<void*>(reinterpret_cast<const void*>(path)));
+      injectingPacket(packet, 0, network_->pcVcs(pc).baseVc);
+    }
+  } else if (_message->getMulticastGroup() == U32_MAX) {
+    InjectionAlgorithm* inj = injectionAlgorithms_[pc];
+    inj->processMessage(_message);
+  } else {
+    for (u32 p = 0; p < _message->numPackets(); p++) {
+      injectingPacket(_message->packet(p), 0, network_->pcVcs(pc).baseVc);
+    }
+  }
+
+  // account for the message in the congestion controller
+  if (congestionController_ != nullptr) {
+    bool res = admitTimes_.insert({_message, gSim->time()}).second;
+    (void)res;  // UNUSED
+    assert(res);
+    congestionController_->messageSent(_message->getDestinationId(),
+                                       _message->numFlits());
+  }
+
+  // create an event to inject the message into the queues
+  addEvent(gSim->time(), 1, _message, INJECT_MESSAGE);
+}
+
 void Interface::injectMessage(Message* _message) {
   for (u32 p = 0; p < _message->numPackets(); p++) {
     Packet* packet = _message->packet(p);
 
     // lookup the port and VC information for this packet
-    u32 port = std::get<0>(injectionInfo_.at(packet));
-    u32 vc = std::get<1>(injectionInfo_.at(packet));
+    auto it = injectionInfo_.find(packet);
+    CHECK_HOT(it != injectionInfo_.end());
+    u32 port = std::get<0>(it->second);
+    u32 vc = std::get<1>(it->second);
     u32 vcIdx = vcIndex(port, vc);
-    injectionInfo_.erase(packet);
+    injectionInfo_.erase(it);
 
     // apply VC to each flit in the packet
     u32 flits = packet->numFlits();
@@ -344,9 +474,66 @@ void Interface::injectMessage(Message* _message) {
     dbgprintf("injecting into %u,%u", port, vc);
     for (u32 f = 0; f < flits; f++) {
       Flit* flit = packet->getFlit(f);
-      outputQueues_.at(vcIdx)->receiveFlit(0, flit);  // single port queues
+      outputQueues_[vcIdx]->receiveFlit(0, flit);  // single port queues
+    }
+  }
+}
+
+void Interface::sendAck(Message* _message) {
+  // the message is marked if any of its packets were marked
+  bool marked = false;
+  for (u32 p = 0; p < _message->numPackets(); p++) {
+    marked |= _message->packet(p)->getCongestionMark();
+  }
+
+  // reflect the mark back to the source interface
+  Interface* source = dynamic_cast<Interface*>(
+      network_->getInterface(_message->getSourceId()));
+  assert(source != nullptr);
+  source->receiveAck(id_, _message, marked);
+}
+
+Packet* Interface::receiveMulticastPacket(Packet* _packet) {
+  // the tree belongs to the network's MulticastTrees, not the packet, the
+  //  routers made all other branches before the original left its last one
+  _packet->setRoutingExtension(nullptr);
+
+  // the original packet stays with the original message, deliver a copy
+  Message* origin = _packet->message();
+  if (origin->packet(_packet->id()) == _packet) {
+    _packet = _packet->replicate();
+  }
+
+  // attach the packet to this interface's copy of the message
+  Message*& copy = multicastCopies_[origin];
+  if (copy == nullptr) {
+    copy = origin->multicastCopy();
+    copy->setDestinationId(id_);
+  }
+  copy->setPacket(_packet->id(), _packet);
+  _packet->setMessage(copy);
+  return _packet;
+}
+
+void Interface::processAck(Ack* _ack) {
+  // inform the congestion controller
+  u64 rtt = (gSim->time() - _ack->admitTime) /
+            gSim->cycleTime(Simulator::Clock::INTERFACE);
+  congestionController_->messageAcknowledged(_ack->flow, _ack->flits,
+                                             _ack->marked, rtt);
+
+  // admit pending messages of this flow
+  auto it = pendingMessages_.find(_ack->flow);
+  if (it != pendingMessages_.end()) {
+    std::queue<Message*>& pending = it->second;
+    while ((!pending.empty()) &&
+           (congestionController_->admissible(_ack->flow,
+                                              pending.front()->numFlits()))) {
+      admitMessage(pending.front());
+      pending.pop();
     }
   }
+  delete _ack;
 }
 
 }  // namespace Standard
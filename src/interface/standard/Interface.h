@@ -15,6 +15,7 @@
 #ifndef INTERFACE_STANDARD_INTERFACE_H_
 #define INTERFACE_STANDARD_INTERFACE_H_
 
+#include <queue>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -27,6 +28,7 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "routing/InjectionAlgorithm.h"
+#include "types/Address.h"
 #include "types/Credit.h"
 #include "types/CreditReceiver.h"
 #include "types/Flit.h"
@@ -39,6 +41,7 @@
 
 namespace Standard {
 
+class CongestionController;
 class OutputQueue;
 class Ejector;
 class PacketReassembler;
@@ -47,7 +50,7 @@ class MessageReassembler;
 class Interface : public ::Interface {
  public:
   Interface(const std::string& _name, const Component* _parent,
-            Network* _network, u32 _id, const std::vector<u32>& _address,
+            Network* _network, u32 _id, const Address& _address,
             u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
             nlohmann::json _settings);
   ~Interface();
@@ -63,6 +66,7 @@ class Interface : public ::Interface {
 
   void injectingPacket(Packet* _packet, u32 _port, u32 _vc) override;
   u32 occupancy(u32 _port, u32 _vc) const override;
+  u32 downstreamOccupancy(u32 _port, u32 _vc) const override;
 
   void sendFlit(u32 _port, Flit* _flit) override;
   void receiveFlit(u32 _port, Flit* _flit) override;
@@ -71,10 +75,25 @@ class Interface : public ::Interface {
 
   void incrementCredit(u32 _port, u32 _vc);
 
+  // this is called by the destination interface of a message when congestion
+  //  control is enabled, the acknowledgement arrives after the ack latency
+  void receiveAck(u32 _flow, const Message* _message, bool _marked);
+
   void processEvent(void* _event, s32 _type) override;
 
  private:
+  struct Ack {
+    u32 flow;
+    u32 flits;
+    bool marked;
+    u64 admitTime;
+  };
+
+  void admitMessage(Message* _message);
   void injectMessage(Message* _message);
+  void sendAck(Message* _message);
+  Packet* receiveMulticastPacket(Packet* _packet);
+  void processAck(Ack* _ack);
 
   std::vector<Channel*> inputChannels_;
   std::vector<Channel*> outputChannels_;
@@ -85,10 +104,13 @@ class Interface : public ::Interface {
   f64 inputQueueMult_;
   u32 inputQueueMax_;
   u32 inputQueueMin_;
+  // reserved credits per VC when the downstream buffer is shared, else 0
+  u32 initCreditsReserved_;
 
   std::vector<InjectionAlgorithm*> injectionAlgorithms_;
   std::vector<OutputQueue*> outputQueues_;
   std::vector<u32> queueOccupancy_;  // used for adaptive injection
+  std::vector<u32> maxCredits_;      // per port, used for adaptive injection
   std::vector<Crossbar*> crossbars_;
   std::vector<CrossbarScheduler*> crossbarSchedulers_;
   std::vector<Ejector*> ejectors_;
@@ -98,6 +120,16 @@ class Interface : public ::Interface {
 
   // this holds temporary injection information
   std::unordered_map<Packet*, std::tuple<u32, u32>> injectionInfo_;
+
+  // endpoint congestion control, messages wait per flow until admissible
+  CongestionController* congestionController_;
+  u32 ackLatency_;
+  std::unordered_map<u32, std::queue<Message*>> pendingMessages_;
+  // the round trip time starts at admission so it excludes the time pending
+  std::unordered_map<const Message*, u64> admitTimes_;
+
+  // multicast copies being reassembled, keyed by the original message
+  std::unordered_map<Message*, Message*> multicastCopies_;
 };
 
 }  // namespace Standard
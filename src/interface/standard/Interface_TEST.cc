@@ -0,0 +1,260 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/Interface.h"
+
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "network/Channel.h"
+#include "network/MulticastTrees.h"
+#include "network/Network_TESTLIB.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+#include "types/MessageReceiver.h"
+#include "types/Packet.h"
+#include "workload/util.h"
+
+namespace {
+
+// this deletes delivered messages as the terminals do, an origin is deleted
+//  after its last multicast copy
+class DeletingReceiver : public MessageReceiver {
+ public:
+  DeletingReceiver() : delivered_(0) {}
+  ~DeletingReceiver() {}
+
+  void receiveMessage(Message* _message) override {
+    Message* origin = _message->multicastOrigin();
+    if (origin != nullptr && origin->multicastCopyReceived(_message)) {
+      delete origin;
+    }
+    delete _message;
+    delivered_++;
+  }
+
+  u32 delivered() const {
+    return delivered_;
+  }
+
+ private:
+  u32 delivered_;
+};
+
+nlohmann::json interfaceSettings() {
+  nlohmann::json settings;
+  settings["init_credits_mode"] = "fixed";
+  settings["init_credits"] = 8;
+  settings["crossbar"]["latency"] = 1;
+  nlohmann::json& scheduler = settings["crossbar_scheduler"];
+  scheduler["allocator"]["type"] = "r_separable";
+  scheduler["allocator"]["slip_latch"] = true;
+  scheduler["allocator"]["resource_arbiter"]["type"] = "random";
+  scheduler["full_packet"] = true;
+  scheduler["packet_lock"] = true;
+  scheduler["idle_unlock"] = true;
+  return settings;
+}
+
+// router 0 holds interface N on port N, the interfaces hand delivered
+//  messages to '_receiver'
+void createNetwork(TestNetwork* _network, u32 _numInterfaces,
+                   MessageReceiver* _receiver) {
+  Router* router = new TestRouter(_network, 0, _numInterfaces,
+                                  _network->numVcs());
+  _network->addRouter(router);
+  for (u32 id = 0; id < _numInterfaces; id++) {
+    Interface* interface = new Standard::Interface(
+        "Interface_" + std::to_string(id), nullptr, _network, id, {id}, 1,
+        _network->numVcs(), nullptr, interfaceSettings());
+    interface->setMessageReceiver(_receiver);
+    _network->addInterface(interface);
+    _network->connect(router, id, interface, 0);
+    _network->connect(interface, 0, router, id);
+  }
+}
+
+Message* createMessage(u32 _numPackets, u32 _numFlits, u32 _source,
+                       u32 _destination, u32 _id) {
+  Message* message = new Message(_numPackets, nullptr);
+  message->setId(_id);
+  message->setTransaction(transactionId(0, _source, _id));
+  message->setProtocolClass(0);
+  message->setSourceId(_source);
+  message->setDestinationId(_destination);
+  for (u32 p = 0; p < _numPackets; p++) {
+    Packet* packet = new Packet(p, _numFlits, message);
+    message->setPacket(p, packet);
+    for (u32 f = 0; f < _numFlits; f++) {
+      Flit* flit = new Flit(f, f == 0, f == _numFlits - 1, packet);
+      flit->setSendTime(0);  // the source sent it before the test begins
+      packet->setFlit(f, flit);
+    }
+  }
+  return message;
+}
+
+// this sends packets on a channel one flit per cycle
+class FlitSource : public Component {
+ public:
+  FlitSource(const std::string& _name, Channel* _channel)
+      : Component(_name, nullptr), channel_(_channel), flits_(0) {}
+  ~FlitSource() {}
+
+  void send(Packet* _packet) {
+    for (u32 f = 0; f < _packet->numFlits(); f++) {
+      Flit* flit = _packet->getFlit(f);
+      flit->setVc(0);
+      flits_++;
+      addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, flits_), 0, flit,
+               0);
+    }
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    channel_->setNextFlit(reinterpret_cast<Flit*>(_event));
+  }
+
+ private:
+  Channel* channel_;
+  u32 flits_;
+};
+
+}  // namespace
+
+TEST(StandardInterface, sourceRoutedDelivery) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  nlohmann::json settings = TestNetwork::makeJSON(2);
+  settings["protocol_classes"][0]["source_routing"]["paths"] = "minimal";
+  TestNetwork network(settings);
+  DeletingReceiver receiver;
+  createNetwork(&network, 3, &receiver);
+
+  // the source interface attaches the path to each packet, the receiver
+  //  deletes the message once it is delivered
+  Message* message = createMessage(3, 2, 0, 2, 0);
+  for (u32 p = 0; p < message->numPackets(); p++) {
+    const std::vector<u32>* path = network.sourceRoutes(0)->route(0, 2);
+    ASSERT_EQ(*path, std::vector<u32>({2}));
+    message->packet(p)->setRoutingExtension(
+        const_cast<void*>(reinterpret_cast<const void*>(path)));
+  }
+  FlitSource source("FlitSource", network.getRouter(0)->getOutputChannel(2));
+  for (u32 p = 0; p < message->numPackets(); p++) {
+    source.send(message->packet(p));
+  }
+  gSim->initialize();
+  gSim->simulate();
+  ASSERT_EQ(receiver.delivered(), 1u);
+}
+
+TEST(StandardInterface, multicastDelivery) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  TestNetwork network(TestNetwork::makeJSON(2));
+  DeletingReceiver receiver;
+  createNetwork(&network, 3, &receiver);
+  u32 group = network.multicastTrees()->createGroup({0, 1, 2});
+  Router* router = network.getRouter(0);
+  std::vector<FlitSource*> sources;
+  for (u32 port = 0; port < 3; port++) {
+    sources.push_back(new FlitSource("FlitSource_" + std::to_string(port),
+                                     router->getOutputChannel(port)));
+  }
+
+  // the router attaches the tree to the original packet, copies it to all but
+  //  the last branch, then sends the original down the last branch
+  Message* origin = createMessage(2, 3, 0, U32_MAX, 0);
+  origin->setMulticastGroup(group);
+  origin->setMulticastPending(3);
+  for (u32 p = 0; p < origin->numPackets(); p++) {
+    Packet* packet = origin->packet(p);
+    const std::vector<u32>& ports = router->multicastPorts(packet);
+    ASSERT_EQ(ports, std::vector<u32>({0, 1, 2}));
+    for (u32 b = 0; b < ports.size() - 1; b++) {
+      Packet* copy = packet->replicate();
+      ASSERT_EQ(copy->getRoutingExtension(), packet->getRoutingExtension());
+      sources.at(ports.at(b))->send(copy);
+    }
+    sources.at(ports.back())->send(packet);
+  }
+
+  // the receiver deletes the origin with its last copy
+  gSim->initialize();
+  gSim->simulate();
+  ASSERT_EQ(receiver.delivered(), 3u);
+
+  for (FlitSource* source : sources) {
+    delete source;
+  }
+}
+
+TEST(StandardInterface, reductionDelivery) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  TestNetwork network(TestNetwork::makeJSON(2));
+  DeletingReceiver receiver;
+  createNetwork(&network, 3, &receiver);
+  u32 group = network.multicastTrees()->createGroup({0, 1, 2});
+  Router* router = network.getRouter(0);
+  std::vector<FlitSource*> sources;
+  for (u32 port = 0; port < 3; port++) {
+    sources.push_back(new FlitSource("FlitSource_" + std::to_string(port),
+                                     router->getOutputChannel(port)));
+  }
+
+  // the root combines one contribution from each interface, the last one
+  //  carries the result back down the tree
+  std::vector<Message*> contributions;
+  for (u32 id = 0; id < 3; id++) {
+    Message* message = createMessage(1, 2, id, U32_MAX, id);
+    message->setMulticastGroup(group);
+    message->setReductionId(9);
+    contributions.push_back(message);
+  }
+  u32 port = 0;
+  ASSERT_FALSE(router->reductionArrival(contributions.at(0)->packet(0),
+                                        &port));
+  ASSERT_FALSE(router->reductionArrival(contributions.at(1)->packet(0),
+                                        &port));
+  Message* result = contributions.at(2);
+  result->setMulticastPending(3);
+  Packet* packet = result->packet(0);
+  ASSERT_TRUE(router->reductionArrival(packet, &port));
+  ASSERT_EQ(port, U32_MAX);
+  ASSERT_NE(packet->getRoutingExtension(), nullptr);
+  const std::vector<u32>& ports = router->multicastPorts(packet);
+  ASSERT_EQ(ports, std::vector<u32>({0, 1, 2}));
+  for (u32 b = 0; b < ports.size() - 1; b++) {
+    sources.at(ports.at(b))->send(packet->replicate());
+  }
+  sources.at(ports.back())->send(packet);
+
+  // the receiver deletes the result with its last copy, the terminals delete
+  //  the combined contributions
+  gSim->initialize();
+  gSim->simulate();
+  ASSERT_EQ(receiver.delivered(), 3u);
+  delete contributions.at(0);
+  delete contributions.at(1);
+
+  for (FlitSource* source : sources) {
+    delete source;
+  }
+}
@@ -14,51 +14,64 @@
  */
 #include "interface/standard/MessageReassembler.h"
 
-#include <cassert>
 #include <cstdio>
 
+#include "util/invariant.h"
 #include "workload/util.h"
 
 namespace Standard {
 
 MessageReassembler::MessageReassembler(const std::string& _name,
                                        const Component* _parent)
-    : Component(_name, _parent) {}
+    : Component(_name, _parent), numPartial_(0) {
+  slots_.resize(64, {0, nullptr, 0, 0});
+  slotMask_ = slots_.size() - 1;
+}
 
 MessageReassembler::~MessageReassembler() {}
 
 Message* MessageReassembler::receivePacket(Packet* _packet) {
-  // get the message and determine unqiue id
+  // single packet messages don't need a table entry
   Message* message = _packet->message();
+  u32 numPackets = message->numPackets();
+  CHECK_HOT(_packet->id() < numPackets);
+  if (numPackets == 1) {
+    return message;
+  }
+
+  // determine the unique id
   u32 sourceId = message->getSourceId();
   u32 messageId = message->id();
   u32 appId1 = appId(message->getTransaction());
   u64 umid = transactionId(appId1, sourceId, messageId);
-  // u64 mid = ((u64)sourceId) << 32 | ((u64)messageId);
 
   // if non-existent, add a new table entry
-  bool umidExists = messages_.count(umid) == 1;
-  if (!umidExists) {
-    messages_[umid] = MessageData();
-    messages_[umid].message = message;
-    messages_[umid].packetsReceived.resize(message->numPackets(), false);
-    messages_[umid].receivedCount = 0;
+  u32 index = findSlot(umid);
+  if (slots_[index].message == nullptr) {
+    if ((numPartial_ + 1) * 2 > slots_.size()) {
+      grow();
+      index = findSlot(umid);
+    }
+    slots_[index] = {umid, message, 0, 0};
+    numPartial_++;
   }
 
   // retrieve the message data
-  MessageData& messageData = messages_.at(umid);
-  assert(messageData.message == message);
+  Slot& slot = slots_[index];
+  CHECK_HOT(slot.message == message);
 
   // mark the packet as received
-  assert(messageData.packetsReceived.at(_packet->id()) == false);
-  messageData.packetsReceived.at(_packet->id()) = true;
-  messageData.receivedCount++;
+  if (_packet->id() < 64) {
+    u64 bit = (u64)1 << _packet->id();
+    CHECK_HOT((slot.packetsReceived & bit) == 0);
+    slot.packetsReceived |= bit;
+  }
+  slot.receivedCount++;
 
   // check if the full message has been received
-  if (messageData.receivedCount == message->numPackets()) {
-    // remove the message from the map
-    s32 erased = messages_.erase(umid);
-    assert(erased == 1);
+  if (slot.receivedCount == numPackets) {
+    // remove the message from the table
+    eraseSlot(index);
     return message;
   } else {
     // return nullptr to signify more packets are needed for the message
@@ -66,4 +79,59 @@ Message* MessageReassembler::receivePacket(Packet* _packet) {
   }
 }
 
+u32 MessageReassembler::partialMessages() const {
+  return numPartial_;
+}
+
+u64 MessageReassembler::hash(u64 _umid) {
+  // 64-bit mixing function (splitmix64 finalizer)
+  _umid ^= _umid >> 30;
+  _umid *= 0xBF58476D1CE4E5B9ull;
+  _umid ^= _umid >> 27;
+  _umid *= 0x94D049BB133111EBull;
+  _umid ^= _umid >> 31;
+  return _umid;
+}
+
+u32 MessageReassembler::findSlot(u64 _umid) const {
+  // linear probing ends at the matching slot or at an empty slot
+  u32 index = hash(_umid) & slotMask_;
+  while (slots_[index].message != nullptr && slots_[index].umid != _umid) {
+    index = (index + 1) & slotMask_;
+  }
+  return index;
+}
+
+void MessageReassembler::eraseSlot(u32 _index) {
+  // shift following entries back so probe sequences stay unbroken
+  u32 hole = _index;
+  u32 index = _index;
+  while (true) {
+    index = (index + 1) & slotMask_;
+    if (slots_[index].message == nullptr) {
+      break;
+    }
+    u32 home = hash(slots_[index].umid) & slotMask_;
+    bool between = (hole <= index) ? (hole < home && home <= index) :
+                   (hole < home || home <= index);
+    if (!between) {
+      slots_[hole] = slots_[index];
+      hole = index;
+    }
+  }
+  slots_[hole].message = nullptr;
+  numPartial_--;
+}
+
+void MessageReassembler::grow() {
+  std::vector<Slot> old(slots_.size() * 2, {0, nullptr, 0, 0});
+  old.swap(slots_);
+  slotMask_ = slots_.size() - 1;
+  for (const Slot& slot : old) {
+    if (slot.message != nullptr) {
+      slots_[findSlot(slot.umid)] = slot;
+    }
+  }
+}
+
 }  // namespace Standard
@@ -16,28 +16,46 @@
 #define INTERFACE_STANDARD_MESSAGEREASSEMBLER_H_
 
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "event/Component.h"
+#include "prim/prim.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
 namespace Standard {
 
+/*
+ * Single packet messages are returned immediately without any bookkeeping.
+ *  Partial multi-packet messages are held in an open addressed slot table
+ *  keyed by the unique message id. The table only grows, thus once it has
+ *  reached the peak number of partial messages no allocations are made.
+ */
 class MessageReassembler : public Component {
  public:
   MessageReassembler(const std::string& _name, const Component* _parent);
   ~MessageReassembler();
   Message* receivePacket(Packet* _packet);
 
+  // this returns the number of partially received messages
+  u32 partialMessages() const;
+
  private:
-  struct MessageData {
-    Message* message;
-    std::vector<bool> packetsReceived;
+  struct Slot {
+    u64 umid;
+    Message* message;  // nullptr when the slot is empty
+    u64 packetsReceived;  // bitmask of the first 64 packets
     u32 receivedCount;
   };
-  std::unordered_map<u64, MessageData> messages_;
+
+  static u64 hash(u64 _umid);
+  u32 findSlot(u64 _umid) const;
+  void eraseSlot(u32 _index);
+  void grow();
+
+  std::vector<Slot> slots_;
+  u32 slotMask_;
+  u32 numPartial_;
 };
 
 }  // namespace Standard
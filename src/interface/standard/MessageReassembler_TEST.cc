@@ -0,0 +1,79 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "interface/standard/MessageReassembler.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+#include "workload/util.h"
+
+static Message* createMessage(u32 _numPackets, u32 _sourceId, u32 _id) {
+  Message* message = new Message(_numPackets, nullptr);
+  message->setSourceId(_sourceId);
+  message->setId(_id);
+  message->setTransaction(transactionId(0, _sourceId, _id));
+  for (u32 p = 0; p < _numPackets; p++) {
+    message->setPacket(p, new Packet(p, 1, message));
+  }
+  return message;
+}
+
+TEST(MessageReassembler, singlePacket) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  Standard::MessageReassembler mr("MessageReassembler", nullptr);
+
+  Message* message = createMessage(1, 3, 7);
+  ASSERT_EQ(mr.receivePacket(message->packet(0)), message);
+  ASSERT_EQ(mr.partialMessages(), 0u);
+  delete message;
+}
+
+TEST(MessageReassembler, interleaved) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  Standard::MessageReassembler mr("MessageReassembler", nullptr);
+
+  // enough messages to grow the table several times
+  const u32 kMessages = 500;
+  const u32 kPackets = 70;
+  std::vector<Message*> messages;
+  for (u32 m = 0; m < kMessages; m++) {
+    messages.push_back(createMessage(kPackets, m % 13, m));
+  }
+
+  // deliver packets round robin across messages, last packet first
+  for (u32 p = 0; p < kPackets; p++) {
+    for (u32 m = 0; m < kMessages; m++) {
+      Message* message = messages.at(m);
+      Message* done = mr.receivePacket(message->packet(kPackets - 1 - p));
+      if (p == kPackets - 1) {
+        ASSERT_EQ(done, message);
+        ASSERT_EQ(mr.partialMessages(), kMessages - 1 - m);
+      } else {
+        ASSERT_EQ(done, nullptr);
+      }
+    }
+    if (p < kPackets - 1) {
+      ASSERT_EQ(mr.partialMessages(), kMessages);
+    }
+  }
+
+  for (Message* message : messages) {
+    delete message;
+  }
+}
@@ -18,6 +18,7 @@
 
 #include "interface/standard/Interface.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define INJECTED_FLIT (0x33)
@@ -52,11 +53,11 @@ OutputQueue::OutputQueue(const std::string& _name, Interface* _interface,
 OutputQueue::~OutputQueue() {}
 
 void OutputQueue::receiveFlit(u32 _port, Flit* _flit) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   // make sure this is the right port and VC
-  assert(_port == 0);  // the queue is single ported
-  assert(_flit->getVc() == vc_);
+  CHECK_HOT(_port == 0);  // the queue is single ported
+  CHECK_HOT(_flit->getVc() == vc_);
 
   // push flit into corresponding buffer
   buffer_.push(_flit);
@@ -75,12 +76,12 @@ void OutputQueue::receiveFlit(u32 _port, Flit* _flit) {
 void OutputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (INJECTED_FLIT):
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       setPipelineEvent();
       break;
 
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
+      CHECK_HOT(gSim->epsilon() == 2);
       processPipeline();
       break;
 
@@ -90,12 +91,12 @@ void OutputQueue::processEvent(void* _event, s32 _type) {
 }
 
 void OutputQueue::crossbarSchedulerResponse(u32 _port, u32 _vc) {
-  assert(swa_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(swa_.fsm == ePipelineFsm::kWaitingForResponse);
 
   if (_port != U32_MAX) {
     // granted
-    assert(_port == 0);  // xbar has single port
-    assert(_vc == vc_);  // same VC as this
+    CHECK_HOT(_port == 0);  // xbar has single port
+    CHECK_HOT(_vc == vc_);  // same VC as this
     swa_.fsm = ePipelineFsm::kReadyToAdvance;
   } else {
     // denied
@@ -115,7 +116,7 @@ void OutputQueue::setPipelineEvent() {
 
 void OutputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
+  CHECK_HOT(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
 
   /*
    * attempt to load the crossbar
@@ -142,7 +143,7 @@ void OutputQueue::processPipeline() {
     dbgprintf("loading SWA");
 
     // ensure SWA is empty
-    assert(swa_.flit == nullptr);
+    CHECK_HOT(swa_.flit == nullptr);
 
     // pull out the front flit
     Flit* flit = buffer_.front();
@@ -18,60 +18,54 @@
 #include <cstdio>
 
 #include "types/Message.h"
+#include "util/invariant.h"
 
 namespace Standard {
 
 PacketReassembler::PacketReassembler(const std::string& _name,
                                      const Component* _parent)
     : Component(_name, _parent) {
-  expSourceId_ = U32_MAX;
-  expPacketId_ = U32_MAX;
+  expPacket_ = nullptr;
   expFlitId_ = 0;
 }
 
 PacketReassembler::~PacketReassembler() {}
 
 Packet* PacketReassembler::receiveFlit(Flit* _flit) {
-  Packet* packet = nullptr;
-  u32 sourceId = _flit->packet()->message()->getSourceId();
-  u32 packetId = _flit->packet()->id();
+  // the packet pointer identifies the packet, thus the message isn't needed
+  Packet* packet = _flit->packet();
   u32 flitId = _flit->id();
 
-  dbgprintf("src=%u pkt=%u flit=%u/%u", sourceId, packetId, flitId,
-            _flit->packet()->numFlits());
+  dbgprintf("src=%u pkt=%u flit=%u/%u", packet->message()->getSourceId(),
+            packet->id(), flitId, packet->numFlits());
 
-  // if expected packet id isn't yet set, set it
-  if (expPacketId_ == U32_MAX) {
-    assert(flitId == 0);
-    expSourceId_ = sourceId;
-    expPacketId_ = packetId;
+  // if expected packet isn't yet set, set it
+  if (expPacket_ == nullptr) {
+    CHECK_HOT(flitId == 0);
+    expPacket_ = packet;
   }
 
-  // check sourceId, packetId, and flitId
-  if (sourceId != expSourceId_) {
+  // check packet and flitId
+  if (packet != expPacket_) {
     fprintf(stderr, "error name: %s\n", fullName().c_str());
     assert(false);
   }
-  if (packetId != expPacketId_) {
-    assert(false);
-  }
   if (flitId != expFlitId_) {
     assert(false);
   }
 
-  assert(flitId < _flit->packet()->numFlits());
-  assert(packetId < _flit->packet()->message()->numPackets());
+  CHECK_HOT(flitId < packet->numFlits());
+  CHECK_HOT(_flit->isTail() == (flitId == (packet->numFlits() - 1)));
 
   // if this is the last flit of the packet
-  if (flitId == (_flit->packet()->numFlits() - 1)) {
-    expSourceId_ = U32_MAX;  // clear expected source id
-    expPacketId_ = U32_MAX;  // clear expected packet id
-    expFlitId_ = 0;          // expect flit 0 on the next packet
-    packet = _flit->packet();
+  if (_flit->isTail()) {
+    expPacket_ = nullptr;  // clear expected packet
+    expFlitId_ = 0;        // expect flit 0 on the next packet
+    return packet;
   } else {
     expFlitId_ = flitId + 1;
+    return nullptr;
   }
-  return packet;
 }
 
 }  // namespace Standard
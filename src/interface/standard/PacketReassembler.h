@@ -31,8 +31,7 @@ class PacketReassembler : public Component {
   Packet* receiveFlit(Flit* _flit);
 
  private:
-  u32 expSourceId_;
-  u32 expPacketId_;
+  Packet* expPacket_;
   u32 expFlitId_;
 };
 
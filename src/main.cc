@@ -22,6 +22,7 @@
 #include "event/VectorQueue.h"
 #include "metadata/MetadataHandler.h"
 #include "network/Network.h"
+#include "network/WiringModel.h"
 #include "nlohmann/json.hpp"
 #include "settings/settings.h"
 #include "workload/Terminal.h"
@@ -73,6 +74,17 @@ s32 main(s32 _argc, char** _argv) {
   }
   gSim->infoLog.logInfo("VCs", std::to_string(numVcs));
   gSim->infoLog.logInfo("Components", std::to_string(numComponents));
+  const WiringModel* wiringModel = network->wiringModel();
+  if (wiringModel != nullptr) {
+    gSim->infoLog.logInfo("Wiring links",
+                          std::to_string(wiringModel->numLinks()));
+    gSim->infoLog.logInfo("Wiring total length",
+                          std::to_string(wiringModel->totalLength()));
+    gSim->infoLog.logInfo("Wiring total energy",
+                          std::to_string(wiringModel->totalEnergy()));
+    gSim->infoLog.logInfo("Wiring total cost",
+                          std::to_string(wiringModel->totalCost()));
+  }
 
   // create the workload
   Workload* workload =
@@ -91,6 +103,7 @@ s32 main(s32 _argc, char** _argv) {
     printf("Simulation beginning\n");
     gSim->simulate();
     printf("Simulation complete\n");
+    network->logSwaStats();
   } else {
     printf("Simulation skipped\n");
   }
@@ -0,0 +1,50 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "metadata/TrafficClassMetadataHandler.h"
+
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+#include "types/Packet.h"
+#include "workload/Application.h"
+
+TrafficClassMetadataHandler::TrafficClassMetadataHandler(
+    nlohmann::json _settings)
+    : MetadataHandler(_settings) {
+  assert(_settings.contains("age") && _settings["age"].is_boolean());
+  age_ = _settings["age"].get<bool>();
+}
+
+TrafficClassMetadataHandler::~TrafficClassMetadataHandler() {}
+
+void TrafficClassMetadataHandler::packetInjection(const Application* _app,
+                                                  Packet* _packet) {
+  u64 value = age_ ? gSim->time() : 0;
+  _packet->setMetadata(encode(_app->trafficClass(), value));
+}
+
+u64 TrafficClassMetadataHandler::encode(u32 _trafficClass, u64 _value) {
+  assert(_trafficClass < (1u << kClassBits));
+  assert(_value < ((u64)1 << kValueBits));
+  return ((u64)_trafficClass << kValueBits) | _value;
+}
+
+u32 TrafficClassMetadataHandler::trafficClass(u64 _metadata) {
+  return (u32)(_metadata >> kValueBits);
+}
+
+registerWithObjectFactory("traffic_class", MetadataHandler,
+                          TrafficClassMetadataHandler, METADATAHANDLER_ARGS);
@@ -0,0 +1,46 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef METADATA_TRAFFICCLASSMETADATAHANDLER_H_
+#define METADATA_TRAFFICCLASSMETADATAHANDLER_H_
+
+#include "metadata/MetadataHandler.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+class Application;
+
+// this places the application's traffic class in the upper 8 bits of the
+//  metadata, the lower bits are optionally filled with the packet creation time
+//  (i.e., the "comparing" arbiter with "greater"=false yields strict priority
+//  where traffic class 0 is the highest priority)
+class TrafficClassMetadataHandler : public MetadataHandler {
+ public:
+  explicit TrafficClassMetadataHandler(nlohmann::json _settings);
+  ~TrafficClassMetadataHandler();
+
+  void packetInjection(const Application* _app, Packet* _packet) override;
+
+  // these encode and decode traffic classes in metadata
+  static u64 encode(u32 _trafficClass, u64 _value);
+  static u32 trafficClass(u64 _metadata);
+
+  static const u32 kClassBits = 8;
+  static const u32 kValueBits = 64 - kClassBits;
+
+ private:
+  bool age_;
+};
+
+#endif  // METADATA_TRAFFICCLASSMETADATAHANDLER_H_
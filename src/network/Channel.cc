@@ -17,11 +17,13 @@
 #include <cassert>
 
 #include "event/Simulator.h"
+#include "network/Watchdog.h"
 #include "types/Credit.h"
 #include "types/CreditReceiver.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 #define FLIT 0xBE
 #define CRDT 0xEF
@@ -44,6 +46,9 @@ Channel::Channel(const std::string& _name, const Component* _parent,
   monitoring_ = false;
   monitorTime_ = U64_MAX;
   monitorCounts_.resize(_numVcs + 1);
+
+  watchdog_ = nullptr;
+  ejection_ = false;
 }
 
 Channel::~Channel() {}
@@ -62,6 +67,15 @@ void Channel::setSink(FlitReceiver* _sink, u32 _port) {
   sinkPort_ = _port;
 }
 
+void Channel::setWatchdog(Watchdog* _watchdog, bool _ejection) {
+  watchdog_ = _watchdog;
+  ejection_ = _ejection;
+}
+
+FlitReceiver* Channel::getSink() const {
+  return sink_;
+}
+
 void Channel::startMonitoring() {
   assert(monitoring_ == false);
   assert(monitorTime_ == U64_MAX);
@@ -94,14 +108,20 @@ f64 Channel::utilization(u32 _vc) const {
 }
 
 void Channel::processEvent(void* _event, s32 _type) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
   switch (_type) {
     case FLIT: {
       Flit* flit = reinterpret_cast<Flit*>(_event);
+      if (watchdog_ != nullptr) {
+        watchdog_->flitArrived(ejection_);
+      }
       sink_->receiveFlit(sinkPort_, flit);
     } break;
     case CRDT: {
       Credit* credit = reinterpret_cast<Credit*>(_event);
+      if (watchdog_ != nullptr) {
+        watchdog_->creditArrived();
+      }
       source_->receiveCredit(sourcePort_, credit);
     } break;
     default:
@@ -125,7 +145,7 @@ Flit* Channel::getNextFlit() const {
 u64 Channel::setNextFlit(Flit* _flit) {
   // determine the next time slot to send a flit
   u64 nextSlot = gSim->futureCycle(Simulator::Clock::CHANNEL, 1);
-  assert(nextSlot != nextFlitTime_);
+  CHECK_HOT(nextSlot != nextFlitTime_);
 
   // set the time and value
   nextFlitTime_ = nextSlot;
@@ -136,7 +156,7 @@ u64 Channel::setNextFlit(Flit* _flit) {
   addEvent(nextTime, 1, _flit, FLIT);
 
   // increment the count when monitoring
-  assert(_flit->getVc() < numVcs_);
+  CHECK_HOT(_flit->getVc() < numVcs_);
   if (monitoring_) {
     monitorCounts_.at(_flit->getVc())++;
     monitorCounts_.at(numVcs_)++;
@@ -162,7 +182,7 @@ Credit* Channel::getNextCredit() const {
 u64 Channel::setNextCredit(Credit* _credit) {
   // determine the next time slot to send a credit
   u64 nextSlot = gSim->futureCycle(Simulator::Clock::CHANNEL, 1);
-  assert(nextSlot != nextCreditTime_);
+  CHECK_HOT(nextSlot != nextCreditTime_);
 
   // set the time and value
   nextCreditTime_ = nextSlot;
@@ -26,6 +26,7 @@ class Flit;
 class FlitReceiver;
 class Credit;
 class CreditReceiver;
+class Watchdog;
 
 class Channel : public Component {
  public:
@@ -37,6 +38,11 @@ class Channel : public Component {
   u32 latency() const;
   void setSource(CreditReceiver* _source, u32 _port);
   void setSink(FlitReceiver* _sink, u32 _port);
+  FlitReceiver* getSink() const;
+
+  // this reports arriving flits and credits to a watchdog, flits are
+  //  counted as ejected on channels to interfaces
+  void setWatchdog(Watchdog* _watchdog, bool _ejection);
   void startMonitoring();
   void endMonitoring();
   f64 utilization(u32 _vc) const;  // U32_MAX for total
@@ -88,6 +94,9 @@ class Channel : public Component {
   u32 sourcePort_;
   FlitReceiver* sink_;  // receives flits, sends credits
   u32 sinkPort_;
+
+  Watchdog* watchdog_;
+  bool ejection_;
 };
 
 #endif  // NETWORK_CHANNEL_H_
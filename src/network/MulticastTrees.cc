@@ -0,0 +1,163 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/MulticastTrees.h"
+
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+const std::vector<u32>& MulticastTrees::Tree::ports(u32 _routerId) const {
+  return ports_.at(_routerId);
+}
+
+u32 MulticastTrees::Tree::upPort(u32 _routerId) const {
+  return upPorts_.at(_routerId);
+}
+
+u32 MulticastTrees::Tree::numEdges() const {
+  return numEdges_;
+}
+
+u32 MulticastTrees::Tree::depth() const {
+  return depth_;
+}
+
+MulticastTrees::MulticastTrees() {}
+
+MulticastTrees::~MulticastTrees() {
+  for (auto& trees : trees_) {
+    for (auto& it : trees) {
+      delete it.second;
+    }
+  }
+}
+
+void MulticastTrees::addRouterChannel(u32 _routerId, u32 _port,
+                                      u32 _neighborRouterId) {
+  u32 size = std::max(_routerId, _neighborRouterId) + 1;
+  if (links_.size() < size) {
+    links_.resize(size);
+  }
+  links_.at(_routerId).push_back({_port, _neighborRouterId});
+}
+
+void MulticastTrees::addInterfaceChannel(u32 _routerId, u32 _port,
+                                         u32 _interfaceId) {
+  if (links_.size() <= _routerId) {
+    links_.resize(_routerId + 1);
+  }
+  if (ejection_.size() <= _interfaceId) {
+    ejection_.resize(_interfaceId + 1, {U32_MAX, U32_MAX});
+  }
+  assert(ejection_.at(_interfaceId).router == U32_MAX);
+  ejection_.at(_interfaceId) = {_port, _routerId};
+}
+
+u32 MulticastTrees::createGroup(const std::vector<u32>& _interfaceIds) {
+  assert(_interfaceIds.size() > 0);
+  std::vector<u32> members(_interfaceIds);
+  std::sort(members.begin(), members.end());
+  assert(std::adjacent_find(members.begin(), members.end()) == members.end());
+  groups_.push_back(members);
+  trees_.emplace_back();
+  return groups_.size() - 1;
+}
+
+u32 MulticastTrees::numGroups() const {
+  return groups_.size();
+}
+
+const std::vector<u32>& MulticastTrees::group(u32 _group) const {
+  return groups_.at(_group);
+}
+
+const MulticastTrees::Tree* MulticastTrees::tree(u32 _group,
+                                                 u32 _rootRouterId) {
+  std::unordered_map<u32, Tree*>& trees = trees_.at(_group);
+  auto it = trees.find(_rootRouterId);
+  if (it == trees.end()) {
+    it = trees.insert({_rootRouterId, buildTree(_group, _rootRouterId)}).first;
+  }
+  return it->second;
+}
+
+const MulticastTrees::Tree* MulticastTrees::reductionTree(u32 _group) {
+  u32 root = ejection_.at(groups_.at(_group).front()).router;
+  return tree(_group, root);
+}
+
+MulticastTrees::Tree* MulticastTrees::buildTree(u32 _group,
+                                                u32 _rootRouterId) const {
+  // breadth first search from the root, remembering each router's parent
+  u32 numRouters = links_.size();
+  assert(_rootRouterId < numRouters);
+  std::vector<Link> parent(numRouters, {U32_MAX, U32_MAX});
+  std::vector<u32> distance(numRouters, U32_MAX);
+  std::queue<u32> frontier;
+  distance.at(_rootRouterId) = 0;
+  frontier.push(_rootRouterId);
+  while (!frontier.empty()) {
+    u32 router = frontier.front();
+    frontier.pop();
+    for (const Link& link : links_.at(router)) {
+      if (distance.at(link.router) == U32_MAX) {
+        distance.at(link.router) = distance.at(router) + 1;
+        parent.at(link.router) = {link.port, router};
+        frontier.push(link.router);
+      }
+    }
+  }
+
+  // add each member's ejection port then walk up to the root adding the
+  //  parent ports until reaching a router already in the tree
+  Tree* tree = new Tree();
+  tree->numEdges_ = 0;
+  tree->depth_ = 0;
+  tree->upPorts_[_rootRouterId] = U32_MAX;
+  for (u32 member : groups_.at(_group)) {
+    const Link& ejection = ejection_.at(member);
+    assert(ejection.router != U32_MAX);
+    assert(distance.at(ejection.router) != U32_MAX);  // unreachable member
+    tree->depth_ = std::max(tree->depth_, distance.at(ejection.router) + 1);
+    u32 router = ejection.router;
+    u32 port = ejection.port;
+    while (true) {
+      bool known = tree->ports_.count(router) > 0;
+      tree->ports_[router].push_back(port);
+      tree->numEdges_++;
+      if (known || router == _rootRouterId) {
+        break;
+      }
+      port = parent.at(router).port;
+      u32 child = router;
+      router = parent.at(router).router;
+
+      // find the child's port back to the parent
+      for (const Link& link : links_.at(child)) {
+        if (link.router == router) {
+          tree->upPorts_[child] = link.port;
+          break;
+        }
+      }
+      assert(tree->upPorts_.count(child) > 0);
+    }
+  }
+
+  // keep the ports in order for deterministic replication
+  for (auto& it : tree->ports_) {
+    std::sort(it.second.begin(), it.second.end());
+  }
+  return tree;
+}
@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_MULTICASTTREES_H_
+#define NETWORK_MULTICASTTREES_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "prim/prim.h"
+
+/*
+ * This holds the multicast groups of a network and their routing trees. A
+ *  group is a set of interface IDs. A tree is computed per group and per root
+ *  router (the router the source interface injects into) with a breadth first
+ *  search over the router graph, thus every member is reached over a minimal
+ *  path. Ties are broken by port order so trees are deterministic. Trees are
+ *  built on first use and kept for the rest of the simulation.
+ *
+ * Reductions flow up the tree of their group rooted at the router of the
+ *  group's lowest interface ID, so all contributions meet at the same routers.
+ *
+ * The topology is described with addRouterChannel() and
+ *  addInterfaceChannel() before any tree is requested.
+ */
+class MulticastTrees {
+ public:
+  // this holds the output ports a multicast packet is replicated to at each
+  //  router of the tree
+  class Tree {
+   public:
+    const std::vector<u32>& ports(u32 _routerId) const;
+    u32 upPort(u32 _routerId) const;  // toward the root, U32_MAX at the root
+    u32 numEdges() const;  // router-to-router and ejection channels
+    u32 depth() const;  // max routers on a path from the root to a member
+
+   private:
+    friend class MulticastTrees;
+    std::unordered_map<u32, std::vector<u32>> ports_;
+    std::unordered_map<u32, u32> upPorts_;
+    u32 numEdges_;
+    u32 depth_;
+  };
+
+  MulticastTrees();
+  ~MulticastTrees();
+
+  // these describe the output channels of the routers
+  void addRouterChannel(u32 _routerId, u32 _port, u32 _neighborRouterId);
+  void addInterfaceChannel(u32 _routerId, u32 _port, u32 _interfaceId);
+
+  // this creates a group and returns its ID
+  u32 createGroup(const std::vector<u32>& _interfaceIds);
+  u32 numGroups() const;
+  const std::vector<u32>& group(u32 _group) const;
+
+  // this returns the tree of a group rooted at a router
+  const Tree* tree(u32 _group, u32 _rootRouterId);
+
+  // this returns the tree reductions of a group use
+  const Tree* reductionTree(u32 _group);
+
+ private:
+  struct Link {
+    u32 port;
+    u32 router;
+  };
+
+  Tree* buildTree(u32 _group, u32 _rootRouterId) const;
+
+  std::vector<std::vector<Link>> links_;  // [router] router-to-router
+  std::vector<Link> ejection_;  // [interface] router and port
+  std::vector<std::vector<u32>> groups_;
+  std::vector<std::unordered_map<u32, Tree*>> trees_;  // [group][root]
+};
+
+#endif  // NETWORK_MULTICASTTREES_H_
@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/MulticastTrees.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+// 4 routers in a ring, port 0 is clockwise, port 1 is counter-clockwise, and
+//  port 2 connects the router's interface (interface ID = router ID)
+static void ring(MulticastTrees* _trees) {
+  for (u32 r = 0; r < 4; r++) {
+    _trees->addRouterChannel(r, 0, (r + 1) % 4);
+    _trees->addRouterChannel(r, 1, (r + 3) % 4);
+    _trees->addInterfaceChannel(r, 2, r);
+  }
+}
+
+TEST(MulticastTrees, groups) {
+  MulticastTrees trees;
+  ring(&trees);
+  ASSERT_EQ(trees.numGroups(), 0u);
+  ASSERT_EQ(trees.createGroup({3, 1, 2}), 0u);
+  ASSERT_EQ(trees.createGroup({0}), 1u);
+  ASSERT_EQ(trees.numGroups(), 2u);
+  ASSERT_EQ(trees.group(0), std::vector<u32>({1, 2, 3}));
+  ASSERT_EQ(trees.group(1), std::vector<u32>({0}));
+}
+
+TEST(MulticastTrees, ring) {
+  MulticastTrees trees;
+  ring(&trees);
+  u32 group = trees.createGroup({1, 2, 3});
+
+  // router 2 is reached clockwise first, router 3 counter-clockwise
+  const MulticastTrees::Tree* tree = trees.tree(group, 0);
+  ASSERT_EQ(tree->ports(0), std::vector<u32>({0, 1}));
+  ASSERT_EQ(tree->ports(1), std::vector<u32>({0, 2}));
+  ASSERT_EQ(tree->ports(2), std::vector<u32>({2}));
+  ASSERT_EQ(tree->ports(3), std::vector<u32>({2}));
+  ASSERT_EQ(tree->numEdges(), 6u);
+  ASSERT_EQ(tree->depth(), 3u);
+
+  // trees are cached per root
+  ASSERT_EQ(trees.tree(group, 0), tree);
+
+  // a root that is also a member ejects locally
+  const MulticastTrees::Tree* other = trees.tree(group, 2);
+  ASSERT_NE(other, tree);
+  ASSERT_EQ(other->ports(2), std::vector<u32>({0, 1, 2}));
+  ASSERT_EQ(other->ports(1), std::vector<u32>({2}));
+  ASSERT_EQ(other->ports(3), std::vector<u32>({2}));
+  ASSERT_EQ(other->numEdges(), 5u);
+  ASSERT_EQ(other->depth(), 2u);
+}
+
+TEST(MulticastTrees, reduction) {
+  MulticastTrees trees;
+  ring(&trees);
+  u32 group = trees.createGroup({2, 3, 1, 0});
+
+  // rooted at the router of the lowest member
+  const MulticastTrees::Tree* tree = trees.reductionTree(group);
+  ASSERT_EQ(tree, trees.tree(group, 0));
+  ASSERT_EQ(tree->upPort(0), U32_MAX);
+  ASSERT_EQ(tree->upPort(1), 1u);
+  ASSERT_EQ(tree->upPort(2), 1u);
+  ASSERT_EQ(tree->upPort(3), 0u);
+
+  // each router waits for one contribution per tree port
+  ASSERT_EQ(tree->ports(0).size(), 3u);
+  ASSERT_EQ(tree->ports(1).size(), 2u);
+  ASSERT_EQ(tree->ports(2).size(), 1u);
+  ASSERT_EQ(tree->ports(3).size(), 1u);
+}
@@ -15,8 +15,10 @@
 #include "network/Network.h"
 
 #include <cassert>
+#include <string>
 #include <utility>
 
+#include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
 
 static u32 computeNumVcs(const nlohmann::json& _pcs) {
@@ -44,11 +46,45 @@ Network::Network(const std::string& _name, const Component* _parent,
 
   // create a traffic log object
   trafficLog_ = new TrafficLog(_settings["traffic_log"]);
+
+  // create a wiring model if physical wiring is described
+  if (_settings.contains("wiring") && !_settings["wiring"].is_null()) {
+    wiringModel_ = new WiringModel(_settings["wiring"]);
+  } else {
+    wiringModel_ = nullptr;
+  }
+
+  // multicast trees are created on first use
+  multicastTrees_ = nullptr;
+  inputQueuedRouters_ =
+      _settings.contains("router") &&
+      _settings["router"]["architecture"].get<std::string>() == "input_queued";
+
+  // create a watchdog if forward progress is to be checked
+  if (_settings.contains("watchdog") && !_settings["watchdog"].is_null()) {
+    watchdog_ = new Watchdog("Watchdog", this, this, _settings["watchdog"]);
+  } else {
+    watchdog_ = nullptr;
+  }
 }
 
 Network::~Network() {
   delete channelLog_;
   delete trafficLog_;
+  if (wiringModel_) {
+    delete wiringModel_;
+  }
+  if (multicastTrees_) {
+    delete multicastTrees_;
+  }
+  if (watchdog_) {
+    delete watchdog_;
+  }
+  for (SourceRoutes* sourceRoutes : sourceRoutes_) {
+    if (sourceRoutes) {
+      delete sourceRoutes;
+    }
+  }
 }
 
 Network* Network::create(const std::string& _name, const Component* _parent,
@@ -124,6 +160,98 @@ void Network::logTraffic(const Component* _device, u32 _inputPort, u32 _inputVc,
   }
 }
 
+Channel* Network::createRouterChannel(const std::string& _name,
+                                      const Router* _source,
+                                      const Router* _destination,
+                                      nlohmann::json _settings) {
+  return createRouterChannel(_name, _source, _destination,
+                             _settings["latency"].get<u32>());
+}
+
+Channel* Network::createRouterChannel(const std::string& _name,
+                                      const Router* _source,
+                                      const Router* _destination,
+                                      u32 _latency) {
+  if (wiringModel_) {
+    _latency = wiringModel_->addLink(_name, _source->id(), _destination->id());
+  }
+  return new Channel(_name, this, numVcs_, _latency);
+}
+
+const WiringModel* Network::wiringModel() const {
+  return wiringModel_;
+}
+
+static f64 ratio(u64 _num, u64 _den) {
+  return _den == 0 ? 0.0 : (f64)_num / (f64)_den;
+}
+
+void Network::logSwaStats() const {
+  Router::SwaStats t = {0, 0, 0, 0, 0};
+  bool speculative = false;
+  for (u32 id = 0; id < numRouters(); id++) {
+    speculative |= getRouter(id)->addSwaStats(&t);
+  }
+  if (!speculative) {
+    return;
+  }
+  gSim->infoLog.logInfo("Switch requests", std::to_string(t.requests));
+  gSim->infoLog.logInfo("Switch grant rate",
+                        std::to_string(ratio(t.grants, t.requests)));
+  gSim->infoLog.logInfo("Speculative switch requests",
+                        std::to_string(t.specRequests));
+  gSim->infoLog.logInfo("Speculative switch grant rate",
+                        std::to_string(ratio(t.specGrants, t.specRequests)));
+  gSim->infoLog.logInfo("Speculative switch grants used",
+                        std::to_string(ratio(t.specUsed, t.specGrants)));
+}
+
+template <typename T>
+void Network::describeRouterGraph(T* _graph) {
+  for (u32 id = 0; id < numRouters(); id++) {
+    Router* router = getRouter(id);
+    for (u32 port = 0; port < router->numPorts(); port++) {
+      Channel* channel = router->getOutputChannel(port);
+      if (channel == nullptr) {
+        continue;
+      }
+      FlitReceiver* sink = channel->getSink();
+      Router* neighbor = dynamic_cast<Router*>(sink);
+      Interface* interface = dynamic_cast<Interface*>(sink);
+      if (neighbor != nullptr) {
+        _graph->addRouterChannel(id, port, neighbor->id());
+      } else if (interface != nullptr) {
+        _graph->addInterfaceChannel(id, port, interface->id());
+      }
+    }
+  }
+}
+
+MulticastTrees* Network::multicastTrees() {
+  if (multicastTrees_ == nullptr) {
+    if (!inputQueuedRouters_) {
+      fprintf(stderr, "multicast requires input_queued routers\n");
+      assert(false);
+    }
+    multicastTrees_ = new MulticastTrees();
+    describeRouterGraph(multicastTrees_);
+  }
+  return multicastTrees_;
+}
+
+bool Network::sourceRouted(u32 _pc) const {
+  return _pc < sourceRoutes_.size() && sourceRoutes_.at(_pc) != nullptr;
+}
+
+SourceRoutes* Network::sourceRoutes(u32 _pc) {
+  assert(sourceRouted(_pc));
+  if (!sourceRoutesDescribed_.at(_pc)) {
+    describeRouterGraph(sourceRoutes_.at(_pc));
+    sourceRoutesDescribed_.at(_pc) = true;
+  }
+  return sourceRoutes_.at(_pc);
+}
+
 void Network::loadProtocolClassInfo(nlohmann::json _settings) {
   // parse the protocol classes description
   for (u32 pc = 0, vcs = 0; pc < _settings.size(); pc++) {
@@ -139,6 +267,20 @@ void Network::loadProtocolClassInfo(nlohmann::json _settings) {
     pcCfg.routing = _settings[pc]["routing"];
     assert(!pcCfg.routing.is_null());
     pcSettings_.push_back(pcCfg);
+    if (_settings[pc].contains("source_routing") &&
+        !_settings[pc]["source_routing"].is_null()) {
+      // the path rides in the routing extension, which other architectures
+      //  hand to the routing algorithm
+      if (!inputQueuedRouters_) {
+        fprintf(stderr, "source routing requires input_queued routers\n");
+        assert(false);
+      }
+      sourceRoutes_.push_back(
+          new SourceRoutes(_settings[pc]["source_routing"]));
+    } else {
+      sourceRoutes_.push_back(nullptr);
+    }
+    sourceRoutesDescribed_.push_back(false);
     for (u32 vc = 0; vc < pcVcInfo.numVcs; vc++, vcs++) {
       bool ins = vcToPc_.insert(std::make_pair(vcs, pc)).second;
       (void)ins;  // UNUSED
@@ -24,6 +24,10 @@
 #include "interface/Interface.h"
 #include "metadata/MetadataHandler.h"
 #include "network/Channel.h"
+#include "network/MulticastTrees.h"
+#include "network/SourceRoutes.h"
+#include "network/Watchdog.h"
+#include "network/WiringModel.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
@@ -31,6 +35,7 @@
 #include "routing/RoutingAlgorithm.h"
 #include "stats/ChannelLog.h"
 #include "stats/TrafficLog.h"
+#include "types/Address.h"
 
 #define NETWORK_ARGS \
   const std::string&, const Component*, MetadataHandler*, nlohmann::json
@@ -60,16 +65,16 @@ class Network : public Component {
   virtual Router* getRouter(u32 _id) const = 0;
   virtual Interface* getInterface(u32 _id) const = 0;
   virtual void translateInterfaceIdToAddress(
-      u32 _id, std::vector<u32>* _address) const = 0;
+      u32 _id, Address* _address) const = 0;
   virtual u32 translateInterfaceAddressToId(
-      const std::vector<u32>* _address) const = 0;
+      const Address* _address) const = 0;
   virtual void translateRouterIdToAddress(u32 _id,
-                                          std::vector<u32>* _address) const = 0;
+                                          Address* _address) const = 0;
   virtual u32 translateRouterAddressToId(
-      const std::vector<u32>* _address) const = 0;
+      const Address* _address) const = 0;
   virtual u32 computeMinimalHops(
-      const std::vector<u32>* _source,
-      const std::vector<u32>* _destination) const = 0;
+      const Address* _source,
+      const Address* _destination) const = 0;
   MetadataHandler* metadataHandler() const;
 
   void startMonitoring();
@@ -86,6 +91,22 @@ class Network : public Component {
   PcVcInfo pcVcs(u32 _pc) const;
   u32 vcToPc(u32 _vc) const;
 
+  // this holds the multicast groups and their trees, the router graph is
+  //  read from the channels on first use
+  MulticastTrees* multicastTrees();
+
+  // this holds the paths of a protocol class configured with
+  //  "source_routing", the router graph is read from the channels on first use
+  bool sourceRouted(u32 _pc) const;
+  SourceRoutes* sourceRoutes(u32 _pc);
+
+  // this is nullptr unless "wiring" is specified
+  const WiringModel* wiringModel() const;
+
+  // this logs the switch allocation counts of all routers to the info log,
+  //  if any router allocates speculatively
+  void logSwaStats() const;
+
   // this function logs traffic
   void logTraffic(const Component* _device, u32 _inputPort, u32 _inputVc,
                   u32 _outputPort, u32 _outputVc, u32 _flits);
@@ -101,6 +122,14 @@ class Network : public Component {
 
   virtual void collectChannels(std::vector<Channel*>* _channels) = 0;
 
+  // these create a channel from one router to another, if a wiring model is
+  //  configured its latency replaces the given latency
+  Channel* createRouterChannel(const std::string& _name, const Router* _source,
+                               const Router* _destination,
+                               nlohmann::json _settings);
+  Channel* createRouterChannel(const std::string& _name, const Router* _source,
+                               const Router* _destination, u32 _latency);
+
   // this loads the routing algorithm info vector
   void loadProtocolClassInfo(nlohmann::json _settings);
 
@@ -113,8 +142,19 @@ class Network : public Component {
   const u32 numVcs_;
 
  private:
+  // this describes the router graph from the channels to a MulticastTrees or
+  //  SourceRoutes object
+  template <typename T>
+  void describeRouterGraph(T* _graph);
+
   ChannelLog* channelLog_;
   TrafficLog* trafficLog_;
+  WiringModel* wiringModel_;
+  MulticastTrees* multicastTrees_;
+  bool inputQueuedRouters_;  // only these replicate and source route packets
+  Watchdog* watchdog_;
+  std::vector<SourceRoutes*> sourceRoutes_;  // [pc] nullptr if not used
+  std::vector<bool> sourceRoutesDescribed_;
   MetadataHandler* metadataHandler_;
   bool monitoring_;
 
@@ -0,0 +1,213 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/Network_TESTLIB.h"
+
+#include <cassert>
+
+TestRouter::TestRouter(Network* _network, u32 _id, u32 _numPorts,
+                       u32 _numVcs)
+    : TestRouter(_network, _id, _numPorts, _numVcs, nlohmann::json()) {}
+
+TestRouter::TestRouter(Network* _network, u32 _id, u32 _numPorts,
+                       u32 _numVcs, nlohmann::json _settings)
+    : Router("TestRouter_" + std::to_string(_id), nullptr, _network, _id,
+             {_id}, _numPorts, _numVcs, nullptr, _settings),
+      inputChannels_(_numPorts, nullptr),
+      outputChannels_(_numPorts, nullptr) {}
+
+TestRouter::~TestRouter() {}
+
+void TestRouter::setInputChannel(u32 _port, Channel* _channel) {
+  inputChannels_.at(_port) = _channel;
+  _channel->setSink(this, _port);
+}
+
+Channel* TestRouter::getInputChannel(u32 _port) const {
+  return inputChannels_.at(_port);
+}
+
+void TestRouter::setOutputChannel(u32 _port, Channel* _channel) {
+  outputChannels_.at(_port) = _channel;
+  _channel->setSource(this, _port);
+}
+
+Channel* TestRouter::getOutputChannel(u32 _port) const {
+  return outputChannels_.at(_port);
+}
+
+void TestRouter::sendCredit(u32 _port, u32 _vc) {}
+
+void TestRouter::receiveCredit(u32 _port, Credit* _credit) {
+  delete _credit;
+}
+
+void TestRouter::sendFlit(u32 _port, Flit* _flit) {}
+
+void TestRouter::receiveFlit(u32 _port, Flit* _flit) {}
+
+f64 TestRouter::congestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort, u32 _outputVc) const {
+  return 0.0;
+}
+
+TestInterface::TestInterface(Network* _network, u32 _id, u32 _numPorts,
+                             u32 _numVcs)
+    : Interface("TestInterface_" + std::to_string(_id), nullptr, _network,
+                _id, {_id}, _numPorts, _numVcs, nullptr, nlohmann::json()),
+      inputChannels_(_numPorts, nullptr),
+      outputChannels_(_numPorts, nullptr) {}
+
+TestInterface::~TestInterface() {}
+
+void TestInterface::setInputChannel(u32 _port, Channel* _channel) {
+  inputChannels_.at(_port) = _channel;
+  _channel->setSink(this, _port);
+}
+
+Channel* TestInterface::getInputChannel(u32 _port) const {
+  return inputChannels_.at(_port);
+}
+
+void TestInterface::setOutputChannel(u32 _port, Channel* _channel) {
+  outputChannels_.at(_port) = _channel;
+  _channel->setSource(this, _port);
+}
+
+Channel* TestInterface::getOutputChannel(u32 _port) const {
+  return outputChannels_.at(_port);
+}
+
+void TestInterface::sendCredit(u32 _port, u32 _vc) {}
+
+void TestInterface::receiveCredit(u32 _port, Credit* _credit) {}
+
+void TestInterface::sendFlit(u32 _port, Flit* _flit) {}
+
+void TestInterface::receiveFlit(u32 _port, Flit* _flit) {}
+
+void TestInterface::receiveMessage(Message* _message) {}
+
+void TestInterface::injectingPacket(Packet* _packet, u32 _port, u32 _vc) {}
+
+u32 TestInterface::occupancy(u32 _port, u32 _vc) const {
+  return 0;
+}
+
+u32 TestInterface::downstreamOccupancy(u32 _port, u32 _vc) const {
+  return 0;
+}
+
+TestNetwork::TestNetwork(nlohmann::json _settings)
+    : Network("TestNetwork", nullptr, nullptr, _settings) {
+  loadProtocolClassInfo(_settings["protocol_classes"]);
+  clearProtocolClassInfo();
+}
+
+TestNetwork::~TestNetwork() {
+  for (Channel* channel : channels_) {
+    delete channel;
+  }
+  for (Router* router : routers_) {
+    delete router;
+  }
+  for (Interface* interface : interfaces_) {
+    delete interface;
+  }
+}
+
+nlohmann::json TestNetwork::makeJSON(u32 _numVcs) {
+  nlohmann::json settings;
+  settings["router"]["architecture"] = "input_queued";
+  settings["protocol_classes"][0]["num_vcs"] = _numVcs;
+  settings["protocol_classes"][0]["injection"]["algorithm"] = "none";
+  settings["protocol_classes"][0]["routing"]["algorithm"] = "none";
+  return settings;
+}
+
+InjectionAlgorithm* TestNetwork::createInjectionAlgorithm(
+    u32 _inputPc, const std::string& _name, const Component* _parent,
+    Interface* _interface) {
+  return nullptr;
+}
+
+RoutingAlgorithm* TestNetwork::createRoutingAlgorithm(
+    u32 _inputPort, u32 _inputVc, const std::string& _name,
+    const Component* _parent, Router* _router) {
+  return nullptr;
+}
+
+u32 TestNetwork::numRouters() const {
+  return routers_.size();
+}
+
+u32 TestNetwork::numInterfaces() const {
+  return interfaces_.size();
+}
+
+Router* TestNetwork::getRouter(u32 _id) const {
+  return routers_.at(_id);
+}
+
+Interface* TestNetwork::getInterface(u32 _id) const {
+  return interfaces_.at(_id);
+}
+
+void TestNetwork::translateInterfaceIdToAddress(
+    u32 _id, Address* _address) const {
+  *_address = {_id};
+}
+
+u32 TestNetwork::translateInterfaceAddressToId(
+    const Address* _address) const {
+  return _address->at(0);
+}
+
+void TestNetwork::translateRouterIdToAddress(
+    u32 _id, Address* _address) const {
+  *_address = {_id};
+}
+
+u32 TestNetwork::translateRouterAddressToId(const Address* _address) const {
+  return _address->at(0);
+}
+
+u32 TestNetwork::computeMinimalHops(const Address* _source,
+                                    const Address* _destination) const {
+  return 1;
+}
+
+void TestNetwork::addRouter(Router* _router) {
+  assert(_router->id() == routers_.size());
+  routers_.push_back(_router);
+}
+
+void TestNetwork::addInterface(Interface* _interface) {
+  assert(_interface->id() == interfaces_.size());
+  interfaces_.push_back(_interface);
+}
+
+Channel* TestNetwork::connect(PortedDevice* _source, u32 _sourcePort,
+                              PortedDevice* _sink, u32 _sinkPort) {
+  Channel* channel = new Channel("Channel_" + std::to_string(
+      channels_.size()), nullptr, numVcs_, 1);
+  _source->setOutputChannel(_sourcePort, channel);
+  _sink->setInputChannel(_sinkPort, channel);
+  channels_.push_back(channel);
+  return channel;
+}
+
+void TestNetwork::collectChannels(std::vector<Channel*>* _channels) {
+  _channels->insert(_channels->end(), channels_.begin(), channels_.end());
+}
@@ -0,0 +1,131 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_NETWORK_TESTLIB_H_
+#define NETWORK_NETWORK_TESTLIB_H_
+
+#include <string>
+#include <vector>
+
+#include "architecture/PortedDevice.h"
+#include "event/Component.h"
+#include "interface/Interface.h"
+#include "network/Channel.h"
+#include "network/Network.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+#include "types/Address.h"
+#include "types/Credit.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+// this is a test router that only keeps its channels and drops the credits it
+//  receives
+class TestRouter : public Router {
+ public:
+  TestRouter(Network* _network, u32 _id, u32 _numPorts, u32 _numVcs);
+  TestRouter(Network* _network, u32 _id, u32 _numPorts, u32 _numVcs,
+             nlohmann::json _settings);
+  ~TestRouter();
+
+  void setInputChannel(u32 _port, Channel* _channel) override;
+  Channel* getInputChannel(u32 _port) const override;
+  void setOutputChannel(u32 _port, Channel* _channel) override;
+  Channel* getOutputChannel(u32 _port) const override;
+  void sendCredit(u32 _port, u32 _vc) override;
+  void receiveCredit(u32 _port, Credit* _credit) override;
+  void sendFlit(u32 _port, Flit* _flit) override;
+  void receiveFlit(u32 _port, Flit* _flit) override;
+  f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
+                       u32 _outputVc) const override;
+
+ private:
+  std::vector<Channel*> inputChannels_;
+  std::vector<Channel*> outputChannels_;
+};
+
+// this is a test interface that only keeps its channels and ignores
+//  everything given to it
+class TestInterface : public Interface {
+ public:
+  TestInterface(Network* _network, u32 _id, u32 _numPorts, u32 _numVcs);
+  ~TestInterface();
+
+  void setInputChannel(u32 _port, Channel* _channel) override;
+  Channel* getInputChannel(u32 _port) const override;
+  void setOutputChannel(u32 _port, Channel* _channel) override;
+  Channel* getOutputChannel(u32 _port) const override;
+  void sendCredit(u32 _port, u32 _vc) override;
+  void receiveCredit(u32 _port, Credit* _credit) override;
+  void sendFlit(u32 _port, Flit* _flit) override;
+  void receiveFlit(u32 _port, Flit* _flit) override;
+  void receiveMessage(Message* _message) override;
+  void injectingPacket(Packet* _packet, u32 _port, u32 _vc) override;
+  u32 occupancy(u32 _port, u32 _vc) const override;
+  u32 downstreamOccupancy(u32 _port, u32 _vc) const override;
+
+ private:
+  std::vector<Channel*> inputChannels_;
+  std::vector<Channel*> outputChannels_;
+};
+
+// this is a test network of the routers and interfaces added to it, the
+//  address of each device is its id and all pairs are a single hop apart
+class TestNetwork : public Network {
+ public:
+  explicit TestNetwork(nlohmann::json _settings);
+  ~TestNetwork();
+
+  // these are the settings of one protocol class with '_numVcs' VCs
+  static nlohmann::json makeJSON(u32 _numVcs);
+
+  InjectionAlgorithm* createInjectionAlgorithm(
+      u32 _inputPc, const std::string& _name, const Component* _parent,
+      Interface* _interface) override;
+  RoutingAlgorithm* createRoutingAlgorithm(
+      u32 _inputPort, u32 _inputVc, const std::string& _name,
+      const Component* _parent, Router* _router) override;
+  u32 numRouters() const override;
+  u32 numInterfaces() const override;
+  Router* getRouter(u32 _id) const override;
+  Interface* getInterface(u32 _id) const override;
+  void translateInterfaceIdToAddress(
+      u32 _id, Address* _address) const override;
+  u32 translateInterfaceAddressToId(const Address* _address) const override;
+  void translateRouterIdToAddress(u32 _id, Address* _address) const override;
+  u32 translateRouterAddressToId(const Address* _address) const override;
+  u32 computeMinimalHops(const Address* _source,
+                         const Address* _destination) const override;
+
+  // the network takes ownership of the devices, their ids must be in order
+  void addRouter(Router* _router);
+  void addInterface(Interface* _interface);
+
+  // this creates a channel from an output port of a router or interface to
+  //  an input port of another
+  Channel* connect(PortedDevice* _source, u32 _sourcePort, PortedDevice* _sink,
+                   u32 _sinkPort);
+
+ protected:
+  void collectChannels(std::vector<Channel*>* _channels) override;
+
+ private:
+  std::vector<Router*> routers_;
+  std::vector<Interface*> interfaces_;
+  std::vector<Channel*> channels_;
+};
+
+#endif  // NETWORK_NETWORK_TESTLIB_H_
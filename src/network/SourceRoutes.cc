@@ -0,0 +1,190 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/SourceRoutes.h"
+
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+#include "event/Simulator.h"
+#include "fio/InFile.h"
+#include "strop/strop.h"
+
+SourceRoutes::SourceRoutes(nlohmann::json _settings) {
+  const std::string& paths = _settings["paths"].get<std::string>();
+  if (paths == "minimal") {
+    paths_ = Paths::kMinimal;
+  } else if (paths == "valiant") {
+    paths_ = Paths::kValiant;
+  } else if (paths == "file") {
+    paths_ = Paths::kFile;
+    loadPathFile(_settings["path_file"].get<std::string>());
+  } else {
+    fprintf(stderr, "unknown source routing paths: %s\n", paths.c_str());
+    assert(false);
+  }
+}
+
+SourceRoutes::~SourceRoutes() {
+  for (auto& it : routes_) {
+    delete it.second;
+  }
+  for (auto& it : valiantRoutes_) {
+    delete it.second;
+  }
+}
+
+void SourceRoutes::addRouterChannel(u32 _routerId, u32 _port,
+                                    u32 _neighborRouterId) {
+  u32 size = std::max(_routerId, _neighborRouterId) + 1;
+  if (links_.size() < size) {
+    links_.resize(size);
+  }
+  links_.at(_routerId).push_back({_port, _neighborRouterId});
+}
+
+void SourceRoutes::addInterfaceChannel(u32 _routerId, u32 _port,
+                                       u32 _interfaceId) {
+  if (links_.size() <= _routerId) {
+    links_.resize(_routerId + 1);
+  }
+  if (ejection_.size() <= _interfaceId) {
+    ejection_.resize(_interfaceId + 1, {U32_MAX, U32_MAX});
+  }
+  // interfaces with several ports eject through the first one
+  if (ejection_.at(_interfaceId).router == U32_MAX) {
+    ejection_.at(_interfaceId) = {_port, _routerId};
+  }
+}
+
+u32 SourceRoutes::numRouters() const {
+  return links_.size();
+}
+
+const std::vector<u32>* SourceRoutes::route(u32 _sourceId,
+                                            u32 _destinationId) {
+  switch (paths_) {
+    case Paths::kMinimal:
+      return minimalPath(_sourceId, _destinationId);
+
+    case Paths::kValiant:
+      return valiantPath(_sourceId, gSim->rnd.nextU64(0, numRouters() - 1),
+                         _destinationId);
+
+    case Paths::kFile: {
+      auto it = routes_.find(std::make_tuple(_sourceId, _destinationId));
+      if (it == routes_.end()) {
+        fprintf(stderr, "no path from %u to %u\n", _sourceId, _destinationId);
+        assert(false);
+      }
+      return it->second;
+    }
+
+    default:
+      assert(false);
+      return nullptr;
+  }
+}
+
+const std::vector<u32>* SourceRoutes::minimalPath(u32 _sourceId,
+                                                  u32 _destinationId) {
+  std::tuple<u32, u32> key(_sourceId, _destinationId);
+  auto it = routes_.find(key);
+  if (it == routes_.end()) {
+    // interfaces inject into the router they eject from
+    std::vector<u32>* path = new std::vector<u32>();
+    const Link& destination = ejection_.at(_destinationId);
+    appendMinimal(ejection_.at(_sourceId).router, destination.router, path);
+    path->push_back(destination.port);
+    it = routes_.insert({key, path}).first;
+  }
+  return it->second;
+}
+
+const std::vector<u32>* SourceRoutes::valiantPath(u32 _sourceId,
+                                                  u32 _intermediateId,
+                                                  u32 _destinationId) {
+  std::tuple<u32, u32, u32> key(_sourceId, _intermediateId, _destinationId);
+  auto it = valiantRoutes_.find(key);
+  if (it == valiantRoutes_.end()) {
+    std::vector<u32>* path = new std::vector<u32>();
+    const Link& destination = ejection_.at(_destinationId);
+    appendMinimal(ejection_.at(_sourceId).router, _intermediateId, path);
+    appendMinimal(_intermediateId, destination.router, path);
+    path->push_back(destination.port);
+    it = valiantRoutes_.insert({key, path}).first;
+  }
+  return it->second;
+}
+
+void SourceRoutes::loadPathFile(const std::string& _filename) {
+  fio::InFile inf(_filename);
+  fio::InFile::Status sts = fio::InFile::Status::OK;
+  while (sts == fio::InFile::Status::OK) {
+    std::string line;
+    sts = inf.getLine(&line);
+    assert(sts != fio::InFile::Status::ERROR);
+    if (sts == fio::InFile::Status::OK && line.size() > 0 && line[0] != '#') {
+      std::vector<std::string> strs = strop::split(line, ',');
+      assert(strs.size() == 3);
+      std::tuple<u32, u32> key(std::stoul(strs.at(0)), std::stoul(strs.at(1)));
+      std::vector<u32>* path = new std::vector<u32>();
+      for (const std::string& port : strop::split(strs.at(2), ' ')) {
+        if (port.size() > 0) {
+          path->push_back(std::stoul(port));
+        }
+      }
+      assert(path->size() > 0);
+      bool res = routes_.insert({key, path}).second;
+      assert(res);  // no duplicates
+    }
+  }
+}
+
+void SourceRoutes::appendMinimal(u32 _sourceRouterId,
+                                 u32 _destinationRouterId,
+                                 std::vector<u32>* _path) {
+  // breadth first search once per source router, remembering each router's
+  //  parent
+  if (parents_.size() < numRouters()) {
+    parents_.resize(numRouters());
+  }
+  std::vector<Link>& parent = parents_.at(_sourceRouterId);
+  if (parent.empty()) {
+    parent.resize(numRouters(), {U32_MAX, U32_MAX});
+    parent.at(_sourceRouterId) = {U32_MAX, _sourceRouterId};
+    std::queue<u32> frontier;
+    frontier.push(_sourceRouterId);
+    while (!frontier.empty()) {
+      u32 router = frontier.front();
+      frontier.pop();
+      for (const Link& link : links_.at(router)) {
+        if (parent.at(link.router).router == U32_MAX) {
+          parent.at(link.router) = {link.port, router};
+          frontier.push(link.router);
+        }
+      }
+    }
+  }
+
+  // walk back from the destination
+  assert(parent.at(_destinationRouterId).router != U32_MAX);
+  u32 start = _path->size();
+  for (u32 router = _destinationRouterId; router != _sourceRouterId;
+       router = parent.at(router).router) {
+    _path->push_back(parent.at(router).port);
+  }
+  std::reverse(_path->begin() + start, _path->end());
+}
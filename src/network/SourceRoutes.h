@@ -0,0 +1,86 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_SOURCEROUTES_H_
+#define NETWORK_SOURCEROUTES_H_
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "colhash/tuplehash.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+/*
+ * This provides the paths of a source routed protocol class. A path is the
+ *  list of output ports taken at each router from the source interface's
+ *  router (through its port 0) up to and including the ejection port. The
+ *  interface attaches the path to each packet and the routers index it by the
+ *  packet's hop count. Paths are owned by this object.
+ *
+ * The "paths" setting selects where paths come from:
+ *  "minimal": the shortest path found by a breadth first search over the
+ *    router graph, ties broken by port order.
+ *  "valiant": the minimal path to a random intermediate router then the
+ *    minimal path to the destination.
+ *  "file": "path_file" is a csv of "source,destination,ports" lines where
+ *    ports are space separated.
+ *
+ * The topology is described with addRouterChannel() and addInterfaceChannel()
+ *  before the generated paths are used.
+ */
+class SourceRoutes {
+ public:
+  enum class Paths : u8 {kMinimal, kValiant, kFile};
+
+  explicit SourceRoutes(nlohmann::json _settings);
+  ~SourceRoutes();
+
+  // these describe the output channels of the routers
+  void addRouterChannel(u32 _routerId, u32 _port, u32 _neighborRouterId);
+  void addInterfaceChannel(u32 _routerId, u32 _port, u32 _interfaceId);
+  u32 numRouters() const;
+
+  // this returns the path of a packet from one interface to another
+  const std::vector<u32>* route(u32 _sourceId, u32 _destinationId);
+
+  // these return generated paths, the valiant path is through a router
+  const std::vector<u32>* minimalPath(u32 _sourceId, u32 _destinationId);
+  const std::vector<u32>* valiantPath(u32 _sourceId, u32 _intermediateId,
+                                      u32 _destinationId);
+
+ private:
+  struct Link {
+    u32 port;
+    u32 router;
+  };
+
+  void loadPathFile(const std::string& _filename);
+  void appendMinimal(u32 _sourceRouterId, u32 _destinationRouterId,
+                     std::vector<u32>* _path);
+
+  Paths paths_;
+
+  std::vector<std::vector<Link>> links_;  // [router] router-to-router
+  std::vector<Link> ejection_;  // [interface] router and port
+  std::vector<std::vector<Link>> parents_;  // [source router][router]
+
+  std::unordered_map<std::tuple<u32, u32>, std::vector<u32>*> routes_;
+  std::unordered_map<std::tuple<u32, u32, u32>, std::vector<u32>*>
+      valiantRoutes_;
+};
+
+#endif  // NETWORK_SOURCEROUTES_H_
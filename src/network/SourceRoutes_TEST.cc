@@ -0,0 +1,59 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/SourceRoutes.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+// 4 routers in a ring, port 0 is clockwise, port 1 is counter-clockwise, and
+//  port 2 connects the router's interface (interface ID = router ID)
+static void ring(SourceRoutes* _routes) {
+  for (u32 r = 0; r < 4; r++) {
+    _routes->addRouterChannel(r, 0, (r + 1) % 4);
+    _routes->addRouterChannel(r, 1, (r + 3) % 4);
+    _routes->addInterfaceChannel(r, 2, r);
+  }
+}
+
+TEST(SourceRoutes, minimal) {
+  nlohmann::json settings;
+  settings["paths"] = "minimal";
+  SourceRoutes routes(settings);
+  ring(&routes);
+  ASSERT_EQ(routes.numRouters(), 4u);
+
+  ASSERT_EQ(*routes.route(0, 0), std::vector<u32>({2}));
+  ASSERT_EQ(*routes.route(0, 1), std::vector<u32>({0, 2}));
+  ASSERT_EQ(*routes.route(0, 3), std::vector<u32>({1, 2}));
+  ASSERT_EQ(*routes.route(3, 1), std::vector<u32>({0, 0, 2}));
+
+  // paths are cached
+  ASSERT_EQ(routes.route(3, 1), routes.minimalPath(3, 1));
+}
+
+TEST(SourceRoutes, valiant) {
+  nlohmann::json settings;
+  settings["paths"] = "valiant";
+  SourceRoutes routes(settings);
+  ring(&routes);
+
+  ASSERT_EQ(*routes.valiantPath(0, 3, 1), std::vector<u32>({1, 0, 0, 2}));
+  ASSERT_EQ(*routes.valiantPath(0, 0, 2), std::vector<u32>({0, 0, 2}));
+  ASSERT_EQ(*routes.valiantPath(1, 1, 1), std::vector<u32>({2}));
+  ASSERT_EQ(routes.valiantPath(0, 3, 1), routes.valiantPath(0, 3, 1));
+}
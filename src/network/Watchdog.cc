@@ -0,0 +1,290 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/Watchdog.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+#include "event/Simulator.h"
+#include "network/Channel.h"
+#include "network/Network.h"
+#include "router/Router.h"
+
+// event types
+#define CHECK_PROGRESS (0x5D)
+
+// the number of blocked input VCs printed when no cycle is found
+static const u32 kMaxPrinted = 32;
+
+Watchdog::Watchdog(const std::string& _name, const Component* _parent,
+                   Network* _network, nlohmann::json _settings)
+    : Component(_name, _parent), network_(_network),
+      timeout_(_settings["timeout"].get<u32>()), checkPending_(false),
+      holding_(false), ejectedFlits_(0), credits_(0), lastEjectedFlits_(0),
+      lastCredits_(0) {
+  assert(timeout_ > 0);
+}
+
+Watchdog::~Watchdog() {}
+
+void Watchdog::initialize() {
+  // number the input VCs and find the input port each channel feeds
+  for (u32 id = 0, base = 0; id < network_->numRouters(); id++) {
+    Router* router = network_->getRouter(id);
+    nodeBases_.push_back(base);
+    base += router->numPorts() * router->numVcs();
+    for (u32 port = 0; port < router->numPorts(); port++) {
+      Channel* channel = router->getInputChannel(port);
+      if (channel != nullptr) {
+        channel->setWatchdog(this, false);
+        channelSinks_[channel] = std::make_tuple(id, port);
+      }
+    }
+  }
+
+  // the rest of the channels lead to interfaces
+  for (u32 id = 0; id < network_->numRouters(); id++) {
+    Router* router = network_->getRouter(id);
+    for (u32 port = 0; port < router->numPorts(); port++) {
+      Channel* channel = router->getOutputChannel(port);
+      if (channel != nullptr && channelSinks_.count(channel) == 0) {
+        channel->setWatchdog(this, true);
+      }
+    }
+  }
+}
+
+void Watchdog::processEvent(void* _event, s32 _type) {
+  switch (_type) {
+    case CHECK_PROGRESS:
+      checkPending_ = false;
+      check();
+      break;
+
+    default:
+      assert(false);
+  }
+}
+
+void Watchdog::flitArrived(bool _ejection) {
+  if (_ejection) {
+    ejectedFlits_++;
+  }
+  if (!checkPending_) {
+    scheduleCheck();
+  }
+}
+
+void Watchdog::creditArrived() {
+  credits_++;
+}
+
+std::vector<u32> Watchdog::findCycle(
+    const std::vector<std::vector<u32>>& _graph) {
+  // iterative depth first search, a node still on the stack that is reached
+  //  again closes a cycle
+  enum class Color : u8 {kWhite, kGray, kBlack};
+  std::vector<Color> color(_graph.size(), Color::kWhite);
+  std::vector<std::tuple<u32, u32>> stack;  // node, next edge
+  for (u32 root = 0; root < _graph.size(); root++) {
+    if (color.at(root) != Color::kWhite) {
+      continue;
+    }
+    color.at(root) = Color::kGray;
+    stack.push_back(std::make_tuple(root, 0));
+    while (!stack.empty()) {
+      u32 node = std::get<0>(stack.back());
+      u32& edge = std::get<1>(stack.back());
+      if (edge == _graph.at(node).size()) {
+        color.at(node) = Color::kBlack;
+        stack.pop_back();
+        continue;
+      }
+      u32 next = _graph.at(node).at(edge++);
+      if (color.at(next) == Color::kWhite) {
+        color.at(next) = Color::kGray;
+        stack.push_back(std::make_tuple(next, 0));
+      } else if (color.at(next) == Color::kGray) {
+        std::vector<u32> cycle;
+        u32 start = stack.size();
+        while (std::get<0>(stack.at(start - 1)) != next) {
+          start--;
+        }
+        for (u32 idx = start - 1; idx < stack.size(); idx++) {
+          cycle.push_back(std::get<0>(stack.at(idx)));
+        }
+        return cycle;
+      }
+    }
+  }
+  return std::vector<u32>();
+}
+
+void Watchdog::scheduleCheck() {
+  checkPending_ = true;
+  addEvent(gSim->futureCycle(Simulator::Clock::ROUTER, timeout_), 0, nullptr,
+           CHECK_PROGRESS);
+}
+
+void Watchdog::check() {
+  bool ejected = ejectedFlits_ != lastEjectedFlits_;
+  bool credited = credits_ != lastCredits_;
+  bool wasHolding = holding_;
+  lastEjectedFlits_ = ejectedFlits_;
+  lastCredits_ = credits_;
+
+  if (ejected) {
+    // the network made progress, the routers are only inspected when a check
+    //  sees no ejections. This check doesn't count as holding for livelock.
+    holding_ = false;
+    scheduleCheck();
+    return;
+  }
+
+  u32 holding = holdingVcs();
+  holding_ = holding > 0;
+  if (holding == 0) {
+    // the routers drained, the next flit restarts the checks
+    return;
+  }
+
+  if (!credited) {
+    fprintf(stderr,
+            "watchdog: deadlock, no progress in %u router cycles at time %lu, "
+            "%u input VCs hold flits\n", timeout_, gSim->time(), holding);
+    std::vector<std::vector<Wait>> waits;
+    waitGraph(&waits);
+    reportDeadlock(waits);
+    exit(-1);
+  } else if (wasHolding) {
+    fprintf(stderr,
+            "watchdog: livelock, flits moved but none were ejected in %u "
+            "router cycles at time %lu, %u input VCs hold flits\n", timeout_,
+            gSim->time(), holding);
+    exit(-1);
+  }
+  scheduleCheck();
+}
+
+u32 Watchdog::holdingVcs() const {
+  u32 holding = 0;
+  std::vector<std::tuple<u32, u32>> outputs;
+  for (u32 id = 0; id < network_->numRouters(); id++) {
+    Router* router = network_->getRouter(id);
+    for (u32 port = 0; port < router->numPorts(); port++) {
+      for (u32 vc = 0; vc < router->numVcs(); vc++) {
+        outputs.clear();
+        router->waitingFor(port, vc, &outputs);
+        if (!outputs.empty()) {
+          holding++;
+        }
+      }
+    }
+  }
+  return holding;
+}
+
+void Watchdog::waitGraph(std::vector<std::vector<Wait>>* _waits) const {
+  std::vector<std::tuple<u32, u32>> outputs;
+  for (u32 id = 0; id < network_->numRouters(); id++) {
+    Router* router = network_->getRouter(id);
+    for (u32 port = 0; port < router->numPorts(); port++) {
+      for (u32 vc = 0; vc < router->numVcs(); vc++) {
+        outputs.clear();
+        router->waitingFor(port, vc, &outputs);
+        _waits->emplace_back();
+        for (const std::tuple<u32, u32>& output : outputs) {
+          // the input VC downstream of the output VC, if it is a router's
+          Wait wait = {U32_MAX, std::get<0>(output), std::get<1>(output)};
+          if (wait.port != U32_MAX) {
+            auto it = channelSinks_.find(router->getOutputChannel(wait.port));
+            if (it != channelSinks_.end()) {
+              u32 sinkId = std::get<0>(it->second);
+              wait.node = nodeBases_.at(sinkId) +
+                          network_->getRouter(sinkId)->vcIndex(
+                              std::get<1>(it->second), wait.vc);
+            }
+          }
+          _waits->back().push_back(wait);
+        }
+      }
+    }
+  }
+}
+
+void Watchdog::printNode(u32 _node) const {
+  u32 id = 0;
+  while (id + 1 < nodeBases_.size() && nodeBases_.at(id + 1) <= _node) {
+    id++;
+  }
+  u32 port, vc;
+  network_->getRouter(id)->vcIndexInv(_node - nodeBases_.at(id), &port, &vc);
+  fprintf(stderr, "router %u port %u vc %u", id, port, vc);
+}
+
+void Watchdog::reportDeadlock(
+    const std::vector<std::vector<Wait>>& _waits) const {
+  // keep only the waits for other input VCs
+  std::vector<std::vector<u32>> graph(_waits.size());
+  for (u32 node = 0; node < _waits.size(); node++) {
+    for (const Wait& wait : _waits.at(node)) {
+      if (wait.node != U32_MAX) {
+        graph.at(node).push_back(wait.node);
+      }
+    }
+  }
+
+  std::vector<u32> cycle = findCycle(graph);
+  if (!cycle.empty()) {
+    fprintf(stderr, "wait-for cycle of %lu input VCs:\n", cycle.size());
+    for (u32 idx = 0; idx < cycle.size(); idx++) {
+      u32 node = cycle.at(idx);
+      u32 next = cycle.at((idx + 1) % cycle.size());
+      for (const Wait& wait : _waits.at(node)) {
+        if (wait.node == next) {
+          fprintf(stderr, "  ");
+          printNode(node);
+          fprintf(stderr, " -> output port %u vc %u -> ", wait.port, wait.vc);
+          printNode(next);
+          fprintf(stderr, "\n");
+          break;
+        }
+      }
+    }
+    return;
+  }
+
+  // without a cycle, print what the blocked input VCs wait for
+  fprintf(stderr, "no wait-for cycle found, blocked input VCs:\n");
+  u32 printed = 0;
+  for (u32 node = 0; node < _waits.size() && printed < kMaxPrinted; node++) {
+    if (_waits.at(node).empty()) {
+      continue;
+    }
+    fprintf(stderr, "  ");
+    printNode(node);
+    fprintf(stderr, " ->");
+    for (const Wait& wait : _waits.at(node)) {
+      if (wait.port == U32_MAX) {
+        fprintf(stderr, " (not routed)");
+      } else {
+        fprintf(stderr, " (port %u vc %u)", wait.port, wait.vc);
+      }
+    }
+    fprintf(stderr, "\n");
+    printed++;
+  }
+}
@@ -0,0 +1,97 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_WATCHDOG_H_
+#define NETWORK_WATCHDOG_H_
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+class Channel;
+class Network;
+
+/*
+ * This watches a network for forward progress and aborts the simulation when
+ *  it stops. Progress is counted as flits ejected to interfaces and credits
+ *  returned over channels. While routers hold flits, the network is checked
+ *  every "timeout" router cycles. A check that sees ejected flits only counts
+ *  them, the routers are inspected when no flit was ejected:
+ *   - if no credit moved either, the network is deadlocked. A wait-for graph
+ *     between input VCs is built from each router's queue and VC state (see
+ *     Router::waitingFor()) and a cycle in it is printed.
+ *   - if credits moved while routers held flits at two checks in a row
+ *     without ejections, the network is livelocked.
+ *  Checks stop when the routers are empty and resume with the next flit, so
+ *  the watchdog doesn't keep a finished simulation alive.
+ */
+class Watchdog : public Component {
+ public:
+  Watchdog(const std::string& _name, const Component* _parent,
+           Network* _network, nlohmann::json _settings);
+  ~Watchdog();
+
+  // this attaches the watchdog to the network's channels
+  void initialize() override;
+
+  void processEvent(void* _event, s32 _type) override;
+
+  // these are called by the watched channels
+  void flitArrived(bool _ejection);
+  void creditArrived();
+
+  // this returns the nodes of a cycle in a directed graph, each node is
+  //  followed by the one it waits for. It is empty if the graph is acyclic.
+  static std::vector<u32> findCycle(
+      const std::vector<std::vector<u32>>& _graph);
+
+ private:
+  struct Wait {
+    u32 node;  // U32_MAX if not another router's input VC
+    u32 port;
+    u32 vc;
+  };
+
+  void scheduleCheck();
+  void check();
+
+  // this returns the number of input VCs holding flits
+  u32 holdingVcs() const;
+
+  // this builds the wait-for graph between the input VCs
+  void waitGraph(std::vector<std::vector<Wait>>* _waits) const;
+  void printNode(u32 _node) const;
+  void reportDeadlock(const std::vector<std::vector<Wait>>& _waits) const;
+
+  Network* network_;
+  const u32 timeout_;
+
+  // input VCs of all routers are numbered from the routers' bases
+  std::vector<u32> nodeBases_;  // [router]
+  std::unordered_map<const Channel*, std::tuple<u32, u32>> channelSinks_;
+
+  bool checkPending_;
+  bool holding_;  // routers held flits at the last check, without ejections
+  u64 ejectedFlits_;
+  u64 credits_;
+  u64 lastEjectedFlits_;
+  u64 lastCredits_;
+};
+
+#endif  // NETWORK_WATCHDOG_H_
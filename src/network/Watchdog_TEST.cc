@@ -0,0 +1,45 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/Watchdog.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(Watchdog, acyclic) {
+  // a chain and a diamond
+  ASSERT_TRUE(Watchdog::findCycle({}).empty());
+  ASSERT_TRUE(Watchdog::findCycle({{1}, {2}, {}}).empty());
+  ASSERT_TRUE(Watchdog::findCycle({{1, 2}, {3}, {3}, {}}).empty());
+}
+
+TEST(Watchdog, cycle) {
+  // a self wait
+  ASSERT_EQ(Watchdog::findCycle({{}, {1}}), std::vector<u32>({1}));
+
+  // 0 leads into the cycle 1 -> 3 -> 2 -> 1 but isn't part of it
+  std::vector<std::vector<u32>> graph = {{1}, {3}, {1}, {4, 2}, {}};
+  ASSERT_EQ(Watchdog::findCycle(graph), std::vector<u32>({1, 3, 2}));
+
+  // each node is followed by the one it waits for
+  graph = {{}, {}, {5}, {}, {2}, {4}};
+  std::vector<u32> cycle = Watchdog::findCycle(graph);
+  ASSERT_EQ(cycle.size(), 3u);
+  for (u32 idx = 0; idx < cycle.size(); idx++) {
+    const std::vector<u32>& waits = graph.at(cycle.at(idx));
+    ASSERT_EQ(waits.at(0), cycle.at((idx + 1) % cycle.size()));
+  }
+}
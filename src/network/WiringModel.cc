@@ -0,0 +1,193 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/WiringModel.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "fio/InFile.h"
+#include "strop/strop.h"
+
+WiringModel::WiringModel(nlohmann::json _settings)
+    : numLinks_(0), totalLength_(0.0), totalEnergy_(0.0), totalCost_(0.0),
+      outFile_(nullptr) {
+  // router placement
+  assert(_settings.contains("layout"));
+  const std::string& layout = _settings["layout"].get<std::string>();
+  if (layout == "cabinets") {
+    fileLayout_ = false;
+    routersPerCabinet_ = _settings["routers_per_cabinet"].get<u32>();
+    cabinetsPerRow_ = _settings["cabinets_per_row"].get<u32>();
+    cabinetWidth_ = _settings["cabinet_width"].get<f64>();
+    rowPitch_ = _settings["row_pitch"].get<f64>();
+    assert(routersPerCabinet_ > 0);
+    assert(cabinetsPerRow_ > 0);
+    assert(cabinetWidth_ >= 0.0);
+    assert(rowPitch_ >= 0.0);
+  } else if (layout == "file") {
+    fileLayout_ = true;
+    routersPerCabinet_ = 0;
+    cabinetsPerRow_ = 0;
+    cabinetWidth_ = 0.0;
+    rowPitch_ = 0.0;
+    loadLayoutFile(_settings["layout_file"].get<std::string>());
+  } else {
+    fprintf(stderr, "unknown wiring layout: %s\n", layout.c_str());
+    assert(false);
+  }
+
+  // cabling
+  intraCabinetLength_ = _settings["intra_cabinet_length"].get<f64>();
+  cableOverhead_ = _settings["cable_overhead"].get<f64>();
+  copperMaxLength_ = _settings["copper_max_length"].get<f64>();
+  assert(intraCabinetLength_ >= 0.0);
+  assert(cableOverhead_ >= 0.0);
+  assert(copperMaxLength_ >= 0.0);
+  media_[static_cast<u8>(Medium::COPPER)] = parseMedium(_settings["copper"]);
+  media_[static_cast<u8>(Medium::OPTICAL)] = parseMedium(_settings["optical"]);
+
+  // link log
+  if (_settings.contains("file") && !_settings["file"].is_null()) {
+    outFile_ = new fio::OutFile(_settings["file"].get<std::string>());
+    ss_.precision(6);
+    ss_.setf(std::ios::fixed, std::ios::floatfield);
+    ss_ << "name,source,destination,length,medium,latency,energy,cost"
+        << std::endl;
+    outFile_->write(ss_.str());
+    ss_.str("");
+    ss_.clear();
+  }
+}
+
+WiringModel::~WiringModel() {
+  if (outFile_) {
+    delete outFile_;
+  }
+}
+
+WiringModel::Link WiringModel::link(u32 _sourceRouterId,
+                                    u32 _destinationRouterId) const {
+  Position source = position(_sourceRouterId);
+  Position destination = position(_destinationRouterId);
+
+  Link link;
+  if (source.cabinet == destination.cabinet) {
+    link.length = intraCabinetLength_;
+  } else {
+    link.length = std::fabs(source.x - destination.x) +
+                  std::fabs(source.y - destination.y) + cableOverhead_;
+  }
+  link.medium = (link.length <= copperMaxLength_) ? Medium::COPPER :
+                Medium::OPTICAL;
+
+  const MediumInfo& info = media_[static_cast<u8>(link.medium)];
+  link.latency = info.latencyOverhead +
+                 (u32)std::ceil(info.latencyPerMeter * link.length);
+  if (link.latency == 0) {
+    link.latency = 1;  // channels must have some latency
+  }
+  link.energy = info.energyOverhead + (info.energyPerMeter * link.length);
+  link.cost = info.costOverhead + (info.costPerMeter * link.length);
+  return link;
+}
+
+u32 WiringModel::addLink(const std::string& _name, u32 _sourceRouterId,
+                         u32 _destinationRouterId) {
+  Link link = this->link(_sourceRouterId, _destinationRouterId);
+  numLinks_++;
+  totalLength_ += link.length;
+  totalEnergy_ += link.energy;
+  totalCost_ += link.cost;
+
+  if (outFile_) {
+    ss_ << _name << ',' << _sourceRouterId << ',' << _destinationRouterId
+        << ',' << link.length << ','
+        << (link.medium == Medium::COPPER ? "copper" : "optical") << ','
+        << link.latency << ',' << link.energy << ',' << link.cost
+        << std::endl;
+    outFile_->write(ss_.str());
+    ss_.str("");
+    ss_.clear();
+  }
+  return link.latency;
+}
+
+u32 WiringModel::numLinks() const {
+  return numLinks_;
+}
+
+f64 WiringModel::totalLength() const {
+  return totalLength_;
+}
+
+f64 WiringModel::totalEnergy() const {
+  return totalEnergy_;
+}
+
+f64 WiringModel::totalCost() const {
+  return totalCost_;
+}
+
+WiringModel::MediumInfo WiringModel::parseMedium(nlohmann::json _settings) {
+  MediumInfo info;
+  info.latencyPerMeter = _settings["latency_per_meter"].get<f64>();
+  info.latencyOverhead = _settings["latency_overhead"].get<u32>();
+  info.energyPerMeter = _settings["energy_per_meter"].get<f64>();
+  info.energyOverhead = _settings["energy_overhead"].get<f64>();
+  info.costPerMeter = _settings["cost_per_meter"].get<f64>();
+  info.costOverhead = _settings["cost_overhead"].get<f64>();
+  assert(info.latencyPerMeter >= 0.0);
+  assert(info.energyPerMeter >= 0.0);
+  assert(info.energyOverhead >= 0.0);
+  assert(info.costPerMeter >= 0.0);
+  assert(info.costOverhead >= 0.0);
+  return info;
+}
+
+void WiringModel::loadLayoutFile(const std::string& _filename) {
+  fio::InFile inf(_filename);
+  fio::InFile::Status sts = fio::InFile::Status::OK;
+  while (sts == fio::InFile::Status::OK) {
+    std::string line;
+    sts = inf.getLine(&line);
+    assert(sts != fio::InFile::Status::ERROR);
+    if (sts == fio::InFile::Status::OK && line.size() > 0 && line[0] != '#') {
+      std::vector<std::string> strs = strop::split(line, ',');
+      assert(strs.size() == 4);
+      u32 id = std::stoul(strs.at(0));
+      if (id >= positions_.size()) {
+        positions_.resize(id + 1, {U32_MAX, 0.0, 0.0});
+      }
+      assert(positions_.at(id).cabinet == U32_MAX);  // no duplicates
+      positions_.at(id).cabinet = std::stoul(strs.at(1));
+      positions_.at(id).x = std::stod(strs.at(2));
+      positions_.at(id).y = std::stod(strs.at(3));
+    }
+  }
+}
+
+WiringModel::Position WiringModel::position(u32 _routerId) const {
+  if (fileLayout_) {
+    assert(_routerId < positions_.size());
+    assert(positions_[_routerId].cabinet != U32_MAX);
+    return positions_[_routerId];
+  }
+
+  Position pos;
+  pos.cabinet = _routerId / routersPerCabinet_;
+  pos.x = (pos.cabinet % cabinetsPerRow_) * cabinetWidth_;
+  pos.y = (pos.cabinet / cabinetsPerRow_) * rowPitch_;
+  return pos;
+}
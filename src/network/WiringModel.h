@@ -0,0 +1,119 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_WIRINGMODEL_H_
+#define NETWORK_WIRINGMODEL_H_
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "fio/OutFile.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+/*
+ * This models the physical wiring of a network. Routers are placed into
+ *  cabinets on a machine room floor and each router-to-router link is given a
+ *  cable length, a medium (copper or optical), a latency, an energy, and a
+ *  cost. Networks use the latency in place of the configured channel latency.
+ *
+ * Placement is either generated or read from a file:
+ *  "layout": "cabinets" places routers by ID, "routers_per_cabinet" to a
+ *    cabinet and "cabinets_per_row" cabinets to a row. Cabinets are
+ *    "cabinet_width" meters wide and rows are "row_pitch" meters apart.
+ *  "layout": "file" reads "layout_file", a csv of "id,cabinet,x,y" lines.
+ *
+ * Links within a cabinet have length "intra_cabinet_length". Links between
+ *  cabinets follow the rectilinear distance between cabinets plus
+ *  "cable_overhead" meters of slack for routing in and out of the cabinets.
+ *  Links no longer than "copper_max_length" use the "copper" medium, the
+ *  others use the "optical" medium. Each medium is described by:
+ *    "latency_per_meter", "latency_overhead": channel cycles
+ *    "energy_per_meter", "energy_overhead": energy per flit
+ *    "cost_per_meter", "cost_overhead": cost per cable
+ *
+ * If "file" is given, each link is logged as
+ *  "name,source,destination,length,medium,latency,energy,cost".
+ */
+class WiringModel {
+ public:
+  enum class Medium : u8 {COPPER = 0, OPTICAL = 1};
+
+  struct Link {
+    f64 length;
+    Medium medium;
+    u32 latency;
+    f64 energy;
+    f64 cost;
+  };
+
+  explicit WiringModel(nlohmann::json _settings);
+  ~WiringModel();
+
+  // this returns the physical properties of a link between two routers
+  Link link(u32 _sourceRouterId, u32 _destinationRouterId) const;
+
+  // this computes, logs, and accumulates a link, then returns its latency
+  u32 addLink(const std::string& _name, u32 _sourceRouterId,
+              u32 _destinationRouterId);
+
+  // these are the sums over all added links
+  u32 numLinks() const;
+  f64 totalLength() const;
+  f64 totalEnergy() const;
+  f64 totalCost() const;
+
+ private:
+  struct MediumInfo {
+    f64 latencyPerMeter;
+    u32 latencyOverhead;
+    f64 energyPerMeter;
+    f64 energyOverhead;
+    f64 costPerMeter;
+    f64 costOverhead;
+  };
+
+  struct Position {
+    u32 cabinet;
+    f64 x;
+    f64 y;
+  };
+
+  static MediumInfo parseMedium(nlohmann::json _settings);
+  void loadLayoutFile(const std::string& _filename);
+  Position position(u32 _routerId) const;
+
+  bool fileLayout_;
+  u32 routersPerCabinet_;
+  u32 cabinetsPerRow_;
+  f64 cabinetWidth_;
+  f64 rowPitch_;
+  std::vector<Position> positions_;  // only used with a layout file
+
+  f64 intraCabinetLength_;
+  f64 cableOverhead_;
+  f64 copperMaxLength_;
+  MediumInfo media_[2];
+
+  u32 numLinks_;
+  f64 totalLength_;
+  f64 totalEnergy_;
+  f64 totalCost_;
+
+  fio::OutFile* outFile_;
+  std::stringstream ss_;
+};
+
+#endif  // NETWORK_WIRINGMODEL_H_
@@ -0,0 +1,90 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/WiringModel.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+static nlohmann::json wiringSettings() {
+  nlohmann::json settings;
+  settings["layout"] = "cabinets";
+  settings["routers_per_cabinet"] = 4;
+  settings["cabinets_per_row"] = 3;
+  settings["cabinet_width"] = 1.0;
+  settings["row_pitch"] = 4.0;
+  settings["intra_cabinet_length"] = 0.5;
+  settings["cable_overhead"] = 2.0;
+  settings["copper_max_length"] = 4.0;
+  settings["copper"]["latency_per_meter"] = 1.0;
+  settings["copper"]["latency_overhead"] = 0;
+  settings["copper"]["energy_per_meter"] = 2.0;
+  settings["copper"]["energy_overhead"] = 0.0;
+  settings["copper"]["cost_per_meter"] = 1.0;
+  settings["copper"]["cost_overhead"] = 5.0;
+  settings["optical"]["latency_per_meter"] = 0.5;
+  settings["optical"]["latency_overhead"] = 3;
+  settings["optical"]["energy_per_meter"] = 0.0;
+  settings["optical"]["energy_overhead"] = 10.0;
+  settings["optical"]["cost_per_meter"] = 2.0;
+  settings["optical"]["cost_overhead"] = 50.0;
+  return settings;
+}
+
+TEST(WiringModel, cabinets) {
+  WiringModel wiring(wiringSettings());
+
+  // same cabinet
+  WiringModel::Link link = wiring.link(1, 3);
+  ASSERT_DOUBLE_EQ(link.length, 0.5);
+  ASSERT_EQ(link.medium, WiringModel::Medium::COPPER);
+  ASSERT_EQ(link.latency, 1u);
+  ASSERT_DOUBLE_EQ(link.energy, 1.0);
+  ASSERT_DOUBLE_EQ(link.cost, 5.5);
+
+  // neighboring cabinets in a row
+  link = wiring.link(0, 4);
+  ASSERT_DOUBLE_EQ(link.length, 3.0);
+  ASSERT_EQ(link.medium, WiringModel::Medium::COPPER);
+  ASSERT_EQ(link.latency, 3u);
+  ASSERT_DOUBLE_EQ(link.energy, 6.0);
+  ASSERT_DOUBLE_EQ(link.cost, 8.0);
+
+  // cabinet 0 to cabinet 5 (second row, last column)
+  link = wiring.link(2, 21);
+  ASSERT_DOUBLE_EQ(link.length, 2.0 + 4.0 + 2.0);
+  ASSERT_EQ(link.medium, WiringModel::Medium::OPTICAL);
+  ASSERT_EQ(link.latency, 7u);
+  ASSERT_DOUBLE_EQ(link.energy, 10.0);
+  ASSERT_DOUBLE_EQ(link.cost, 66.0);
+
+  // links are symmetric
+  WiringModel::Link back = wiring.link(21, 2);
+  ASSERT_DOUBLE_EQ(back.length, link.length);
+  ASSERT_EQ(back.latency, link.latency);
+}
+
+TEST(WiringModel, totals) {
+  WiringModel wiring(wiringSettings());
+  ASSERT_EQ(wiring.numLinks(), 0u);
+
+  ASSERT_EQ(wiring.addLink("a", 1, 3), 1u);
+  ASSERT_EQ(wiring.addLink("b", 0, 4), 3u);
+  ASSERT_EQ(wiring.addLink("c", 2, 21), 7u);
+  ASSERT_EQ(wiring.numLinks(), 3u);
+  ASSERT_DOUBLE_EQ(wiring.totalLength(), 0.5 + 3.0 + 8.0);
+  ASSERT_DOUBLE_EQ(wiring.totalEnergy(), 1.0 + 6.0 + 10.0);
+  ASSERT_DOUBLE_EQ(wiring.totalCost(), 5.5 + 8.0 + 66.0);
+}
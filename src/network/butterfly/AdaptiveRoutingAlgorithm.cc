@@ -0,0 +1,85 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/butterfly/AdaptiveRoutingAlgorithm.h"
+
+#include <cassert>
+#include <tuple>
+#include <unordered_set>
+
+#include "factory/ObjectFactory.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace Butterfly {
+
+AdaptiveRoutingAlgorithm::AdaptiveRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _numPorts,
+    u32 _numStages, u32 _interfacePorts, u32 _stage, u32 _extraStages,
+    const std::vector<std::vector<u32>>* _stagePorts, nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _numPorts, _numStages, _interfacePorts, _stage,
+                       _extraStages, _stagePorts, _settings),
+      mode_(parseRoutingMode(_settings["mode"].get<std::string>())) {
+  // create the reduction
+  reduction_ = Reduction::create("Reduction", this, _router, mode_, false,
+                                 _settings["reduction"]);
+}
+
+AdaptiveRoutingAlgorithm::~AdaptiveRoutingAlgorithm() {
+  delete reduction_;
+}
+
+void AdaptiveRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  const Address* destinationAddress =
+      _flit->packet()->message()->getDestinationAddress();
+
+  // every candidate has the same number of remaining hops
+  u32 hops = numStages_ + extraStages_ - stage_;
+  for (u32 port : candidatePorts(destinationAddress)) {
+    if (routingModeIsPort(mode_)) {
+      f64 cong = portCongestion(mode_, router_, inputPort_, inputVc_, port);
+      reduction_->add(port, U32_MAX, hops, cong);
+    } else {
+      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+        f64 cong = router_->congestionStatus(inputPort_, inputVc_, port, vc);
+        reduction_->add(port, vc, hops, cong);
+      }
+    }
+  }
+
+  // reduction phase
+  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+      reduction_->reduce(nullptr);
+  for (const auto& t : *outputs) {
+    u32 port = std::get<0>(t);
+    u32 vc = std::get<1>(t);
+    if (vc == U32_MAX) {
+      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+        _response->add(port, vc);
+      }
+    } else {
+      _response->add(port, vc);
+    }
+  }
+}
+
+}  // namespace Butterfly
+
+registerWithObjectFactory("adaptive", Butterfly::RoutingAlgorithm,
+                          Butterfly::AdaptiveRoutingAlgorithm,
+                          BUTTERFLY_ROUTINGALGORITHM_ARGS);
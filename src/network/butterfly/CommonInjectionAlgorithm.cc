@@ -23,19 +23,14 @@ CommonInjectionAlgorithm::CommonInjectionAlgorithm(
     const std::string& _name, const Component* _parent, Interface* _interface,
     u32 _baseVc, u32 _numVcs, u32 _inputPc, nlohmann::json _settings)
     : InjectionAlgorithm(_name, _parent, _interface, _baseVc, _numVcs, _inputPc,
-                         _settings) {
-  assert(_settings.contains("adaptive"));
-  adaptive_ = _settings["adaptive"].get<bool>();
-
-  assert(_settings.contains("fixed_msg_vc"));
-  fixedMsgVc_ = _settings["fixed_msg_vc"].get<bool>();
-}
+                         _settings),
+      settings_(Common::parseInjectionSettings(_settings)) {}
 
 CommonInjectionAlgorithm::~CommonInjectionAlgorithm() {}
 
 void CommonInjectionAlgorithm::processMessage(Message* _message) {
-  Common::injection(interface_, this, baseVc_, numVcs_, adaptive_, fixedMsgVc_,
-                    _message);
+  Common::commonInjection(interface_, this, baseVc_, numVcs_, settings_,
+                          _message);
 }
 
 }  // namespace Butterfly
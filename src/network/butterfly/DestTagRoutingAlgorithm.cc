@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -25,31 +26,22 @@ namespace Butterfly {
 DestTagRoutingAlgorithm::DestTagRoutingAlgorithm(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _numPorts,
-    u32 _numStages, u32 _interfacePorts, u32 _stage, nlohmann::json _settings)
+    u32 _numStages, u32 _interfacePorts, u32 _stage, u32 _extraStages,
+    const std::vector<std::vector<u32>>* _stagePorts, nlohmann::json _settings)
     : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                        _inputVc, _numPorts, _numStages, _interfacePorts, _stage,
-                       _settings) {}
+                       _extraStages, _stagePorts, _settings) {}
 
 DestTagRoutingAlgorithm::~DestTagRoutingAlgorithm() {}
 
 void DestTagRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   assert(destinationAddress->size() == numStages_);
 
-  std::vector<u32> outputPorts;
-  if (stage_ != numStages_ - 1) {
-    // pick the output port using the "tag" in the address
-    outputPorts.push_back(destinationAddress->at(stage_));
-  } else {
-    // use the tag
-    u32 basePort = destinationAddress->at(stage_) * interfacePorts_;
-    for (u32 offset = 0; offset < interfacePorts_; offset++) {
-      u32 port = basePort + offset;
-      outputPorts.push_back(port);
-    }
-  }
+  // the tag selects the output ports, extra stages may use any port
+  const std::vector<u32>& outputPorts = candidatePorts(destinationAddress);
 
   // select all VCs in the output ports
   for (u32 port : outputPorts) {
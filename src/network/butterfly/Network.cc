@@ -39,12 +39,31 @@ Network::Network(const std::string& _name, const Component* _parent,
   assert(interfacePorts_ > 0);
   assert(routerRadix_ % interfacePorts_ == 0);
 
+  // path diversity: extra randomizing stages in front of the destination tag
+  //  stages and parallel channels between routers
+  extraStages_ = 0;
+  if (_settings.contains("extra_stages")) {
+    extraStages_ = _settings["extra_stages"].get<u32>();
+  }
+  assert(extraStages_ == 0 || numStages_ >= 2);
+  dilation_ = 1;
+  if (_settings.contains("dilation")) {
+    dilation_ = _settings["dilation"].get<u32>();
+  }
+  assert(dilation_ >= 1);
+  u32 totalStages = numStages_ + extraStages_;
+  u32 routerPorts = routerRadix_ * dilation_;
+
+  // the routing tables are used while the routers are created
+  computeStagePorts(routerRadix_, numStages_, extraStages_, dilation_,
+                    interfacePorts_, &stagePorts_);
+
   // parse the protocol classes description
   loadProtocolClassInfo(_settings["protocol_classes"]);
 
   // create the routers
-  routers_.resize(stageWidth_ * numStages_, nullptr);
-  for (u32 stage = 0; stage < numStages_; stage++) {
+  routers_.resize(stageWidth_ * totalStages, nullptr);
+  for (u32 stage = 0; stage < totalStages; stage++) {
     tmpStage_ = stage;
     for (u32 column = 0; column < stageWidth_; column++) {
       // create the router name
@@ -54,39 +73,48 @@ Network::Network(const std::string& _name, const Component* _parent,
       // create the router
       u32 routerId = stage * stageWidth_ + column;
       routers_.at(routerId) = Router::create(
-          rname, this, this, routerId, {stage, column}, routerRadix_, numVcs_,
+          rname, this, this, routerId, {stage, column}, routerPorts, numVcs_,
           _metadataHandler, _settings["router"]);
     }
   }
 
   // create internal channels, link routers via channels
-  for (u32 cStage = 0; cStage < numStages_ - 1; cStage++) {
-    u32 cBaseUnit = (u32)pow(routerRadix_, numStages_ - 1 - cStage);
+  //  each link stage replaces one column digit with the output port and the
+  //  replaced digit becomes the input port
+  for (u32 cStage = 0; cStage + 1 < totalStages; cStage++) {
+    u32 digit = computeLinkDigit(numStages_, extraStages_, cStage);
+    u32 unit = (u32)pow(routerRadix_, digit);
     u32 nStage = cStage + 1;
-    u32 nBaseUnit = (u32)pow(routerRadix_, numStages_ - 1 - nStage);
     for (u32 cColumn = 0; cColumn < stageWidth_; cColumn++) {
       u32 sourceId = cStage * stageWidth_ + cColumn;
       Router* sourceRouter = routers_.at(sourceId);
-      u32 cBaseOffset = (cColumn / cBaseUnit) * cBaseUnit;
-      u32 cBaseIndex = cColumn % cBaseUnit;
+      u32 cDigit = (cColumn / unit) % routerRadix_;
+      u32 cBase = cColumn - (cDigit * unit);
       for (u32 cOutputPort = 0; cOutputPort < routerRadix_; cOutputPort++) {
-        u32 nColumn =
-            cBaseOffset + (cBaseIndex % nBaseUnit) + (cOutputPort * nBaseUnit);
+        u32 nColumn = cBase + (cOutputPort * unit);
         u32 destinationId = nStage * stageWidth_ + nColumn;
         Router* destinationRouter = routers_.at(destinationId);
-        u32 nInputPort = cBaseIndex / nBaseUnit;  // cBaseIndex / routerRadix_;
-
-        // create channel
-        std::string chname =
-            "Channel_" + strop::vecString<u32>(sourceRouter->address(), '-') +
-            "-to-" + strop::vecString<u32>(destinationRouter->address(), '-');
-        Channel* channel =
-            new Channel(chname, this, numVcs_, _settings["internal_channel"]);
-        internalChannels_.push_back(channel);
-
-        // connect routers
-        sourceRouter->setOutputChannel(cOutputPort, channel);
-        destinationRouter->setInputChannel(nInputPort, channel);
+        u32 nInputPort = cDigit;
+
+        for (u32 copy = 0; copy < dilation_; copy++) {
+          // create channel
+          std::string chname =
+              "Channel_" + sourceRouter->address().toString('-') +
+              "-to-" + destinationRouter->address().toString('-');
+          if (dilation_ > 1) {
+            chname += "_" + std::to_string(copy);
+          }
+          Channel* channel =
+              createRouterChannel(chname, sourceRouter, destinationRouter,
+                                  _settings["internal_channel"]);
+          internalChannels_.push_back(channel);
+
+          // connect routers
+          sourceRouter->setOutputChannel((cOutputPort * dilation_) + copy,
+                                         channel);
+          destinationRouter->setInputChannel((nInputPort * dilation_) + copy,
+                                             channel);
+        }
       }
     }
   }
@@ -98,7 +126,7 @@ Network::Network(const std::string& _name, const Component* _parent,
   for (u32 r = 0, interfaceId = 0; r < stageWidth_; r++) {
     // get the routers
     u32 inputRouterId = 0 * stageWidth_ + r;
-    u32 outputRouterId = (numStages_ - 1) * stageWidth_ + r;
+    u32 outputRouterId = (totalStages - 1) * stageWidth_ + r;
     Router* inputRouter = routers_.at(inputRouterId);
     Router* outputRouter = routers_.at(outputRouterId);
 
@@ -106,7 +134,7 @@ Network::Network(const std::string& _name, const Component* _parent,
     for (u32 iface = 0; iface < interfacesPerRouter; iface++, interfaceId++) {
       // create the interface
       std::string interfaceName = "Interface_" + std::to_string(interfaceId);
-      std::vector<u32> interfaceAddress;
+      Address interfaceAddress;
       translateInterfaceIdToAddress(interfaceId, &interfaceAddress);
       Interface* interface = Interface::create(
           interfaceName, this, this, interfaceId, interfaceAddress,
@@ -188,11 +216,12 @@ Network::~Network() {
   return RoutingAlgorithm::create(_name, _parent, _router, settings.baseVc,
                                   settings.numVcs, _inputPort, _inputVc,
                                   routerRadix_, numStages_, interfacePorts_,
-                                  tmpStage_, settings.routing);
+                                  tmpStage_, extraStages_, &stagePorts_,
+                                  settings.routing);
 }
 
 u32 Network::numRouters() const {
-  return stageWidth_ * numStages_;
+  return stageWidth_ * (numStages_ + extraStages_);
 }
 
 u32 Network::numInterfaces() const {
@@ -208,32 +237,32 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   Butterfly::translateInterfaceIdToAddress(
       routerRadix_, numStages_, stageWidth_, interfacePorts_, _id, _address);
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Butterfly::translateInterfaceAddressToId(
       routerRadix_, numStages_, stageWidth_, interfacePorts_, _address);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   Butterfly::translateRouterIdToAddress(routerRadix_, numStages_, stageWidth_,
                                         _id, _address);
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Butterfly::translateRouterAddressToId(routerRadix_, numStages_,
                                                stageWidth_, _address);
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
-  return Butterfly::computeMinimalHops(numStages_);
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
+  return Butterfly::computeMinimalHops(numStages_ + extraStages_);
 }
 
 void Network::collectChannels(std::vector<Channel*>* _channels) {
@@ -25,6 +25,7 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "types/Address.h"
 
 namespace Butterfly {
 
@@ -51,15 +52,15 @@ class Network : public ::Network {
   Router* getRouter(u32 _id) const override;
   Interface* getInterface(u32 _id) const override;
   void translateInterfaceIdToAddress(u32 _id,
-                                     std::vector<u32>* _address) const override;
+                                     Address* _address) const override;
   u32 translateInterfaceAddressToId(
-      const std::vector<u32>* _address) const override;
+      const Address* _address) const override;
   void translateRouterIdToAddress(u32 _id,
-                                  std::vector<u32>* _address) const override;
+                                  Address* _address) const override;
   u32 translateRouterAddressToId(
-      const std::vector<u32>* _address) const override;
-  u32 computeMinimalHops(const std::vector<u32>* _source,
-                         const std::vector<u32>* _destination) const override;
+      const Address* _address) const override;
+  u32 computeMinimalHops(const Address* _source,
+                         const Address* _destination) const override;
 
  protected:
   void collectChannels(std::vector<Channel*>* _channels) override;
@@ -67,9 +68,12 @@ class Network : public ::Network {
  private:
   u32 routerRadix_;
   u32 numStages_;
+  u32 extraStages_;
+  u32 dilation_;
   u32 stageWidth_;
   u32 interfacePorts_;
   u32 tmpStage_;
+  std::vector<std::vector<u32>> stagePorts_;
 
   std::vector<Router*> routers_;
   std::vector<Interface*> interfaces_;
@@ -0,0 +1,55 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/butterfly/RandomRoutingAlgorithm.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace Butterfly {
+
+RandomRoutingAlgorithm::RandomRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _numPorts,
+    u32 _numStages, u32 _interfacePorts, u32 _stage, u32 _extraStages,
+    const std::vector<std::vector<u32>>* _stagePorts, nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _numPorts, _numStages, _interfacePorts, _stage,
+                       _extraStages, _stagePorts, _settings) {}
+
+RandomRoutingAlgorithm::~RandomRoutingAlgorithm() {}
+
+void RandomRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  const Address* destinationAddress =
+      _flit->packet()->message()->getDestinationAddress();
+
+  // pick one candidate port, select all VCs in it
+  const std::vector<u32>& ports = candidatePorts(destinationAddress);
+  assert(!ports.empty());
+  u32 port = ports.at(gSim->rnd.nextU64(0, ports.size() - 1));
+  for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+    _response->add(port, vc);
+  }
+}
+
+}  // namespace Butterfly
+
+registerWithObjectFactory("random", Butterfly::RoutingAlgorithm,
+                          Butterfly::RandomRoutingAlgorithm,
+                          BUTTERFLY_ROUTINGALGORITHM_ARGS);
@@ -0,0 +1,49 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_BUTTERFLY_RANDOMROUTINGALGORITHM_H_
+#define NETWORK_BUTTERFLY_RANDOMROUTINGALGORITHM_H_
+
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "network/butterfly/RoutingAlgorithm.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+
+namespace Butterfly {
+
+// this chooses one of the candidate ports of each stage uniformly at random,
+//  spreading traffic obliviously over the extra stages and dilated channels
+class RandomRoutingAlgorithm : public RoutingAlgorithm {
+ public:
+  RandomRoutingAlgorithm(const std::string& _name, const Component* _parent,
+                         Router* _router, u32 _baseVc, u32 _numVcs,
+                         u32 _inputPort, u32 _inputVc, u32 _numPorts,
+                         u32 _numStages, u32 _interfacePorts, u32 _stage,
+                         u32 _extraStages,
+                         const std::vector<std::vector<u32>>* _stagePorts,
+                         nlohmann::json _settings);
+  ~RandomRoutingAlgorithm();
+
+ protected:
+  void processRequest(Flit* _flit,
+                      RoutingAlgorithm::Response* _response) override;
+};
+
+}  // namespace Butterfly
+
+#endif  // NETWORK_BUTTERFLY_RANDOMROUTINGALGORITHM_H_
@@ -20,25 +20,28 @@
 
 namespace Butterfly {
 
-RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
-                                   const Component* _parent, Router* _router,
-                                   u32 _baseVc, u32 _numVcs, u32 _inputPort,
-                                   u32 _inputVc, u32 _numPorts, u32 _numStages,
-                                   u32 _interfacePorts, u32 _stage,
-                                   nlohmann::json _settings)
+RoutingAlgorithm::RoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _numPorts,
+    u32 _numStages, u32 _interfacePorts, u32 _stage, u32 _extraStages,
+    const std::vector<std::vector<u32>>* _stagePorts, nlohmann::json _settings)
     : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
                          _inputVc, _settings),
       numPorts_(_numPorts),
       numStages_(_numStages),
       interfacePorts_(_interfacePorts),
-      stage_(_stage) {}
+      stage_(_stage),
+      extraStages_(_extraStages),
+      stagePorts_(_stagePorts) {}
 
 RoutingAlgorithm::~RoutingAlgorithm() {}
 
 RoutingAlgorithm* RoutingAlgorithm::create(
     const std::string& _name, const Component* _parent, Router* _router,
     u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _numPorts,
-    u32 _numStages, u32 _interfacePorts, u32 _stage, nlohmann::json _settings) {
+    u32 _numStages, u32 _interfacePorts, u32 _stage, u32 _extraStages,
+    const std::vector<std::vector<u32>>* _stagePorts,
+    nlohmann::json _settings) {
   // retrieve the algorithm
   const std::string& algorithm = _settings["algorithm"].get<std::string>();
 
@@ -46,7 +49,8 @@ RoutingAlgorithm* RoutingAlgorithm::create(
   RoutingAlgorithm* ra = factory::
       ObjectFactory<RoutingAlgorithm, BUTTERFLY_ROUTINGALGORITHM_ARGS>::create(
           algorithm, _name, _parent, _router, _baseVc, _numVcs, _inputPort,
-          _inputVc, _numPorts, _numStages, _interfacePorts, _stage, _settings);
+          _inputVc, _numPorts, _numStages, _interfacePorts, _stage,
+          _extraStages, _stagePorts, _settings);
 
   // check that the factory had this type
   if (ra == nullptr) {
@@ -57,4 +61,14 @@ RoutingAlgorithm* RoutingAlgorithm::create(
   return ra;
 }
 
+const std::vector<u32>& RoutingAlgorithm::candidatePorts(
+    const Address* _destinationAddress) const {
+  assert(_destinationAddress->size() == numStages_);
+  u32 tag = 0;
+  if (stage_ >= extraStages_) {
+    tag = _destinationAddress->at(stage_ - extraStages_);
+  }
+  return stagePorts_->at((stage_ * numPorts_) + tag);
+}
+
 }  // namespace Butterfly
@@ -23,10 +23,11 @@
 #include "prim/prim.h"
 #include "router/Router.h"
 #include "routing/RoutingAlgorithm.h"
+#include "types/Address.h"
 
 #define BUTTERFLY_ROUTINGALGORITHM_ARGS                                        \
   const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, u32, \
-      u32, u32, nlohmann::json
+      u32, u32, u32, const std::vector<std::vector<u32>>*, nlohmann::json
 
 namespace Butterfly {
 
@@ -35,17 +36,26 @@ class RoutingAlgorithm : public ::RoutingAlgorithm {
   RoutingAlgorithm(const std::string& _name, const Component* _parent,
                    Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
                    u32 _inputVc, u32 _numPorts, u32 _numStages,
-                   u32 _interfacePorts, u32 _stage, nlohmann::json _settings);
+                   u32 _interfacePorts, u32 _stage, u32 _extraStages,
+                   const std::vector<std::vector<u32>>* _stagePorts,
+                   nlohmann::json _settings);
   virtual ~RoutingAlgorithm();
 
   // this is a routing algorithm factory for the butterfly topology
   static RoutingAlgorithm* create(BUTTERFLY_ROUTINGALGORITHM_ARGS);
 
  protected:
+  // this returns the candidate output ports of this stage toward the
+  //  destination, found by table lookup
+  const std::vector<u32>& candidatePorts(
+      const Address* _destinationAddress) const;
+
   const u32 numPorts_;
   const u32 numStages_;
   const u32 interfacePorts_;
   const u32 stage_;
+  const u32 extraStages_;
+  const std::vector<std::vector<u32>>* stagePorts_;
 };
 
 }  // namespace Butterfly
@@ -21,7 +21,7 @@ namespace Butterfly {
 
 void translateInterfaceIdToAddress(u32 _routerRadix, u32 _numStages,
                                    u32 _stageWidth, u32 _interfacePorts,
-                                   u32 _id, std::vector<u32>* _address) {
+                                   u32 _id, Address* _address) {
   _address->resize(_numStages);
   // scale the _id for _interfacePorts
   _id *= _interfacePorts;
@@ -37,7 +37,7 @@ void translateInterfaceIdToAddress(u32 _routerRadix, u32 _numStages,
 
 u32 translateInterfaceAddressToId(u32 _routerRadix, u32 _numStages,
                                   u32 _stageWidth, u32 _interfacePorts,
-                                  const std::vector<u32>* _address) {
+                                  const Address* _address) {
   u32 sum = 0;
   u32 pow = 1;
   for (u32 stage = 0; stage < _numStages; stage++) {
@@ -51,7 +51,7 @@ u32 translateInterfaceAddressToId(u32 _routerRadix, u32 _numStages,
 
 void translateRouterIdToAddress(u32 _routerRadix, u32 _numStages,
                                 u32 _stageWidth, u32 _id,
-                                std::vector<u32>* _address) {
+                                Address* _address) {
   _address->resize(2);
   _address->at(0) = _id / _stageWidth;
   _address->at(1) = _id % _stageWidth;
@@ -59,11 +59,50 @@ void translateRouterIdToAddress(u32 _routerRadix, u32 _numStages,
 
 u32 translateRouterAddressToId(u32 _routerRadix, u32 _numStages,
                                u32 _stageWidth,
-                               const std::vector<u32>* _address) {
+                               const Address* _address) {
   return _address->at(0) * _stageWidth + _address->at(1);
 }
 
 u32 computeMinimalHops(u32 _numStages) {
   return _numStages;
 }
+
+u32 computeLinkDigit(u32 _numStages, u32 _extraStages, u32 _linkStage) {
+  assert(_numStages >= 2);
+  assert(_linkStage < _numStages + _extraStages - 1);
+  u32 digits = _numStages - 1;
+  u32 offset = (_linkStage + digits - (_extraStages % digits)) % digits;
+  return digits - 1 - offset;
+}
+
+void computeStagePorts(u32 _routerRadix, u32 _numStages, u32 _extraStages,
+                       u32 _dilation, u32 _interfacePorts,
+                       std::vector<std::vector<u32>>* _stagePorts) {
+  u32 totalStages = _numStages + _extraStages;
+  _stagePorts->clear();
+  _stagePorts->resize(totalStages * _routerRadix);
+  for (u32 stage = 0; stage < totalStages; stage++) {
+    for (u32 tag = 0; tag < _routerRadix; tag++) {
+      std::vector<u32>& ports = _stagePorts->at((stage * _routerRadix) + tag);
+      if (stage == totalStages - 1) {
+        // interface ports
+        if (tag < _routerRadix / _interfacePorts) {
+          for (u32 ch = 0; ch < _interfacePorts; ch++) {
+            ports.push_back((tag * _interfacePorts) + ch);
+          }
+        }
+      } else if (stage < _extraStages) {
+        // any output port
+        for (u32 port = 0; port < _routerRadix * _dilation; port++) {
+          ports.push_back(port);
+        }
+      } else {
+        // the dilated copies of the tag's port
+        for (u32 copy = 0; copy < _dilation; copy++) {
+          ports.push_back((tag * _dilation) + copy);
+        }
+      }
+    }
+  }
+}
 }  // namespace Butterfly
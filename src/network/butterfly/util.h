@@ -18,23 +18,38 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 namespace Butterfly {
 
 void translateInterfaceIdToAddress(u32 _routerRadix, u32 _numStages,
                                    u32 _stageWidth, u32 _interfacePorts,
-                                   u32 _id, std::vector<u32>* _address);
+                                   u32 _id, Address* _address);
 u32 translateInterfaceAddressToId(u32 _routerRadix, u32 _numStages,
                                   u32 _stageWidth, u32 _interfacePorts,
-                                  const std::vector<u32>* _address);
+                                  const Address* _address);
 void translateRouterIdToAddress(u32 _routerRadix, u32 _numStages,
                                 u32 _stageWidth, u32 _id,
-                                std::vector<u32>* _address);
+                                Address* _address);
 u32 translateRouterAddressToId(u32 _routerRadix, u32 _numStages,
                                u32 _stageWidth,
-                               const std::vector<u32>* _address);
+                               const Address* _address);
 u32 computeMinimalHops(u32 _numStages);
 
+// this returns the column digit (with weight radix^digit) that is replaced by
+//  the links leaving a stage. the last (_numStages - 1) link stages replace
+//  each digit once, as in the plain butterfly, and the extra stages in front
+//  of them cycle through the digits
+u32 computeLinkDigit(u32 _numStages, u32 _extraStages, u32 _linkStage);
+
+// this computes the candidate output ports of every stage, indexed by
+//  [stage * routerRadix + tag]. extra stages may use any port, the other
+//  stages use the dilated copies of the tag's port, and the last stage uses
+//  the tag's interface ports.
+void computeStagePorts(u32 _routerRadix, u32 _numStages, u32 _extraStages,
+                       u32 _dilation, u32 _interfacePorts,
+                       std::vector<std::vector<u32>>* _stagePorts);
+
 }  // namespace Butterfly
 
 #endif  // NETWORK_BUTTERFLY_UTIL_H_
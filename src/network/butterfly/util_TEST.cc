@@ -18,6 +18,7 @@
 
 #include "gtest/gtest.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 
 TEST(Butterfly, translateInterfaceIdToAddress1) {
   const u32 routerRadix = 2;
@@ -25,8 +26,8 @@ TEST(Butterfly, translateInterfaceIdToAddress1) {
   const u32 stageWidth = 4;
   const u32 interfacePorts = 1;
 
-  std::vector<u32> act;
-  std::vector<u32> exp;
+  Address act;
+  Address exp;
   u32 id;
 
   id = 0;
@@ -66,8 +67,8 @@ TEST(Butterfly, translateInterfaceIdToAddress2) {
   const u32 stageWidth = 4;
   const u32 interfacePorts = 2;
 
-  std::vector<u32> act;
-  std::vector<u32> exp;
+  Address act;
+  Address exp;
   u32 id;
 
   id = 0;
@@ -101,8 +102,8 @@ TEST(Butterfly, translateInterfaceIdToAddress3) {
   const u32 stageWidth = 16;
   const u32 interfacePorts = 2;
 
-  std::vector<u32> act;
-  std::vector<u32> exp;
+  Address act;
+  Address exp;
   u32 id;
 
   id = 0;
@@ -142,7 +143,7 @@ TEST(Butterfly, translateInterfaceAddressToId1) {
   const u32 stageWidth = 4;
   const u32 interfacePorts = 1;
 
-  std::vector<u32> addr;
+  Address addr;
 
   addr = {0, 0, 0};
   ASSERT_EQ(0u, Butterfly::translateInterfaceAddressToId(
@@ -171,7 +172,7 @@ TEST(Butterfly, translateInterfaceAddressToId2) {
   const u32 stageWidth = 4;
   const u32 interfacePorts = 2;
 
-  std::vector<u32> addr;
+  Address addr;
 
   addr = {0, 0, 0};
   ASSERT_EQ(0u, Butterfly::translateInterfaceAddressToId(
@@ -196,7 +197,7 @@ TEST(Butterfly, translateInterfaceAddressToId3) {
   const u32 stageWidth = 16;
   const u32 interfacePorts = 2;
 
-  std::vector<u32> addr;
+  Address addr;
 
   addr = {0, 0, 0};
   ASSERT_EQ(0u, Butterfly::translateInterfaceAddressToId(
@@ -249,8 +250,8 @@ TEST(Butterfly, translateRouterIdToAddress) {
   const u32 numStages = 3;
   const u32 stageWidth = 4;
 
-  std::vector<u32> act;
-  std::vector<u32> exp;
+  Address act;
+  Address exp;
   u32 id;
 
   id = 0;
@@ -289,7 +290,7 @@ TEST(Butterfly, translateRouterAddressToId) {
   const u32 numStages = 3;
   const u32 stageWidth = 4;
 
-  std::vector<u32> addr;
+  Address addr;
 
   addr = {0, 0};
   ASSERT_EQ(0u, Butterfly::translateRouterAddressToId(routerRadix, numStages,
@@ -328,3 +329,52 @@ TEST(Butterfly, computeMinimalHops) {
   exp = 10;
   ASSERT_EQ(exp, Butterfly::computeMinimalHops(numStages));
 }
+
+TEST(Butterfly, computeLinkDigit) {
+  // plain butterfly, most significant digit first
+  ASSERT_EQ(1u, Butterfly::computeLinkDigit(3, 0, 0));
+  ASSERT_EQ(0u, Butterfly::computeLinkDigit(3, 0, 1));
+
+  // extra stages cycle so that the last links match the plain butterfly
+  ASSERT_EQ(0u, Butterfly::computeLinkDigit(3, 1, 0));
+  ASSERT_EQ(1u, Butterfly::computeLinkDigit(3, 1, 1));
+  ASSERT_EQ(0u, Butterfly::computeLinkDigit(3, 1, 2));
+
+  ASSERT_EQ(1u, Butterfly::computeLinkDigit(4, 2, 0));
+  ASSERT_EQ(0u, Butterfly::computeLinkDigit(4, 2, 1));
+  ASSERT_EQ(2u, Butterfly::computeLinkDigit(4, 2, 2));
+  ASSERT_EQ(1u, Butterfly::computeLinkDigit(4, 2, 3));
+  ASSERT_EQ(0u, Butterfly::computeLinkDigit(4, 2, 4));
+}
+
+TEST(Butterfly, computeStagePorts) {
+  std::vector<std::vector<u32>> stagePorts;
+  std::vector<u32> exp;
+
+  // radix 2, 2 stages, 1 extra stage, dilation 2, 1 interface port
+  Butterfly::computeStagePorts(2, 2, 1, 2, 1, &stagePorts);
+  ASSERT_EQ(stagePorts.size(), 6u);
+
+  exp = {0, 1, 2, 3};
+  ASSERT_EQ(stagePorts.at(0), exp);
+  ASSERT_EQ(stagePorts.at(1), exp);
+
+  exp = {0, 1};
+  ASSERT_EQ(stagePorts.at(2), exp);
+  exp = {2, 3};
+  ASSERT_EQ(stagePorts.at(3), exp);
+
+  exp = {0};
+  ASSERT_EQ(stagePorts.at(4), exp);
+  exp = {1};
+  ASSERT_EQ(stagePorts.at(5), exp);
+
+  // radix 4, 2 stages, 2 interface ports
+  Butterfly::computeStagePorts(4, 2, 0, 1, 2, &stagePorts);
+  ASSERT_EQ(stagePorts.size(), 8u);
+  exp = {3};
+  ASSERT_EQ(stagePorts.at(3), exp);
+  exp = {2, 3};
+  ASSERT_EQ(stagePorts.at(5), exp);
+  ASSERT_TRUE(stagePorts.at(6).empty());
+}
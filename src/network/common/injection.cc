@@ -18,8 +18,44 @@
 #include <tuple>
 #include <vector>
 
+#include "event/Simulator.h"
+
 namespace Common {
 
+static u32 congestion(const Interface* _interface, u32 _port, u32 _vc) {
+  return _interface->occupancy(_port, _vc) +
+         _interface->downstreamOccupancy(_port, _vc);
+}
+
+// the congestion of a VC is its local occupancy, plus its downstream
+//  occupancy if '_downstream' is set
+static void leastOccupied(const Interface* _interface, u32 _minPort,
+                          u32 _maxPort, u32 _baseVc, u32 _numVcs,
+                          bool _downstream, u32* _port, u32* _vc) {
+  // find all minimally congested VCs within the ports
+  std::vector<std::tuple<u32, u32>> minOutputs;
+  u32 minCongestion = U32_MAX;
+  for (u32 port = _minPort; port <= _maxPort; port++) {
+    for (u32 vc = _baseVc; vc < _baseVc + _numVcs; vc++) {
+      u32 cong = _downstream ? congestion(_interface, port, vc) :
+                 _interface->occupancy(port, vc);
+      if (cong < minCongestion) {
+        minCongestion = cong;
+        minOutputs.clear();
+      }
+      if (cong <= minCongestion) {
+        minOutputs.push_back(std::make_tuple(port, vc));
+      }
+    }
+  }
+
+  // choose randomly among the minimally congested VCs
+  assert(minOutputs.size() > 0);
+  u32 rnd = gSim->rnd.nextU64(0, minOutputs.size() - 1);
+  *_port = std::get<0>(minOutputs.at(rnd));
+  *_vc = std::get<1>(minOutputs.at(rnd));
+}
+
 void injection(Interface* _interface, InjectionAlgorithm* _algorithm,
                u32 _baseVc, u32 _numVcs, bool _adaptive, bool _fixedMsgVc,
                Message* _message) {
@@ -33,27 +69,9 @@ void injection(Interface* _interface, InjectionAlgorithm* _algorithm,
     if (!_fixedMsgVc || pktVc == U32_MAX) {
       // choose VC
       if (_adaptive) {
-        // find all minimally congested VCs within the protocol class
-        std::vector<std::tuple<u32, u32>> minOutputs;
-        u32 minOccupancy = U32_MAX;
-        for (u32 port = 0; port < _interface->numPorts(); port++) {
-          for (u32 vc = _baseVc; vc < _baseVc + _numVcs; vc++) {
-            u32 occupancy = _interface->occupancy(port, vc);
-            if (occupancy < minOccupancy) {
-              minOccupancy = occupancy;
-              minOutputs.clear();
-            }
-            if (occupancy <= minOccupancy) {
-              minOutputs.push_back(std::make_tuple(port, vc));
-            }
-          }
-        }
-
-        // choose randomly among the minimally congested VCs
-        assert(minOutputs.size() > 0);
-        u32 rnd = gSim->rnd.nextU64(0, minOutputs.size() - 1);
-        pktPort = std::get<0>(minOutputs.at(rnd));
-        pktVc = std::get<1>(minOutputs.at(rnd));
+        // choose randomly among the least occupied VCs of all ports
+        leastOccupied(_interface, 0, _interface->numPorts() - 1, _baseVc,
+                      _numVcs, false, &pktPort, &pktVc);
       } else {
         // choose a random VC within the protocol class
         pktPort = gSim->rnd.nextU64(0, _interface->numPorts() - 1);
@@ -66,4 +84,107 @@ void injection(Interface* _interface, InjectionAlgorithm* _algorithm,
   }
 }
 
+InjectionPolicy parseInjectionPolicy(const std::string& _policy) {
+  if (_policy == "least_occupied") {
+    return InjectionPolicy::kLeastOccupied;
+  } else if (_policy == "power_of_two") {
+    return InjectionPolicy::kPowerOfTwo;
+  } else if (_policy == "flow_hash") {
+    return InjectionPolicy::kFlowHash;
+  } else {
+    fprintf(stderr, "invalid injection policy: %s\n", _policy.c_str());
+    assert(false);
+    return InjectionPolicy::kLeastOccupied;
+  }
+}
+
+void balancedInjection(Interface* _interface, InjectionAlgorithm* _algorithm,
+                       u32 _baseVc, u32 _numVcs, InjectionPolicy _policy,
+                       bool _fixedMsgVc, Message* _message) {
+  u32 numPorts = _interface->numPorts();
+  u32 pktPort = U32_MAX;
+  u32 pktVc = U32_MAX;
+  for (u32 p = 0; p < _message->numPackets(); p++) {
+    Packet* packet = _message->packet(p);
+
+    // get the packet's port and VC
+    if (!_fixedMsgVc || pktVc == U32_MAX) {
+      switch (_policy) {
+        case InjectionPolicy::kLeastOccupied: {
+          leastOccupied(_interface, 0, numPorts - 1, _baseVc, _numVcs, true,
+                        &pktPort, &pktVc);
+          break;
+        }
+
+        case InjectionPolicy::kPowerOfTwo: {
+          u32 port1 = gSim->rnd.nextU64(0, numPorts - 1);
+          u32 vc1 = gSim->rnd.nextU64(_baseVc, _baseVc + _numVcs - 1);
+          u32 port2 = gSim->rnd.nextU64(0, numPorts - 1);
+          u32 vc2 = gSim->rnd.nextU64(_baseVc, _baseVc + _numVcs - 1);
+          if (congestion(_interface, port2, vc2) <
+              congestion(_interface, port1, vc1)) {
+            pktPort = port2;
+            pktVc = vc2;
+          } else {
+            pktPort = port1;
+            pktVc = vc1;
+          }
+          break;
+        }
+
+        case InjectionPolicy::kFlowHash: {
+          u64 flow = ((u64)_message->getSourceId() << 32) |
+                     _message->getDestinationId();
+          // 64-bit mixing function (splitmix64 finalizer)
+          flow = (flow ^ (flow >> 30)) * 0xBF58476D1CE4E5B9ull;
+          flow = (flow ^ (flow >> 27)) * 0x94D049BB133111EBull;
+          flow = flow ^ (flow >> 31);
+          u32 port = flow % numPorts;
+          leastOccupied(_interface, port, port, _baseVc, _numVcs, true,
+                        &pktPort, &pktVc);
+          break;
+        }
+
+        default:
+          assert(false);
+          break;
+      }
+    }
+
+    // inform the algorithm of the packet's injection
+    _algorithm->injectPacket(packet, pktPort, pktVc);
+  }
+}
+
+InjectionSettings parseInjectionSettings(nlohmann::json _settings) {
+  InjectionSettings settings;
+  assert(_settings.contains("adaptive"));
+  settings.adaptive = _settings["adaptive"].get<bool>();
+
+  assert(_settings.contains("fixed_msg_vc"));
+  settings.fixedMsgVc = _settings["fixed_msg_vc"].get<bool>();
+
+  // the optional balanced injection policy supersedes "adaptive"
+  settings.balanced =
+      _settings.contains("policy") && !_settings["policy"].is_null();
+  settings.policy = InjectionPolicy::kLeastOccupied;
+  if (settings.balanced) {
+    settings.policy =
+        parseInjectionPolicy(_settings["policy"].get<std::string>());
+  }
+  return settings;
+}
+
+void commonInjection(Interface* _interface, InjectionAlgorithm* _algorithm,
+                     u32 _baseVc, u32 _numVcs,
+                     const InjectionSettings& _settings, Message* _message) {
+  if (_settings.balanced) {
+    balancedInjection(_interface, _algorithm, _baseVc, _numVcs,
+                      _settings.policy, _settings.fixedMsgVc, _message);
+  } else {
+    injection(_interface, _algorithm, _baseVc, _numVcs, _settings.adaptive,
+              _settings.fixedMsgVc, _message);
+  }
+}
+
 }  // namespace Common
@@ -15,7 +15,10 @@
 #ifndef NETWORK_COMMON_INJECTION_H_
 #define NETWORK_COMMON_INJECTION_H_
 
+#include <string>
+
 #include "interface/Interface.h"
+#include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "routing/InjectionAlgorithm.h"
 #include "types/Message.h"
@@ -26,6 +29,39 @@ void injection(Interface* _interface, InjectionAlgorithm* _algorithm,
                u32 _baseVc, u32 _numVcs, bool _adaptive, bool _fixedMsgVc,
                Message* _message);
 
+// these are the policies of balanced injection, which chooses both the port
+//  and VC of each packet using local and downstream buffer occupancy
+//  least_occupied: the least occupied port and VC (random tie break)
+//  power_of_two: the less occupied of two randomly chosen ports and VCs
+//  flow_hash: the port is chosen by hashing the flow (source and destination),
+//             the VC is the least occupied within the port
+enum class InjectionPolicy : u8 { kLeastOccupied, kPowerOfTwo, kFlowHash };
+
+InjectionPolicy parseInjectionPolicy(const std::string& _policy);
+
+void balancedInjection(Interface* _interface, InjectionAlgorithm* _algorithm,
+                       u32 _baseVc, u32 _numVcs, InjectionPolicy _policy,
+                       bool _fixedMsgVc, Message* _message);
+
+// these are the settings shared by the topologies' "common" injection
+//  algorithms
+//  adaptive: choose the injection VC adaptively
+//  fixed_msg_vc: all packets of a message use the same VC
+//  policy: (optional) a balanced injection policy, supersedes "adaptive"
+struct InjectionSettings {
+  bool adaptive;
+  bool fixedMsgVc;
+  bool balanced;
+  InjectionPolicy policy;
+};
+
+InjectionSettings parseInjectionSettings(nlohmann::json _settings);
+
+// this uses balancedInjection() when a policy is given, otherwise injection()
+void commonInjection(Interface* _interface, InjectionAlgorithm* _algorithm,
+                     u32 _baseVc, u32 _numVcs,
+                     const InjectionSettings& _settings, Message* _message);
+
 }  // namespace Common
 
 #endif  // NETWORK_COMMON_INJECTION_H_
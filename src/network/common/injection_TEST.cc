@@ -0,0 +1,246 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/common/injection.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "network/Network_TESTLIB.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "routing/InjectionAlgorithm.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace {
+
+// this records where packets are injected and reports the occupancy it is
+//  given
+class InjectionInterface : public TestInterface {
+ public:
+  InjectionInterface(u32 _numPorts, u32 _numVcs)
+      : TestInterface(nullptr, 0, _numPorts, _numVcs),
+        occupancy_(_numPorts * _numVcs, 0),
+        downstreamOccupancy_(_numPorts * _numVcs, 0) {}
+  ~InjectionInterface() {}
+  void injectingPacket(Packet* _packet, u32 _port, u32 _vc) override {
+    injections_.push_back(std::make_tuple(_port, _vc));
+  }
+  u32 occupancy(u32 _port, u32 _vc) const override {
+    return occupancy_.at(vcIndex(_port, _vc));
+  }
+  u32 downstreamOccupancy(u32 _port, u32 _vc) const override {
+    return downstreamOccupancy_.at(vcIndex(_port, _vc));
+  }
+
+  void setOccupancy(u32 _port, u32 _vc, u32 _local, u32 _downstream) {
+    occupancy_.at(vcIndex(_port, _vc)) = _local;
+    downstreamOccupancy_.at(vcIndex(_port, _vc)) = _downstream;
+  }
+  std::vector<std::tuple<u32, u32>>* injections() {
+    return &injections_;
+  }
+
+ private:
+  std::vector<u32> occupancy_;
+  std::vector<u32> downstreamOccupancy_;
+  std::vector<std::tuple<u32, u32>> injections_;
+};
+
+class TestInjectionAlgorithm : public InjectionAlgorithm {
+ public:
+  TestInjectionAlgorithm(Interface* _interface, u32 _baseVc, u32 _numVcs,
+                         Common::InjectionPolicy _policy, bool _fixedMsgVc)
+      : InjectionAlgorithm("TestInjectionAlgorithm", nullptr, _interface,
+                           _baseVc, _numVcs, 0, nlohmann::json()),
+        policy_(_policy), fixedMsgVc_(_fixedMsgVc) {}
+  ~TestInjectionAlgorithm() {}
+  void processMessage(Message* _message) override {
+    Common::balancedInjection(interface_, this, baseVc_, numVcs_, policy_,
+                              fixedMsgVc_, _message);
+  }
+
+ private:
+  const Common::InjectionPolicy policy_;
+  const bool fixedMsgVc_;
+};
+
+Message* createMessage(u32 _numPackets, u32 _source, u32 _destination) {
+  Message* message = new Message(_numPackets, nullptr);
+  for (u32 p = 0; p < _numPackets; p++) {
+    Packet* packet = new Packet(p, 1, message);
+    packet->setFlit(0, new Flit(0, true, true, packet));
+    message->setPacket(p, packet);
+  }
+  message->setSourceId(_source);
+  message->setDestinationId(_destination);
+  return message;
+}
+
+// this injects one message and returns where its packets were injected
+std::vector<std::tuple<u32, u32>> inject(
+    InjectionInterface* _interface, InjectionAlgorithm* _algorithm,
+    u32 _numPackets, u32 _source, u32 _destination) {
+  _interface->injections()->clear();
+  Message* message = createMessage(_numPackets, _source, _destination);
+  _algorithm->processMessage(message);
+  delete message;
+  return *_interface->injections();
+}
+
+}  // namespace
+
+TEST(Injection, parseInjectionPolicy) {
+  ASSERT_EQ(Common::parseInjectionPolicy("least_occupied"),
+            Common::InjectionPolicy::kLeastOccupied);
+  ASSERT_EQ(Common::parseInjectionPolicy("power_of_two"),
+            Common::InjectionPolicy::kPowerOfTwo);
+  ASSERT_EQ(Common::parseInjectionPolicy("flow_hash"),
+            Common::InjectionPolicy::kFlowHash);
+  ASSERT_DEATH(Common::parseInjectionPolicy("least_congested"),
+               "invalid injection policy: least_congested");
+}
+
+TEST(Injection, parseInjectionSettings) {
+  nlohmann::json settings;
+  settings["adaptive"] = true;
+  settings["fixed_msg_vc"] = false;
+  Common::InjectionSettings parsed = Common::parseInjectionSettings(settings);
+  ASSERT_TRUE(parsed.adaptive);
+  ASSERT_FALSE(parsed.fixedMsgVc);
+  ASSERT_FALSE(parsed.balanced);
+
+  settings["policy"] = "flow_hash";
+  parsed = Common::parseInjectionSettings(settings);
+  ASSERT_TRUE(parsed.balanced);
+  ASSERT_EQ(parsed.policy, Common::InjectionPolicy::kFlowHash);
+}
+
+TEST(Injection, leastOccupied) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  InjectionInterface interface(2, 3);
+  TestInjectionAlgorithm algorithm(
+      &interface, 1, 2, Common::InjectionPolicy::kLeastOccupied, false);
+
+  // local and downstream occupancy are summed, VC 0 is another protocol class
+  interface.setOccupancy(0, 0, 0, 0);
+  interface.setOccupancy(0, 1, 0, 6);
+  interface.setOccupancy(0, 2, 3, 3);
+  interface.setOccupancy(1, 1, 6, 0);
+  interface.setOccupancy(1, 2, 2, 3);
+  for (u32 i = 0; i < 100; i++) {
+    for (const auto& t : inject(&interface, &algorithm, 3, 0, 1)) {
+      ASSERT_EQ(t, std::make_tuple(1u, 2u));
+    }
+  }
+
+  // ties are broken randomly
+  interface.setOccupancy(0, 1, 1, 4);
+  u32 first = 0;
+  u32 second = 0;
+  for (u32 i = 0; i < 1000; i++) {
+    for (const auto& t : inject(&interface, &algorithm, 1, 0, 1)) {
+      if (t == std::make_tuple(0u, 1u)) {
+        first++;
+      } else {
+        ASSERT_EQ(t, std::make_tuple(1u, 2u));
+        second++;
+      }
+    }
+  }
+  ASSERT_NEAR(first, 500u, 100u);
+  ASSERT_NEAR(second, 500u, 100u);
+}
+
+TEST(Injection, powerOfTwo) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  InjectionInterface interface(2, 2);
+  TestInjectionAlgorithm algorithm(
+      &interface, 0, 2, Common::InjectionPolicy::kPowerOfTwo, false);
+
+  // the less congested of two random choices wins, of four options the one
+  //  with N less congested options is chosen with probability
+  //  (2 * (4 - N) - 1) / 16
+  interface.setOccupancy(0, 0, 0, 0);
+  interface.setOccupancy(0, 1, 1, 0);
+  interface.setOccupancy(1, 0, 1, 1);
+  interface.setOccupancy(1, 1, 0, 3);
+  const u32 kRounds = 16000;
+  std::vector<u32> counts(4, 0);
+  for (u32 i = 0; i < kRounds; i++) {
+    for (const auto& t : inject(&interface, &algorithm, 1, 0, 1)) {
+      counts.at(std::get<0>(t) * 2 + std::get<1>(t))++;
+    }
+  }
+  ASSERT_NEAR(counts.at(0), 7000u, 400u);
+  ASSERT_NEAR(counts.at(1), 5000u, 400u);
+  ASSERT_NEAR(counts.at(2), 3000u, 400u);
+  ASSERT_NEAR(counts.at(3), 1000u, 400u);
+}
+
+TEST(Injection, flowHash) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  InjectionInterface interface(4, 2);
+  TestInjectionAlgorithm algorithm(
+      &interface, 0, 2, Common::InjectionPolicy::kFlowHash, false);
+
+  // the least occupied VC of each port is VC 1
+  for (u32 port = 0; port < 4; port++) {
+    interface.setOccupancy(port, 0, 2, 2);
+    interface.setOccupancy(port, 1, 1, 2);
+  }
+
+  // each flow sticks to one port, flows are spread over all ports
+  std::vector<u32> portFlows(4, 0);
+  for (u32 destination = 0; destination < 400; destination++) {
+    u32 flowPort = U32_MAX;
+    for (u32 i = 0; i < 3; i++) {
+      for (const auto& t : inject(&interface, &algorithm, 2, 7, destination)) {
+        if (flowPort == U32_MAX) {
+          flowPort = std::get<0>(t);
+        }
+        ASSERT_EQ(std::get<0>(t), flowPort);
+        ASSERT_EQ(std::get<1>(t), 1u);
+      }
+    }
+    portFlows.at(flowPort)++;
+  }
+  for (u32 port = 0; port < 4; port++) {
+    ASSERT_NEAR(portFlows.at(port), 100u, 40u);
+  }
+}
+
+TEST(Injection, fixedMsgVc) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  InjectionInterface interface(2, 2);
+  for (Common::InjectionPolicy policy :
+           {Common::InjectionPolicy::kLeastOccupied,
+            Common::InjectionPolicy::kPowerOfTwo,
+            Common::InjectionPolicy::kFlowHash}) {
+    TestInjectionAlgorithm algorithm(&interface, 0, 2, policy, true);
+    for (u32 i = 0; i < 100; i++) {
+      std::vector<std::tuple<u32, u32>> injections =
+          inject(&interface, &algorithm, 4, 0, i);
+      ASSERT_EQ(injections.size(), 4u);
+      for (const auto& t : injections) {
+        ASSERT_EQ(t, injections.at(0));
+      }
+    }
+  }
+}
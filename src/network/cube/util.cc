@@ -37,7 +37,7 @@ u32 computeNumRouters(const std::vector<u32>& _widths) {
 
 void translateInterfaceIdToAddress(u32 _id, const std::vector<u32>& _widths,
                                    u32 _concentration, u32 _interfacePorts,
-                                   std::vector<u32>* _address) {
+                                   Address* _address) {
   assert(_id < computeNumInterfaces(_widths, _concentration, _interfacePorts));
 
   u32 dimensions = _widths.size();
@@ -57,37 +57,25 @@ void translateInterfaceIdToAddress(u32 _id, const std::vector<u32>& _widths,
   }
 }
 
-u32 translateInterfaceAddressToId(const std::vector<u32>* _address,
+u32 translateInterfaceAddressToId(const Address* _address,
                                   const std::vector<u32>& _widths,
                                   u32 _concentration, u32 _interfacePorts) {
   u32 dimensions = _widths.size();
-  std::vector<u32> coeff(dimensions + 1);
+  assert(_address->size() >= dimensions + 1);
 
-  // compute coefficients
-  u32 interfacesPerRouter = _concentration / _interfacePorts;
-  u32 prod = 1;
-  for (u32 idx = 0; idx < dimensions + 1; idx++) {
-    coeff.at(idx) = prod;
-    if (idx == 0) {
-      assert(_address->at(idx) < interfacesPerRouter);
-      prod *= interfacesPerRouter;
-    } else {
-      assert(_address->at(idx) < _widths.at(idx - 1));
-      prod *= _widths.at(idx - 1);
-    }
-  }
-
-  // compute dot product
+  // mixed-radix evaluation from the most significant dimension down
   u32 sum = 0;
-  for (u32 idx = 0; idx < dimensions + 1; idx++) {
-    sum += coeff.at(idx) * _address->at(idx);
+  for (s32 dim = dimensions - 1; dim >= 0; dim--) {
+    assert(_address->at(dim + 1) < _widths.at(dim));
+    sum = (sum * _widths[dim]) + (*_address)[dim + 1];
   }
-
-  return sum;
+  u32 interfacesPerRouter = _concentration / _interfacePorts;
+  assert(_address->at(0) < interfacesPerRouter);
+  return (sum * interfacesPerRouter) + (*_address)[0];
 }
 
 void translateRouterIdToAddress(const u32 _id, const std::vector<u32>& _widths,
-                                std::vector<u32>* _address) {
+                                Address* _address) {
   assert(_id < computeNumRouters(_widths));
 
   u32 dimensions = _widths.size();
@@ -104,25 +92,17 @@ void translateRouterIdToAddress(const u32 _id, const std::vector<u32>& _widths,
   }
 }
 
-u32 translateRouterAddressToId(const std::vector<u32>* _address,
+u32 translateRouterAddressToId(const Address* _address,
                                const std::vector<u32>& _widths) {
   u32 dimensions = _widths.size();
-  std::vector<u32> coeff(dimensions);
-
-  // compute coefficients
-  u32 prod = 1;
-  for (u32 idx = 0; idx < dimensions; idx++) {
-    coeff.at(idx) = prod;
-    assert(_address->at(idx) < _widths.at(idx));
-    prod *= _widths.at(idx);
-  }
+  assert(_address->size() >= dimensions);
 
-  // compute dot product
+  // mixed-radix evaluation from the most significant dimension down
   u32 sum = 0;
-  for (u32 idx = 0; idx < dimensions; idx++) {
-    sum += coeff.at(idx) * _address->at(idx);
+  for (s32 dim = dimensions - 1; dim >= 0; dim--) {
+    assert(_address->at(dim) < _widths.at(dim));
+    sum = (sum * _widths[dim]) + (*_address)[dim];
   }
-
   return sum;
 }
 
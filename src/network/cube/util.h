@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 namespace Cube {
 
@@ -28,16 +29,16 @@ u32 computeNumRouters(const std::vector<u32>& _widths);
 
 void translateInterfaceIdToAddress(u32 _id, const std::vector<u32>& _widths,
                                    u32 _concentration, u32 _interfacePorts,
-                                   std::vector<u32>* _address);
+                                   Address* _address);
 
-u32 translateInterfaceAddressToId(const std::vector<u32>* _address,
+u32 translateInterfaceAddressToId(const Address* _address,
                                   const std::vector<u32>& _widths,
                                   u32 _concentration, u32 _interfacePorts);
 
 void translateRouterIdToAddress(const u32 _id, const std::vector<u32>& _widths,
-                                std::vector<u32>* _address);
+                                Address* _address);
 
-u32 translateRouterAddressToId(const std::vector<u32>* _address,
+u32 translateRouterAddressToId(const Address* _address,
                                const std::vector<u32>& _widths);
 
 }  // namespace Cube
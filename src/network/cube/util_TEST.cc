@@ -20,6 +20,7 @@
 #include "gtest/gtest.h"
 #include "prim/prim.h"
 #include "test/TestSetup_TESTLIB.h"
+#include "types/Address.h"
 
 TEST(CubeUtil, computeNumRoutersAndInterfaces) {
   TestSetup ts(1, 1, 1, 1, 0xDEAFBEEF);
@@ -61,7 +62,7 @@ TEST(CubeUtil, translateInterfaceIdToAddress) {
   const u32 concentration = 4;
   const u32 interfacePorts = 2;
 
-  std::vector<u32> address;
+  Address address;
 
   Cube::translateInterfaceIdToAddress(0, widths, concentration, interfacePorts,
                                       &address);
@@ -101,7 +102,7 @@ TEST(CubeUtil, translateInterfaceAddressToId) {
   const u32 concentration = 4;
   const u32 interfacePorts = 2;
 
-  std::vector<u32> address;
+  Address address;
 
   address = {0, 0, 0, 0};
   ASSERT_EQ(0u, Cube::translateInterfaceAddressToId(
@@ -139,7 +140,7 @@ TEST(CubeUtil, translateInterfaceAddressToId) {
 TEST(CubeUtil, translateRouterIdToAddress) {
   const std::vector<u32> widths({3, 2, 3});
 
-  std::vector<u32> address;
+  Address address;
 
   Cube::translateRouterIdToAddress(0, widths, &address);
   ASSERT_EQ(address, std::vector<u32>({0, 0, 0}));
@@ -169,7 +170,7 @@ TEST(CubeUtil, translateRouterIdToAddress) {
 TEST(CubeUtil, translateRouterAddressToId) {
   const std::vector<u32> widths({3, 2, 3});
 
-  std::vector<u32> address;
+  Address address;
 
   address = {0, 0, 0};
   ASSERT_EQ(0u, Cube::translateRouterAddressToId(&address, widths));
@@ -21,6 +21,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/dragonfly/util.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -58,9 +59,9 @@ MinimalRoutingAlgorithm::~MinimalRoutingAlgorithm() {
 void MinimalRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   // addresses
-  const std::vector<u32>* sourceAddress =
+  const Address* sourceAddress =
       _flit->packet()->message()->getSourceAddress();
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   assert(sourceAddress->size() == destinationAddress->size());
 
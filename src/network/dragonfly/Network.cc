@@ -66,12 +66,15 @@ Network::Network(const std::string& _name, const Component* _parent,
   // scalars
   f64 global_scalar = 0.0;
   f64 local_scalar = 0.0;
-  if (_settings["channel_mode"].get<std::string>() == "scalar") {
+  bool scalarMode = _settings["channel_mode"].get<std::string>() == "scalar";
+  if (scalarMode) {
     assert(_settings.contains("global_scalar"));
     assert(_settings.contains("local_scalar"));
     global_scalar = _settings["global_scalar"].get<f32>();
     local_scalar = _settings["local_scalar"].get<f32>();
   }
+  u32 globalLatency = _settings["global_channel"]["latency"].get<u32>();
+  u32 localLatency = _settings["local_channel"]["latency"].get<u32>();
 
   // radix
   groupRadix_ = ((globalWidth_ - 1) * globalWeight_);
@@ -89,10 +92,10 @@ Network::Network(const std::string& _name, const Component* _parent,
     routers_.at(group).resize(localWidth_, nullptr);
     for (u32 r = 0; r < localWidth_; r++) {
       // router info
-      std::vector<u32> routerAddress = {r, group};
+      Address routerAddress = {r, group};
       u32 routerId = translateRouterAddressToId(&routerAddress);
 
-      std::string rname = "Router_" + strop::vecString<u32>(routerAddress, '-');
+      std::string rname = "Router_" + routerAddress.toString('-');
       // make router
       routers_.at(group).at(r) = Router::create(
           rname, this, this, routerId, routerAddress, routerRadix_, numVcs_,
@@ -112,25 +115,24 @@ Network::Network(const std::string& _name, const Component* _parent,
         u32 dstGroupPort, dstRouter, dstRouterPort;
         computeGlobalToRouterMap(weight, reverseOffset, &dstGroupPort,
                                  &dstRouter, &dstRouterPort);
-        std::vector<u32> srcAddress = {srcRouter, srcGroup};
-        std::vector<u32> dstAddress = {dstRouter, dstGroup};
+        Address srcAddress = {srcRouter, srcGroup};
+        Address dstAddress = {dstRouter, dstGroup};
 
         // create channels
         std::string globalChannelName =
-            "GlobalChannel_" + strop::vecString<u32>(srcAddress, '-') + "-to-" +
-            strop::vecString<u32>(dstAddress, '-');
+            "GlobalChannel_" + srcAddress.toString('-') + "-to-" +
+            dstAddress.toString('-');
 
         // determine the global channel latency for current src dst group
-        if (_settings["channel_mode"].get<std::string>() == "scalar") {
+        u32 channelLatency = globalLatency;
+        if (scalarMode) {
           f64 link_dist = fabs((s64)srcGroup - (s64)dstGroup);
-          u32 channelLatency = (u32)(ceil(global_scalar * link_dist));
-
-          // override settings
-          _settings["global_channel"]["latency"] = channelLatency;
+          channelLatency = (u32)(ceil(global_scalar * link_dist));
         }
 
-        Channel* globalChannel = new Channel(globalChannelName, this, numVcs_,
-                                             _settings["global_channel"]);
+        Channel* globalChannel = createRouterChannel(
+            globalChannelName, routers_.at(srcGroup).at(srcRouter),
+            routers_.at(dstGroup).at(dstRouter), channelLatency);
         globalChannels_.push_back(globalChannel);
 
         // link the routers from source to dst
@@ -147,28 +149,27 @@ Network::Network(const std::string& _name, const Component* _parent,
     for (u32 srcRouter = 0; srcRouter < localWidth_; srcRouter++) {
       u32 portBase = concentration_;
       for (u32 offset = 1; offset < localWidth_; offset++) {
-        std::vector<u32> srcAddress = {srcRouter, group};
+        Address srcAddress = {srcRouter, group};
 
         u32 dstRouter = (srcRouter + offset) % localWidth_;
-        std::vector<u32> dstAddress = {dstRouter, group};
+        Address dstAddress = {dstRouter, group};
 
         for (u32 weight = 0; weight < localWeight_; weight++) {
           // create the channel
           std::string channelName =
-              "LocalChannel_" + strop::vecString<u32>(srcAddress, '-') +
-              "-to-" + strop::vecString<u32>(dstAddress, '-') + "-" +
+              "LocalChannel_" + srcAddress.toString('-') +
+              "-to-" + dstAddress.toString('-') + "-" +
               std::to_string(weight);
           // determine the local channel latency
-          if (_settings["channel_mode"].get<std::string>() == "scalar") {
+          u32 channelLatency = localLatency;
+          if (scalarMode) {
             f64 link_dist = fabs((s64)srcRouter - (s64)dstRouter);
-            u32 channelLatency = (u32)(ceil(local_scalar * link_dist));
-
-            // override settings
-            _settings["local_channel"]["latency"] = channelLatency;
+            channelLatency = (u32)(ceil(local_scalar * link_dist));
           }
 
-          Channel* channel = new Channel(channelName, this, numVcs_,
-                                         _settings["local_channel"]);
+          Channel* channel = createRouterChannel(
+              channelName, routers_.at(group).at(srcRouter),
+              routers_.at(group).at(dstRouter), channelLatency);
           localChannels_.push_back(channel);
 
           // determine the port numbers
@@ -195,16 +196,16 @@ Network::Network(const std::string& _name, const Component* _parent,
     for (u32 r = 0; r < localWidth_; r++) {
       // get the router now, for later linking with terminals
       Router* router = routers_.at(group).at(r);
-      std::vector<u32> routerAddress({r, group});
+      Address routerAddress({r, group});
 
       // loop over interfaces
       for (u32 iface = 0; iface < interfacesPerRouter; iface++) {
         // create a vector for the Interface address
-        std::vector<u32> interfaceAddress({iface, r, group});
+        Address interfaceAddress({iface, r, group});
 
         // create an interface name
         std::string interfaceName =
-            "Interface_" + strop::vecString<u32>(interfaceAddress, '-');
+            "Interface_" + interfaceAddress.toString('-');
 
         // create the interface
         u32 interfaceId = translateInterfaceAddressToId(&interfaceAddress);
@@ -217,12 +218,12 @@ Network::Network(const std::string& _name, const Component* _parent,
         for (u32 ch = 0; ch < interfacePorts_; ch++) {
           // create I/O channels
           std::string inChannelName =
-              "Channel_" + strop::vecString<u32>(interfaceAddress, '-') +
-              "-to-" + strop::vecString<u32>(routerAddress, '-') + "_" +
+              "Channel_" + interfaceAddress.toString('-') +
+              "-to-" + routerAddress.toString('-') + "_" +
               std::to_string(ch);
           std::string outChannelName =
-              "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-              strop::vecString<u32>(interfaceAddress, '-') + "_" +
+              "Channel_" + routerAddress.toString('-') + "-to-" +
+              interfaceAddress.toString('-') + "_" +
               std::to_string(ch);
           Channel* inChannel = new Channel(inChannelName, this, numVcs_,
                                            _settings["external_channel"]);
@@ -331,7 +332,7 @@ u32 Network::numInterfaces() const {
 }
 
 Router* Network::getRouter(u32 _id) const {
-  std::vector<u32> routerAddress;
+  Address routerAddress;
   translateRouterIdToAddress(_id, &routerAddress);
   u32 g = routerAddress.at(1);
   u32 r = routerAddress.at(0);
@@ -344,29 +345,29 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   Dragonfly::translateInterfaceIdToAddress(concentration_, interfacePorts_,
                                            localWidth_, _id, _address);
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Dragonfly::translateInterfaceAddressToId(
       concentration_, interfacePorts_, localWidth_, _address);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   Dragonfly::translateRouterIdToAddress(localWidth_, _id, _address);
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Dragonfly::translateRouterAddressToId(localWidth_, _address);
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
   return Dragonfly::computeMinimalHops(_source, _destination, globalWidth_,
                                        globalWeight_, routerGlobalPortBase_,
                                        globalPortsPerRouter_, localWidth_);
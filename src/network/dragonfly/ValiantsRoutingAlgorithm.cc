@@ -23,6 +23,7 @@
 #include "network/dragonfly/util.h"
 #include "routing/util.h"
 #include "strop/strop.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -60,9 +61,9 @@ ValiantsRoutingAlgorithm::~ValiantsRoutingAlgorithm() {
 void ValiantsRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   // addresses
-  const std::vector<u32>* sourceAddress =
+  const Address* sourceAddress =
       _flit->packet()->message()->getSourceAddress();
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   assert(sourceAddress->size() == destinationAddress->size());
 
@@ -80,7 +81,7 @@ void ValiantsRoutingAlgorithm::processRequest(
     assert(packet->getHopCount() == 0);
     // create routing extension header
     // random intermediate address [router, group]
-    std::vector<u32>* re = new std::vector<u32>(2);
+    Address* re = new Address(2);
     // router
     re->at(0) = gSim->rnd.nextU64(0, localWidth_ - 1);
     // group
@@ -100,8 +101,8 @@ void ValiantsRoutingAlgorithm::processRequest(
   }
 
   // get a const pointer to the int address [router, group]
-  const std::vector<u32>* intermediateAddress =
-      reinterpret_cast<const std::vector<u32>*>(packet->getRoutingExtension());
+  const Address* intermediateAddress =
+      reinterpret_cast<const Address*>(packet->getRoutingExtension());
 
   // determine which stage we are in based on VC set
   // if this is a terminal port, force to stage 0
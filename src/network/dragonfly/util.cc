@@ -66,7 +66,7 @@ void computeGlobalToRouterMap(u32 _routerGlobalPortBase,
 
 void translateInterfaceIdToAddress(u32 _concentration, u32 _interfacePorts,
                                    u32 _localWidth, u32 _id,
-                                   std::vector<u32>* _address) {
+                                   Address* _address) {
   _address->resize(3);
   u32 interfacesPerRouter = _concentration / _interfacePorts;
   u32 interfacesPerGroup = _localWidth * interfacesPerRouter;
@@ -83,7 +83,7 @@ void translateInterfaceIdToAddress(u32 _concentration, u32 _interfacePorts,
 
 u32 translateInterfaceAddressToId(u32 _concentration, u32 _interfacePorts,
                                   u32 _localWidth,
-                                  const std::vector<u32>* _address) {
+                                  const Address* _address) {
   u32 interfacesPerRouter = _concentration / _interfacePorts;
   u32 interfacesPerGroup = _localWidth * interfacesPerRouter;
 
@@ -95,22 +95,22 @@ u32 translateInterfaceAddressToId(u32 _concentration, u32 _interfacePorts,
 }
 
 void translateRouterIdToAddress(u32 _localWidth, u32 _id,
-                                std::vector<u32>* _address) {
+                                Address* _address) {
   _address->resize(2);
   _address->at(0) = _id % _localWidth;  // router
   _address->at(1) = _id / _localWidth;  // group
 }
 
 u32 translateRouterAddressToId(u32 _localWidth,
-                               const std::vector<u32>* _address) {
+                               const Address* _address) {
   u32 r = _address->at(0);
   u32 group = _address->at(1);
   u32 base = group * _localWidth;
   return base + r;
 }
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination, u32 _globalWidth,
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination, u32 _globalWidth,
                        u32 _globalWeight, u32 _routerGlobalPortBase,
                        u32 _globalPortsPerRouter, u32 _localWidth) {
   assert(_source->size() == 3);
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 namespace Dragonfly {
 u32 computeOffset(u32 _source, u32 _destination, u32 _width);
@@ -35,18 +36,18 @@ void computeGlobalToRouterMap(u32 _routerGlobalPortBase,
                               u32* _localPort);
 void translateInterfaceIdToAddress(u32 _concentration, u32 _interfacePorts,
                                    u32 _localWidth, u32 _id,
-                                   std::vector<u32>* _address);
+                                   Address* _address);
 u32 translateInterfaceAddressToId(u32 _concentration, u32 _interfacePorts,
                                   u32 _localWidth,
-                                  const std::vector<u32>* _address);
+                                  const Address* _address);
 
 void translateRouterIdToAddress(u32 _localWidth, u32 _id,
-                                std::vector<u32>* _address);
+                                Address* _address);
 u32 translateRouterAddressToId(u32 _localWidth,
-                               const std::vector<u32>* _address);
+                               const Address* _address);
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination, u32 _globalWidth,
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination, u32 _globalWidth,
                        u32 _globalWeight, u32 _routerGlobalPortBase,
                        u32 _globalPortsPerRouter, u32 _localWidth);
 }  // namespace Dragonfly
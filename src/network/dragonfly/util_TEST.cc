@@ -18,6 +18,7 @@
 
 #include "gtest/gtest.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 
 TEST(Dragonfly, computeOffset) {
   // u32 computeOffset(u32 _source, u32 _destination, u32 _width)
@@ -187,7 +188,7 @@ TEST(Dragonfly, translateInterfaceIdToAddress) {
   u32 conc = 4;
   u32 ifacePorts = 2;
   u32 id;
-  std::vector<u32> address;
+  Address address;
   std::vector<u32> exp;
 
   id = 0;
@@ -231,7 +232,7 @@ TEST(Dragonfly, translateInterfaceAddressToId) {
   u32 localWidth = 3;
   u32 conc = 4;
   u32 ifacePorts = 2;
-  std::vector<u32> address;
+  Address address;
 
   address = {0, 2, 6};
   ASSERT_EQ(40u, Dragonfly::translateInterfaceAddressToId(
@@ -257,7 +258,7 @@ TEST(Dragonfly, translateInterfaceAddressToId) {
 TEST(Dragonfly, translateRouterIdToAddress) {
   u32 localWidth = 3;
   u32 id;
-  std::vector<u32> address;
+  Address address;
   std::vector<u32> exp;
 
   id = 10;
@@ -290,10 +291,10 @@ TEST(Dragonfly, translateRouterAddressToId) {
   /*
     u32 translateRouterAddressToId(
     u32 _localWidth,
-    const std::vector<u32>* _address);
+    const Address* _address);
   */
   u32 localWidth = 3;
-  std::vector<u32> address;
+  Address address;
 
   address = {0, 0};
   ASSERT_EQ(0u, Dragonfly::translateRouterAddressToId(localWidth, &address));
@@ -307,14 +308,14 @@ TEST(Dragonfly, translateRouterAddressToId) {
 
 TEST(Dragonfly, computeMinimalHops) {
   /*
-    u32 computeMinimalHops(const std::vector<u32>* _source,
-    const std::vector<u32>* _destination,
+    u32 computeMinimalHops(const Address* _source,
+    const Address* _destination,
     u32 _globalWidth, u32 _globalWeight,
     u32 _routerGlobalPortBase,
     u32 _localWidth);
   */
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   u32 globalWidth = 33;
   u32 globalWeight = 1;
   u32 localWidth = 8;
@@ -325,11 +326,11 @@ TEST(Dragonfly, computeMinimalHops) {
 
   Dragonfly::translateInterfaceIdToAddress(concentration, interfacePorts,
                                            localWidth, 519, &src);
-  std::vector<u32> expSrc({1, 3, 32});
+  Address expSrc({1, 3, 32});
   ASSERT_EQ(src, expSrc);
   Dragonfly::translateInterfaceIdToAddress(concentration, interfacePorts,
                                            localWidth, 18, &dst);
-  std::vector<u32> expDst({0, 1, 1});
+  Address expDst({0, 1, 1});
   ASSERT_EQ(dst, expDst);
   ASSERT_EQ(4u, Dragonfly::computeMinimalHops(
                     &src, &dst, globalWidth, globalWeight, routerPortBase,
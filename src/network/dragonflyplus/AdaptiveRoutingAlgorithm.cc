@@ -0,0 +1,104 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/AdaptiveRoutingAlgorithm.h"
+
+#include <cassert>
+#include <vector>
+
+#include "factory/ObjectFactory.h"
+#include "network/dragonfly/util.h"
+#include "network/dragonflyplus/util.h"
+#include "routing/util.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace DragonflyPlus {
+
+AdaptiveRoutingAlgorithm::AdaptiveRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _leaves,
+    u32 _spines, u32 _groups, u32 _globalWeight, u32 _concentration,
+    u32 _interfacePorts, nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _leaves, _spines, _groups, _globalWeight,
+                       _concentration, _interfacePorts, _settings) {
+  rcs_ = 3;
+  assert(_numVcs >= rcs_);
+}
+
+AdaptiveRoutingAlgorithm::~AdaptiveRoutingAlgorithm() {}
+
+void AdaptiveRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  const Address* destinationAddress =
+      _flit->packet()->message()->getDestinationAddress();
+  u32 destinationGroup = destinationAddress->at(2);
+
+  u32 thisIndex = router_->address().at(0);
+  u32 thisGroup = router_->address().at(1);
+  bool isLeaf = thisIndex < leaves_;
+  bool fromTerminal = isLeaf && inputPort_ < concentration_;
+  bool fromLeaf = !isLeaf && inputPort_ < leaves_;
+  u32 rc = fromTerminal ? kSourceRc : vcToRc(baseVc_, numVcs_, inputVc_, rcs_);
+
+  if (thisGroup == destinationGroup || rc != kSourceRc ||
+      (!isLeaf && !fromLeaf)) {
+    // the source group decisions have been made, a packet arriving on a
+    //  source class global channel is in its intermediate group
+    routeFromIntermediate(thisIndex, thisGroup, destinationAddress);
+  } else if (isLeaf) {
+    // source leaf: spines with a link to the destination group are minimal,
+    //  the others must take a non-minimal global link
+    assert(fromTerminal);
+    u32 globalOffset =
+        Dragonfly::computeOffset(thisGroup, destinationGroup, groups_);
+    std::vector<bool> minimal(spines_, false);
+    for (u32 weight = 0; weight < globalWeight_; weight++) {
+      u32 spine, spinePort;
+      computeGlobalPort(leaves_, spines_, globalWeight_, globalOffset, weight,
+                        &spine, &spinePort);
+      minimal.at(spine) = true;
+    }
+    for (u32 spine = 0; spine < spines_; spine++) {
+      addPort(concentration_ + spine, minimal.at(spine) ? 3 : 5, kSourceRc);
+    }
+  } else {
+    // source spine: global links to the destination group are minimal and
+    //  enter the destination class, all others lead to an intermediate group
+    u32 thisSpine = thisIndex - leaves_;
+    u32 minimalOffset =
+        Dragonfly::computeOffset(thisGroup, destinationGroup, groups_);
+    for (u32 port = leaves_; port < leaves_ + globalPortsPerSpine_; port++) {
+      u32 globalOffset;
+      if (computeGlobalOffset(leaves_, spines_, groups_, globalWeight_,
+                              thisSpine, port, &globalOffset)) {
+        if (globalOffset == minimalOffset) {
+          addPort(port, 2, kDestinationRc);
+        } else {
+          addPort(port, 4, kSourceRc);
+        }
+      }
+    }
+  }
+
+  reduce(_response);
+}
+
+}  // namespace DragonflyPlus
+
+registerWithObjectFactory("adaptive", DragonflyPlus::RoutingAlgorithm,
+                          DragonflyPlus::AdaptiveRoutingAlgorithm,
+                          DRAGONFLYPLUS_ROUTINGALGORITHM_ARGS);
@@ -0,0 +1,85 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/MinimalRoutingAlgorithm.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace DragonflyPlus {
+
+MinimalRoutingAlgorithm::MinimalRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _leaves,
+    u32 _spines, u32 _groups, u32 _globalWeight, u32 _concentration,
+    u32 _interfacePorts, nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _leaves, _spines, _groups, _globalWeight,
+                       _concentration, _interfacePorts, _settings) {
+  // minimal paths only go up, across, then down so one class suffices
+  rcs_ = 1;
+}
+
+MinimalRoutingAlgorithm::~MinimalRoutingAlgorithm() {}
+
+void MinimalRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  const Address* destinationAddress =
+      _flit->packet()->message()->getDestinationAddress();
+  u32 destinationTerminal = destinationAddress->at(0);
+  u32 destinationLeaf = destinationAddress->at(1);
+  u32 destinationGroup = destinationAddress->at(2);
+
+  u32 thisIndex = router_->address().at(0);
+  u32 thisGroup = router_->address().at(1);
+
+  if (thisIndex < leaves_) {
+    // leaf
+    if (thisGroup == destinationGroup && thisIndex == destinationLeaf) {
+      addExitPorts(destinationTerminal);
+    } else {
+      // only the source leaf routes upward
+      assert(inputPort_ < concentration_);
+      if (thisGroup == destinationGroup) {
+        addAllUpPorts(2, 0);
+      } else {
+        addUpPortsToGroup(thisGroup, destinationGroup, 3, 0);
+      }
+    }
+  } else {
+    // spine
+    u32 thisSpine = thisIndex - leaves_;
+    if (thisGroup == destinationGroup) {
+      addPort(destinationLeaf, 1, 0);
+    } else {
+      // the source leaf only chose spines with a link to the destination
+      bool found = addGlobalPortsToGroup(thisSpine, thisGroup,
+                                         destinationGroup, 2, 0);
+      (void)found;
+      assert(found);
+    }
+  }
+
+  reduce(_response);
+}
+
+}  // namespace DragonflyPlus
+
+registerWithObjectFactory("minimal", DragonflyPlus::RoutingAlgorithm,
+                          DragonflyPlus::MinimalRoutingAlgorithm,
+                          DRAGONFLYPLUS_ROUTINGALGORITHM_ARGS);
@@ -0,0 +1,292 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/Network.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "network/dragonflyplus/InjectionAlgorithm.h"
+#include "network/dragonflyplus/RoutingAlgorithm.h"
+#include "network/dragonflyplus/util.h"
+
+namespace DragonflyPlus {
+
+Network::Network(const std::string& _name, const Component* _parent,
+                 MetadataHandler* _metadataHandler, nlohmann::json _settings)
+    : ::Network(_name, _parent, _metadataHandler, _settings) {
+  // concentration
+  assert(_settings.contains("concentration"));
+  concentration_ = _settings["concentration"].get<u32>();
+  assert(concentration_ > 0);
+
+  // interface ports
+  interfacePorts_ = _settings["interface_ports"].get<u32>();
+  assert(interfacePorts_ > 0);
+  assert(concentration_ % interfacePorts_ == 0);
+
+  // groups
+  assert(_settings.contains("groups"));
+  groups_ = _settings["groups"].get<u32>();
+  assert(groups_ > 0);
+  assert(_settings.contains("leaves"));
+  leaves_ = _settings["leaves"].get<u32>();
+  assert(leaves_ > 0);
+  assert(_settings.contains("spines"));
+  spines_ = _settings["spines"].get<u32>();
+  assert(spines_ > 0);
+  assert(_settings.contains("global_weight"));
+  globalWeight_ = _settings["global_weight"].get<u32>();
+  assert(globalWeight_ > 0);
+
+  // channels
+  assert(_settings.contains("global_channel"));
+  assert(_settings.contains("local_channel"));
+  assert(_settings.contains("external_channel"));
+
+  // radix
+  globalPortsPerSpine_ =
+      computeGlobalPortsPerSpine(spines_, groups_, globalWeight_);
+  u32 leafRadix = concentration_ + spines_;
+  u32 spineRadix = leaves_ + globalPortsPerSpine_;
+  dbgprintf("leafRadix = %u", leafRadix);
+  dbgprintf("spineRadix = %u", spineRadix);
+
+  // parse the protocol classes description
+  loadProtocolClassInfo(_settings["protocol_classes"]);
+
+  // create the routers, leaves then spines in each group
+  u32 routersPerGroup = leaves_ + spines_;
+  routers_.resize(groups_ * routersPerGroup, nullptr);
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Address routerAddress;
+    translateRouterIdToAddress(routerId, &routerAddress);
+    u32 radix = (routerAddress.at(0) < leaves_) ? leafRadix : spineRadix;
+    std::string routerName = "Router_" + routerAddress.toString('-');
+    routers_.at(routerId) = Router::create(
+        routerName, this, this, routerId, routerAddress, radix, numVcs_,
+        _metadataHandler, _settings["router"]);
+  }
+
+  // link every leaf to every spine within each group
+  for (u32 group = 0; group < groups_; group++) {
+    u32 groupBase = group * routersPerGroup;
+    for (u32 leaf = 0; leaf < leaves_; leaf++) {
+      Router* leafRouter = routers_.at(groupBase + leaf);
+      for (u32 spine = 0; spine < spines_; spine++) {
+        Router* spineRouter = routers_.at(groupBase + leaves_ + spine);
+
+        std::string upChannelName =
+            "UpChannel_" + leafRouter->address().toString('-') + "-to-" +
+            spineRouter->address().toString('-');
+        Channel* up = createRouterChannel(upChannelName, leafRouter,
+                                          spineRouter,
+                                          _settings["local_channel"]);
+        localChannels_.push_back(up);
+        leafRouter->setOutputChannel(concentration_ + spine, up);
+        spineRouter->setInputChannel(leaf, up);
+
+        std::string downChannelName =
+            "DownChannel_" + spineRouter->address().toString('-') + "-to-" +
+            leafRouter->address().toString('-');
+        Channel* down = createRouterChannel(downChannelName, spineRouter,
+                                            leafRouter,
+                                            _settings["local_channel"]);
+        localChannels_.push_back(down);
+        spineRouter->setOutputChannel(leaf, down);
+        leafRouter->setInputChannel(concentration_ + spine, down);
+      }
+    }
+  }
+
+  // link the groups via the spines' global ports
+  for (u32 srcGroup = 0; srcGroup < groups_; srcGroup++) {
+    for (u32 fwdOffset = 1; fwdOffset < groups_; fwdOffset++) {
+      u32 dstGroup = (srcGroup + fwdOffset) % groups_;
+      u32 reverseOffset = groups_ - fwdOffset;
+      for (u32 weight = 0; weight < globalWeight_; weight++) {
+        u32 srcSpine, srcPort;
+        computeGlobalPort(leaves_, spines_, globalWeight_, fwdOffset, weight,
+                          &srcSpine, &srcPort);
+        u32 dstSpine, dstPort;
+        computeGlobalPort(leaves_, spines_, globalWeight_, reverseOffset,
+                          weight, &dstSpine, &dstPort);
+        Router* srcRouter =
+            routers_.at((srcGroup * routersPerGroup) + leaves_ + srcSpine);
+        Router* dstRouter =
+            routers_.at((dstGroup * routersPerGroup) + leaves_ + dstSpine);
+
+        std::string globalChannelName =
+            "GlobalChannel_" + srcRouter->address().toString('-') + "-to-" +
+            dstRouter->address().toString('-') + "-" + std::to_string(weight);
+        Channel* globalChannel = createRouterChannel(
+            globalChannelName, srcRouter, dstRouter,
+            _settings["global_channel"]);
+        globalChannels_.push_back(globalChannel);
+
+        srcRouter->setOutputChannel(srcPort, globalChannel);
+        dstRouter->setInputChannel(dstPort, globalChannel);
+      }
+    }
+  }
+
+  // create the interfaces and link them with the leaves
+  u32 interfacesPerLeaf = concentration_ / interfacePorts_;
+  interfaces_.resize(groups_ * leaves_ * interfacesPerLeaf, nullptr);
+  for (u32 interfaceId = 0; interfaceId < interfaces_.size(); interfaceId++) {
+    Address interfaceAddress;
+    translateInterfaceIdToAddress(interfaceId, &interfaceAddress);
+    u32 iface = interfaceAddress.at(0);
+    u32 leaf = interfaceAddress.at(1);
+    u32 group = interfaceAddress.at(2);
+    Router* router = routers_.at((group * routersPerGroup) + leaf);
+
+    std::string interfaceName = "Interface_" + interfaceAddress.toString('-');
+    Interface* interface = Interface::create(
+        interfaceName, this, this, interfaceId, interfaceAddress,
+        interfacePorts_, numVcs_, _metadataHandler, _settings["interface"]);
+    interfaces_.at(interfaceId) = interface;
+
+    // create and link channels
+    for (u32 ch = 0; ch < interfacePorts_; ch++) {
+      std::string inChannelName =
+          "Channel_" + interfaceAddress.toString('-') + "-to-" +
+          router->address().toString('-') + "_" + std::to_string(ch);
+      std::string outChannelName =
+          "Channel_" + router->address().toString('-') + "-to-" +
+          interfaceAddress.toString('-') + "_" + std::to_string(ch);
+      Channel* inChannel = new Channel(inChannelName, this, numVcs_,
+                                       _settings["external_channel"]);
+      Channel* outChannel = new Channel(outChannelName, this, numVcs_,
+                                        _settings["external_channel"]);
+      externalChannels_.push_back(inChannel);
+      externalChannels_.push_back(outChannel);
+
+      u32 routerPort = (iface * interfacePorts_) + ch;
+      router->setInputChannel(routerPort, inChannel);
+      interface->setOutputChannel(ch, inChannel);
+      router->setOutputChannel(routerPort, outChannel);
+      interface->setInputChannel(ch, outChannel);
+    }
+  }
+
+  // sanity checks
+  assert(routers_.size() == numRouters());
+  assert(interfaces_.size() == numInterfaces());
+  dbgprintf("numRouters = %u", numRouters());
+  dbgprintf("numInterfaces = %u", numInterfaces());
+
+  // clear the protocol class info
+  clearProtocolClassInfo();
+}
+
+Network::~Network() {
+  for (Router* router : routers_) {
+    delete router;
+  }
+  for (Interface* interface : interfaces_) {
+    delete interface;
+  }
+  for (Channel* channel : globalChannels_) {
+    delete channel;
+  }
+  for (Channel* channel : localChannels_) {
+    delete channel;
+  }
+  for (Channel* channel : externalChannels_) {
+    delete channel;
+  }
+}
+
+::InjectionAlgorithm* Network::createInjectionAlgorithm(
+    u32 _inputPc, const std::string& _name, const Component* _parent,
+    Interface* _interface) {
+  // get the info
+  const ::Network::PcSettings& settings = pcSettings(_inputPc);
+
+  // call the injection algorithm factory
+  return InjectionAlgorithm::create(_name, _parent, _interface, settings.baseVc,
+                                    settings.numVcs, _inputPc,
+                                    settings.injection);
+}
+
+::RoutingAlgorithm* Network::createRoutingAlgorithm(u32 _inputPort,
+                                                    u32 _inputVc,
+                                                    const std::string& _name,
+                                                    const Component* _parent,
+                                                    Router* _router) {
+  // get the info
+  u32 pc = vcToPc(_inputVc);
+  const ::Network::PcSettings& settings = pcSettings(pc);
+
+  // call the routing algorithm factory
+  return RoutingAlgorithm::create(
+      _name, _parent, _router, settings.baseVc, settings.numVcs, _inputPort,
+      _inputVc, leaves_, spines_, groups_, globalWeight_, concentration_,
+      interfacePorts_, settings.routing);
+}
+
+u32 Network::numRouters() const {
+  return groups_ * (leaves_ + spines_);
+}
+
+u32 Network::numInterfaces() const {
+  return groups_ * leaves_ * (concentration_ / interfacePorts_);
+}
+
+Router* Network::getRouter(u32 _id) const {
+  return routers_.at(_id);
+}
+
+Interface* Network::getInterface(u32 _id) const {
+  return interfaces_.at(_id);
+}
+
+void Network::translateInterfaceIdToAddress(u32 _id,
+                                            Address* _address) const {
+  DragonflyPlus::translateInterfaceIdToAddress(concentration_, interfacePorts_,
+                                               leaves_, _id, _address);
+}
+
+u32 Network::translateInterfaceAddressToId(const Address* _address) const {
+  return DragonflyPlus::translateInterfaceAddressToId(
+      concentration_, interfacePorts_, leaves_, _address);
+}
+
+void Network::translateRouterIdToAddress(u32 _id, Address* _address) const {
+  DragonflyPlus::translateRouterIdToAddress(leaves_, spines_, _id, _address);
+}
+
+u32 Network::translateRouterAddressToId(const Address* _address) const {
+  return DragonflyPlus::translateRouterAddressToId(leaves_, spines_, _address);
+}
+
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
+  return DragonflyPlus::computeMinimalHops(_source, _destination);
+}
+
+void Network::collectChannels(std::vector<Channel*>* _channels) {
+  _channels->insert(_channels->end(), externalChannels_.begin(),
+                    externalChannels_.end());
+  _channels->insert(_channels->end(), localChannels_.begin(),
+                    localChannels_.end());
+  _channels->insert(_channels->end(), globalChannels_.begin(),
+                    globalChannels_.end());
+}
+
+}  // namespace DragonflyPlus
+
+registerWithObjectFactory("dragonfly_plus", ::Network, DragonflyPlus::Network,
+                          NETWORK_ARGS);
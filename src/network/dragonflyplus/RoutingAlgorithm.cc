@@ -0,0 +1,205 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/RoutingAlgorithm.h"
+
+#include <cassert>
+#include <tuple>
+#include <unordered_set>
+
+#include "factory/ObjectFactory.h"
+#include "network/dragonfly/util.h"
+#include "network/dragonflyplus/util.h"
+
+namespace DragonflyPlus {
+
+RoutingAlgorithm::RoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _leaves,
+    u32 _spines, u32 _groups, u32 _globalWeight, u32 _concentration,
+    u32 _interfacePorts, nlohmann::json _settings)
+    : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                         _inputVc, _settings),
+      leaves_(_leaves),
+      spines_(_spines),
+      groups_(_groups),
+      globalWeight_(_globalWeight),
+      concentration_(_concentration),
+      interfacePorts_(_interfacePorts),
+      globalPortsPerSpine_(
+          computeGlobalPortsPerSpine(_spines, _groups, _globalWeight)),
+      rcs_(1),
+      mode_(parseRoutingMode(_settings["mode"].get<std::string>())) {
+  // create the reduction
+  reduction_ = Reduction::create("Reduction", this, _router, mode_, true,
+                                 _settings["reduction"]);
+}
+
+RoutingAlgorithm::~RoutingAlgorithm() {
+  delete reduction_;
+}
+
+RoutingAlgorithm* RoutingAlgorithm::create(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _leaves,
+    u32 _spines, u32 _groups, u32 _globalWeight, u32 _concentration,
+    u32 _interfacePorts, nlohmann::json _settings) {
+  // retrieve the algorithm
+  const std::string& algorithm = _settings["algorithm"].get<std::string>();
+
+  // attempt to create the routing algorithm
+  RoutingAlgorithm* ra = factory::ObjectFactory<
+      RoutingAlgorithm, DRAGONFLYPLUS_ROUTINGALGORITHM_ARGS>::
+      create(algorithm, _name, _parent, _router, _baseVc, _numVcs, _inputPort,
+             _inputVc, _leaves, _spines, _groups, _globalWeight,
+             _concentration, _interfacePorts, _settings);
+
+  // check that the factory had this type
+  if (ra == nullptr) {
+    fprintf(stderr, "invalid Dragonfly+ routing algorithm: %s\n",
+            algorithm.c_str());
+    assert(false);
+  }
+  return ra;
+}
+
+void RoutingAlgorithm::addPort(u32 _port, u32 _hops, u32 _routingClass) {
+  if (routingModeIsPort(mode_)) {
+    f64 cong = portCongestion(mode_, router_, inputPort_, inputVc_, _port);
+    reduction_->add(_port, _routingClass, _hops, cong);
+  } else if (_routingClass == U32_MAX) {
+    // add all VCs in the port
+    for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+      f64 cong = router_->congestionStatus(inputPort_, inputVc_, _port, vc);
+      reduction_->add(_port, vc, _hops, cong);
+    }
+  } else {
+    // add all VCs in the specified routing class
+    for (u32 vc = baseVc_ + _routingClass; vc < baseVc_ + numVcs_;
+         vc += rcs_) {
+      f64 cong = router_->congestionStatus(inputPort_, inputVc_, _port, vc);
+      reduction_->add(_port, vc, _hops, cong);
+    }
+  }
+}
+
+void RoutingAlgorithm::addExitPorts(u32 _terminal) {
+  u32 basePort = _terminal * interfacePorts_;
+  for (u32 offset = 0; offset < interfacePorts_; offset++) {
+    addPort(basePort + offset, 1, U32_MAX);
+  }
+}
+
+void RoutingAlgorithm::addAllUpPorts(u32 _hops, u32 _routingClass) {
+  for (u32 spine = 0; spine < spines_; spine++) {
+    addPort(concentration_ + spine, _hops, _routingClass);
+  }
+}
+
+void RoutingAlgorithm::addUpPortsToGroup(u32 _thisGroup, u32 _group,
+                                         u32 _hops, u32 _routingClass) {
+  // only the spines holding a global link to the group are used
+  u32 globalOffset = Dragonfly::computeOffset(_thisGroup, _group, groups_);
+  for (u32 weight = 0; weight < globalWeight_; weight++) {
+    u32 spine, spinePort;
+    computeGlobalPort(leaves_, spines_, globalWeight_, globalOffset, weight,
+                      &spine, &spinePort);
+    addPort(concentration_ + spine, _hops, _routingClass);
+  }
+}
+
+void RoutingAlgorithm::addAllDownPorts(u32 _hops, u32 _routingClass) {
+  for (u32 leaf = 0; leaf < leaves_; leaf++) {
+    addPort(leaf, _hops, _routingClass);
+  }
+}
+
+bool RoutingAlgorithm::addGlobalPortsToGroup(u32 _thisSpine, u32 _thisGroup,
+                                             u32 _group, u32 _hops,
+                                             u32 _routingClass) {
+  bool found = false;
+  u32 globalOffset = Dragonfly::computeOffset(_thisGroup, _group, groups_);
+  for (u32 weight = 0; weight < globalWeight_; weight++) {
+    u32 spine, spinePort;
+    computeGlobalPort(leaves_, spines_, globalWeight_, globalOffset, weight,
+                      &spine, &spinePort);
+    if (spine == _thisSpine) {
+      addPort(spinePort, _hops, _routingClass);
+      found = true;
+    }
+  }
+  return found;
+}
+
+void RoutingAlgorithm::routeFromIntermediate(
+    u32 _thisIndex, u32 _thisGroup, const Address* _destinationAddress) {
+  u32 destinationTerminal = _destinationAddress->at(0);
+  u32 destinationLeaf = _destinationAddress->at(1);
+  u32 destinationGroup = _destinationAddress->at(2);
+
+  if (_thisIndex < leaves_) {
+    // leaf
+    if (_thisGroup == destinationGroup) {
+      if (_thisIndex == destinationLeaf) {
+        addExitPorts(destinationTerminal);
+      } else {
+        // any spine reaches the destination leaf
+        addAllUpPorts(2, kIntermediateRc);
+      }
+    } else {
+      // detour through a spine with a global link to the destination group
+      addUpPortsToGroup(_thisGroup, destinationGroup, 3, kIntermediateRc);
+    }
+  } else {
+    // spine
+    u32 thisSpine = _thisIndex - leaves_;
+    if (_thisGroup == destinationGroup) {
+      addPort(destinationLeaf, 1, kDestinationRc);
+    } else if (!addGlobalPortsToGroup(thisSpine, _thisGroup, destinationGroup,
+                                      2, kDestinationRc)) {
+      // this spine has no link to the destination group, detour through a
+      //  leaf to reach a spine that does
+      addAllDownPorts(4, kIntermediateRc);
+    }
+  }
+}
+
+void RoutingAlgorithm::reduce(RoutingAlgorithm::Response* _response) {
+  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+      reduction_->reduce(nullptr);
+  for (const auto& t : *outputs) {
+    u32 port = std::get<0>(t);
+    if (routingModeIsPort(mode_)) {
+      // port mode
+      // add all VCs in the specified routing class
+      u32 rc = std::get<1>(t);
+      if (rc != U32_MAX) {
+        for (u32 vc = baseVc_ + rc; vc < baseVc_ + numVcs_; vc += rcs_) {
+          _response->add(port, vc);
+        }
+      } else {
+        // exit - all VCs
+        for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+          _response->add(port, vc);
+        }
+      }
+    } else {
+      // vc mode
+      u32 vc = std::get<1>(t);
+      _response->add(port, vc);
+    }
+  }
+}
+
+}  // namespace DragonflyPlus
@@ -0,0 +1,90 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_DRAGONFLYPLUS_ROUTINGALGORITHM_H_
+#define NETWORK_DRAGONFLYPLUS_ROUTINGALGORITHM_H_
+
+#include <string>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+#include "routing/Reduction.h"
+#include "routing/RoutingAlgorithm.h"
+#include "routing/mode.h"
+
+#define DRAGONFLYPLUS_ROUTINGALGORITHM_ARGS                               \
+  const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, \
+      u32, u32, u32, u32, u32, nlohmann::json
+
+namespace DragonflyPlus {
+
+class RoutingAlgorithm : public ::RoutingAlgorithm {
+ public:
+  RoutingAlgorithm(const std::string& _name, const Component* _parent,
+                   Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
+                   u32 _inputVc, u32 _leaves, u32 _spines, u32 _groups,
+                   u32 _globalWeight, u32 _concentration, u32 _interfacePorts,
+                   nlohmann::json _settings);
+  virtual ~RoutingAlgorithm();
+
+  // this is a routing algorithm factory for the Dragonfly+ topology
+  static RoutingAlgorithm* create(DRAGONFLYPLUS_ROUTINGALGORITHM_ARGS);
+
+ protected:
+  // these are the routing classes of the non-minimal algorithms:
+  //  source: up and global channels toward the intermediate group
+  //  intermediate: down and up channels within the intermediate group
+  //  destination: global channels into and down channels within the
+  //    destination group
+  static const u32 kSourceRc = 0;
+  static const u32 kIntermediateRc = 1;
+  static const u32 kDestinationRc = 2;
+
+  // these add candidate output ports to the reduction
+  void addPort(u32 _port, u32 _hops, u32 _routingClass);
+  void addExitPorts(u32 _terminal);
+  void addAllUpPorts(u32 _hops, u32 _routingClass);
+  void addUpPortsToGroup(u32 _thisGroup, u32 _group, u32 _hops,
+                         u32 _routingClass);
+  void addAllDownPorts(u32 _hops, u32 _routingClass);
+  // this returns false if this spine has no global ports to the group
+  bool addGlobalPortsToGroup(u32 _thisSpine, u32 _thisGroup, u32 _group,
+                             u32 _hops, u32 _routingClass);
+
+  // this routes a packet that is in its intermediate group or has left it,
+  //  using the intermediate and destination routing classes
+  void routeFromIntermediate(u32 _thisIndex, u32 _thisGroup,
+                             const Address* _destinationAddress);
+
+  // this reduces the added ports into the response
+  void reduce(RoutingAlgorithm::Response* _response);
+
+  const u32 leaves_;
+  const u32 spines_;
+  const u32 groups_;
+  const u32 globalWeight_;
+  const u32 concentration_;
+  const u32 interfacePorts_;
+  const u32 globalPortsPerSpine_;
+
+  u32 rcs_;  // set by each algorithm
+  const RoutingMode mode_;
+  Reduction* reduction_;
+};
+
+}  // namespace DragonflyPlus
+
+#endif  // NETWORK_DRAGONFLYPLUS_ROUTINGALGORITHM_H_
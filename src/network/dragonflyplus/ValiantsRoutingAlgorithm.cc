@@ -0,0 +1,106 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/ValiantsRoutingAlgorithm.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "routing/util.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace DragonflyPlus {
+
+ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc, u32 _leaves,
+    u32 _spines, u32 _groups, u32 _globalWeight, u32 _concentration,
+    u32 _interfacePorts, nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _leaves, _spines, _groups, _globalWeight,
+                       _concentration, _interfacePorts, _settings) {
+  rcs_ = 3;
+  assert(_numVcs >= rcs_);
+}
+
+ValiantsRoutingAlgorithm::~ValiantsRoutingAlgorithm() {}
+
+void ValiantsRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  Packet* packet = _flit->packet();
+  const Address* destinationAddress =
+      packet->message()->getDestinationAddress();
+  u32 destinationTerminal = destinationAddress->at(0);
+  u32 destinationLeaf = destinationAddress->at(1);
+  u32 destinationGroup = destinationAddress->at(2);
+
+  u32 thisIndex = router_->address().at(0);
+  u32 thisGroup = router_->address().at(1);
+  bool fromTerminal = thisIndex < leaves_ && inputPort_ < concentration_;
+
+  // the source leaf chooses the intermediate group [group]
+  if (packet->getRoutingExtension() == nullptr) {
+    assert(fromTerminal);
+    Address* re = new Address(1);
+    if (thisGroup == destinationGroup) {
+      // traffic within a group is already spread across all spines
+      re->at(0) = thisGroup;
+    } else {
+      re->at(0) = gSim->rnd.nextU64(0, groups_ - 1);
+    }
+    packet->setRoutingExtension(re);
+  }
+  const Address* intermediateAddress =
+      reinterpret_cast<const Address*>(packet->getRoutingExtension());
+  u32 intermediateGroup = intermediateAddress->at(0);
+
+  // determine whether the packet is still heading to the intermediate group
+  bool toIntermediate;
+  if (fromTerminal) {
+    toIntermediate = thisGroup != intermediateGroup;
+  } else {
+    u32 rc = vcToRc(baseVc_, numVcs_, inputVc_, rcs_);
+    toIntermediate = rc == kSourceRc && thisGroup != intermediateGroup;
+  }
+
+  if (thisIndex < leaves_ && thisGroup == destinationGroup &&
+      thisIndex == destinationLeaf) {
+    // exit the network
+    addExitPorts(destinationTerminal);
+    delete intermediateAddress;
+    packet->setRoutingExtension(nullptr);
+  } else if (!toIntermediate) {
+    routeFromIntermediate(thisIndex, thisGroup, destinationAddress);
+  } else if (thisIndex < leaves_) {
+    // source leaf
+    addUpPortsToGroup(thisGroup, intermediateGroup, 5, kSourceRc);
+  } else {
+    // source spine
+    u32 thisSpine = thisIndex - leaves_;
+    bool found = addGlobalPortsToGroup(thisSpine, thisGroup,
+                                       intermediateGroup, 4, kSourceRc);
+    (void)found;
+    assert(found);
+  }
+
+  reduce(_response);
+}
+
+}  // namespace DragonflyPlus
+
+registerWithObjectFactory("valiants", DragonflyPlus::RoutingAlgorithm,
+                          DragonflyPlus::ValiantsRoutingAlgorithm,
+                          DRAGONFLYPLUS_ROUTINGALGORITHM_ARGS);
@@ -0,0 +1,100 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/util.h"
+
+#include <cassert>
+
+namespace DragonflyPlus {
+
+u32 computeGlobalPortsPerSpine(u32 _spines, u32 _groups, u32 _globalWeight) {
+  u32 groupPorts = (_groups - 1) * _globalWeight;
+  return (groupPorts + _spines - 1) / _spines;
+}
+
+void computeGlobalPort(u32 _leaves, u32 _spines, u32 _globalWeight,
+                       u32 _globalOffset, u32 _weight, u32* _spine,
+                       u32* _spinePort) {
+  assert(_globalOffset > 0);
+  assert(_weight < _globalWeight);
+
+  // the group's global ports are striped across the spines so that the links
+  //  to each remote group are spread over as many spines as possible
+  u32 groupPort = ((_globalOffset - 1) * _globalWeight) + _weight;
+  *_spine = groupPort % _spines;
+  *_spinePort = _leaves + (groupPort / _spines);
+}
+
+bool computeGlobalOffset(u32 _leaves, u32 _spines, u32 _groups,
+                         u32 _globalWeight, u32 _spine, u32 _spinePort,
+                         u32* _globalOffset) {
+  assert(_spine < _spines);
+  assert(_spinePort >= _leaves);
+  u32 groupPort = ((_spinePort - _leaves) * _spines) + _spine;
+  if (groupPort >= (_groups - 1) * _globalWeight) {
+    return false;
+  }
+  *_globalOffset = (groupPort / _globalWeight) + 1;
+  return true;
+}
+
+void translateInterfaceIdToAddress(u32 _concentration, u32 _interfacePorts,
+                                   u32 _leaves, u32 _id, Address* _address) {
+  u32 interfacesPerLeaf = _concentration / _interfacePorts;
+  _address->resize(3);
+  _address->at(0) = _id % interfacesPerLeaf;
+  _id /= interfacesPerLeaf;
+  _address->at(1) = _id % _leaves;
+  _address->at(2) = _id / _leaves;
+}
+
+u32 translateInterfaceAddressToId(u32 _concentration, u32 _interfacePorts,
+                                  u32 _leaves, const Address* _address) {
+  u32 interfacesPerLeaf = _concentration / _interfacePorts;
+  assert(_address->at(0) < interfacesPerLeaf);
+  assert(_address->at(1) < _leaves);
+  return (((_address->at(2) * _leaves) + _address->at(1)) *
+          interfacesPerLeaf) + _address->at(0);
+}
+
+void translateRouterIdToAddress(u32 _leaves, u32 _spines, u32 _id,
+                                Address* _address) {
+  u32 routersPerGroup = _leaves + _spines;
+  _address->resize(2);
+  _address->at(0) = _id % routersPerGroup;
+  _address->at(1) = _id / routersPerGroup;
+}
+
+u32 translateRouterAddressToId(u32 _leaves, u32 _spines,
+                               const Address* _address) {
+  u32 routersPerGroup = _leaves + _spines;
+  assert(_address->at(0) < routersPerGroup);
+  return (_address->at(1) * routersPerGroup) + _address->at(0);
+}
+
+u32 computeMinimalHops(const Address* _source, const Address* _destination) {
+  assert(_source->size() == 3);
+  assert(_destination->size() == 3);
+  if (_source->at(2) != _destination->at(2)) {
+    // leaf, spine, spine, leaf
+    return 4;
+  } else if (_source->at(1) != _destination->at(1)) {
+    // leaf, spine, leaf
+    return 3;
+  } else {
+    return 1;
+  }
+}
+
+}  // namespace DragonflyPlus
@@ -0,0 +1,65 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_DRAGONFLYPLUS_UTIL_H_
+#define NETWORK_DRAGONFLYPLUS_UTIL_H_
+
+#include "prim/prim.h"
+#include "types/Address.h"
+
+/*
+ * A Dragonfly+ group is a two level fat tree of leaf and spine routers. Every
+ *  leaf connects to every spine and terminals attach to the leaves. The spines
+ *  hold the global ports which connect all groups to each other.
+ *
+ * Router addresses are [index, group] where leaves have indices
+ *  [0, leaves) and spines have indices [leaves, leaves + spines).
+ * Interface addresses are [interface, leaf, group].
+ *
+ * Leaf ports:  [0, concentration) terminals,
+ *              [concentration, concentration + spines) up to each spine
+ * Spine ports: [0, leaves) down to each leaf,
+ *              [leaves, leaves + globalPortsPerSpine) global
+ */
+namespace DragonflyPlus {
+
+u32 computeGlobalPortsPerSpine(u32 _spines, u32 _groups, u32 _globalWeight);
+
+// this computes the spine and spine port that hold a group's global link for
+//  a given group offset and weight
+void computeGlobalPort(u32 _leaves, u32 _spines, u32 _globalWeight,
+                       u32 _globalOffset, u32 _weight, u32* _spine,
+                       u32* _spinePort);
+
+// this computes the group offset of a spine's global port, false is returned
+//  if the port isn't connected
+bool computeGlobalOffset(u32 _leaves, u32 _spines, u32 _groups,
+                         u32 _globalWeight, u32 _spine, u32 _spinePort,
+                         u32* _globalOffset);
+
+void translateInterfaceIdToAddress(u32 _concentration, u32 _interfacePorts,
+                                   u32 _leaves, u32 _id, Address* _address);
+u32 translateInterfaceAddressToId(u32 _concentration, u32 _interfacePorts,
+                                  u32 _leaves, const Address* _address);
+
+void translateRouterIdToAddress(u32 _leaves, u32 _spines, u32 _id,
+                                Address* _address);
+u32 translateRouterAddressToId(u32 _leaves, u32 _spines,
+                               const Address* _address);
+
+u32 computeMinimalHops(const Address* _source, const Address* _destination);
+
+}  // namespace DragonflyPlus
+
+#endif  // NETWORK_DRAGONFLYPLUS_UTIL_H_
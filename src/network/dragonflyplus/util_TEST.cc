@@ -0,0 +1,133 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/dragonflyplus/util.h"
+
+#include <set>
+#include <tuple>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+#include "types/Address.h"
+
+TEST(DragonflyPlus, computeGlobalPortsPerSpine) {
+  ASSERT_EQ(DragonflyPlus::computeGlobalPortsPerSpine(4, 9, 2), 4u);
+  ASSERT_EQ(DragonflyPlus::computeGlobalPortsPerSpine(4, 5, 1), 1u);
+  ASSERT_EQ(DragonflyPlus::computeGlobalPortsPerSpine(3, 5, 1), 2u);
+}
+
+TEST(DragonflyPlus, computeGlobalPort) {
+  for (u32 leaves = 1; leaves < 4; leaves++) {
+    for (u32 spines = 1; spines < 5; spines++) {
+      for (u32 groups = 2; groups < 7; groups++) {
+        for (u32 globalWeight = 1; globalWeight < 4; globalWeight++) {
+          u32 globalPortsPerSpine = DragonflyPlus::computeGlobalPortsPerSpine(
+              spines, groups, globalWeight);
+
+          // every group link lands on a unique valid spine port which maps
+          //  back to the same offset
+          std::set<std::tuple<u32, u32>> used;
+          for (u32 offset = 1; offset < groups; offset++) {
+            for (u32 weight = 0; weight < globalWeight; weight++) {
+              u32 spine, spinePort;
+              DragonflyPlus::computeGlobalPort(leaves, spines, globalWeight,
+                                               offset, weight, &spine,
+                                               &spinePort);
+              ASSERT_LT(spine, spines);
+              ASSERT_GE(spinePort, leaves);
+              ASSERT_LT(spinePort, leaves + globalPortsPerSpine);
+              bool inserted =
+                  used.insert(std::make_tuple(spine, spinePort)).second;
+              ASSERT_TRUE(inserted);
+
+              u32 act;
+              ASSERT_TRUE(DragonflyPlus::computeGlobalOffset(
+                  leaves, spines, groups, globalWeight, spine, spinePort,
+                  &act));
+              ASSERT_EQ(act, offset);
+            }
+          }
+
+          // all other spine ports are unconnected
+          for (u32 spine = 0; spine < spines; spine++) {
+            for (u32 port = leaves; port < leaves + globalPortsPerSpine;
+                 port++) {
+              u32 act;
+              bool connected = DragonflyPlus::computeGlobalOffset(
+                  leaves, spines, groups, globalWeight, spine, port, &act);
+              ASSERT_EQ(connected,
+                        used.count(std::make_tuple(spine, port)) == 1);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(DragonflyPlus, translateInterface) {
+  u32 concentration = 4;
+  u32 interfacePorts = 2;
+  u32 leaves = 3;
+  u32 groups = 5;
+  Address exp(3);
+  u32 id = 0;
+  for (u32 group = 0; group < groups; group++) {
+    for (u32 leaf = 0; leaf < leaves; leaf++) {
+      for (u32 iface = 0; iface < concentration / interfacePorts; iface++) {
+        exp.at(0) = iface;
+        exp.at(1) = leaf;
+        exp.at(2) = group;
+        Address act;
+        DragonflyPlus::translateInterfaceIdToAddress(
+            concentration, interfacePorts, leaves, id, &act);
+        ASSERT_EQ(act, exp);
+        ASSERT_EQ(DragonflyPlus::translateInterfaceAddressToId(
+            concentration, interfacePorts, leaves, &exp), id);
+        id++;
+      }
+    }
+  }
+}
+
+TEST(DragonflyPlus, translateRouter) {
+  u32 leaves = 3;
+  u32 spines = 2;
+  u32 groups = 4;
+  Address exp(2);
+  u32 id = 0;
+  for (u32 group = 0; group < groups; group++) {
+    for (u32 index = 0; index < leaves + spines; index++) {
+      exp.at(0) = index;
+      exp.at(1) = group;
+      Address act;
+      DragonflyPlus::translateRouterIdToAddress(leaves, spines, id, &act);
+      ASSERT_EQ(act, exp);
+      ASSERT_EQ(DragonflyPlus::translateRouterAddressToId(leaves, spines,
+                                                          &exp), id);
+      id++;
+    }
+  }
+}
+
+TEST(DragonflyPlus, computeMinimalHops) {
+  Address src = {1, 2, 3};
+  ASSERT_EQ(DragonflyPlus::computeMinimalHops(&src, &src), 1u);
+  Address dst = {0, 2, 3};
+  ASSERT_EQ(DragonflyPlus::computeMinimalHops(&src, &dst), 1u);
+  dst = {1, 0, 3};
+  ASSERT_EQ(DragonflyPlus::computeMinimalHops(&src, &dst), 3u);
+  dst = {1, 2, 0};
+  ASSERT_EQ(DragonflyPlus::computeMinimalHops(&src, &dst), 4u);
+}
@@ -22,6 +22,7 @@
 #include "factory/ObjectFactory.h"
 #include "network/fattree/util.h"
 #include "strop/strop.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -37,7 +38,8 @@ CommonAncestorRoutingAlgorithm::CommonAncestorRoutingAlgorithm(
       mode_(parseRoutingMode(_settings["mode"].get<std::string>())),
       leastCommonAncestor_(_settings["least_common_ancestor"].get<bool>()),
       selection_(parseSelection(_settings["selection"].get<std::string>())),
-      randomId_(gSim->rnd.nextU64()) {
+      randomId_(gSim->rnd.nextU64()),
+      flowCache_(nullptr) {
   assert(!_settings["least_common_ancestor"].is_null());
   assert(!_settings["mode"].is_null());
   assert(!_settings["selection"].is_null());
@@ -48,18 +50,33 @@ CommonAncestorRoutingAlgorithm::CommonAncestorRoutingAlgorithm(
   // create the reduction
   reduction_ = Reduction::create("Reduction", this, _router, mode_, false,
                                  _settings["reduction"]);
+
+  // the flow cache is bounded to "flow_cache_sets" x "flow_cache_ways". There
+  //  is one cache per input port and VC, so the default is kept small.
+  if (selection_ == Selection::kFlowCache) {
+    u32 sets = 64;
+    if (_settings.contains("flow_cache_sets")) {
+      sets = _settings["flow_cache_sets"].get<u32>();
+    }
+    u32 ways = 4;
+    if (_settings.contains("flow_cache_ways")) {
+      ways = _settings["flow_cache_ways"].get<u32>();
+    }
+    flowCache_ = new FlowCache(sets, ways);
+  }
 }
 
 CommonAncestorRoutingAlgorithm::~CommonAncestorRoutingAlgorithm() {
   delete reduction_;
+  delete flowCache_;
 }
 
 void CommonAncestorRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   // addresses
-  const std::vector<u32>* sourceAddress =
+  const Address* sourceAddress =
       _flit->packet()->message()->getSourceAddress();
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   assert(sourceAddress->size() == destinationAddress->size());
 
@@ -128,6 +145,12 @@ void CommonAncestorRoutingAlgorithm::processRequest(
       // hash the flow information to choose a deterministic upward path
       u32 port = downPorts + (flowHash(_flit) % upPorts);
       addPort(port, hops);
+    } else if (selection_ ==
+               CommonAncestorRoutingAlgorithm::Selection::kLeastLoaded) {
+      // choose the least occupied up port, only its VCs are considered by
+      //  the reduction
+      u32 port = leastLoaded(downPorts, upPorts);
+      addPort(port, hops);
     } else {
       assert(false);
     }
@@ -172,6 +195,8 @@ CommonAncestorRoutingAlgorithm::parseSelection(
     return CommonAncestorRoutingAlgorithm::Selection::kFlowCache;
   } else if (_selection == "flow_hash") {
     return CommonAncestorRoutingAlgorithm::Selection::kFlowHash;
+  } else if (_selection == "least_loaded") {
+    return CommonAncestorRoutingAlgorithm::Selection::kLeastLoaded;
   } else {
     fprintf(stderr, "Unknown fat-tree selecion: %s\n", _selection.c_str());
     assert(false);
@@ -182,11 +207,42 @@ u64 CommonAncestorRoutingAlgorithm::flowCache(const Flit* _flit) {
   u32 sourceId = _flit->packet()->message()->getSourceId();
   u32 destinationId = _flit->packet()->message()->getDestinationId();
   u64 srcDst = (static_cast<u64>(sourceId) << 32) | destinationId;
-  if (flowCache_.find(srcDst) == flowCache_.end()) {
-    u64 rand = random_.nextU64();
-    flowCache_[srcDst] = rand;
+  u64 rand;
+  if (!flowCache_->lookup(srcDst, &rand)) {
+    // new or evicted flows get a new random path
+    rand = random_.nextU64();
+    flowCache_->insert(srcDst, rand);
+  }
+  return rand;
+}
+
+u32 CommonAncestorRoutingAlgorithm::leastLoaded(u32 _downPorts,
+                                                u32 _upPorts) {
+  // the router's congestion status is shared by all inputs and drains as
+  //  flits leave, scan from a random start so that ties are broken randomly
+  u32 start = random_.nextU64(0, _upPorts - 1);
+  u32 best = U32_MAX;
+  f64 bestLoad = F64_POS_INF;
+  // a port resolution sensor reports the same status on every VC, so one
+  //  cached port read orders the ports like the sum over this class's VCs
+  bool portResolution = router_->portCongestionResolution();
+  for (u32 offset = 0; offset < _upPorts; offset++) {
+    u32 port = _downPorts + ((start + offset) % _upPorts);
+    f64 load = 0.0;
+    if (portResolution) {
+      load = router_->portCongestionStatus(inputPort_, inputVc_, port);
+    } else {
+      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+        load += router_->congestionStatus(inputPort_, inputVc_, port, vc);
+      }
+    }
+    if (load < bestLoad) {
+      best = port;
+      bestLoad = load;
+    }
   }
-  return flowCache_.at(srcDst);
+  assert(best != U32_MAX);
+  return best;
 }
 
 // from http://burtleburtle.net/bob/c/lookup3.c
@@ -17,7 +17,6 @@
 
 #include <string>
 #include <tuple>
-#include <unordered_map>
 #include <vector>
 
 #include "colhash/tuplehash.h"
@@ -27,6 +26,7 @@
 #include "prim/prim.h"
 #include "rnd/Random.h"
 #include "router/Router.h"
+#include "routing/FlowCache.h"
 #include "routing/Reduction.h"
 #include "routing/mode.h"
 
@@ -46,12 +46,13 @@ class CommonAncestorRoutingAlgorithm : public RoutingAlgorithm {
                       RoutingAlgorithm::Response* _response) override;
 
  private:
-  enum class Selection { kAll, kFlowCache, kFlowHash };
+  enum class Selection { kAll, kFlowCache, kFlowHash, kLeastLoaded };
 
   void addPort(u32 _port, u32 _hops);
   Selection parseSelection(const std::string& _selection) const;
   u64 flowCache(const Flit* _flit);
   u64 flowHash(const Flit* _flit);
+  u32 leastLoaded(u32 _downPorts, u32 _upPorts);
 
   const RoutingMode mode_;
   const bool leastCommonAncestor_;
@@ -59,7 +60,7 @@ class CommonAncestorRoutingAlgorithm : public RoutingAlgorithm {
   const u64 randomId_;
   rnd::Random random_;
   Reduction* reduction_;
-  std::unordered_map<u64, u32> flowCache_;
+  FlowCache* flowCache_;
 };
 
 }  // namespace FatTree
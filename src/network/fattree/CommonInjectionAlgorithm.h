@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include "network/common/injection.h"
 #include "network/fattree/InjectionAlgorithm.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
@@ -33,8 +34,7 @@ class CommonInjectionAlgorithm : public InjectionAlgorithm {
   void processMessage(Message* _message) override;
 
  private:
-  bool adaptive_;    // choose injection VC adaptively
-  bool fixedMsgVc_;  // all pkts of a msg have same VC
+  const Common::InjectionSettings settings_;
 };
 
 }  // namespace FatTree
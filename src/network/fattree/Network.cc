@@ -90,9 +90,9 @@ Network::Network(const std::string& _name, const Component* _parent,
     u32 levelRouters = routersAtLevel_.at(level);
     for (u32 col = 0; col < levelRouters; col++) {
       // router info
-      std::vector<u32> routerAddress = {level, col};
+      Address routerAddress = {level, col};
       u32 routerId = translateRouterAddressToId(&routerAddress);
-      std::string rname = "Router_" + strop::vecString<u32>(routerAddress, '-');
+      std::string rname = "Router_" + routerAddress.toString('-');
 
       // make router
       u32 rRadix = std::get<2>(radices_.at(level));
@@ -149,14 +149,16 @@ Network::Network(const std::string& _name, const Component* _parent,
         std::string upChannelName = "UpChannel_" + std::to_string(level) + ":" +
                                     std::to_string(col) + ":" +
                                     std::to_string(p);
-        Channel* up = new Channel(upChannelName, this, numVcs_,
-                                  _settings["internal_channels"][level]);
+        Channel* up =
+            createRouterChannel(upChannelName, thisRouter, thatRouter,
+                                _settings["internal_channels"][level]);
         internalChannels_.push_back(up);
         std::string downChannelName = "DownChannel_" + std::to_string(level) +
                                       ":" + std::to_string(col) + ":" +
                                       std::to_string(p);
-        Channel* down = new Channel(downChannelName, this, numVcs_,
-                                    _settings["internal_channels"][level]);
+        Channel* down =
+            createRouterChannel(downChannelName, thatRouter, thisRouter,
+                                _settings["internal_channels"][level]);
         internalChannels_.push_back(down);
         // link routers
         thisRouter->setInputChannel(thisPort, down);
@@ -173,17 +175,16 @@ Network::Network(const std::string& _name, const Component* _parent,
   for (u32 col = 0; col < routersAtLevel_.at(0); col++) {
     // get the router now, for later linking with terminals
     Router* router = routers_.at(0).at(col);
-    const std::vector<u32>& routerAddress = router->address();
+    const Address& routerAddress = router->address();
 
     for (u32 iface = 0; iface < interfacesPerRouter; iface++) {
       // interface id and address
       u32 interfaceId = col * interfacesPerRouter + iface;
-      std::vector<u32> interfaceAddress;
+      Address interfaceAddress;
       translateInterfaceIdToAddress(interfaceId, &interfaceAddress);
 
       // create interface
-      std::string interfaceName =
-          "Interface_" + strop::vecString<u32>(interfaceAddress, '-');
+      std::string interfaceName = "Interface_" + interfaceAddress.toString('-');
       Interface* interface = Interface::create(
           interfaceName, this, this, interfaceId, interfaceAddress,
           interfacePorts_, numVcs_, _metadataHandler, _settings["interface"]);
@@ -193,12 +194,12 @@ Network::Network(const std::string& _name, const Component* _parent,
       for (u32 ch = 0; ch < interfacePorts_; ch++) {
         // create I/O channels
         std::string inChannelName =
-            "Channel_" + strop::vecString<u32>(interfaceAddress, '-') + "-to-" +
-            strop::vecString<u32>(routerAddress, '-') + "_" +
+            "Channel_" + interfaceAddress.toString('-') + "-to-" +
+            routerAddress.toString('-') + "_" +
             std::to_string(ch);
         std::string outChannelName =
-            "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-            strop::vecString<u32>(interfaceAddress, '-') + "_" +
+            "Channel_" + routerAddress.toString('-') + "-to-" +
+            interfaceAddress.toString('-') + "_" +
             std::to_string(ch);
         Channel* inChannel = new Channel(inChannelName, this, numVcs_,
                                          _settings["external_channel"]);
@@ -299,7 +300,7 @@ u32 Network::numInterfaces() const {
 }
 
 Router* Network::getRouter(u32 _id) const {
-  std::vector<u32> routerAddress;
+  Address routerAddress;
   translateRouterIdToAddress(_id, &routerAddress);
   u32 level = routerAddress.at(0);
   u32 col = routerAddress.at(1);
@@ -311,31 +312,31 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   FatTree::translateInterfaceIdToAddress(numLevels_, interfacesPerGroup_, _id,
                                          _address);
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return FatTree::translateInterfaceAddressToId(numLevels_, interfacesPerGroup_,
                                                 _address);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   FatTree::translateRouterIdToAddress(numLevels_, routersAtLevel_, _id,
                                       _address);
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return FatTree::translateRouterAddressToId(numLevels_, routersAtLevel_,
                                              _address);
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
   return FatTree::computeMinimalHops(_source, _destination);
 }
 
@@ -21,8 +21,8 @@
 
 namespace FatTree {
 
-u32 leastCommonAncestor(const std::vector<u32>* _source,
-                        const std::vector<u32>* _destination) {
+u32 leastCommonAncestor(const Address* _source,
+                        const Address* _destination) {
   assert(_source->size() == _destination->size());
   for (s32 level = _source->size() - 1; level >= 0; level--) {
     if (_source->at(level) != _destination->at(level)) {
@@ -34,7 +34,7 @@ u32 leastCommonAncestor(const std::vector<u32>* _source,
 
 void translateInterfaceIdToAddress(u32 _numLevels,
                                    const std::vector<u32>& _interfacesPerGroup,
-                                   u32 _id, std::vector<u32>* _address) {
+                                   u32 _id, Address* _address) {
   _address->resize(_numLevels);
   // work in reverse for little endian format
   for (s32 level = _numLevels - 1; level >= 0; level--) {
@@ -50,7 +50,7 @@ void translateInterfaceIdToAddress(u32 _numLevels,
 
 u32 translateInterfaceAddressToId(u32 _numLevels,
                                   const std::vector<u32>& _interfacesPerGroup,
-                                  const std::vector<u32>* _address) {
+                                  const Address* _address) {
   u32 sum = 0;
   for (s32 level = _numLevels - 1; level >= 0; level--) {
     if (level > 0) {
@@ -65,7 +65,7 @@ u32 translateInterfaceAddressToId(u32 _numLevels,
 
 void translateRouterIdToAddress(u32 _numLevels,
                                 const std::vector<u32>& _routersPerRow, u32 _id,
-                                std::vector<u32>* _address) {
+                                Address* _address) {
   _address->resize(2);
   for (u32 l = 0; l < _numLevels; l++) {
     u32 rowRouters = _routersPerRow.at(l);
@@ -81,7 +81,7 @@ void translateRouterIdToAddress(u32 _numLevels,
 
 u32 translateRouterAddressToId(u32 _numLevels,
                                const std::vector<u32>& _routersPerRow,
-                               const std::vector<u32>* _address) {
+                               const Address* _address) {
   u32 level = _address->at(0);
   u32 prev = 0;
   for (u32 l = 0; l < level; l++) {
@@ -90,8 +90,8 @@ u32 translateRouterAddressToId(u32 _numLevels,
   return prev + _address->at(1);
 }
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination) {
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination) {
   u32 travLevels;
   assert(_source->size() == _destination->size());
   for (travLevels = _source->size(); travLevels > 0; travLevels--) {
@@ -18,25 +18,26 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 namespace FatTree {
 
-u32 leastCommonAncestor(const std::vector<u32>* _source,
-                        const std::vector<u32>* _destination);
+u32 leastCommonAncestor(const Address* _source,
+                        const Address* _destination);
 void translateInterfaceIdToAddress(u32 _numLevels,
                                    const std::vector<u32>& _interfacesPerGroup,
-                                   u32 _id, std::vector<u32>* _address);
+                                   u32 _id, Address* _address);
 u32 translateInterfaceAddressToId(u32 _numLevels,
                                   const std::vector<u32>& _interfacesPerGroup,
-                                  const std::vector<u32>* _address);
+                                  const Address* _address);
 void translateRouterIdToAddress(u32 _numLevels,
                                 const std::vector<u32>& _routersPerRow, u32 _id,
-                                std::vector<u32>* _address);
+                                Address* _address);
 u32 translateRouterAddressToId(u32 _numLevels,
                                const std::vector<u32>& _routersPerRow,
-                               const std::vector<u32>* _address);
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination);
+                               const Address* _address);
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination);
 
 }  // namespace FatTree
 
@@ -18,10 +18,11 @@
 
 #include "gtest/gtest.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 
 TEST(FatTree, translateInterfaceIdToAddress) {
-  std::vector<u32> act;
-  std::vector<u32> exp;
+  Address act;
+  Address exp;
   u32 id;
 
   const u32 numLevels = 4;
@@ -53,7 +54,7 @@ TEST(FatTree, translateInterfaceIdToAddress) {
 }
 
 TEST(FatTree, translateInterfaceAddressToId) {
-  std::vector<u32> addr;
+  Address addr;
 
   const u32 numLevels = 4;
   const std::vector<u32> terminalsPerGroup = {4, 12, 24, 48};
@@ -80,8 +81,8 @@ TEST(FatTree, translateInterfaceAddressToId) {
 }
 
 TEST(FatTree, translateRouterIdToAddress) {
-  std::vector<u32> act;
-  std::vector<u32> exp;
+  Address act;
+  Address exp;
   u32 id;
 
   const u32 numLevels = 4;
@@ -114,7 +115,7 @@ TEST(FatTree, translateRouterIdToAddress) {
 }
 
 TEST(FatTree, translateRouterAddressToId) {
-  std::vector<u32> addr;
+  Address addr;
 
   const u32 numLevels = 4;
   const std::vector<u32> rowRouters = {128, 64, 32, 10};
@@ -145,8 +146,8 @@ TEST(FatTree, translateRouterAddressToId) {
 }
 
 TEST(FatTree, computeMinimalHops) {
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   u32 exp;
 
   src = {0, 0};
@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -198,9 +199,9 @@ DalRoutingAlgorithm::~DalRoutingAlgorithm() {}
 void DalRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   Packet* packet = _flit->packet();
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       packet->message()->getDestinationAddress();
-  const std::vector<u32>& routerAddress = router_->address();
+  const Address& routerAddress = router_->address();
 
   u32 vcSet = U32_MAX;
   if ((adaptivityType_ == AdaptiveRoutingAlg::DOALP) ||
@@ -332,9 +333,9 @@ void DalRoutingAlgorithm::processRequest(
 
 void DalRoutingAlgorithm::vcScheduled(Flit* _flit, u32 _port, u32 _vc) {
   Packet* packet = _flit->packet();
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       packet->message()->getDestinationAddress();
-  const std::vector<u32>& routerAddress = router_->address();
+  const Address& routerAddress = router_->address();
 
   if ((adaptivityType_ != AdaptiveRoutingAlg::DDALP) &&
       (adaptivityType_ != AdaptiveRoutingAlg::DDALV)) {
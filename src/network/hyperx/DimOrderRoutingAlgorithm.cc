@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/hyperx/util.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -69,7 +70,7 @@ DimOrderRoutingAlgorithm::~DimOrderRoutingAlgorithm() {}
 
 void DimOrderRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   if (outputTypePort_) {
     dimOrderPortRoutingOutput(router_, inputPort_, inputVc_, dimensionWidths_,
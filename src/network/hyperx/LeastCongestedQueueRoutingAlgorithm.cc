@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -120,7 +121,7 @@ LeastCongestedQueueRoutingAlgorithm::~LeastCongestedQueueRoutingAlgorithm() {}
 
 void LeastCongestedQueueRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
 
   Packet* packet = _flit->packet();
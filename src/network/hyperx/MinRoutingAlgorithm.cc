@@ -18,6 +18,7 @@
 #include <utility>  // std::pair
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -97,7 +98,7 @@ MinRoutingAlgorithm::~MinRoutingAlgorithm() {}
 
 void MinRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
 
   Packet* packet = _flit->packet();
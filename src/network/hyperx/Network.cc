@@ -24,7 +24,6 @@
 #include "network/hyperx/RoutingAlgorithm.h"
 #include "network/hyperx/util.h"
 #include "strop/strop.h"
-#include "util/DimensionIterator.h"
 
 namespace HyperX {
 
@@ -76,6 +75,7 @@ Network::Network(const std::string& _name, const Component* _parent,
     }
     dbgprintf("scalars = %s", strop::vecString<f64>(scalars, ',').c_str());
   }
+  u32 internalLatency = _settings["internal_channel"]["latency"].get<u32>();
 
   // router radix
   u32 routerRadix = concentration_;
@@ -86,64 +86,62 @@ Network::Network(const std::string& _name, const Component* _parent,
   // parse the protocol classes description
   loadProtocolClassInfo(_settings["protocol_classes"]);
 
-  // setup a router iterator for looping over the router dimensions
-  DimensionIterator routerIterator(dimensionWidths_);
-  std::vector<u32> routerAddress(dimensionWidths_.size());
-
-  // create the routers
-  routerIterator.reset();
+  // create the routers, a router's ID is the flat (little endian) index of its
+  //  address so routers_ is indexed directly by ID
   routers_.setSize(dimensionWidths_);
-  while (routerIterator.next(&routerAddress)) {
-    std::string routerName =
-        "Router_" + strop::vecString<u32>(routerAddress, '-');
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Address routerAddress;
+    routers_.address(routerId, &routerAddress);
+    std::string routerName = "Router_" + routerAddress.toString('-');
 
     // use the router factory to create a router
-    u32 routerId = translateRouterAddressToId(&routerAddress);
-    routers_.at(routerAddress) = Router::create(
+    routers_.at(routerId) = Router::create(
         routerName, this, this, routerId, routerAddress, routerRadix, numVcs_,
         _metadataHandler, _settings["router"]);
   }
 
-  // link routers via channels
-  routerIterator.reset();
-  while (routerIterator.next(&routerAddress)) {
+  // link routers via channels, neighbors are found by their flat index stride
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Router* sourceRouter = routers_.at(routerId);
+    const Address& routerAddress = sourceRouter->address();
+    const Address& sourceAddress = routerAddress;
     u32 portBase = concentration_;
     for (u32 dim = 0; dim < dimensions_; dim++) {
       u32 dimWidth = dimensionWidths_.at(dim);
       u32 dimWeight = dimensionWeights_.at(dim);
+      u32 dimStride = routers_.stride(dim);
+      u32 dimBase = routerId - (sourceAddress.at(dim) * dimStride);
       dbgprintf("dim=%u width=%u weight=%u\n", dim, dimWidth, dimWeight);
 
       for (u32 offset = 1; offset < dimWidth; offset++) {
-        // determine the source router
-        std::vector<u32> sourceAddress(routerAddress);
-
         // determine the destination router
-        std::vector<u32> destinationAddress(sourceAddress);
+        Address destinationAddress(sourceAddress);
         destinationAddress.at(dim) =
             (sourceAddress.at(dim) + offset) % dimWidth;
+        u32 destinationId =
+            dimBase + (destinationAddress.at(dim) * dimStride);
 
         // determine the channel latency for current dim and offset
-        if (_settings["channel_mode"].get<std::string>() == "scalar") {
+        u32 channelLatency = internalLatency;
+        if (!scalars.empty()) {
           f64 link_dist = fabs((s64)sourceAddress.at(dim) -
                                (s64)destinationAddress.at(dim));
-          u32 channelLatency = (u32)(ceil(scalars[dim] * link_dist));
+          channelLatency = (u32)(ceil(scalars[dim] * link_dist));
           dbgprintf("s=%s d=%s c_dist=%.2f l_val=%.2f latency=%u",
-                    strop::vecString<u32>(sourceAddress, '-').c_str(),
-                    strop::vecString<u32>(destinationAddress, '-').c_str(),
+                    sourceAddress.toString('-').c_str(),
+                    destinationAddress.toString('-').c_str(),
                     link_dist, scalars[dim], channelLatency);
-
-          // override settings
-          _settings["internal_channel"]["latency"] = channelLatency;
         }
 
         for (u32 weight = 0; weight < dimWeight; weight++) {
           // create the channel
           std::string channelName =
-              "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-              strop::vecString<u32>(destinationAddress, '-') + "-" +
+              "Channel_" + routerAddress.toString('-') + "-to-" +
+              destinationAddress.toString('-') + "-" +
               std::to_string(weight);
-          Channel* channel = new Channel(channelName, this, numVcs_,
-                                         _settings["internal_channel"]);
+          Channel* channel = createRouterChannel(
+              channelName, sourceRouter, routers_.at(destinationId),
+              channelLatency);
           internalChannels_.push_back(channel);
 
           // determine the port numbers
@@ -151,14 +149,14 @@ Network::Network(const std::string& _name, const Component* _parent,
           u32 destinationPort = portBase + ((dimWidth - 1) * dimWeight) -
                                 (offset * dimWeight) + weight;
           dbgprintf("s=%s:%u to d=%s:%u with %s latency=%d",
-                    strop::vecString<u32>(sourceAddress, '-').c_str(),
+                    sourceAddress.toString('-').c_str(),
                     sourcePort,
-                    strop::vecString<u32>(destinationAddress, '-').c_str(),
+                    destinationAddress.toString('-').c_str(),
                     destinationPort, channelName.c_str(), channel->latency());
 
           // link the routers from source to destination
-          routers_.at(sourceAddress)->setOutputChannel(sourcePort, channel);
-          routers_.at(destinationAddress)
+          sourceRouter->setOutputChannel(sourcePort, channel);
+          routers_.at(destinationId)
               ->setInputChannel(destinationPort, channel);
         }
       }
@@ -175,40 +173,39 @@ Network::Network(const std::string& _name, const Component* _parent,
 
   // create interfaces and link them with the routers
   interfaces_.setSize(fullDimensionWidths);
-  routerIterator.reset();
-  while (routerIterator.next(&routerAddress)) {
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
     // get the router now, for later linking with terminals
-    Router* router = routers_.at(routerAddress);
+    Router* router = routers_.at(routerId);
+    const Address& routerAddress = router->address();
 
     // loop over interfaces
     for (u32 iface = 0; iface < interfacesPerRouter; iface++) {
-      // create a vector for the Interface address
-      std::vector<u32> interfaceAddress(1);
-      interfaceAddress.at(0) = iface;
-      interfaceAddress.insert(interfaceAddress.begin() + 1,
-                              routerAddress.begin(), routerAddress.end());
+      // create the Interface address
+      Address interfaceAddress(1, iface);
+      for (u32 dim = 0; dim < routerAddress.size(); dim++) {
+        interfaceAddress.push_back(routerAddress.at(dim));
+      }
 
       // create an interface name
-      std::string interfaceName =
-          "Interface_" + strop::vecString<u32>(interfaceAddress, '-');
+      std::string interfaceName = "Interface_" + interfaceAddress.toString('-');
 
       // create the interface
-      u32 interfaceId = translateInterfaceAddressToId(&interfaceAddress);
+      u32 interfaceId = (routerId * interfacesPerRouter) + iface;
       Interface* interface = Interface::create(
           interfaceName, this, this, interfaceId, interfaceAddress,
           interfacePorts_, numVcs_, _metadataHandler, _settings["interface"]);
-      interfaces_.at(interfaceAddress) = interface;
+      interfaces_.at(interfaceId) = interface;
 
       // create and link channels
       for (u32 ch = 0; ch < interfacePorts_; ch++) {
         // create I/O channels
         std::string inChannelName =
-            "Channel_" + strop::vecString<u32>(interfaceAddress, '-') + "-to-" +
-            strop::vecString<u32>(routerAddress, '-') + "_" +
+            "Channel_" + interfaceAddress.toString('-') + "-to-" +
+            routerAddress.toString('-') + "_" +
             std::to_string(ch);
         std::string outChannelName =
-            "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-            strop::vecString<u32>(interfaceAddress, '-') + "_" +
+            "Channel_" + routerAddress.toString('-') + "-to-" +
+            interfaceAddress.toString('-') + "_" +
             std::to_string(ch);
         Channel* inChannel = new Channel(inChannelName, this, numVcs_,
                                          _settings["external_channel"]);
@@ -298,29 +295,29 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   Cube::translateInterfaceIdToAddress(_id, dimensionWidths_, concentration_,
                                       interfacePorts_, _address);
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Cube::translateInterfaceAddressToId(_address, dimensionWidths_,
                                              concentration_, interfacePorts_);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   Cube::translateRouterIdToAddress(_id, dimensionWidths_, _address);
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Cube::translateRouterAddressToId(_address, dimensionWidths_);
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
   return HyperX::computeMinimalHops(_source, _destination, dimensions_);
 }
 
@@ -25,6 +25,7 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "types/Address.h"
 #include "util/DimensionalArray.h"
 
 namespace HyperX {
@@ -52,15 +53,15 @@ class Network : public ::Network {
   Router* getRouter(u32 _id) const override;
   Interface* getInterface(u32 _id) const override;
   void translateInterfaceIdToAddress(u32 _id,
-                                     std::vector<u32>* _address) const override;
+                                     Address* _address) const override;
   u32 translateInterfaceAddressToId(
-      const std::vector<u32>* _address) const override;
+      const Address* _address) const override;
   void translateRouterIdToAddress(u32 _id,
-                                  std::vector<u32>* _address) const override;
+                                  Address* _address) const override;
   u32 translateRouterAddressToId(
-      const std::vector<u32>* _address) const override;
-  u32 computeMinimalHops(const std::vector<u32>* _source,
-                         const std::vector<u32>* _destination) const override;
+      const Address* _address) const override;
+  u32 computeMinimalHops(const Address* _source,
+                         const Address* _destination) const override;
 
  protected:
   void collectChannels(std::vector<Channel*>* _channels) override;
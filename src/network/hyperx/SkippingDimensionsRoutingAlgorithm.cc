@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -221,9 +222,9 @@ SkippingDimensionsRoutingAlgorithm::~SkippingDimensionsRoutingAlgorithm() {}
 void SkippingDimensionsRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   Packet* packet = _flit->packet();
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       packet->message()->getDestinationAddress();
-  const std::vector<u32>& routerAddress = router_->address();
+  const Address& routerAddress = router_->address();
 
   u32 numRound = 0;
   if (packet->getHopCount() > 0) {
@@ -276,7 +277,7 @@ void SkippingDimensionsRoutingAlgorithm::processRequest(
         vcSet = baseVc + 1;
         // We need to use fake destination here the same way we use it in
         // skipping util function
-        std::vector<u32> fakeDestinationAddress(*destinationAddress);
+        Address fakeDestinationAddress(*destinationAddress);
         if (inDim > 0) {
           for (u32 dim = 1; dim < inDim; dim++) {
             fakeDestinationAddress.at(dim) = routerAddress.at(dim - 1);
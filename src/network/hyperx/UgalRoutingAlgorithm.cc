@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -237,7 +238,7 @@ UgalRoutingAlgorithm::~UgalRoutingAlgorithm() {}
 
 void UgalRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
-  const std::vector<u32>* destAddress =
+  const Address* destAddress =
       _flit->packet()->message()->getDestinationAddress();
 
   Packet* packet = _flit->packet();
@@ -272,8 +273,8 @@ void UgalRoutingAlgorithm::processRequest(
                     intNodeAlg_, routingAlg_, nonMinimalAlg_, _flit, &weightReg,
                     &weightVal, &vcPoolReg_, &vcPoolVal_);
 
-  const std::vector<u32>* intermediateAddress =
-      reinterpret_cast<const std::vector<u32>*>(packet->getRoutingExtension());
+  const Address* intermediateAddress =
+      reinterpret_cast<const Address*>(packet->getRoutingExtension());
 
   if (packet->getHopCount() == 0) {
     if (!intermediateAddress) {
@@ -283,7 +284,7 @@ void UgalRoutingAlgorithm::processRequest(
       // verify int != src - REMOVE THIS WHEN CONFIDENT
       assert(destAddress);
       bool match = true;
-      const std::vector<u32>& routerAddress = router_->address();
+      const Address& routerAddress = router_->address();
       for (u32 idx = 0; idx < intermediateAddress->size() - 1; idx++) {
         if (routerAddress.at(idx) != intermediateAddress->at(idx + 1)) {
           match = false;
@@ -316,7 +317,7 @@ void UgalRoutingAlgorithm::processRequest(
       delete intermediateAddress;
     }
     // assert is destination router
-    const std::vector<u32>& routerAddress = router_->address();
+    const Address& routerAddress = router_->address();
     assert(destAddress);
     for (u32 dim = 0; dim < routerAddress.size(); dim++) {
       assert(routerAddress.at(dim) == destAddress->at(dim + 1));
@@ -342,7 +343,7 @@ void UgalRoutingAlgorithm::processRequest(
 
   if (packet->getHopCount() == 0) {
     // ex: [x,y,z] for router, [c,x,y,z] for destination
-    const std::vector<u32>& routerAddress = router_->address();
+    const Address& routerAddress = router_->address();
 
     for (u32 dim = 0; dim < routerAddress.size(); dim++) {
       if (routerAddress.at(dim) != destAddress->at(dim + 1)) {
@@ -404,8 +405,7 @@ void UgalRoutingAlgorithm::processRequest(
     }
 
     if (!nonMin) {  // minimal
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
+      delete reinterpret_cast<const Address*>(packet->getRoutingExtension());
       packet->setRoutingExtension(nullptr);
     } else {
       if ((routingAlg_ == BaseRoutingAlg::DORP) ||
@@ -17,6 +17,7 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -144,7 +145,7 @@ ValiantsRoutingAlgorithm::~ValiantsRoutingAlgorithm() {}
 
 void ValiantsRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
 
   Packet* packet = _flit->packet();
@@ -184,9 +185,8 @@ void ValiantsRoutingAlgorithm::processRequest(
   if ((routingAlg_ == BaseRoutingAlg::DORP) ||
       (routingAlg_ == BaseRoutingAlg::DORV)) {
     // get a const pointer to the address (with leading dummy)
-    const std::vector<u32>* intermediateAddress =
-        reinterpret_cast<const std::vector<u32>*>(
-            packet->getRoutingExtension());
+    const Address* intermediateAddress =
+        reinterpret_cast<const Address*>(packet->getRoutingExtension());
     if (intermediateAddress == nullptr) {
       vcSet = baseVc_;
     } else {
@@ -26,8 +26,8 @@ const f64 TOLERANCE = 1e-6;
 
 namespace HyperX {
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination, u32 _dimensions) {
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination, u32 _dimensions) {
   u32 minHops = 1;
   for (u32 dim = 0; dim < _dimensions; dim++) {
     if (_source->at(dim + 1) != _destination->at(dim + 1)) {
@@ -53,9 +53,9 @@ u32 computeSrcDstOffset(u32 _src, u32 _dst, u32 _dimWidth) {
 /**************************UTILITY FUNCTIONS**********************************/
 
 bool isDestinationRouter(Router* _router,
-                         const std::vector<u32>* _destinationAddress) {
+                         const Address* _destinationAddress) {
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -71,10 +71,10 @@ bool isDestinationRouter(Router* _router,
   return false;
 }
 
-u32 hopsLeft(Router* _router, const std::vector<u32>* _destinationAddress) {
+u32 hopsLeft(Router* _router, const Address* _destinationAddress) {
   u32 hops = 0;
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -109,12 +109,12 @@ u32 computeInputPortDim(const std::vector<u32>& _dimensionWidths,
 /*******************INTERMEDIATE DESTINATION FOR VALIANTS**********************/
 
 void intNodeReg(Router* _router, u32 _inputPort, u32 _inputVc,
-                const std::vector<u32>& _sourceRouter,
-                const std::vector<u32>* _destinationTerminal,
+                const Address& _sourceRouter,
+                const Address* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address) {
+                Address* _address) {
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
@@ -127,13 +127,13 @@ void intNodeReg(Router* _router, u32 _inputPort, u32 _inputVc,
 }
 
 void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
-                          const std::vector<u32>& _sourceRouter,
-                          const std::vector<u32>* _destinationTerminal,
+                          const Address& _sourceRouter,
+                          const Address* _destinationTerminal,
                           const std::vector<u32>& _dimensionWidths,
                           const std::vector<u32>& _dimensionWeights,
                           u32 _concentration, u32 _interfacePorts, u32 _vcSet,
                           u32 _numVcSets, u32 _numVcs,
-                          std::vector<u32>* _address) {
+                          Address* _address) {
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
@@ -142,7 +142,7 @@ void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
   u32 numRouters = Cube::computeNumRouters(_dimensionWidths);
 
   for (u32 routerId = 0; routerId < numRouters; ++routerId) {
-    std::vector<u32> routerAddr;
+    Address routerAddr;
     Cube::translateRouterIdToAddress(routerId, _dimensionWidths, &routerAddr);
     bool aligned = true;
     for (u32 dim = 0; dim < _dimensionWidths.size(); dim++) {
@@ -158,7 +158,7 @@ void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
   }
 
   const u32* it = uSetRandElement(nodesUnAligned);
-  std::vector<u32> ancestor;
+  Address ancestor;
   Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
 
   for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
@@ -168,19 +168,19 @@ void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
 }
 
 void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
-                const std::vector<u32>& _sourceRouter,
-                const std::vector<u32>* _destinationTerminal,
+                const Address& _sourceRouter,
+                const Address* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address) {
+                Address* _address) {
   std::unordered_set<u32> ancestors;
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
   for (u32 dim = 0; dim < dimensions; dim++) {
     for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(_sourceRouter);
+      Address tmpVec(_sourceRouter);
       tmpVec.at(dim) = idx;
       u32 ancestorId =
           Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
@@ -189,7 +189,7 @@ void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
   }
 
   const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
+  Address ancestor;
   Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
 
   for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
@@ -199,19 +199,19 @@ void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
 }
 
 void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
-                const std::vector<u32>& _sourceRouter,
-                const std::vector<u32>* _destinationTerminal,
+                const Address& _sourceRouter,
+                const Address* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address) {
+                Address* _address) {
   std::unordered_set<u32> ancestors;
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
   for (u32 dim = 0; dim < dimensions; dim++) {
     for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(dimensions);
+      Address tmpVec(dimensions);
       for (u32 ind = 0; ind < dimensions; ind++) {
         tmpVec.at(ind) = _destinationTerminal->at(ind + 1);
       }
@@ -223,7 +223,7 @@ void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
   }
 
   const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
+  Address ancestor;
   Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
 
   for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
@@ -233,19 +233,19 @@ void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
 }
 
 void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
-                   const std::vector<u32>& _sourceRouter,
-                   const std::vector<u32>* _destinationTerminal,
+                   const Address& _sourceRouter,
+                   const Address* _destinationTerminal,
                    const std::vector<u32>& _dimensionWidths,
                    const std::vector<u32>& _dimensionWeights,
                    u32 _concentration, u32 _interfacePorts, u32 _vcSet,
-                   u32 _numVcSets, u32 _numVcs, std::vector<u32>* _address) {
+                   u32 _numVcSets, u32 _numVcs, Address* _address) {
   std::unordered_set<u32> ancestors;
   u32 dimensions = _dimensionWidths.size();
   _address->resize(1 + dimensions);
 
   for (u32 dim = 0; dim < dimensions; dim++) {
     for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(_sourceRouter);
+      Address tmpVec(_sourceRouter);
       tmpVec.at(dim) = idx;
       u32 ancestorId =
           Cube::translateRouterAddressToId(&tmpVec, _dimensionWidths);
@@ -255,7 +255,7 @@ void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
 
   for (u32 dim = 0; dim < dimensions; dim++) {
     for (u32 idx = 0; idx < _dimensionWidths.at(dim); idx++) {
-      std::vector<u32> tmpVec(dimensions);
+      Address tmpVec(dimensions);
       for (u32 ind = 0; ind < dimensions; ind++) {
         tmpVec.at(ind) = _destinationTerminal->at(ind + 1);
       }
@@ -267,7 +267,7 @@ void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
   }
 
   const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
+  Address ancestor;
   Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
 
   for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
@@ -277,12 +277,12 @@ void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
 }
 
 void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
-                 const std::vector<u32>& _sourceRouter,
-                 const std::vector<u32>* _destinationTerminal,
+                 const Address& _sourceRouter,
+                 const Address* _destinationTerminal,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address) {
+                 Address* _address) {
   u32 dim;
   u32 portBase = _concentration;
   f64 minCongestion = F64_POS_INF;
@@ -305,7 +305,7 @@ void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
             minCongestion = congestion;
             ancestors.clear();
           }
-          std::vector<u32> tmpVec(_sourceRouter);
+          Address tmpVec(_sourceRouter);
           if (idx < _sourceRouter.at(dim)) {
             tmpVec.at(dim) = idx;
           } else {
@@ -325,7 +325,7 @@ void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
   }
 
   const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
+  Address ancestor;
   Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
 
   for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
@@ -335,12 +335,12 @@ void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
 }
 
 void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
-                 const std::vector<u32>& _sourceRouter,
-                 const std::vector<u32>* _destinationTerminal,
+                 const Address& _sourceRouter,
+                 const Address* _destinationTerminal,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address) {
+                 Address* _address) {
   u32 dim;
   u32 portBase = _concentration;
   f64 minCongestion = F64_POS_INF;
@@ -364,7 +364,7 @@ void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
           ancestors.clear();
         }
         for (u32 vc = _vcSet; vc < _numVcs; vc += _numVcSets) {
-          std::vector<u32> tmpVec(_sourceRouter);
+          Address tmpVec(_sourceRouter);
           if (idx < _sourceRouter.at(dim)) {
             tmpVec.at(dim) = idx;
           } else {
@@ -384,7 +384,7 @@ void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
   }
 
   const u32* it = uSetRandElement(ancestors);
-  std::vector<u32> ancestor;
+  Address ancestor;
   Cube::translateRouterIdToAddress(*it, _dimensionWidths, &ancestor);
 
   for (u32 ind = 0; ind < _sourceRouter.size(); ind++) {
@@ -500,14 +500,14 @@ void dimOrderVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   assert(_vcSets.size() > 0);
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -554,13 +554,13 @@ void dimOrderPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -605,13 +605,13 @@ void randMinVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -646,13 +646,13 @@ void randMinPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -686,13 +686,13 @@ void adaptiveMinVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -736,13 +736,13 @@ void adaptiveMinPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   // determine the next dimension to work on
@@ -784,7 +784,7 @@ void valiantsRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
     IntNodeAlg _intNodeAlg, BaseRoutingAlg _routingAlg, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
@@ -793,14 +793,13 @@ void valiantsRoutingOutput(
   Packet* packet = _flit->packet();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   if (_shortCut) {
     // If source == destination, don't pick intermediate address
     if (isDestinationRouter(_router, _destinationAddress)) {
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
+      delete reinterpret_cast<const Address*>(packet->getRoutingExtension());
       packet->setRoutingExtension(nullptr);
       return;
     }
@@ -814,7 +813,7 @@ void valiantsRoutingOutput(
     // create routing extension header
     //  the extension is a vector with one dummy element then the address of the
     //  intermediate router
-    std::vector<u32>* intAddr = new std::vector<u32>(1 + routerAddress.size());
+    Address* intAddr = new Address(1 + routerAddress.size());
 
     IntNodeAlgFunc intNodeAlgFunc;
     switch (_intNodeAlg) {
@@ -858,8 +857,8 @@ void valiantsRoutingOutput(
   u32 stage = (packet->getRoutingExtension() != nullptr) ? 0 : 1;
 
   // get a const pointer to the address (with leading dummy)
-  const std::vector<u32>* intermediateAddress =
-      reinterpret_cast<const std::vector<u32>*>(packet->getRoutingExtension());
+  const Address* intermediateAddress =
+      reinterpret_cast<const Address*>(packet->getRoutingExtension());
 
   MinRoutingAlgFunc routingAlgFunc;
   switch (_routingAlg) {
@@ -903,8 +902,7 @@ void valiantsRoutingOutput(
 
     // at destination (Int)
     if (_vcPool->empty()) {
-      delete reinterpret_cast<const std::vector<u32>*>(
-          packet->getRoutingExtension());
+      delete reinterpret_cast<const Address*>(packet->getRoutingExtension());
       packet->setRoutingExtension(nullptr);
       stage = 1;
       if ((_routingAlg == BaseRoutingAlg::DORP) ||
@@ -946,7 +944,7 @@ void ugalRoutingOutput(
   _vcPoolReg->clear();
   _vcPoolVal->clear();
 
-  const std::vector<u32>* destAddress =
+  const Address* destAddress =
       _flit->packet()->message()->getDestinationAddress();
 
   Packet* packet = _flit->packet();
@@ -1044,7 +1042,7 @@ void lcqVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
@@ -1088,7 +1086,7 @@ void lcqPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool) {
   _vcPool->clear();
@@ -1131,7 +1129,7 @@ void doalPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
@@ -1139,7 +1137,7 @@ void doalPortRoutingOutput(
   _outputVcsNonMin->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   u32 derouted = (_vcSet - _baseVc) % 2;
@@ -1195,7 +1193,7 @@ void doalVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
@@ -1203,7 +1201,7 @@ void doalVcRoutingOutput(
   _outputVcsNonMin->clear();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   u32 derouted = (_vcSet - _baseVc) % 2;
@@ -1259,7 +1257,7 @@ void ddalPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
@@ -1268,7 +1266,7 @@ void ddalPortRoutingOutput(
   Packet* packet = _flit->packet();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   if (packet->getHopCount() == 0) {
@@ -1348,7 +1346,7 @@ void ddalVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin) {
@@ -1357,7 +1355,7 @@ void ddalVcRoutingOutput(
   Packet* packet = _flit->packet();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   if (packet->getHopCount() == 0) {
@@ -1439,7 +1437,7 @@ void vdalPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     bool _multiDeroute,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
@@ -1449,7 +1447,7 @@ void vdalPortRoutingOutput(
   Packet* packet = _flit->packet();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   u32 hops = packet->getHopCount();
@@ -1531,7 +1529,7 @@ void vdalVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     bool _multiDeroute,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
@@ -1541,7 +1539,7 @@ void vdalVcRoutingOutput(
   Packet* packet = _flit->packet();
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
   u32 hops = packet->getHopCount();
@@ -1624,7 +1622,7 @@ void skippingDimOrderRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _startingDim, u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
     Flit* _flit, f64 _iBias, f64 _cBias, f64 _step, f64 _threshold,
     f64 _thresholdMin, f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
@@ -1640,10 +1638,10 @@ void skippingDimOrderRoutingOutput(
   bool nonMin = false;
 
   // ex: [x,y,z] for router, [c,x,y,z] for destination
-  const std::vector<u32>& routerAddress = _router->address();
+  const Address& routerAddress = _router->address();
   assert(routerAddress.size() == (_destinationAddress->size() - 1));
 
-  std::vector<u32> fakeDestinationAddress(*_destinationAddress);
+  Address fakeDestinationAddress(*_destinationAddress);
   if (_startingDim > 0) {
     for (u32 dim = 1; dim < _startingDim; dim++) {
       fakeDestinationAddress.at(dim) = routerAddress.at(dim - 1);
@@ -1786,7 +1784,7 @@ void finishingDimOrderRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     f64 _iBias, f64 _cBias, f64 _threshold, f64 _thresholdMin,
     f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
@@ -21,13 +21,14 @@
 
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
 namespace HyperX {
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination, u32 _dimensions);
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination, u32 _dimensions);
 
 u32 computeOutputPort(u32 _base, u32 _offset, u32 _dimWeight, u32 _weight);
 u32 computeSrcDstOffset(u32 _src, u32 _dst, u32 _dimWidth);
@@ -58,85 +59,85 @@ enum class BiasScheme : u8 {
 enum class HopCountMode : u8 { ABS, NORM };
 enum class OutputAlg : u8 { Rand, Min };
 
-typedef void (*IntNodeAlgFunc)(Router*, u32, u32, const std::vector<u32>&,
-                               const std::vector<u32>*, const std::vector<u32>&,
+typedef void (*IntNodeAlgFunc)(Router*, u32, u32, const Address&,
+                               const Address*, const std::vector<u32>&,
                                const std::vector<u32>&, u32, u32, u32, u32, u32,
-                               std::vector<u32>*);
+                               Address*);
 
 typedef void (*MinRoutingAlgFunc)(
     Router*, u32, u32, const std::vector<u32>&, const std::vector<u32>&, u32,
-    u32, const std::vector<u32>*, const std::vector<u32>&, u32, u32,
+    u32, const Address*, const std::vector<u32>&, u32, u32,
     std::unordered_set<std::tuple<u32, u32, f64>>*);
 
 typedef void (*FirstHopRoutingAlgFunc)(
     Router*, u32, u32, const std::vector<u32>&, const std::vector<u32>&, u32,
-    u32, const std::vector<u32>*, u32, u32, u32, bool,
+    u32, const Address*, u32, u32, u32, bool,
     std::unordered_set<std::tuple<u32, u32, f64>>*);
 
 bool isDestinationRouter(Router* _router,
-                         const std::vector<u32>* _destinationAddress);
+                         const Address* _destinationAddress);
 
-u32 hopsLeft(Router* _router, const std::vector<u32>* _destinationAddress);
+u32 hopsLeft(Router* _router, const Address* _destinationAddress);
 
 u32 computeInputPortDim(const std::vector<u32>& _dimensionWidths,
                         const std::vector<u32>& _dimensionWeights,
                         u32 _concentration, u32 _inputPort);
 void intNodeReg(Router* _router, u32 _inputPort, u32 _inputVc,
-                const std::vector<u32>& _sourceRouter,
-                const std::vector<u32>* _destinationTerminal,
+                const Address& _sourceRouter,
+                const Address* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address);
+                Address* _address);
 
 void intNodeMoveUnaligned(Router* _router, u32 _inputPort, u32 _inputVc,
-                          const std::vector<u32>& _sourceRouter,
-                          const std::vector<u32>* _destinationTerminal,
+                          const Address& _sourceRouter,
+                          const Address* _destinationTerminal,
                           const std::vector<u32>& _dimensionWidths,
                           const std::vector<u32>& _dimensionWeights,
                           u32 _concentration, u32 _interfacePorts, u32 _vcSet,
                           u32 _numVcSets, u32 _numVcs,
-                          std::vector<u32>* _address);
+                          Address* _address);
 
 void intNodeSrc(Router* _router, u32 _inputPort, u32 _inputVc,
-                const std::vector<u32>& _sourceRouter,
-                const std::vector<u32>* _destinationTerminal,
+                const Address& _sourceRouter,
+                const Address* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address);
+                Address* _address);
 
 void intNodeDst(Router* _router, u32 _inputPort, u32 _inputVc,
-                const std::vector<u32>& _sourceRouter,
-                const std::vector<u32>* _destinationTerminal,
+                const Address& _sourceRouter,
+                const Address* _destinationTerminal,
                 const std::vector<u32>& _dimensionWidths,
                 const std::vector<u32>& _dimensionWeights, u32 _concentration,
                 u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                std::vector<u32>* _address);
+                Address* _address);
 
 void intNodeSrcDst(Router* _router, u32 _inputPort, u32 _inputVc,
-                   const std::vector<u32>& _sourceRouter,
-                   const std::vector<u32>* _destinationTerminal,
+                   const Address& _sourceRouter,
+                   const Address* _destinationTerminal,
                    const std::vector<u32>& _dimensionWidths,
                    const std::vector<u32>& _dimensionWeights,
                    u32 _concentration, u32 _interfacePorts, u32 _vcSet,
-                   u32 _numVcSets, u32 _numVcs, std::vector<u32>* _address);
+                   u32 _numVcSets, u32 _numVcs, Address* _address);
 
 void intNodeMinV(Router* _router, u32 _inputPort, u32 _inputVc,
-                 const std::vector<u32>& _sourceRouter,
-                 const std::vector<u32>* _destinationTerminal,
+                 const Address& _sourceRouter,
+                 const Address* _destinationTerminal,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address);
+                 Address* _address);
 
 void intNodeMinP(Router* _router, u32 _inputPort, u32 _inputVc,
-                 const std::vector<u32>& _sourceRouter,
-                 const std::vector<u32>* _destinationTerminal,
+                 const Address& _sourceRouter,
+                 const Address* _destinationTerminal,
                  const std::vector<u32>& _dimensionWidths,
                  const std::vector<u32>& _dimensionWeights, u32 _concentration,
                  u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
-                 std::vector<u32>* _address);
+                 Address* _address);
 
 void makeOutputVcSet(
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool, u32 _maxOutputs,
@@ -157,7 +158,7 @@ void dimOrderVcRoutingOutput(
     Router* router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -165,7 +166,7 @@ void dimOrderPortRoutingOutput(
     Router* router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -173,7 +174,7 @@ void randMinVcRoutingOutput(
     Router* router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -181,7 +182,7 @@ void randMinPortRoutingOutput(
     Router* router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -189,7 +190,7 @@ void adaptiveMinVcRoutingOutput(
     Router* router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSet, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -197,7 +198,7 @@ void adaptiveMinPortRoutingOutput(
     Router* router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     const std::vector<u32>& _vcSets, u32 _numVcSets, u32 _numVcs,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -205,7 +206,7 @@ void valiantsRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
     IntNodeAlg _intNodeAlg, BaseRoutingAlg _routingAlg, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
@@ -225,7 +226,7 @@ void lcqVcRoutingOutput(Router* _router, u32 _inputPort, u32 _inputVc,
                         const std::vector<u32>& _dimensionWidths,
                         const std::vector<u32>& _dimensionWeights,
                         u32 _concentration, u32 _interfacePorts,
-                        const std::vector<u32>* _destinationAddress, u32 _vcSet,
+                        const Address* _destinationAddress, u32 _vcSet,
                         u32 _numVcSets, u32 _numVcs, bool _shortCut,
                         std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -233,7 +234,7 @@ void lcqPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, bool _shortCut,
     std::unordered_set<std::tuple<u32, u32, f64>>* _vcPool);
 
@@ -241,7 +242,7 @@ void doalPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
@@ -250,7 +251,7 @@ void doalVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
@@ -259,7 +260,7 @@ void ddalPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
@@ -268,7 +269,7 @@ void ddalVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsNonMin);
@@ -277,7 +278,7 @@ void vdalPortRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     bool _multiDeroute,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
@@ -287,7 +288,7 @@ void vdalVcRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     bool _multiDeroute,
     std::unordered_set<std::tuple<u32, u32, f64>>* _outputVcsMin,
@@ -297,7 +298,7 @@ void skippingDimOrderRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _startingDim, u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
     Flit* _flit, f64 _iBias, f64 _cBias, f64 _step, f64 _threshold,
     f64 _thresholdMin, f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
@@ -311,7 +312,7 @@ void finishingDimOrderRoutingOutput(
     Router* _router, u32 _inputPort, u32 _inputVc,
     const std::vector<u32>& _dimensionWidths,
     const std::vector<u32>& _dimensionWeights, u32 _concentration,
-    u32 _interfacePorts, const std::vector<u32>* _destinationAddress,
+    u32 _interfacePorts, const Address* _destinationAddress,
     u32 _baseVc, u32 _vcSet, u32 _numVcSets, u32 _numVcs, Flit* _flit,
     f64 _iBias, f64 _cBias, f64 _threshold, f64 _thresholdMin,
     f64 _thresholdNonMin, SkippingRoutingAlg _routingAlg,
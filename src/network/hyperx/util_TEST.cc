@@ -27,12 +27,13 @@
 #include "router/Router.h"
 #include "strop/strop.h"
 #include "test/TestSetup_TESTLIB.h"
+#include "types/Address.h"
 
 namespace {
 
 TEST(HyperX, computeMinimalHops) {
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   u32 exp;
   u32 dimensions;
 
@@ -66,9 +67,9 @@ nlohmann::json makeJSON(u32 _numPorts, u32 _numVcs) {
 
 class TestRouter : public Router {
  public:
-  TestRouter(const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
+  TestRouter(const Address& _address, u32 _numPorts, u32 _numVcs,
              const std::unordered_map<u32, f64>& _congStatus)
-      : Router("TestRouter_" + strop::vecString<u32>(_address), nullptr,
+      : Router("TestRouter_" + _address.toString(), nullptr,
                nullptr, 0, _address, _numPorts, _numVcs, nullptr,
                makeJSON(_numPorts, _numVcs)) {
     congStatus_ = _congStatus;
@@ -99,8 +100,8 @@ class TestRouter : public Router {
   std::unordered_map<u32, f64> congStatus_;
 };
 
-void intNodeTestCongestion(const std::vector<u32>& _sourceRouter,
-                           const std::vector<u32>* _destinationTerminal,
+void intNodeTestCongestion(const Address& _sourceRouter,
+                           const Address* _destinationTerminal,
                            const std::vector<u32>& _dimWidths,
                            const std::vector<u32>& _dimWeights, u32 _conc,
                            u32 _interfacePorts, u32 _vcSet, u32 _numVcSets,
@@ -108,7 +109,7 @@ void intNodeTestCongestion(const std::vector<u32>& _sourceRouter,
                            const std::unordered_set<u32>& _idSet,
                            const std::unordered_map<u32, f64> _congStatus,
                            HyperX::IntNodeAlgFunc _intNodeAlgFunc) {
-  std::vector<u32> addr;
+  Address addr;
   u32 numBuckets;
   u32 nonZeroBuckets = 0;
   const u64 kRounds = 10000;
@@ -168,8 +169,8 @@ void intNodeTestCongestion(const std::vector<u32>& _sourceRouter,
   ASSERT_NEAR(stdDev, 0.0, 0.015);
 }
 
-void intNodeTest(const std::vector<u32>& _sourceRouter,
-                 const std::vector<u32>* _destinationTerminal,
+void intNodeTest(const Address& _sourceRouter,
+                 const Address* _destinationTerminal,
                  const std::vector<u32>& _dimWidths, u32 _refNumBuckets,
                  const std::unordered_set<u32>& _idSet,
                  HyperX::IntNodeAlgFunc _intNodeAlgFunc) {
@@ -181,8 +182,8 @@ void intNodeTest(const std::vector<u32>& _sourceRouter,
 }
 
 void distRoutingTest(
-    const std::vector<u32>& _sourceRouter,
-    const std::vector<u32>* _destinationTerminal,
+    const Address& _sourceRouter,
+    const Address* _destinationTerminal,
     const std::vector<u32>& _widths, const std::vector<u32>& _weights,
     u32 _conc, u32 _interfacePorts, u32 _vcSet, u32 _numVcSets, u32 _numVcs,
     bool _shortCut, u32 _maxOutputs,
@@ -279,7 +280,7 @@ void distRoutingTest(
 
 TEST(HyperXUtil, isDestinationRouter) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst;
+  Address src, dst;
   std::vector<u32> widths, weights;
   u32 conc, numVcs;
   std::unordered_map<u32, f64> congStatus;
@@ -314,7 +315,7 @@ TEST(HyperXUtil, isDestinationRouter) {
 
 TEST(HyperXUtil, hopsLeft) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst;
+  Address src, dst;
   std::vector<u32> widths, weights;
   u32 conc, numVcs;
   std::unordered_map<u32, f64> congStatus;
@@ -370,8 +371,8 @@ TEST(HyperXUtil, hopsLeft) {
 
 TEST(HyperXUtil, intNodeMoveUnaligned) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths;
   std::unordered_set<u32> idSet;
 
@@ -452,8 +453,8 @@ TEST(HyperXUtil, intNodeMoveUnaligned) {
 
 TEST(HyperXUtil, intNodeReg) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths;
   std::unordered_set<u32> idSet;
 
@@ -526,8 +527,8 @@ TEST(HyperXUtil, intNodeReg) {
 
 TEST(HyperXUtil, intNodeSrc) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths;
   std::unordered_set<u32> idSet;
 
@@ -594,8 +595,8 @@ TEST(HyperXUtil, intNodeSrc) {
 
 TEST(HyperXUtil, intNodeDst) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths;
   std::unordered_set<u32> idSet;
 
@@ -662,8 +663,8 @@ TEST(HyperXUtil, intNodeDst) {
 
 TEST(HyperXUtil, intNodeSrcDst) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths;
   std::unordered_set<u32> idSet;
 
@@ -731,8 +732,8 @@ TEST(HyperXUtil, intNodeSrcDst) {
 TEST(HyperXUtil, intNodeMinV) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs;
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths, weights;
   std::unordered_set<u32> idSet;
   std::unordered_map<u32, f64> congStatus;
@@ -846,8 +847,8 @@ TEST(HyperXUtil, intNodeMinV) {
 TEST(HyperXUtil, intNodeMinP) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs;
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths, weights;
   std::unordered_set<u32> idSet;
   std::unordered_map<u32, f64> congStatus;
@@ -975,7 +976,8 @@ TEST(HyperXUtil, intNodeMinP) {
 
 TEST(HyperXUtil, dimOrderVcRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
 
@@ -1209,7 +1211,8 @@ TEST(HyperXUtil, dimOrderVcRoutingAlgorithm) {
 
 TEST(HyperXUtil, randMinVcRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
 
@@ -1284,7 +1287,8 @@ TEST(HyperXUtil, randMinVcRoutingAlgorithm) {
 
 TEST(HyperXUtil, randMinPortRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
 
@@ -1359,7 +1363,8 @@ TEST(HyperXUtil, randMinPortRoutingAlgorithm) {
 
 TEST(HyperXUtil, adaptiveMinVcRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
   std::unordered_map<u32, f64> congStatus;
@@ -1484,7 +1489,8 @@ TEST(HyperXUtil, adaptiveMinVcRoutingAlgorithm) {
 
 TEST(HyperXUtil, adaptiveMinPortRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
   std::unordered_map<u32, f64> congStatus;
@@ -1647,7 +1653,8 @@ TEST(HyperXUtil, adaptiveMinPortRoutingAlgorithm) {
 
 TEST(HyperXUtil, lcqVcRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
   std::unordered_map<u32, f64> congStatus;
@@ -1742,7 +1749,8 @@ TEST(HyperXUtil, lcqVcRoutingAlgorithm) {
 
 TEST(HyperXUtil, lcqPortRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs, numOutputs;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
   std::unordered_map<u32, f64> congStatus;
@@ -1870,7 +1878,8 @@ TEST(HyperXUtil, lcqPortRoutingAlgorithm) {
 
 TEST(HyperXUtil, valiantsRoutingAlgorithm) {
   TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
-  std::vector<u32> src, dst, widths, weights;
+  Address src, dst;
+  std::vector<u32> widths, weights;
   u32 conc, interfacePorts, vcSet, numVcSets, numVcs;
   std::unordered_set<std::tuple<u32, u32, f64>> outputPorts;
   std::unordered_set<std::tuple<u32, u32>> refOutputPorts;
@@ -1899,7 +1908,7 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
   TestRouter* router;
   u32 numPorts;
   numPorts = conc;
-  std::vector<u32>* false_src;
+  Address* false_src;
   for (u32 dim = 0; dim < widths.size(); dim++) {
     numPorts += widths.at(dim) * weights.at(dim);
   }
@@ -1910,7 +1919,7 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
                                 false, intNodeAlg, routingAlg, f, &outputPorts);
   ASSERT_NE(p->getRoutingExtension(), nullptr);
 
-  delete reinterpret_cast<const std::vector<u32>*>(p->getRoutingExtension());
+  delete reinterpret_cast<const Address*>(p->getRoutingExtension());
   p->setRoutingExtension(nullptr);
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
@@ -1926,7 +1935,7 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
     ASSERT_EQ(std::get<0>(it), 0u);
   }
 
-  false_src = new std::vector<u32>({U32_MAX, 0, 0});
+  false_src = new Address({U32_MAX, 0, 0});
   dst = {0, 1, 1};
   p->incrementHopCount();
   p->setRoutingExtension(false_src);
@@ -1935,14 +1944,14 @@ TEST(HyperXUtil, valiantsRoutingAlgorithm) {
                                 false, intNodeAlg, routingAlg, f, &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
 
-  false_src = new std::vector<u32>({U32_MAX, 0, 0});
+  false_src = new Address({U32_MAX, 0, 0});
   p->setRoutingExtension(false_src);
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
                                 interfacePorts, &dst, vcSet, numVcSets, numVcs,
                                 true, intNodeAlg, routingAlg, f, &outputPorts);
   ASSERT_EQ(p->getRoutingExtension(), nullptr);
 
-  false_src = new std::vector<u32>({U32_MAX, 0, 0});
+  false_src = new Address({U32_MAX, 0, 0});
   p->setRoutingExtension(false_src);
   dst = {0, 0, 0};
   HyperX::valiantsRoutingOutput(router, 0, 0, widths, weights, conc,
@@ -0,0 +1,216 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/interfaceonly/Fabric.h"
+
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+#include "util/invariant.h"
+
+namespace InterfaceOnly {
+
+Fabric::Fabric(const std::string& _name, const Component* _parent,
+               u32 _numInterfaces, u32 _interfacePorts, u32 _numVcs,
+               nlohmann::json _settings)
+    : Component(_name, _parent),
+      numInterfaces_(_numInterfaces),
+      interfacePorts_(_interfacePorts),
+      numVcs_(_numVcs),
+      latency_(_settings["latency"].get<u32>()),
+      freeEntry_(U32_MAX),
+      eventPending_(false) {
+  assert(numInterfaces_ > 0);
+  assert(interfacePorts_ > 0);
+  assert(numVcs_ > 0);
+  assert(latency_ > 0);
+
+  u32 numPorts = numInterfaces_ * interfacePorts_;
+  inputChannels_.resize(numPorts, nullptr);
+  outputChannels_.resize(numPorts, nullptr);
+  streams_.resize(numPorts * numVcs_, {U32_MAX, U32_MAX, U32_MAX, false});
+  outputs_.resize(numPorts, {U32_MAX, U32_MAX, U32_MAX, false});
+}
+
+Fabric::~Fabric() {}
+
+void Fabric::setInputChannel(u32 _port, Channel* _channel) {
+  assert(inputChannels_.at(_port) == nullptr);
+  inputChannels_.at(_port) = _channel;
+  _channel->setSink(this, _port);
+}
+
+void Fabric::setOutputChannel(u32 _port, Channel* _channel) {
+  assert(outputChannels_.at(_port) == nullptr);
+  outputChannels_.at(_port) = _channel;
+  _channel->setSource(this, _port);
+}
+
+void Fabric::receiveFlit(u32 _port, Flit* _flit) {
+  CHECK_HOT(_flit->getVc() < numVcs_);
+  u32 stream = _port * numVcs_ + _flit->getVc();
+
+  // grab an entry from the free list
+  u32 entry;
+  if (freeEntry_ != U32_MAX) {
+    entry = freeEntry_;
+    freeEntry_ = entries_[entry].next;
+  } else {
+    entry = entries_.size();
+    entries_.push_back({nullptr, 0, U32_MAX});
+  }
+  entries_[entry].flit = _flit;
+  entries_[entry].readyTime =
+      gSim->futureCycle(Simulator::Clock::CHANNEL, latency_);
+  entries_[entry].next = U32_MAX;
+
+  // append the entry to the stream
+  Stream& s = streams_[stream];
+  if (s.tail == U32_MAX) {
+    s.head = entry;
+  } else {
+    entries_[s.tail].next = entry;
+  }
+  s.tail = entry;
+
+  // a stream that isn't registered has a head flit at its front
+  if (!s.registered) {
+    CHECK_HOT(_flit->isHead());
+    registerStream(stream);
+  }
+
+  // the event is scheduled no later than this flit's ready time
+  if (!eventPending_) {
+    eventPending_ = true;
+    addEvent(entries_[entry].readyTime, 1, nullptr, 0);
+  }
+}
+
+void Fabric::receiveCredit(u32 _port, Credit* _credit) {
+  // interfaces eject flits on arrival, thus their credits aren't tracked
+  delete _credit;
+}
+
+void Fabric::processEvent(void* _event, s32 _type) {
+  CHECK_HOT(gSim->epsilon() == 1);
+  CHECK_HOT(eventPending_);
+  eventPending_ = false;
+  u64 now = gSim->time();
+
+  // only visit the output ports that have work
+  processPorts_.clear();
+  processPorts_.swap(activePorts_);
+  for (u32 port : processPorts_) {
+    Output& output = outputs_[port];
+    output.active = false;
+
+    // lock onto the next pending stream
+    if (output.lock == U32_MAX && output.pendingHead != U32_MAX) {
+      output.lock = output.pendingHead;
+      output.pendingHead = streams_[output.lock].nextPending;
+      if (output.pendingHead == U32_MAX) {
+        output.pendingTail = U32_MAX;
+      }
+    }
+
+    // send the next flit of the locked stream when it is ready
+    u32 stream = output.lock;
+    if (stream != U32_MAX) {
+      Stream& s = streams_[stream];
+      if (s.head != U32_MAX && entries_[s.head].readyTime <= now) {
+        u32 entry = s.head;
+        Flit* flit = entries_[entry].flit;
+        s.head = entries_[entry].next;
+        if (s.head == U32_MAX) {
+          s.tail = U32_MAX;
+        }
+        entries_[entry].flit = nullptr;
+        entries_[entry].next = freeEntry_;
+        freeEntry_ = entry;
+
+        CHECK_HOT(outputChannels_[port]->getNextFlit() == nullptr);
+        outputChannels_[port]->setNextFlit(flit);
+        sendCredit(stream / numVcs_, stream % numVcs_);
+
+        // the tail flit releases the output port
+        if (flit->isTail()) {
+          output.lock = U32_MAX;
+          s.registered = false;
+          if (s.head != U32_MAX) {
+            registerStream(stream);
+          }
+        }
+      }
+    }
+
+    // stay active while there is more to send
+    if (output.lock != U32_MAX || output.pendingHead != U32_MAX) {
+      activate(port);
+    }
+  }
+
+  // run again next cycle while any output port has work
+  if (!activePorts_.empty()) {
+    eventPending_ = true;
+    addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, 1), 1, nullptr, 0);
+  }
+}
+
+u32 Fabric::outputPort(u32 _stream) const {
+  // the packet leaves on the same port index of the destination interface
+  const Stream& s = streams_[_stream];
+  CHECK_HOT(s.head != U32_MAX);
+  const Flit* flit = entries_[s.head].flit;
+  u32 destination = flit->packet()->message()->getDestinationId();
+  CHECK_HOT(destination < numInterfaces_);
+  u32 channel = (_stream / numVcs_) % interfacePorts_;
+  return destination * interfacePorts_ + channel;
+}
+
+void Fabric::registerStream(u32 _stream) {
+  Stream& s = streams_[_stream];
+  CHECK_HOT(!s.registered);
+  s.registered = true;
+  s.nextPending = U32_MAX;
+
+  u32 port = outputPort(_stream);
+  Output& output = outputs_[port];
+  if (output.pendingTail == U32_MAX) {
+    output.pendingHead = _stream;
+  } else {
+    streams_[output.pendingTail].nextPending = _stream;
+  }
+  output.pendingTail = _stream;
+  activate(port);
+}
+
+void Fabric::activate(u32 _port) {
+  if (!outputs_[_port].active) {
+    outputs_[_port].active = true;
+    activePorts_.push_back(_port);
+  }
+}
+
+void Fabric::sendCredit(u32 _port, u32 _vc) {
+  Credit* credit = inputChannels_[_port]->getNextCredit();
+  if (credit == nullptr) {
+    credit = new Credit(numVcs_);
+    inputChannels_[_port]->setNextCredit(credit);
+  }
+  credit->putNum(_vc);
+}
+
+}  // namespace InterfaceOnly
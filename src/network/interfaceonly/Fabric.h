@@ -0,0 +1,109 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_INTERFACEONLY_FABRIC_H_
+#define NETWORK_INTERFACEONLY_FABRIC_H_
+
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "network/Channel.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "types/CreditReceiver.h"
+#include "types/FlitReceiver.h"
+
+namespace InterfaceOnly {
+
+/*
+ * This is an ideal fabric that connects any number of interfaces without
+ *  modeling routers. Every interface port has a channel into the fabric and a
+ *  channel out of the fabric. A flit entering the fabric becomes eligible to
+ *  leave "latency" channel cycles later on the same port index of the
+ *  destination interface. The only contention is at the endpoints: each
+ *  output port sends one flit per channel cycle and delivers one packet at a
+ *  time so the destination never sees interleaved packets.
+ *
+ * Each input port and VC is given as many buffer slots as the interface's
+ *  credits. A credit is returned when a flit leaves the fabric, thus a
+ *  congested destination backpressures its sources.
+ *
+ * State is kept in flat arrays and only the output ports with work are
+ *  visited each cycle, thus the cost scales with traffic rather than with
+ *  the number of interfaces.
+ */
+class Fabric : public Component, public FlitReceiver, public CreditReceiver {
+ public:
+  Fabric(const std::string& _name, const Component* _parent,
+         u32 _numInterfaces, u32 _interfacePorts, u32 _numVcs,
+         nlohmann::json _settings);
+  ~Fabric();
+
+  // port = interface * interfacePorts + channel
+  void setInputChannel(u32 _port, Channel* _channel);
+  void setOutputChannel(u32 _port, Channel* _channel);
+
+  void receiveFlit(u32 _port, Flit* _flit) override;
+  void receiveCredit(u32 _port, Credit* _credit) override;
+  void processEvent(void* _event, s32 _type) override;
+
+ private:
+  // a stream is the sequence of flits received on one input port and VC
+  struct Entry {
+    Flit* flit;
+    u64 readyTime;
+    u32 next;
+  };
+
+  struct Stream {
+    u32 head;
+    u32 tail;
+    u32 nextPending;
+    bool registered;  // pending on or locking an output port
+  };
+
+  struct Output {
+    u32 lock;  // the stream currently sending a packet
+    u32 pendingHead;
+    u32 pendingTail;
+    bool active;
+  };
+
+  u32 outputPort(u32 _stream) const;
+  void registerStream(u32 _stream);
+  void activate(u32 _port);
+  void sendCredit(u32 _port, u32 _vc);
+
+  const u32 numInterfaces_;
+  const u32 interfacePorts_;
+  const u32 numVcs_;
+  const u32 latency_;
+
+  std::vector<Channel*> inputChannels_;
+  std::vector<Channel*> outputChannels_;
+
+  std::vector<Entry> entries_;
+  u32 freeEntry_;
+  std::vector<Stream> streams_;
+  std::vector<Output> outputs_;
+
+  std::vector<u32> activePorts_;
+  std::vector<u32> processPorts_;
+  bool eventPending_;
+};
+
+}  // namespace InterfaceOnly
+
+#endif  // NETWORK_INTERFACEONLY_FABRIC_H_
@@ -0,0 +1,223 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/interfaceonly/Fabric.h"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "event/Component.h"
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "network/Channel.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Credit.h"
+#include "types/CreditReceiver.h"
+#include "types/Flit.h"
+#include "types/FlitReceiver.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace {
+
+// this plays every interface port, it injects flits into the fabric and
+//  records the flits and credits coming back
+class Endpoints : public Component, public FlitReceiver, public CreditReceiver {
+ public:
+  struct Arrival {
+    u32 port;
+    Flit* flit;
+    u64 cycle;
+  };
+
+  Endpoints(InterfaceOnly::Fabric* _fabric, u32 _numPorts, u32 _numVcs,
+            u32 _channelLatency)
+      : Component("Endpoints", nullptr), credits_(_numPorts, 0) {
+    for (u32 port = 0; port < _numPorts; port++) {
+      Channel* in = new Channel("In_" + std::to_string(port), nullptr,
+                                _numVcs, _channelLatency);
+      in->setSource(this, port);
+      _fabric->setInputChannel(port, in);
+      inputs_.push_back(in);
+      Channel* out = new Channel("Out_" + std::to_string(port), nullptr,
+                                 _numVcs, _channelLatency);
+      _fabric->setOutputChannel(port, out);
+      out->setSink(this, port);
+      outputs_.push_back(out);
+    }
+  }
+
+  ~Endpoints() {
+    for (Channel* channel : inputs_) {
+      delete channel;
+    }
+    for (Channel* channel : outputs_) {
+      delete channel;
+    }
+    for (Message* message : messages_) {
+      delete message;
+    }
+  }
+
+  // this sends a packet from a port to a destination interface, one flit per
+  //  cycle starting at '_cycle'
+  Packet* send(u32 _port, u32 _vc, u32 _destination, u32 _numFlits,
+               u64 _cycle) {
+    Message* message = new Message(1, nullptr);
+    message->setDestinationId(_destination);
+    Packet* packet = new Packet(0, _numFlits, message);
+    message->setPacket(0, packet);
+    for (u32 f = 0; f < _numFlits; f++) {
+      Flit* flit = new Flit(f, f == 0, f == _numFlits - 1, packet);
+      flit->setVc(_vc);
+      packet->setFlit(f, flit);
+      addEvent(gSim->futureCycle(Simulator::Clock::CHANNEL, _cycle + f), 0,
+               flit, _port);
+    }
+    messages_.push_back(message);
+    return packet;
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    inputs_.at(_type)->setNextFlit(reinterpret_cast<Flit*>(_event));
+  }
+
+  void receiveFlit(u32 _port, Flit* _flit) override {
+    arrivals_.push_back({_port, _flit, gSim->cycle(Simulator::Clock::CHANNEL)});
+  }
+
+  void receiveCredit(u32 _port, Credit* _credit) override {
+    while (_credit->more()) {
+      _credit->getNum();
+      credits_.at(_port)++;
+    }
+    delete _credit;
+  }
+
+  const std::vector<Arrival>& arrivals() const {
+    return arrivals_;
+  }
+
+  u32 credits(u32 _port) const {
+    return credits_.at(_port);
+  }
+
+ private:
+  std::vector<Channel*> inputs_;
+  std::vector<Channel*> outputs_;
+  std::vector<Message*> messages_;
+  std::vector<Arrival> arrivals_;
+  std::vector<u32> credits_;
+};
+
+nlohmann::json makeJSON(u32 _latency) {
+  nlohmann::json settings;
+  settings["latency"] = _latency;
+  return settings;
+}
+
+}  // namespace
+
+TEST(Fabric, delivery) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  const u32 kInterfaces = 4;
+  const u32 kPorts = 2;
+  const u32 kVcs = 2;
+  InterfaceOnly::Fabric fabric("Fabric", nullptr, kInterfaces, kPorts, kVcs,
+                               makeJSON(3));
+  Endpoints endpoints(&fabric, kInterfaces * kPorts, kVcs, 1);
+
+  // packets leave on the same port index of their destination interface
+  Packet* a = endpoints.send(0 * kPorts + 1, 0, 2, 3, 1);
+  Packet* b = endpoints.send(3 * kPorts + 0, 1, 1, 2, 1);
+  Packet* c = endpoints.send(2 * kPorts + 0, 1, 3, 1, 10);
+
+  gSim->initialize();
+  gSim->simulate();
+
+  ASSERT_EQ(endpoints.arrivals().size(), 6u);
+  std::vector<std::tuple<Packet*, u32>> expected = {
+    {a, 2 * kPorts + 1}, {b, 1 * kPorts + 0}, {c, 3 * kPorts + 0}};
+  for (const auto& e : expected) {
+    Packet* packet = std::get<0>(e);
+    u32 flits = 0;
+    for (const Endpoints::Arrival& arrival : endpoints.arrivals()) {
+      if (arrival.flit->packet() == packet) {
+        ASSERT_EQ(arrival.port, std::get<1>(e));
+        ASSERT_EQ(arrival.flit, packet->getFlit(flits));
+        flits++;
+      }
+    }
+    ASSERT_EQ(flits, packet->numFlits());
+  }
+
+  // every flit that left the fabric returned a credit to its source
+  ASSERT_EQ(endpoints.credits(0 * kPorts + 1), 3u);
+  ASSERT_EQ(endpoints.credits(3 * kPorts + 0), 2u);
+  ASSERT_EQ(endpoints.credits(2 * kPorts + 0), 1u);
+}
+
+TEST(Fabric, latency) {
+  for (u32 latency : {1u, 4u, 25u}) {
+    for (u32 channelLatency : {1u, 3u}) {
+      TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+      InterfaceOnly::Fabric fabric("Fabric", nullptr, 3, 1, 1,
+                                   makeJSON(latency));
+      Endpoints endpoints(&fabric, 3, 1, channelLatency);
+
+      // each flit crosses two channels and the fabric
+      const u64 kStart = 5;
+      Packet* packet = endpoints.send(0, 0, 2, 4, kStart);
+
+      gSim->initialize();
+      gSim->simulate();
+
+      ASSERT_EQ(endpoints.arrivals().size(), 4u);
+      for (u32 f = 0; f < 4; f++) {
+        const Endpoints::Arrival& arrival = endpoints.arrivals().at(f);
+        ASSERT_EQ(arrival.flit, packet->getFlit(f));
+        ASSERT_EQ(arrival.port, 2u);
+        ASSERT_EQ(arrival.cycle, kStart + f + 2 * channelLatency + latency);
+      }
+    }
+  }
+}
+
+TEST(Fabric, contention) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  InterfaceOnly::Fabric fabric("Fabric", nullptr, 3, 1, 2, makeJSON(2));
+  Endpoints endpoints(&fabric, 3, 2, 1);
+
+  // two packets meeting at one destination leave one after the other, one
+  //  flit per cycle
+  Packet* a = endpoints.send(0, 0, 2, 3, 1);
+  Packet* b = endpoints.send(1, 1, 2, 3, 1);
+
+  gSim->initialize();
+  gSim->simulate();
+
+  const std::vector<Endpoints::Arrival>& arrivals = endpoints.arrivals();
+  ASSERT_EQ(arrivals.size(), 6u);
+  Packet* first = arrivals.at(0).flit->packet();
+  ASSERT_TRUE(first == a || first == b);
+  Packet* second = first == a ? b : a;
+  for (u32 f = 0; f < 6; f++) {
+    ASSERT_EQ(arrivals.at(f).port, 2u);
+    ASSERT_EQ(arrivals.at(f).flit, (f < 3 ? first : second)->getFlit(f % 3));
+    ASSERT_EQ(arrivals.at(f).cycle, 1 + 2 * 1 + 2 + f);
+  }
+}
@@ -19,6 +19,7 @@
 #include <tuple>
 
 #include "factory/ObjectFactory.h"
+#include "network/interfaceonly/Fabric.h"
 #include "network/interfaceonly/InjectionAlgorithm.h"
 
 namespace InterfaceOnly {
@@ -29,7 +30,6 @@ Network::Network(const std::string& _name, const Component* _parent,
   // num_interfaces
   numInterfaces_ = _settings["num_interfaces"].get<u32>();
   assert(numInterfaces_ > 0);
-  assert(numInterfaces_ <= 2);
   interfacePorts_ = _settings["interface_ports"].get<u32>();
   assert(interfacePorts_ > 0);
   dbgprintf("num_interfaces_ = %u", numInterfaces_);
@@ -48,6 +48,15 @@ Network::Network(const std::string& _name, const Component* _parent,
     interfaces_.at(id) = interface;
   }
 
+  // without a fabric, one or two interfaces are wired directly
+  fabric_ = nullptr;
+  if (_settings.contains("fabric") && !_settings["fabric"].is_null()) {
+    fabric_ = new Fabric("Fabric", this, numInterfaces_, interfacePorts_,
+                         numVcs_, _settings["fabric"]);
+  } else {
+    assert(numInterfaces_ <= 2);
+  }
+
   // create the channels
   for (u32 iface = 0; iface < numInterfaces_; iface++) {
     for (u32 ch = 0; ch < interfacePorts_; ch++) {
@@ -59,9 +68,35 @@ Network::Network(const std::string& _name, const Component* _parent,
       externalChannels_.push_back(channel);
     }
   }
+  if (fabric_) {
+    // the fabric drives a second set of channels into the interfaces
+    for (u32 iface = 0; iface < numInterfaces_; iface++) {
+      for (u32 ch = 0; ch < interfacePorts_; ch++) {
+        std::string channelName = "FabricChannel_" + std::to_string(iface) +
+                                  "_" + std::to_string(ch);
+        Channel* channel = new Channel(channelName, this, numVcs_,
+                                       _settings["external_channel"]);
+        externalChannels_.push_back(channel);
+      }
+    }
+  }
 
   // connect the interface(s) and channel(s)
-  if (numInterfaces_ == 1) {
+  if (fabric_) {
+    // every interface is wired to the fabric
+    u32 numPorts = numInterfaces_ * interfacePorts_;
+    for (u32 iface = 0; iface < numInterfaces_; iface++) {
+      for (u32 ch = 0; ch < interfacePorts_; ch++) {
+        u32 port = iface * interfacePorts_ + ch;
+        Channel* inChannel = externalChannels_.at(port);
+        Channel* outChannel = externalChannels_.at(numPorts + port);
+        interfaces_.at(iface)->setOutputChannel(ch, inChannel);
+        fabric_->setInputChannel(port, inChannel);
+        fabric_->setOutputChannel(port, outChannel);
+        interfaces_.at(iface)->setInputChannel(ch, outChannel);
+      }
+    }
+  } else if (numInterfaces_ == 1) {
     // a single interface is wired in loopback mode
     for (u32 ch = 0; ch < interfacePorts_; ch++) {
       Channel* channel = externalChannels_.at(ch);
@@ -85,6 +120,9 @@ Network::Network(const std::string& _name, const Component* _parent,
 }
 
 Network::~Network() {
+  if (fabric_) {
+    delete fabric_;
+  }
   for (auto it = interfaces_.begin(); it != interfaces_.end(); ++it) {
     Interface* interface = *it;
     delete interface;
@@ -135,29 +173,29 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   _address->resize(1);
   _address->at(0) = _id;
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return _address->at(0);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   assert(false);  // there are no routers
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   assert(false);  // there are no routers
   return 0;
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
   return 0;
 }
 
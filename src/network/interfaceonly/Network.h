@@ -22,9 +22,11 @@
 #include "interface/Interface.h"
 #include "network/Channel.h"
 #include "network/Network.h"
+#include "network/interfaceonly/Fabric.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "router/Router.h"
+#include "types/Address.h"
 
 namespace InterfaceOnly {
 
@@ -51,15 +53,15 @@ class Network : public ::Network {
   Router* getRouter(u32 _id) const override;
   Interface* getInterface(u32 _id) const override;
   void translateInterfaceIdToAddress(u32 _id,
-                                     std::vector<u32>* _address) const override;
+                                     Address* _address) const override;
   u32 translateInterfaceAddressToId(
-      const std::vector<u32>* _address) const override;
+      const Address* _address) const override;
   void translateRouterIdToAddress(u32 _id,
-                                  std::vector<u32>* _address) const override;
+                                  Address* _address) const override;
   u32 translateRouterAddressToId(
-      const std::vector<u32>* _address) const override;
-  u32 computeMinimalHops(const std::vector<u32>* _source,
-                         const std::vector<u32>* _destination) const override;
+      const Address* _address) const override;
+  u32 computeMinimalHops(const Address* _source,
+                         const Address* _destination) const override;
 
  protected:
   void collectChannels(std::vector<Channel*>* _channels) override;
@@ -67,6 +69,7 @@ class Network : public ::Network {
  private:
   u32 numInterfaces_;
   u32 interfacePorts_;
+  Fabric* fabric_;  // nullptr when interfaces are wired directly
 
   std::vector<Channel*> externalChannels_;
   std::vector<Interface*> interfaces_;
@@ -21,6 +21,7 @@
 #include "factory/ObjectFactory.h"
 #include "network/mesh/util.h"
 #include "strop/strop.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -54,9 +55,9 @@ void DimOrderRoutingAlgorithm::processRequest(
   u32 outputPort;
 
   // ex: [x,y,z]
-  const std::vector<u32>& routerAddress = router_->address();
+  const Address& routerAddress = router_->address();
   // ex: [c,x,y,z]
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   assert(routerAddress.size() == (destinationAddress->size() - 1));
 
@@ -75,7 +76,7 @@ void DimOrderRoutingAlgorithm::processRequest(
 
   // create a temporary router address with a dummy concentration for use with
   //  'util.h' 'computeMinimalHops() frunction'
-  std::vector<u32> tempRA = std::vector<u32>(1 + routerAddress.size());
+  Address tempRA = std::vector<u32>(1 + routerAddress.size());
   tempRA.at(0) = U32_MAX;  // dummy
   for (u32 ind = 1; ind < tempRA.size(); ind++) {
     tempRA.at(ind) = routerAddress.at(ind - 1);
@@ -20,6 +20,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/mesh/util.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -58,7 +59,7 @@ void ValiantsRoutingAlgorithm::processRequest(
 
   // this is the current router's address
   // ex: [x,y,z]
-  const std::vector<u32>& routerAddress = router_->address();
+  const Address& routerAddress = router_->address();
 
   // create the routing extension if needed
   if (packet->getRoutingExtension() == nullptr) {
@@ -68,7 +69,7 @@ void ValiantsRoutingAlgorithm::processRequest(
     // create routing extension header
     //  the extension is a vector with one dummy element then the address of the
     //  intermediate router
-    std::vector<u32>* re = new std::vector<u32>(1 + routerAddress.size());
+    Address* re = new Address(1 + routerAddress.size());
     re->at(0) = U32_MAX;  // dummy
     packet->setRoutingExtension(re);
 
@@ -79,11 +80,11 @@ void ValiantsRoutingAlgorithm::processRequest(
   }
 
   // get a const pointer to the address (with leading dummy)
-  const std::vector<u32>* intermediateAddress =
-      reinterpret_cast<const std::vector<u32>*>(packet->getRoutingExtension());
+  const Address* intermediateAddress =
+      reinterpret_cast<const Address*>(packet->getRoutingExtension());
 
   // ex: [c,x,y,z]
-  const std::vector<u32>* destinationAddress = message->getDestinationAddress();
+  const Address* destinationAddress = message->getDestinationAddress();
   assert(routerAddress.size() == (destinationAddress->size() - 1));
   assert(intermediateAddress->size() == destinationAddress->size());
 
@@ -127,7 +128,7 @@ void ValiantsRoutingAlgorithm::processRequest(
   u32 portBase;
   u32 dimWeight;
   bool stageTransition = false;
-  const std::vector<u32>* routingTo;
+  const Address* routingTo;
   if (stage == 0) {
     if (iDim == routerAddress.size()) {
       // done with stage 0, go to stage 1
@@ -154,7 +155,7 @@ void ValiantsRoutingAlgorithm::processRequest(
 
   // create a temporary router address with a dummy concentration for use with
   //  'util.h' 'computeMinimalHops() frunction'
-  std::vector<u32> tempRA = std::vector<u32>(1 + routerAddress.size());
+  Address tempRA = std::vector<u32>(1 + routerAddress.size());
   tempRA.at(0) = U32_MAX;  // dummy
   for (u32 ind = 1; ind < tempRA.size(); ind++) {
     tempRA.at(ind) = routerAddress.at(ind - 1);
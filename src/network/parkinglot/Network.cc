@@ -63,16 +63,17 @@ Network::Network(const std::string& _name, const Component* _parent,
     // create the channel
     std::string channelName =
         "Channel_" + std::to_string(router) + "-" + std::to_string(router + 1);
+    Router* sourceRouter = routers_.at(router);
+    Router* destinationRouter = routers_.at(router + 1);
     Channel* channel =
-        new Channel(channelName, this, numVcs_, _settings["internal_channel"]);
+        createRouterChannel(channelName, sourceRouter, destinationRouter,
+                            _settings["internal_channel"]);
     internalChannels_.push_back(channel);
 
     // link routers
-    Router* sourceRouter = routers_.at(router);
     assert(sourceRouter->getOutputChannel(outputPort_) == nullptr);
     sourceRouter->setOutputChannel(outputPort_, channel);
 
-    Router* destinationRouter = routers_.at(router + 1);
     assert(destinationRouter->getInputChannel(inputPort_) == nullptr);
     destinationRouter->setInputChannel(inputPort_, channel);
 
@@ -223,27 +224,27 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   _address->resize(1, _id);
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return _address->at(0);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   _address->resize(1, _id);
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return _address->at(0);
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
   u32 numr = routers_.size();
   u32 src = translateRouterAddressToId(_source);
   u32 myr = src / concentration_;
@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "factory/ObjectFactory.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/Packet.h"
 
@@ -39,7 +40,7 @@ DirectRoutingAlgorithm::~DirectRoutingAlgorithm() {}
 void DirectRoutingAlgorithm::processRequest(
     Flit* _flit, RoutingAlgorithm::Response* _response) {
   // direct route to destination
-  const std::vector<u32>* destinationAddress =
+  const Address* destinationAddress =
       _flit->packet()->message()->getDestinationAddress();
   std::vector<u32> outputPorts;
   u32 basePort = destinationAddress->at(0) * interfacePorts_;
@@ -0,0 +1,64 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/MinimalRoutingAlgorithm.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "network/slimfly/util.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace SlimFly {
+
+MinimalRoutingAlgorithm::MinimalRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
+    u32 _concentration, u32 _interfacePorts, const MmsGraph* _graph,
+    nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _concentration, _interfacePorts, _graph,
+                       _settings) {
+  // minimal paths take at most 2 hops
+  rcs_ = 2;
+  assert(_numVcs >= rcs_);
+}
+
+MinimalRoutingAlgorithm::~MinimalRoutingAlgorithm() {}
+
+void MinimalRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  const Address* destinationAddress =
+      _flit->packet()->message()->getDestinationAddress();
+  u32 destinationRouter = computeRouterId(graph_->q(), destinationAddress);
+
+  u32 thisRouter = router_->id();
+  if (thisRouter == destinationRouter) {
+    addExitPorts(destinationAddress->at(0));
+  } else {
+    addMinimalPorts(destinationRouter,
+                    graph_->distance(thisRouter, destinationRouter),
+                    nextRoutingClass());
+  }
+
+  reduce(_response);
+}
+
+}  // namespace SlimFly
+
+registerWithObjectFactory("minimal", SlimFly::RoutingAlgorithm,
+                          SlimFly::MinimalRoutingAlgorithm,
+                          SLIMFLY_ROUTINGALGORITHM_ARGS);
@@ -0,0 +1,310 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/MmsGraph.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+
+namespace SlimFly {
+
+MmsGraph::MmsGraph(u32 _q)
+    : q_(_q) {
+  // q = 4w + delta
+  assert(q_ >= 3);
+  if (q_ % 4 == 1) {
+    delta_ = 1;
+  } else if (q_ % 4 == 0) {
+    delta_ = 0;
+  } else if (q_ % 4 == 3) {
+    delta_ = -1;
+  } else {
+    fprintf(stderr, "Slim Fly requires q = 4w + delta, delta in {-1,0,1}\n");
+    assert(false);
+  }
+  numRouters_ = 2 * q_ * q_;
+  degree_ = ((3 * static_cast<s32>(q_)) - delta_) / 2;
+
+  createField();
+  createAdjacency();
+  createMinimalTable();
+}
+
+MmsGraph::~MmsGraph() {}
+
+u32 MmsGraph::q() const {
+  return q_;
+}
+
+s32 MmsGraph::delta() const {
+  return delta_;
+}
+
+u32 MmsGraph::numRouters() const {
+  return numRouters_;
+}
+
+u32 MmsGraph::degree() const {
+  return degree_;
+}
+
+u32 MmsGraph::neighbor(u32 _router, u32 _index) const {
+  assert(_router < numRouters_);
+  assert(_index < degree_);
+  return adjacency_[(_router * degree_) + _index];
+}
+
+u32 MmsGraph::neighborIndex(u32 _router, u32 _neighbor) const {
+  assert(_router < numRouters_);
+  std::vector<u32>::const_iterator begin =
+      adjacency_.cbegin() + (_router * degree_);
+  std::vector<u32>::const_iterator end = begin + degree_;
+  std::vector<u32>::const_iterator it = std::lower_bound(begin, end,
+                                                         _neighbor);
+  if (it == end || *it != _neighbor) {
+    return U32_MAX;
+  }
+  return it - begin;
+}
+
+u32 MmsGraph::distance(u32 _source, u32 _destination) const {
+  assert(_source < numRouters_);
+  assert(_destination < numRouters_);
+  return distance_[(_source * numRouters_) + _destination];
+}
+
+u32 MmsGraph::numMinimalPorts(u32 _source, u32 _destination) const {
+  u32 pair = (_source * numRouters_) + _destination;
+  return minimalOffsets_[pair + 1] - minimalOffsets_[pair];
+}
+
+u32 MmsGraph::minimalPort(u32 _source, u32 _destination, u32 _index) const {
+  assert(_index < numMinimalPorts(_source, _destination));
+  u32 pair = (_source * numRouters_) + _destination;
+  return minimalPorts_[minimalOffsets_[pair] + _index];
+}
+
+void MmsGraph::createField() {
+  // factor q = p^n
+  u32 p = 2;
+  while (q_ % p != 0) {
+    p++;
+  }
+  u32 n = 0;
+  for (u32 rem = q_; rem > 1; rem /= p) {
+    if (rem % p != 0) {
+      fprintf(stderr, "Slim Fly requires q to be a prime power\n");
+      assert(false);
+    }
+    n++;
+  }
+
+  // elements are polynomials over GF(p) of degree < n, stored as base-p digits
+  std::vector<u32> a(n), b(n), c(2 * n);
+  auto digits = [&](u32 _value, std::vector<u32>* _digits) {
+    for (u32 i = 0; i < n; i++) {
+      _digits->at(i) = _value % p;
+      _value /= p;
+    }
+  };
+
+  // addition is digit-wise modulo p
+  add_.resize(q_ * q_);
+  neg_.resize(q_);
+  for (u32 x = 0; x < q_; x++) {
+    digits(x, &a);
+    for (u32 y = 0; y < q_; y++) {
+      digits(y, &b);
+      u32 sum = 0;
+      for (u32 i = n; i > 0; i--) {
+        sum = (sum * p) + ((a[i - 1] + b[i - 1]) % p);
+      }
+      add_[(x * q_) + y] = sum;
+      if (sum == 0) {
+        neg_[x] = y;
+      }
+    }
+  }
+
+  // multiplication is modulo a monic polynomial x^n + m(x) of degree n. each
+  //  candidate m(x) is tried until the product table has an element of order
+  //  q-1, which only exists if the polynomial is irreducible
+  mul_.resize(q_ * q_);
+  std::vector<u32> m(n);
+  for (u32 modulus = 0; modulus < q_; modulus++) {
+    digits(modulus, &m);
+    for (u32 x = 0; x < q_; x++) {
+      digits(x, &a);
+      for (u32 y = 0; y < q_; y++) {
+        digits(y, &b);
+        std::fill(c.begin(), c.end(), 0);
+        for (u32 i = 0; i < n; i++) {
+          for (u32 j = 0; j < n; j++) {
+            c[i + j] = (c[i + j] + (a[i] * b[j])) % p;
+          }
+        }
+        // reduce using x^n = -m(x)
+        for (u32 k = (2 * n) - 1; k >= n; k--) {
+          u32 coeff = c[k];
+          c[k] = 0;
+          for (u32 i = 0; i < n; i++) {
+            c[k - n + i] = (c[k - n + i] + ((p - m[i]) * coeff)) % p;
+          }
+        }
+        u32 product = 0;
+        for (u32 i = n; i > 0; i--) {
+          product = (product * p) + c[i - 1];
+        }
+        mul_[(x * q_) + y] = product;
+      }
+    }
+
+    // search for a primitive element
+    for (u32 g = 1; g < q_; g++) {
+      u32 order = 1;
+      for (u32 v = g; v != 1 && order < q_; v = mul_[(v * q_) + g]) {
+        order++;
+      }
+      if (order == q_ - 1) {
+        primitive_ = g;
+        return;
+      }
+    }
+  }
+  assert(false);
+}
+
+void MmsGraph::createAdjacency() {
+  // the generator sets X (s=0) and X' (s=1) from powers of the primitive
+  std::vector<u32> powers(q_);
+  powers[0] = 1;
+  for (u32 i = 1; i < q_; i++) {
+    powers[i] = mul_[(powers[i - 1] * q_) + primitive_];
+  }
+  std::vector<u32> gen0, gen1;
+  u32 w = (static_cast<s32>(q_) - delta_) / 4;
+  if (delta_ == 1) {
+    for (u32 i = 0; i + 2 < q_; i += 2) {
+      gen0.push_back(powers[i]);
+      gen1.push_back(powers[i + 1]);
+    }
+  } else if (delta_ == 0) {
+    for (u32 i = 0; i + 1 < q_; i += 2) {
+      gen0.push_back(powers[i]);
+      gen1.push_back(powers[(i + 1) % (q_ - 1)]);
+    }
+  } else {
+    for (u32 i = 0; i + 1 < 2 * w; i += 2) {
+      gen0.push_back(powers[i]);
+      gen1.push_back(powers[i + 1]);
+    }
+    for (u32 i = (2 * w) - 1; i + 1 < 4 * w; i += 2) {
+      gen0.push_back(powers[i]);
+      gen1.push_back(powers[i + 1]);
+    }
+  }
+  assert(gen0.size() + q_ == degree_);
+  assert(gen1.size() + q_ == degree_);
+
+  // router (0, x, y) connects to (0, x, y + X) and to (1, m, y - mx)
+  // router (1, m, c) connects to (1, m, c + X') and to (0, x, mx + c)
+  u32 qq = q_ * q_;
+  adjacency_.resize(numRouters_ * degree_);
+  for (u32 a = 0; a < q_; a++) {
+    for (u32 b = 0; b < q_; b++) {
+      u32* row0 = &adjacency_[((a * q_) + b) * degree_];
+      u32* row1 = &adjacency_[(qq + (a * q_) + b) * degree_];
+      u32 index = 0;
+      for (u32 g : gen0) {
+        row0[index] = (a * q_) + add_[(b * q_) + g];
+        row1[index] = qq + (a * q_) + add_[(b * q_) + gen1[index]];
+        index++;
+      }
+      for (u32 other = 0; other < q_; other++) {
+        // router 0: a=x, b=y, other=m
+        u32 mx = mul_[(other * q_) + a];
+        row0[index] = qq + (other * q_) + add_[(b * q_) + neg_[mx]];
+        // router 1: a=m, b=c, other=x
+        u32 am = mul_[(a * q_) + other];
+        row1[index] = (other * q_) + add_[(am * q_) + b];
+        index++;
+      }
+      std::sort(row0, row0 + degree_);
+      std::sort(row1, row1 + degree_);
+      assert(std::adjacent_find(row0, row0 + degree_) == row0 + degree_);
+      assert(std::adjacent_find(row1, row1 + degree_) == row1 + degree_);
+    }
+  }
+}
+
+void MmsGraph::createMinimalTable() {
+  // each source is a two level breadth first search over the adjacency lists
+  //  with two passes, one to count the minimal ports per destination and one
+  //  to fill them in
+  distance_.resize(numRouters_ * numRouters_);
+  minimalOffsets_.resize((numRouters_ * numRouters_) + 1);
+  minimalPorts_.clear();
+  minimalPorts_.reserve(numRouters_ * numRouters_);
+  std::vector<u32> count(numRouters_);
+  std::vector<u32> cursor(numRouters_);
+
+  u32 total = 0;
+  for (u32 src = 0; src < numRouters_; src++) {
+    u8* dist = &distance_[src * numRouters_];
+    const u32* row = &adjacency_[src * degree_];
+    std::fill(dist, dist + numRouters_, U8_MAX);
+    std::fill(count.begin(), count.end(), 0);
+
+    dist[src] = 0;
+    for (u32 i = 0; i < degree_; i++) {
+      dist[row[i]] = 1;
+      count[row[i]] = 1;
+    }
+    for (u32 i = 0; i < degree_; i++) {
+      const u32* next = &adjacency_[row[i] * degree_];
+      for (u32 j = 0; j < degree_; j++) {
+        u32 dst = next[j];
+        if (dist[dst] == U8_MAX) {
+          dist[dst] = 2;
+        }
+        if (dist[dst] == 2) {
+          count[dst]++;
+        }
+      }
+    }
+
+    for (u32 dst = 0; dst < numRouters_; dst++) {
+      assert(dist[dst] != U8_MAX);  // diameter 2
+      minimalOffsets_[(src * numRouters_) + dst] = total;
+      cursor[dst] = total;
+      total += count[dst];
+    }
+    minimalPorts_.resize(total);
+
+    for (u32 i = 0; i < degree_; i++) {
+      minimalPorts_[cursor[row[i]]++] = i;
+      const u32* next = &adjacency_[row[i] * degree_];
+      for (u32 j = 0; j < degree_; j++) {
+        u32 dst = next[j];
+        if (dist[dst] == 2) {
+          minimalPorts_[cursor[dst]++] = i;
+        }
+      }
+    }
+  }
+  minimalOffsets_[numRouters_ * numRouters_] = total;
+}
+
+}  // namespace SlimFly
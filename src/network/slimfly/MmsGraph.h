@@ -0,0 +1,88 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_SLIMFLY_MMSGRAPH_H_
+#define NETWORK_SLIMFLY_MMSGRAPH_H_
+
+#include <vector>
+
+#include "prim/prim.h"
+
+namespace SlimFly {
+
+/*
+ * This is the McKay-Miller-Siran (MMS) graph used by the Slim Fly topology.
+ *  It is built over the finite field GF(q) where q is a prime power with
+ *  q = 4w + delta and delta in {-1, 0, 1}. There are 2q^2 routers (s, x, y)
+ *  with s in {0, 1} and x, y in GF(q), each of degree (3q - delta) / 2, and
+ *  the graph diameter is 2.
+ *
+ * Routers are numbered s*q^2 + x*q + y. Each router's neighbors are sorted by
+ *  router ID and a neighbor's index in that list is its port offset.
+ *
+ * All minimal paths are precomputed when the graph is built. For every
+ *  (source, destination) pair the table holds the neighbor indices at the
+ *  source which start a minimal path.
+ */
+class MmsGraph {
+ public:
+  explicit MmsGraph(u32 _q);
+  ~MmsGraph();
+
+  u32 q() const;
+  s32 delta() const;
+  u32 numRouters() const;
+  u32 degree() const;
+
+  // this returns the neighbor router ID at the index
+  u32 neighbor(u32 _router, u32 _index) const;
+  // this returns the index of a neighbor, U32_MAX if not adjacent
+  u32 neighborIndex(u32 _router, u32 _neighbor) const;
+
+  // this returns the number of hops between two routers (0, 1, or 2)
+  u32 distance(u32 _source, u32 _destination) const;
+
+  // these return the neighbor indices at the source that start a minimal path
+  //  to the destination
+  u32 numMinimalPorts(u32 _source, u32 _destination) const;
+  u32 minimalPort(u32 _source, u32 _destination, u32 _index) const;
+
+ private:
+  void createField();
+  void createAdjacency();
+  void createMinimalTable();
+
+  u32 q_;
+  s32 delta_;
+  u32 numRouters_;
+  u32 degree_;
+
+  // GF(q) arithmetic tables and a primitive element
+  std::vector<u32> add_;
+  std::vector<u32> mul_;
+  std::vector<u32> neg_;
+  u32 primitive_;
+
+  // [router * degree + index] = neighbor
+  std::vector<u32> adjacency_;
+
+  // [source * routers + destination]
+  std::vector<u8> distance_;
+  std::vector<u32> minimalOffsets_;  // one extra entry at the end
+  std::vector<u32> minimalPorts_;
+};
+
+}  // namespace SlimFly
+
+#endif  // NETWORK_SLIMFLY_MMSGRAPH_H_
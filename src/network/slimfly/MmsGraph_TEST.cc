@@ -0,0 +1,86 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/MmsGraph.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(SlimFlyMmsGraph, structure) {
+  for (u32 q : {3, 4, 5, 7, 8, 9, 11, 13, 16, 17, 25, 27}) {
+    SlimFly::MmsGraph graph(q);
+    ASSERT_EQ(graph.numRouters(), 2 * q * q);
+    ASSERT_EQ(graph.degree(),
+              static_cast<u32>((3 * static_cast<s32>(q) - graph.delta()) / 2));
+
+    for (u32 router = 0; router < graph.numRouters(); router++) {
+      for (u32 index = 0; index < graph.degree(); index++) {
+        // sorted and undirected
+        u32 neighbor = graph.neighbor(router, index);
+        if (index > 0) {
+          ASSERT_LT(graph.neighbor(router, index - 1), neighbor);
+        }
+        ASSERT_NE(neighbor, router);
+        ASSERT_EQ(graph.neighborIndex(router, neighbor), index);
+        ASSERT_NE(graph.neighborIndex(neighbor, router), U32_MAX);
+      }
+    }
+  }
+}
+
+TEST(SlimFlyMmsGraph, minimal) {
+  for (u32 q : {3, 4, 5, 7, 8, 9}) {
+    SlimFly::MmsGraph graph(q);
+    u32 routers = graph.numRouters();
+    for (u32 src = 0; src < routers; src++) {
+      // brute force distances
+      std::vector<u32> dist(routers, U32_MAX);
+      dist[src] = 0;
+      for (u32 i = 0; i < graph.degree(); i++) {
+        dist[graph.neighbor(src, i)] = 1;
+      }
+      for (u32 i = 0; i < graph.degree(); i++) {
+        u32 mid = graph.neighbor(src, i);
+        for (u32 j = 0; j < graph.degree(); j++) {
+          u32 dst = graph.neighbor(mid, j);
+          if (dist[dst] == U32_MAX) {
+            dist[dst] = 2;
+          }
+        }
+      }
+
+      for (u32 dst = 0; dst < routers; dst++) {
+        // diameter 2
+        ASSERT_LE(dist[dst], 2u);
+        ASSERT_EQ(graph.distance(src, dst), dist[dst]);
+
+        // every minimal port is one hop closer and all are found
+        u32 expected = 0;
+        for (u32 i = 0; i < graph.degree(); i++) {
+          u32 next = graph.neighbor(src, i);
+          if (dist[dst] > 0 && graph.distance(next, dst) == dist[dst] - 1) {
+            expected++;
+          }
+        }
+        ASSERT_EQ(graph.numMinimalPorts(src, dst), expected);
+        for (u32 idx = 0; idx < graph.numMinimalPorts(src, dst); idx++) {
+          u32 next = graph.neighbor(src, graph.minimalPort(src, dst, idx));
+          ASSERT_EQ(graph.distance(next, dst), dist[dst] - 1);
+        }
+      }
+    }
+  }
+}
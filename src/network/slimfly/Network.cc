@@ -0,0 +1,233 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/Network.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "network/slimfly/InjectionAlgorithm.h"
+#include "network/slimfly/RoutingAlgorithm.h"
+#include "network/slimfly/util.h"
+
+namespace SlimFly {
+
+Network::Network(const std::string& _name, const Component* _parent,
+                 MetadataHandler* _metadataHandler, nlohmann::json _settings)
+    : ::Network(_name, _parent, _metadataHandler, _settings) {
+  // concentration
+  assert(_settings.contains("concentration"));
+  concentration_ = _settings["concentration"].get<u32>();
+  assert(concentration_ > 0);
+
+  // interface ports
+  interfacePorts_ = _settings["interface_ports"].get<u32>();
+  assert(interfacePorts_ > 0);
+  assert(concentration_ % interfacePorts_ == 0);
+
+  // channels
+  assert(_settings.contains("internal_channel"));
+  assert(_settings.contains("external_channel"));
+
+  // the MMS graph and its routing tables are built before the routers since
+  //  the routers create their routing algorithms on construction
+  assert(_settings.contains("q"));
+  q_ = _settings["q"].get<u32>();
+  graph_ = new MmsGraph(q_);
+  u32 routerRadix = concentration_ + graph_->degree();
+  dbgprintf("delta = %d", graph_->delta());
+  dbgprintf("degree = %u", graph_->degree());
+  dbgprintf("routerRadix = %u", routerRadix);
+
+  // parse the protocol classes description
+  loadProtocolClassInfo(_settings["protocol_classes"]);
+
+  // create the routers
+  routers_.resize(graph_->numRouters(), nullptr);
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Address routerAddress;
+    translateRouterIdToAddress(routerId, &routerAddress);
+    std::string routerName = "Router_" + routerAddress.toString('-');
+    routers_.at(routerId) = Router::create(
+        routerName, this, this, routerId, routerAddress, routerRadix, numVcs_,
+        _metadataHandler, _settings["router"]);
+  }
+
+  // link the routers following the graph, each neighbor index is a port
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Router* sourceRouter = routers_.at(routerId);
+    for (u32 index = 0; index < graph_->degree(); index++) {
+      u32 destinationId = graph_->neighbor(routerId, index);
+      Router* destinationRouter = routers_.at(destinationId);
+      u32 destinationIndex = graph_->neighborIndex(destinationId, routerId);
+      assert(destinationIndex != U32_MAX);
+
+      std::string channelName =
+          "Channel_" + sourceRouter->address().toString('-') + "-to-" +
+          destinationRouter->address().toString('-');
+      Channel* channel = createRouterChannel(channelName, sourceRouter,
+                                             destinationRouter,
+                                             _settings["internal_channel"]);
+      internalChannels_.push_back(channel);
+
+      sourceRouter->setOutputChannel(concentration_ + index, channel);
+      destinationRouter->setInputChannel(concentration_ + destinationIndex,
+                                         channel);
+    }
+  }
+
+  // create the interfaces and link them with the routers
+  u32 interfacesPerRouter = concentration_ / interfacePorts_;
+  interfaces_.resize(routers_.size() * interfacesPerRouter, nullptr);
+  for (u32 interfaceId = 0; interfaceId < interfaces_.size(); interfaceId++) {
+    Address interfaceAddress;
+    translateInterfaceIdToAddress(interfaceId, &interfaceAddress);
+    u32 iface = interfaceAddress.at(0);
+    Router* router = routers_.at(interfaceId / interfacesPerRouter);
+
+    std::string interfaceName = "Interface_" + interfaceAddress.toString('-');
+    Interface* interface = Interface::create(
+        interfaceName, this, this, interfaceId, interfaceAddress,
+        interfacePorts_, numVcs_, _metadataHandler, _settings["interface"]);
+    interfaces_.at(interfaceId) = interface;
+
+    // create and link channels
+    for (u32 ch = 0; ch < interfacePorts_; ch++) {
+      std::string inChannelName =
+          "Channel_" + interfaceAddress.toString('-') + "-to-" +
+          router->address().toString('-') + "_" + std::to_string(ch);
+      std::string outChannelName =
+          "Channel_" + router->address().toString('-') + "-to-" +
+          interfaceAddress.toString('-') + "_" + std::to_string(ch);
+      Channel* inChannel = new Channel(inChannelName, this, numVcs_,
+                                       _settings["external_channel"]);
+      Channel* outChannel = new Channel(outChannelName, this, numVcs_,
+                                        _settings["external_channel"]);
+      externalChannels_.push_back(inChannel);
+      externalChannels_.push_back(outChannel);
+
+      u32 routerPort = (iface * interfacePorts_) + ch;
+      router->setInputChannel(routerPort, inChannel);
+      interface->setOutputChannel(ch, inChannel);
+      router->setOutputChannel(routerPort, outChannel);
+      interface->setInputChannel(ch, outChannel);
+    }
+  }
+
+  // sanity checks
+  assert(routers_.size() == numRouters());
+  assert(interfaces_.size() == numInterfaces());
+  dbgprintf("numRouters = %u", numRouters());
+  dbgprintf("numInterfaces = %u", numInterfaces());
+
+  // clear the protocol class info
+  clearProtocolClassInfo();
+}
+
+Network::~Network() {
+  for (Router* router : routers_) {
+    delete router;
+  }
+  for (Interface* interface : interfaces_) {
+    delete interface;
+  }
+  for (Channel* channel : internalChannels_) {
+    delete channel;
+  }
+  for (Channel* channel : externalChannels_) {
+    delete channel;
+  }
+  delete graph_;
+}
+
+::InjectionAlgorithm* Network::createInjectionAlgorithm(
+    u32 _inputPc, const std::string& _name, const Component* _parent,
+    Interface* _interface) {
+  // get the info
+  const ::Network::PcSettings& settings = pcSettings(_inputPc);
+
+  // call the injection algorithm factory
+  return InjectionAlgorithm::create(_name, _parent, _interface, settings.baseVc,
+                                    settings.numVcs, _inputPc,
+                                    settings.injection);
+}
+
+::RoutingAlgorithm* Network::createRoutingAlgorithm(u32 _inputPort,
+                                                    u32 _inputVc,
+                                                    const std::string& _name,
+                                                    const Component* _parent,
+                                                    Router* _router) {
+  // get the info
+  u32 pc = vcToPc(_inputVc);
+  const ::Network::PcSettings& settings = pcSettings(pc);
+
+  // call the routing algorithm factory
+  return RoutingAlgorithm::create(
+      _name, _parent, _router, settings.baseVc, settings.numVcs, _inputPort,
+      _inputVc, concentration_, interfacePorts_, graph_, settings.routing);
+}
+
+u32 Network::numRouters() const {
+  return graph_->numRouters();
+}
+
+u32 Network::numInterfaces() const {
+  return graph_->numRouters() * (concentration_ / interfacePorts_);
+}
+
+Router* Network::getRouter(u32 _id) const {
+  return routers_.at(_id);
+}
+
+Interface* Network::getInterface(u32 _id) const {
+  return interfaces_.at(_id);
+}
+
+void Network::translateInterfaceIdToAddress(u32 _id,
+                                            Address* _address) const {
+  SlimFly::translateInterfaceIdToAddress(q_, concentration_, interfacePorts_,
+                                         _id, _address);
+}
+
+u32 Network::translateInterfaceAddressToId(const Address* _address) const {
+  return SlimFly::translateInterfaceAddressToId(q_, concentration_,
+                                                interfacePorts_, _address);
+}
+
+void Network::translateRouterIdToAddress(u32 _id, Address* _address) const {
+  SlimFly::translateRouterIdToAddress(q_, _id, _address);
+}
+
+u32 Network::translateRouterAddressToId(const Address* _address) const {
+  return SlimFly::translateRouterAddressToId(q_, _address);
+}
+
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
+  u32 sourceRouter = computeRouterId(q_, _source);
+  u32 destinationRouter = computeRouterId(q_, _destination);
+  return graph_->distance(sourceRouter, destinationRouter) + 1;
+}
+
+void Network::collectChannels(std::vector<Channel*>* _channels) {
+  _channels->insert(_channels->end(), externalChannels_.begin(),
+                    externalChannels_.end());
+  _channels->insert(_channels->end(), internalChannels_.begin(),
+                    internalChannels_.end());
+}
+
+}  // namespace SlimFly
+
+registerWithObjectFactory("slim_fly", ::Network, SlimFly::Network,
+                          NETWORK_ARGS);
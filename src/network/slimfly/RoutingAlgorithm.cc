@@ -0,0 +1,177 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/RoutingAlgorithm.h"
+
+#include <cassert>
+#include <tuple>
+#include <unordered_set>
+
+#include "factory/ObjectFactory.h"
+#include "routing/util.h"
+#include "types/Address.h"
+
+namespace SlimFly {
+
+RoutingAlgorithm::RoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
+    u32 _concentration, u32 _interfacePorts, const MmsGraph* _graph,
+    nlohmann::json _settings)
+    : ::RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                         _inputVc, _settings),
+      concentration_(_concentration),
+      interfacePorts_(_interfacePorts),
+      graph_(_graph),
+      rcs_(2),
+      mode_(parseRoutingMode(_settings["mode"].get<std::string>())) {
+  // create the reduction
+  reduction_ = Reduction::create("Reduction", this, _router, mode_, true,
+                                 _settings["reduction"]);
+}
+
+RoutingAlgorithm::~RoutingAlgorithm() {
+  delete reduction_;
+}
+
+RoutingAlgorithm* RoutingAlgorithm::create(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
+    u32 _concentration, u32 _interfacePorts, const MmsGraph* _graph,
+    nlohmann::json _settings) {
+  // retrieve the algorithm
+  const std::string& algorithm = _settings["algorithm"].get<std::string>();
+
+  // attempt to create the routing algorithm
+  RoutingAlgorithm* ra = factory::ObjectFactory<
+      RoutingAlgorithm, SLIMFLY_ROUTINGALGORITHM_ARGS>::
+      create(algorithm, _name, _parent, _router, _baseVc, _numVcs, _inputPort,
+             _inputVc, _concentration, _interfacePorts, _graph, _settings);
+
+  // check that the factory had this type
+  if (ra == nullptr) {
+    fprintf(stderr, "invalid Slim Fly routing algorithm: %s\n",
+            algorithm.c_str());
+    assert(false);
+  }
+  return ra;
+}
+
+u32 RoutingAlgorithm::nextRoutingClass() const {
+  if (inputPort_ < concentration_) {
+    return 0;
+  }
+  u32 rc = vcToRc(baseVc_, numVcs_, inputVc_, rcs_) + 1;
+  assert(rc < rcs_);
+  return rc;
+}
+
+void RoutingAlgorithm::addPort(u32 _port, u32 _hops, u32 _routingClass) {
+  if (routingModeIsPort(mode_)) {
+    f64 cong = portCongestion(mode_, router_, inputPort_, inputVc_, _port);
+    reduction_->add(_port, _routingClass, _hops, cong);
+  } else if (_routingClass == U32_MAX) {
+    // add all VCs in the port
+    for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+      f64 cong = router_->congestionStatus(inputPort_, inputVc_, _port, vc);
+      reduction_->add(_port, vc, _hops, cong);
+    }
+  } else {
+    // add all VCs in the specified routing class
+    for (u32 vc = baseVc_ + _routingClass; vc < baseVc_ + numVcs_;
+         vc += rcs_) {
+      f64 cong = router_->congestionStatus(inputPort_, inputVc_, _port, vc);
+      reduction_->add(_port, vc, _hops, cong);
+    }
+  }
+}
+
+void RoutingAlgorithm::addExitPorts(u32 _terminal) {
+  u32 basePort = _terminal * interfacePorts_;
+  for (u32 offset = 0; offset < interfacePorts_; offset++) {
+    addPort(basePort + offset, 1, U32_MAX);
+  }
+}
+
+void RoutingAlgorithm::addMinimalPorts(u32 _target, u32 _hops,
+                                       u32 _routingClass) {
+  u32 thisRouter = router_->id();
+  u32 ports = graph_->numMinimalPorts(thisRouter, _target);
+  assert(ports > 0);
+  for (u32 idx = 0; idx < ports; idx++) {
+    addPort(concentration_ + graph_->minimalPort(thisRouter, _target, idx),
+            _hops, _routingClass);
+  }
+}
+
+void RoutingAlgorithm::routeViaIntermediate(Packet* _packet,
+                                            u32 _destinationRouter,
+                                            u32 _destinationTerminal) {
+  u32 thisRouter = router_->id();
+  const Address* intermediateAddress =
+      reinterpret_cast<const Address*>(_packet->getRoutingExtension());
+
+  // the intermediate phase ends at the intermediate router
+  if (intermediateAddress != nullptr &&
+      (intermediateAddress->at(0) == thisRouter ||
+       thisRouter == _destinationRouter)) {
+    delete intermediateAddress;
+    intermediateAddress = nullptr;
+    _packet->setRoutingExtension(nullptr);
+  }
+
+  if (thisRouter == _destinationRouter) {
+    addExitPorts(_destinationTerminal);
+  } else if (intermediateAddress == nullptr) {
+    addMinimalPorts(_destinationRouter,
+                    graph_->distance(thisRouter, _destinationRouter),
+                    nextRoutingClass());
+  } else {
+    u32 intermediateRouter = intermediateAddress->at(0);
+    u32 hops = graph_->distance(thisRouter, intermediateRouter) +
+               graph_->distance(intermediateRouter, _destinationRouter);
+    addMinimalPorts(intermediateRouter, hops, nextRoutingClass());
+  }
+}
+
+void RoutingAlgorithm::reduce(RoutingAlgorithm::Response* _response) {
+  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+      reduction_->reduce(nullptr);
+  for (const auto& t : *outputs) {
+    addResponse(std::get<0>(t), std::get<1>(t), _response);
+  }
+}
+
+void RoutingAlgorithm::addResponse(u32 _port, u32 _vcRc,
+                                   RoutingAlgorithm::Response* _response) {
+  if (routingModeIsPort(mode_)) {
+    // port mode
+    if (_vcRc != U32_MAX) {
+      // add all VCs in the specified routing class
+      for (u32 vc = baseVc_ + _vcRc; vc < baseVc_ + numVcs_; vc += rcs_) {
+        _response->add(_port, vc);
+      }
+    } else {
+      // exit - all VCs
+      for (u32 vc = baseVc_; vc < baseVc_ + numVcs_; vc++) {
+        _response->add(_port, vc);
+      }
+    }
+  } else {
+    // vc mode
+    _response->add(_port, _vcRc);
+  }
+}
+
+}  // namespace SlimFly
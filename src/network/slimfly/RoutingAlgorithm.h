@@ -0,0 +1,84 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_SLIMFLY_ROUTINGALGORITHM_H_
+#define NETWORK_SLIMFLY_ROUTINGALGORITHM_H_
+
+#include <string>
+
+#include "event/Component.h"
+#include "network/slimfly/MmsGraph.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+#include "routing/Reduction.h"
+#include "routing/RoutingAlgorithm.h"
+#include "routing/mode.h"
+#include "types/Packet.h"
+
+#define SLIMFLY_ROUTINGALGORITHM_ARGS                                     \
+  const std::string&, const Component*, Router*, u32, u32, u32, u32, u32, \
+      u32, const SlimFly::MmsGraph*, nlohmann::json
+
+namespace SlimFly {
+
+/*
+ * Slim Fly routing algorithms use the minimal path tables of the MMS graph.
+ *  Deadlock is avoided with hop-indexed routing classes: the n-th router to
+ *  router hop of a packet uses routing class n. Minimal paths take at most 2
+ *  hops and non-minimal paths through an intermediate router at most 4.
+ */
+class RoutingAlgorithm : public ::RoutingAlgorithm {
+ public:
+  RoutingAlgorithm(const std::string& _name, const Component* _parent,
+                   Router* _router, u32 _baseVc, u32 _numVcs, u32 _inputPort,
+                   u32 _inputVc, u32 _concentration, u32 _interfacePorts,
+                   const MmsGraph* _graph, nlohmann::json _settings);
+  virtual ~RoutingAlgorithm();
+
+  // this is a routing algorithm factory for the Slim Fly topology
+  static RoutingAlgorithm* create(SLIMFLY_ROUTINGALGORITHM_ARGS);
+
+ protected:
+  // this returns the routing class of the next hop
+  u32 nextRoutingClass() const;
+
+  // these add candidate output ports to the reduction
+  void addPort(u32 _port, u32 _hops, u32 _routingClass);
+  void addExitPorts(u32 _terminal);
+  void addMinimalPorts(u32 _target, u32 _hops, u32 _routingClass);
+
+  // this routes a packet toward the intermediate router held in its routing
+  //  extension, if any, then to its destination
+  void routeViaIntermediate(Packet* _packet, u32 _destinationRouter,
+                            u32 _destinationTerminal);
+
+  // this reduces the added ports into the response
+  void reduce(RoutingAlgorithm::Response* _response);
+  // this adds one reduction output to the response
+  void addResponse(u32 _port, u32 _vcRc,
+                   RoutingAlgorithm::Response* _response);
+
+  const u32 concentration_;
+  const u32 interfacePorts_;
+  const MmsGraph* graph_;
+
+  u32 rcs_;  // set by each algorithm
+  const RoutingMode mode_;
+  Reduction* reduction_;
+};
+
+}  // namespace SlimFly
+
+#endif  // NETWORK_SLIMFLY_ROUTINGALGORITHM_H_
@@ -0,0 +1,129 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/UgalRoutingAlgorithm.h"
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include <unordered_set>
+
+#include "factory/ObjectFactory.h"
+#include "network/slimfly/util.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace SlimFly {
+
+UgalRoutingAlgorithm::UgalRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
+    u32 _concentration, u32 _interfacePorts, const MmsGraph* _graph,
+    nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _concentration, _interfacePorts, _graph,
+                       _settings),
+      intermediates_(_settings["intermediates"].get<u32>()),
+      portIntermediate_(_graph->degree()),
+      portMinimal_(_graph->degree()) {
+  // up to 2 hops to the intermediate and 2 hops to the destination
+  rcs_ = 4;
+  assert(_numVcs >= rcs_);
+  assert(intermediates_ > 0);
+}
+
+UgalRoutingAlgorithm::~UgalRoutingAlgorithm() {}
+
+void UgalRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  Packet* packet = _flit->packet();
+  const Address* destinationAddress =
+      packet->message()->getDestinationAddress();
+  u32 destinationRouter = computeRouterId(graph_->q(), destinationAddress);
+
+  u32 thisRouter = router_->id();
+  if (inputPort_ >= concentration_ || thisRouter == destinationRouter) {
+    // the decision has been made at the source router
+    routeViaIntermediate(packet, destinationRouter, destinationAddress->at(0));
+    reduce(_response);
+    return;
+  }
+  assert(packet->getRoutingExtension() == nullptr);
+
+  // minimal candidates
+  std::fill(portIntermediate_.begin(), portIntermediate_.end(), U32_MAX);
+  std::fill(portMinimal_.begin(), portMinimal_.end(), false);
+  u32 minimalHops = graph_->distance(thisRouter, destinationRouter);
+  for (u32 idx = 0;
+       idx < graph_->numMinimalPorts(thisRouter, destinationRouter); idx++) {
+    u32 offset = graph_->minimalPort(thisRouter, destinationRouter, idx);
+    portMinimal_[offset] = true;
+    addPort(concentration_ + offset, minimalHops, 0);
+  }
+
+  // non-minimal candidates, duplicate ports keep their first meaning
+  for (u32 cand = 0; cand < intermediates_; cand++) {
+    u32 intermediateRouter = gSim->rnd.nextU64(0, graph_->numRouters() - 1);
+    if (intermediateRouter == thisRouter ||
+        intermediateRouter == destinationRouter) {
+      continue;
+    }
+    u32 hops = graph_->distance(thisRouter, intermediateRouter) +
+               graph_->distance(intermediateRouter, destinationRouter);
+    for (u32 idx = 0;
+         idx < graph_->numMinimalPorts(thisRouter, intermediateRouter);
+         idx++) {
+      u32 offset = graph_->minimalPort(thisRouter, intermediateRouter, idx);
+      if (!portMinimal_[offset] && portIntermediate_[offset] == U32_MAX) {
+        portIntermediate_[offset] = intermediateRouter;
+        addPort(concentration_ + offset, hops, 0);
+      }
+    }
+  }
+
+  bool allMinimal;
+  const std::unordered_set<std::tuple<u32, u32>>* outputs =
+      reduction_->reduce(&allMinimal);
+
+  // a non-minimal decision is restricted to the ports of one intermediate
+  //  router so that the routing extension matches every output
+  u32 intermediateRouter = U32_MAX;
+  if (!allMinimal) {
+    for (const auto& t : *outputs) {
+      u32 offset = std::get<0>(t) - concentration_;
+      if (!portMinimal_[offset]) {
+        intermediateRouter = portIntermediate_[offset];
+        break;
+      }
+    }
+    assert(intermediateRouter != U32_MAX);
+    Address* re = new Address(1);
+    re->at(0) = intermediateRouter;
+    packet->setRoutingExtension(re);
+  }
+  for (const auto& t : *outputs) {
+    u32 offset = std::get<0>(t) - concentration_;
+    if (intermediateRouter == U32_MAX ||
+        portIntermediate_[offset] == intermediateRouter) {
+      addResponse(std::get<0>(t), std::get<1>(t), _response);
+    }
+  }
+}
+
+}  // namespace SlimFly
+
+registerWithObjectFactory("ugal", SlimFly::RoutingAlgorithm,
+                          SlimFly::UgalRoutingAlgorithm,
+                          SLIMFLY_ROUTINGALGORITHM_ARGS);
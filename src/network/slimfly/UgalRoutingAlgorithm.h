@@ -0,0 +1,54 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_SLIMFLY_UGALROUTINGALGORITHM_H_
+#define NETWORK_SLIMFLY_UGALROUTINGALGORITHM_H_
+
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "network/slimfly/MmsGraph.h"
+#include "network/slimfly/RoutingAlgorithm.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "router/Router.h"
+
+namespace SlimFly {
+
+// this chooses at the source router between the minimal path and the paths
+//  through "intermediates" random intermediate routers based on congestion
+//  and hop count
+class UgalRoutingAlgorithm : public RoutingAlgorithm {
+ public:
+  UgalRoutingAlgorithm(const std::string& _name, const Component* _parent,
+                       Router* _router, u32 _baseVc, u32 _numVcs,
+                       u32 _inputPort, u32 _inputVc, u32 _concentration,
+                       u32 _interfacePorts, const MmsGraph* _graph,
+                       nlohmann::json _settings);
+  ~UgalRoutingAlgorithm();
+
+ protected:
+  void processRequest(Flit* _flit,
+                      RoutingAlgorithm::Response* _response) override;
+
+ private:
+  const u32 intermediates_;
+  std::vector<u32> portIntermediate_;
+  std::vector<bool> portMinimal_;
+};
+
+}  // namespace SlimFly
+
+#endif  // NETWORK_SLIMFLY_UGALROUTINGALGORITHM_H_
@@ -0,0 +1,70 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/ValiantsRoutingAlgorithm.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+#include "network/slimfly/util.h"
+#include "types/Address.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace SlimFly {
+
+ValiantsRoutingAlgorithm::ValiantsRoutingAlgorithm(
+    const std::string& _name, const Component* _parent, Router* _router,
+    u32 _baseVc, u32 _numVcs, u32 _inputPort, u32 _inputVc,
+    u32 _concentration, u32 _interfacePorts, const MmsGraph* _graph,
+    nlohmann::json _settings)
+    : RoutingAlgorithm(_name, _parent, _router, _baseVc, _numVcs, _inputPort,
+                       _inputVc, _concentration, _interfacePorts, _graph,
+                       _settings) {
+  // up to 2 hops to the intermediate and 2 hops to the destination
+  rcs_ = 4;
+  assert(_numVcs >= rcs_);
+}
+
+ValiantsRoutingAlgorithm::~ValiantsRoutingAlgorithm() {}
+
+void ValiantsRoutingAlgorithm::processRequest(
+    Flit* _flit, RoutingAlgorithm::Response* _response) {
+  Packet* packet = _flit->packet();
+  const Address* destinationAddress =
+      packet->message()->getDestinationAddress();
+  u32 destinationRouter = computeRouterId(graph_->q(), destinationAddress);
+
+  // the source router chooses the intermediate router [router]
+  u32 thisRouter = router_->id();
+  if (inputPort_ < concentration_ && thisRouter != destinationRouter) {
+    assert(packet->getRoutingExtension() == nullptr);
+    u32 intermediateRouter = gSim->rnd.nextU64(0, graph_->numRouters() - 1);
+    if (intermediateRouter != thisRouter &&
+        intermediateRouter != destinationRouter) {
+      Address* re = new Address(1);
+      re->at(0) = intermediateRouter;
+      packet->setRoutingExtension(re);
+    }
+  }
+
+  routeViaIntermediate(packet, destinationRouter, destinationAddress->at(0));
+  reduce(_response);
+}
+
+}  // namespace SlimFly
+
+registerWithObjectFactory("valiants", SlimFly::RoutingAlgorithm,
+                          SlimFly::ValiantsRoutingAlgorithm,
+                          SLIMFLY_ROUTINGALGORITHM_ARGS);
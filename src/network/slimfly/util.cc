@@ -0,0 +1,70 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "network/slimfly/util.h"
+
+#include <cassert>
+
+namespace SlimFly {
+
+void translateInterfaceIdToAddress(u32 _q, u32 _concentration,
+                                   u32 _interfacePorts, u32 _id,
+                                   Address* _address) {
+  u32 interfacesPerRouter = _concentration / _interfacePorts;
+  _address->resize(4);
+  _address->at(0) = _id % interfacesPerRouter;
+  _id /= interfacesPerRouter;
+  _address->at(1) = _id % _q;
+  _id /= _q;
+  _address->at(2) = _id % _q;
+  _address->at(3) = _id / _q;
+  assert(_address->at(3) < 2);
+}
+
+u32 translateInterfaceAddressToId(u32 _q, u32 _concentration,
+                                  u32 _interfacePorts,
+                                  const Address* _address) {
+  u32 interfacesPerRouter = _concentration / _interfacePorts;
+  assert(_address->at(0) < interfacesPerRouter);
+  return (computeRouterId(_q, _address) * interfacesPerRouter) +
+         _address->at(0);
+}
+
+void translateRouterIdToAddress(u32 _q, u32 _id, Address* _address) {
+  _address->resize(3);
+  _address->at(0) = _id % _q;
+  _id /= _q;
+  _address->at(1) = _id % _q;
+  _address->at(2) = _id / _q;
+  assert(_address->at(2) < 2);
+}
+
+u32 translateRouterAddressToId(u32 _q, const Address* _address) {
+  assert(_address->size() == 3);
+  assert(_address->at(0) < _q);
+  assert(_address->at(1) < _q);
+  assert(_address->at(2) < 2);
+  return (((_address->at(2) * _q) + _address->at(1)) * _q) + _address->at(0);
+}
+
+u32 computeRouterId(u32 _q, const Address* _interfaceAddress) {
+  assert(_interfaceAddress->size() == 4);
+  assert(_interfaceAddress->at(1) < _q);
+  assert(_interfaceAddress->at(2) < _q);
+  assert(_interfaceAddress->at(3) < 2);
+  return (((_interfaceAddress->at(3) * _q) + _interfaceAddress->at(2)) * _q) +
+         _interfaceAddress->at(1);
+}
+
+}  // namespace SlimFly
@@ -0,0 +1,46 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NETWORK_SLIMFLY_UTIL_H_
+#define NETWORK_SLIMFLY_UTIL_H_
+
+#include "prim/prim.h"
+#include "types/Address.h"
+
+/*
+ * Slim Fly router (s, x, y) has router ID s*q^2 + x*q + y and address
+ *  [y, x, s]. Interface addresses are [interface, y, x, s].
+ *
+ * Router ports: [0, concentration) terminals,
+ *               [concentration, concentration + degree) to each neighbor in
+ *               the order given by the MMS graph
+ */
+namespace SlimFly {
+
+void translateInterfaceIdToAddress(u32 _q, u32 _concentration,
+                                   u32 _interfacePorts, u32 _id,
+                                   Address* _address);
+u32 translateInterfaceAddressToId(u32 _q, u32 _concentration,
+                                  u32 _interfacePorts,
+                                  const Address* _address);
+
+void translateRouterIdToAddress(u32 _q, u32 _id, Address* _address);
+u32 translateRouterAddressToId(u32 _q, const Address* _address);
+
+// this returns the ID of the router an interface address is attached to
+u32 computeRouterId(u32 _q, const Address* _interfaceAddress);
+
+}  // namespace SlimFly
+
+#endif  // NETWORK_SLIMFLY_UTIL_H_
@@ -25,7 +25,6 @@
 #include "network/torus/RoutingAlgorithm.h"
 #include "network/torus/util.h"
 #include "strop/strop.h"
-#include "util/DimensionIterator.h"
 
 namespace Torus {
 
@@ -70,87 +69,91 @@ Network::Network(const std::string& _name, const Component* _parent,
   // parse the protocol classes description
   loadProtocolClassInfo(_settings["protocol_classes"]);
 
-  // setup a router iterator for looping over the router dimensions
-  DimensionIterator routerIterator(dimensionWidths_);
-  std::vector<u32> routerAddress(dimensionWidths_.size());
-
-  // create the routers
-  routerIterator.reset();
+  // create the routers, a router's ID is the flat (little endian) index of its
+  //  address so routers_ is indexed directly by ID
   routers_.setSize(dimensionWidths_);
-  while (routerIterator.next(&routerAddress)) {
-    std::string routerName =
-        "Router_" + strop::vecString<u32>(routerAddress, '-');
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Address routerAddress;
+    routers_.address(routerId, &routerAddress);
+    std::string routerName = "Router_" + routerAddress.toString('-');
 
     // use the router factory to create a router
-    u32 routerId = translateRouterAddressToId(&routerAddress);
-    routers_.at(routerAddress) = Router::create(
+    routers_.at(routerId) = Router::create(
         routerName, this, this, routerId, routerAddress, routerRadix, numVcs_,
         _metadataHandler, _settings["router"]);
   }
 
-  // link routers via channels
-  routerIterator.reset();
-  while (routerIterator.next(&routerAddress)) {
+  // link routers via channels, neighbors are found by their flat index stride
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
+    Router* sourceRouter = routers_.at(routerId);
+    const Address& routerAddress = sourceRouter->address();
     u32 portBase = concentration_;
     u32 sourcePort, destinationPort;
     // determine the source router
-    std::vector<u32> sourceAddress(routerAddress);
+    const Address& sourceAddress = routerAddress;
     for (u32 dim = 0; dim < dimensions_; dim++) {
       u32 dimWidth = dimensionWidths_.at(dim);
       u32 dimWeight = dimensionWeights_.at(dim);
-      std::vector<u32> destinationAddress(sourceAddress);
+      u32 dimStride = routers_.stride(dim);
+      u32 dimBase = routerId - (sourceAddress.at(dim) * dimStride);
+      Address destinationAddress(sourceAddress);
 
       // there are 'dimWeight' ports going right (to router with larger
       // index in this dimension), and 'dimWeight' ports going left.
 
       std::string channelName;
       Channel* channel;
+      u32 destinationId;
 
       // connect to the destination router going right
       destinationAddress.at(dim) = (sourceAddress.at(dim) + 1) % dimWidth;
+      destinationId = dimBase + (destinationAddress.at(dim) * dimStride);
       for (u32 wInd = 0; wInd < dimWeight; wInd++) {
         sourcePort = portBase + wInd;
         destinationPort = portBase + dimWeight + wInd;
 
         // create the channels
-        channelName = "RChannel_" + strop::vecString<u32>(routerAddress, '-') +
-                      "-to-" + strop::vecString<u32>(destinationAddress, '-') +
+        channelName = "RChannel_" + routerAddress.toString('-') +
+                      "-to-" + destinationAddress.toString('-') +
                       "-" + std::to_string(wInd);
-        channel = new Channel(channelName, this, numVcs_,
-                              _settings["internal_channel"]);
+        channel = createRouterChannel(channelName, sourceRouter,
+                                      routers_.at(destinationId),
+                                      _settings["internal_channel"]);
         internalChannels_.push_back(channel);
 
         // link the routers from source to destination
         dbgprintf("linking %s:%u to %s:%u with %s",
-                  strop::vecString<u32>(sourceAddress, '-').c_str(), sourcePort,
-                  strop::vecString<u32>(destinationAddress, '-').c_str(),
+                  sourceAddress.toString('-').c_str(), sourcePort,
+                  destinationAddress.toString('-').c_str(),
                   destinationPort, channelName.c_str());
 
-        routers_.at(sourceAddress)->setOutputChannel(sourcePort, channel);
-        routers_.at(destinationAddress)
+        sourceRouter->setOutputChannel(sourcePort, channel);
+        routers_.at(destinationId)
             ->setInputChannel(destinationPort, channel);
       }
 
       // connect to the destination router going left
       destinationAddress.at(dim) =
           (sourceAddress.at(dim) + dimWidth - 1) % dimWidth;
+      destinationId = dimBase + (destinationAddress.at(dim) * dimStride);
       for (u32 wInd = 0; wInd < dimWeight; wInd++) {
         sourcePort = portBase + dimWeight + wInd;
         destinationPort = portBase + wInd;
-        channelName = "LChannel_" + strop::vecString<u32>(routerAddress, '-') +
-                      "-to-" + strop::vecString<u32>(destinationAddress, '-') +
+        channelName = "LChannel_" + routerAddress.toString('-') +
+                      "-to-" + destinationAddress.toString('-') +
                       "-" + std::to_string(wInd);
-        channel = new Channel(channelName, this, numVcs_,
-                              _settings["internal_channel"]);
+        channel = createRouterChannel(channelName, sourceRouter,
+                                      routers_.at(destinationId),
+                                      _settings["internal_channel"]);
         internalChannels_.push_back(channel);
 
         // link the routers from source to destination
         dbgprintf("linking %s:%u to %s:%u with %s",
-                  strop::vecString<u32>(sourceAddress, '-').c_str(), sourcePort,
-                  strop::vecString<u32>(destinationAddress, '-').c_str(),
+                  sourceAddress.toString('-').c_str(), sourcePort,
+                  destinationAddress.toString('-').c_str(),
                   destinationPort, channelName.c_str());
-        routers_.at(sourceAddress)->setOutputChannel(sourcePort, channel);
-        routers_.at(destinationAddress)
+        sourceRouter->setOutputChannel(sourcePort, channel);
+        routers_.at(destinationId)
             ->setInputChannel(destinationPort, channel);
       }
       portBase += 2 * dimWeight;
@@ -166,40 +169,39 @@ Network::Network(const std::string& _name, const Component* _parent,
 
   // create interfaces and link them with the routers
   interfaces_.setSize(fullDimensionWidths);
-  routerIterator.reset();
-  while (routerIterator.next(&routerAddress)) {
+  for (u32 routerId = 0; routerId < routers_.size(); routerId++) {
     // get the router now, for later linking with terminals
-    Router* router = routers_.at(routerAddress);
+    Router* router = routers_.at(routerId);
+    const Address& routerAddress = router->address();
 
     // loop over interfaces
     for (u32 iface = 0; iface < interfacesPerRouter; iface++) {
-      // create a vector for the Interface address
-      std::vector<u32> interfaceAddress(1);
-      interfaceAddress.at(0) = iface;
-      interfaceAddress.insert(interfaceAddress.begin() + 1,
-                              routerAddress.begin(), routerAddress.end());
+      // create the Interface address
+      Address interfaceAddress(1, iface);
+      for (u32 dim = 0; dim < routerAddress.size(); dim++) {
+        interfaceAddress.push_back(routerAddress.at(dim));
+      }
 
       // create an interface name
-      std::string interfaceName =
-          "Interface_" + strop::vecString<u32>(interfaceAddress, '-');
+      std::string interfaceName = "Interface_" + interfaceAddress.toString('-');
 
       // create the interface
-      u32 interfaceId = translateInterfaceAddressToId(&interfaceAddress);
+      u32 interfaceId = (routerId * interfacesPerRouter) + iface;
       Interface* interface = Interface::create(
           interfaceName, this, this, interfaceId, interfaceAddress,
           interfacePorts_, numVcs_, _metadataHandler, _settings["interface"]);
-      interfaces_.at(interfaceAddress) = interface;
+      interfaces_.at(interfaceId) = interface;
 
       // create and link channels
       for (u32 ch = 0; ch < interfacePorts_; ch++) {
         // create I/O channels
         std::string inChannelName =
-            "Channel_" + strop::vecString<u32>(interfaceAddress, '-') + "-to-" +
-            strop::vecString<u32>(routerAddress, '-') + "_" +
+            "Channel_" + interfaceAddress.toString('-') + "-to-" +
+            routerAddress.toString('-') + "_" +
             std::to_string(ch);
         std::string outChannelName =
-            "Channel_" + strop::vecString<u32>(routerAddress, '-') + "-to-" +
-            strop::vecString<u32>(interfaceAddress, '-') + "_" +
+            "Channel_" + routerAddress.toString('-') + "-to-" +
+            interfaceAddress.toString('-') + "_" +
             std::to_string(ch);
         Channel* inChannel = new Channel(inChannelName, this, numVcs_,
                                          _settings["external_channel"]);
@@ -289,29 +291,29 @@ Interface* Network::getInterface(u32 _id) const {
 }
 
 void Network::translateInterfaceIdToAddress(u32 _id,
-                                            std::vector<u32>* _address) const {
+                                            Address* _address) const {
   Cube::translateInterfaceIdToAddress(_id, dimensionWidths_, concentration_,
                                       interfacePorts_, _address);
 }
 
 u32 Network::translateInterfaceAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Cube::translateInterfaceAddressToId(_address, dimensionWidths_,
                                              concentration_, interfacePorts_);
 }
 
 void Network::translateRouterIdToAddress(u32 _id,
-                                         std::vector<u32>* _address) const {
+                                         Address* _address) const {
   Cube::translateRouterIdToAddress(_id, dimensionWidths_, _address);
 }
 
 u32 Network::translateRouterAddressToId(
-    const std::vector<u32>* _address) const {
+    const Address* _address) const {
   return Cube::translateRouterAddressToId(_address, dimensionWidths_);
 }
 
-u32 Network::computeMinimalHops(const std::vector<u32>* _source,
-                                const std::vector<u32>* _destination) const {
+u32 Network::computeMinimalHops(const Address* _source,
+                                const Address* _destination) const {
   return Torus::computeMinimalHops(_source, _destination, dimensions_,
                                    dimensionWidths_);
 }
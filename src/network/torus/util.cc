@@ -38,8 +38,8 @@ u32 computeInputPortDim(const std::vector<u32>& _dimensionWidths,
   assert(false);
 }
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination, u32 _dimensions,
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination, u32 _dimensions,
                        const std::vector<u32>& _dimensionWidths) {
   u32 minHops = 1;
   for (u32 dim = 0; dim < _dimensions; dim++) {
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 namespace Torus {
 
@@ -27,8 +28,8 @@ u32 computeInputPortDim(const std::vector<u32>& _dimensionWidths,
                         const std::vector<u32>& _dimensionWeights,
                         u32 _concentration, u32 _inputPort);
 
-u32 computeMinimalHops(const std::vector<u32>* _source,
-                       const std::vector<u32>* _destination, u32 _dimensions,
+u32 computeMinimalHops(const Address* _source,
+                       const Address* _destination, u32 _dimensions,
                        const std::vector<u32>& _dimensionWidths);
 }  // namespace Torus
 
@@ -18,10 +18,11 @@
 
 #include "gtest/gtest.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 
 TEST(Torus, computeMinimalHops) {
-  std::vector<u32> src;
-  std::vector<u32> dst;
+  Address src;
+  Address dst;
   std::vector<u32> widths;
   u32 exp;
   u32 dimensions;
@@ -0,0 +1,44 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "router/FrequencySchedule.h"
+
+#include <cassert>
+
+#include "router/Router.h"
+
+FrequencySchedule::FrequencySchedule(const std::string& _name,
+                                     const Component* _parent, Router* _router,
+                                     nlohmann::json _settings)
+    : Component(_name, _parent), router_(_router) {
+  assert(_settings.is_array());
+  u64 lastTime = 0;
+  for (const nlohmann::json& step : _settings) {
+    assert(!step["time"].is_null());
+    assert(!step["cycle_time"].is_null());
+    u64 time = step["time"].get<u64>();
+    u64 cycleTime = step["cycle_time"].get<u64>();
+    assert(time >= lastTime);
+    lastTime = time;
+    addEvent(time, 0, reinterpret_cast<void*>(cycleTime), 0);
+  }
+}
+
+FrequencySchedule::~FrequencySchedule() {}
+
+void FrequencySchedule::processEvent(void* _event, s32 _type) {
+  u64 cycleTime = reinterpret_cast<u64>(_event);
+  dbgprintf("cycle time %lu", cycleTime);
+  router_->setCycleTime(cycleTime);
+}
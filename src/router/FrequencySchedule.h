@@ -0,0 +1,43 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ROUTER_FREQUENCYSCHEDULE_H_
+#define ROUTER_FREQUENCYSCHEDULE_H_
+
+#include <string>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+class Router;
+
+/*
+ * This changes a router's cycle time at the times given in its settings
+ *  (DVFS). The settings are an array of steps in time order, for example:
+ *   [{"time": 10000, "cycle_time": 4}, {"time": 20000, "cycle_time": 2}]
+ */
+class FrequencySchedule : public Component {
+ public:
+  FrequencySchedule(const std::string& _name, const Component* _parent,
+                    Router* _router, nlohmann::json _settings);
+  ~FrequencySchedule();
+
+  void processEvent(void* _event, s32 _type) override;
+
+ private:
+  Router* router_;
+};
+
+#endif  // ROUTER_FREQUENCYSCHEDULE_H_
@@ -17,24 +17,74 @@
 #include <cassert>
 
 #include "factory/ObjectFactory.h"
+#include "network/Network.h"
+#include "router/FrequencySchedule.h"
 #include "strop/strop.h"
+#include "types/Message.h"
 #include "types/Packet.h"
 #include "workload/Workload.h"
 
 Router::Router(const std::string& _name, const Component* _parent,
-               Network* _network, u32 _id, const std::vector<u32>& _address,
+               Network* _network, u32 _id, const Address& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
                nlohmann::json _settings)
     : Component(_name, _parent),
       PortedDevice(_id, _address, _numPorts, _numVcs),
       network_(_network),
-      metadataHandler_(_metadataHandler) {}
+      metadataHandler_(_metadataHandler) {
+  // "cycle_time" gives every router its own clock, an entry of "clocks" that
+  //  lists this router's id overrides it and may add a frequency schedule
+  u64 cycleTime = 0;
+  if (_settings.contains("cycle_time") && !_settings["cycle_time"].is_null()) {
+    cycleTime = _settings["cycle_time"].get<u64>();
+  }
+  nlohmann::json clockSettings;
+  if (_settings.contains("clocks")) {
+    for (const nlohmann::json& entry : _settings["clocks"]) {
+      assert(!entry["routers"].is_null());
+      for (const nlohmann::json& router : entry["routers"]) {
+        if (router.get<u32>() == _id) {
+          assert(clockSettings.is_null());
+          clockSettings = entry;
+        }
+      }
+    }
+  }
+  if (clockSettings.contains("cycle_time")) {
+    cycleTime = clockSettings["cycle_time"].get<u64>();
+  }
+  if (cycleTime == 0 && !clockSettings.is_null()) {
+    cycleTime = gSim->cycleTime(Simulator::Clock::ROUTER);
+  }
+
+  ownClock_ = nullptr;
+  if (cycleTime > 0) {
+    ownClock_ = new ClockDomain(cycleTime);
+    clock_ = ownClock_;
+  } else {
+    clock_ = gSim->clockDomain(Simulator::Clock::ROUTER);
+  }
+  nominalCycleTime_ = clock_->cycleTime();
 
-Router::~Router() {}
+  frequencySchedule_ = nullptr;
+  if (clockSettings.contains("schedule")) {
+    frequencySchedule_ = new FrequencySchedule(
+        "FrequencySchedule", this, this, clockSettings["schedule"]);
+  }
+}
+
+Router::~Router() {
+  if (ownClock_) {
+    delete ownClock_;
+  }
+  if (frequencySchedule_) {
+    delete frequencySchedule_;
+  }
+}
 
 Router* Router::create(const std::string& _name, const Component* _parent,
                        Network* _network, u32 _id,
-                       const std::vector<u32>& _address, u32 _numPorts,
+                       const Address& _address, u32 _numPorts,
                        u32 _numVcs, MetadataHandler* _metadataHandler,
                        nlohmann::json _settings) {
   // retrieve the architecture
@@ -58,6 +108,16 @@ Network* Router::network() const {
   return network_;
 }
 
+const ClockDomain* Router::clockDomain() const {
+  return clock_;
+}
+
+void Router::setCycleTime(u64 _cycleTime) {
+  assert(ownClock_ != nullptr);
+  assert(_cycleTime >= nominalCycleTime_);
+  ownClock_->setCycleTime(gSim->time(), _cycleTime);
+}
+
 void Router::packetArrival(u32 _port, Packet* _packet) const {
   metadataHandler_->packetRouterArrival(this, _port, _packet);
 }
@@ -66,3 +126,89 @@ void Router::packetDeparture(u32 _port, Packet* _packet) const {
   _packet->incrementHopCount();
   metadataHandler_->packetRouterDeparture(this, _port, _packet);
 }
+
+const std::vector<u32>& Router::multicastPorts(Packet* _packet) {
+  const MulticastTrees::Tree* tree;
+  if (_packet->getRoutingExtension() == nullptr) {
+    u32 group = _packet->message()->getMulticastGroup();
+    assert(group != U32_MAX);
+    auto it = multicastTrees_.find(group);
+    if (it == multicastTrees_.end()) {
+      tree = network_->multicastTrees()->tree(group, id_);
+      checkTreeVcs(_packet, tree->depth());
+      multicastTrees_[group] = tree;
+    } else {
+      tree = it->second;
+    }
+    _packet->setRoutingExtension(
+        const_cast<void*>(reinterpret_cast<const void*>(tree)));
+  } else {
+    tree = reinterpret_cast<const MulticastTrees::Tree*>(
+        _packet->getRoutingExtension());
+    assert(tree != nullptr);
+  }
+  return tree->ports(id_);
+}
+
+bool Router::reductionArrival(Packet* _packet, u32* _port) {
+  u32 group = _packet->message()->getMulticastGroup();
+  const MulticastTrees::Tree* tree;
+  auto it = reductionTrees_.find(group);
+  if (it == reductionTrees_.end()) {
+    tree = network_->multicastTrees()->reductionTree(group);
+    checkTreeVcs(_packet, 2 * tree->depth() - 1);  // up then back down
+    reductionTrees_[group] = tree;
+  } else {
+    tree = it->second;
+  }
+
+  // count the contribution, one is expected from each port of the tree
+  std::tuple<u64, u32> key(_packet->message()->getReductionId(),
+                           _packet->id());
+  u32& count = reductionCounts_[key];
+  count++;
+  u32 expected = tree->ports(id_).size();
+  assert(count <= expected);
+  if (count < expected) {
+    return false;
+  }
+  reductionCounts_.erase(key);
+
+  // forward the result
+  *_port = tree->upPort(id_);
+  if (*_port == U32_MAX) {
+    _packet->setRoutingExtension(
+        const_cast<void*>(reinterpret_cast<const void*>(tree)));
+  }
+  return true;
+}
+
+void Router::checkTreeVcs(const Packet* _packet, u32 _routers) const {
+  u32 pc = _packet->message()->getProtocolClass();
+  u32 numVcs = network_->pcVcs(pc).numVcs;
+  if (_routers > numVcs) {
+    fprintf(stderr, "a tree path of %u routers exceeds the %u VCs of protocol "
+            "class %u\n", _routers, numVcs, pc);
+    assert(false);
+  }
+}
+
+bool Router::addSwaStats(SwaStats* _stats) const {
+  return false;
+}
+
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort) const {
+  f64 sum = 0;
+  for (u32 vc = 0; vc < numVcs_; vc++) {
+    sum += congestionStatus(_inputPort, _inputVc, _outputPort, vc);
+  }
+  return sum / numVcs_;
+}
+
+bool Router::portCongestionResolution() const {
+  return false;
+}
+
+void Router::waitingFor(u32 _inputPort, u32 _inputVc,
+                        std::vector<std::tuple<u32, u32>>* _outputs) const {}
@@ -17,23 +17,29 @@
 
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "architecture/PortedDevice.h"
+#include "colhash/tuplehash.h"
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "metadata/MetadataHandler.h"
+#include "network/MulticastTrees.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "types/CreditReceiver.h"
 #include "types/CreditSender.h"
 #include "types/FlitReceiver.h"
 #include "types/FlitSender.h"
 
+class FrequencySchedule;
 class Network;
 
 #define ROUTER_ARGS                                    \
   const std::string&, const Component*, Network*, u32, \
-      const std::vector<u32>&, u32, u32, MetadataHandler*, nlohmann::json
+      const Address&, u32, u32, MetadataHandler*, nlohmann::json
 
 class Router : public Component,
                public PortedDevice,
@@ -43,7 +49,7 @@ class Router : public Component,
                public CreditReceiver {
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
-         u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
+         u32 _id, const Address& _address, u32 _numPorts, u32 _numVcs,
          MetadataHandler* _metadataHandler, nlohmann::json _settings);
   virtual ~Router();
 
@@ -53,6 +59,17 @@ class Router : public Component,
   // return the network of this router
   Network* network() const;
 
+  // this is the clock domain of the router's pipeline. It is the simulator's
+  //  router clock unless "cycle_time" or an entry of "clocks" gives this
+  //  router its own clock.
+  const ClockDomain* clockDomain() const;
+
+  // this changes the router's frequency while simulating (DVFS), it is
+  //  called by the "schedule" of the router's entry in "clocks". The router
+  //  must have its own clock and can't run faster than its configured
+  //  frequency since buffers and credits are sized for it.
+  void setCycleTime(u64 _cycleTime);
+
   // this must be called by all subclasses when a packet's head flit arrives
   //  on an input port.
   void packetArrival(u32 _port, Packet* _packet) const;
@@ -61,14 +78,67 @@ class Router : public Component,
   //  on an output port.
   void packetDeparture(u32 _port, Packet* _packet) const;
 
+  // this returns the output ports a multicast packet is replicated to. The
+  //  root router finds the group's tree (cached per group) and attaches it to
+  //  the packet as its routing extension, downstream routers read it from
+  //  there. Only input-queued routers replicate packets.
+  const std::vector<u32>& multicastPorts(Packet* _packet);
+
+  // this counts a reduction packet arriving at this router on its way up the
+  //  group's reduction tree. It returns false if the packet is combined into
+  //  the partial result and consumed. The last contribution is forwarded to
+  //  '_port', or at the root (U32_MAX) it is multicast down the tree.
+  bool reductionArrival(Packet* _packet, u32* _port);
+
   virtual f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                u32 _outputVc) const = 0;
 
+  // this returns the congestion status of an output port as a whole. By
+  //  default it averages congestionStatus() over the port's VCs. When
+  //  portCongestionResolution() is true every VC of a port reports this same
+  //  value, so the per-VC minimum and maximum equal it too.
+  virtual f64 portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                   u32 _outputPort) const;
+  virtual bool portCongestionResolution() const;
+
+  // switch allocation counts, speculative requests are made by head flits
+  //  during VC allocation and are only used when the VC was also granted
+  struct SwaStats {
+    u64 requests;
+    u64 grants;
+    u64 specRequests;
+    u64 specGrants;
+    u64 specUsed;
+  };
+
+  // this adds the router's switch allocation counts to '_stats'. It returns
+  //  false if the router doesn't allocate speculatively, the default.
+  virtual bool addSwaStats(SwaStats* _stats) const;
+
+  // this is used to diagnose deadlocks. It adds the output (port, VC) pairs
+  //  that the packet at the front of an input VC waits for, or
+  //  (U32_MAX, U32_MAX) if its flits aren't routed yet. Nothing is added for
+  //  empty input VCs. By default routers report nothing.
+  virtual void waitingFor(u32 _inputPort, u32 _inputVc,
+                          std::vector<std::tuple<u32, u32>>* _outputs) const;
+
  protected:
   Network* network_;
+  const ClockDomain* clock_;
 
  private:
+  // packets on a tree use the VC of their hop count, so the protocol class
+  //  needs a VC for each router on the longest path
+  void checkTreeVcs(const Packet* _packet, u32 _routers) const;
+
   MetadataHandler* metadataHandler_;
+  ClockDomain* ownClock_;
+  FrequencySchedule* frequencySchedule_;
+  u64 nominalCycleTime_;
+  std::unordered_map<u32, const MulticastTrees::Tree*> multicastTrees_;
+  std::unordered_map<u32, const MulticastTrees::Tree*> reductionTrees_;
+  // contributions received per reduction ID and packet ID
+  std::unordered_map<std::tuple<u64, u32>, u32> reductionCounts_;
 };
 
 #endif  // ROUTER_ROUTER_H_
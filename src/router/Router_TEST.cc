@@ -0,0 +1,146 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "router/Router.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "network/MulticastTrees.h"
+#include "network/Network_TESTLIB.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+
+namespace {
+
+// router 0 holds interfaces 0 and 1 on ports 0 and 1 and connects to router 1
+//  on port 2, router 1 holds interface 2 on port 0 and connects back on port 1
+void createNetwork(TestNetwork* _network, u32 _numVcs) {
+  _network->addRouter(new TestRouter(_network, 0, 3, _numVcs));
+  _network->addRouter(new TestRouter(_network, 1, 2, _numVcs));
+  for (u32 id = 0; id < 3; id++) {
+    _network->addInterface(new TestInterface(_network, id, 1, _numVcs));
+  }
+  Router* router0 = _network->getRouter(0);
+  Router* router1 = _network->getRouter(1);
+  _network->connect(router0, 0, _network->getInterface(0), 0);
+  _network->connect(router0, 1, _network->getInterface(1), 0);
+  _network->connect(router0, 2, router1, 1);
+  _network->connect(router1, 0, _network->getInterface(2), 0);
+  _network->connect(router1, 1, router0, 2);
+}
+
+Message* createReduction(u32 _group, u64 _reductionId) {
+  Message* message = new Message(1, nullptr);
+  Packet* packet = new Packet(0, 2, message);
+  message->setPacket(0, packet);
+  for (u32 f = 0; f < 2; f++) {
+    packet->setFlit(f, new Flit(f, f == 0, f == 1, packet));
+  }
+  message->setProtocolClass(0);
+  message->setMulticastGroup(_group);
+  message->setReductionId(_reductionId);
+  return message;
+}
+
+}  // namespace
+
+TEST(Router, reductionArrival) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  TestNetwork network(TestNetwork::makeJSON(3));
+  createNetwork(&network, 3);
+  u32 group = network.multicastTrees()->createGroup({0, 1, 2});
+  Router* root = network.getRouter(0);
+  Router* leaf = network.getRouter(1);
+  u32 port;
+
+  // interface 2 is the only contribution at router 1, it moves up right away
+  Message* leafMessage = createReduction(group, 5);
+  port = 100;
+  ASSERT_TRUE(leaf->reductionArrival(leafMessage->packet(0), &port));
+  ASSERT_EQ(port, 1u);
+  ASSERT_EQ(leafMessage->packet(0)->getRoutingExtension(), nullptr);
+
+  // router 0 combines interface 0, interface 1, and router 1
+  std::vector<Message*> messages;
+  for (u32 c = 0; c < 3; c++) {
+    messages.push_back(createReduction(group, 5));
+  }
+  port = 100;
+  ASSERT_FALSE(root->reductionArrival(messages.at(0)->packet(0), &port));
+  ASSERT_FALSE(root->reductionArrival(messages.at(1)->packet(0), &port));
+  ASSERT_EQ(port, 100u);
+
+  // another reduction of the same group is counted on its own
+  Message* other = createReduction(group, 6);
+  ASSERT_FALSE(root->reductionArrival(other->packet(0), &port));
+  ASSERT_EQ(port, 100u);
+
+  // the last contribution is the result, it goes back down the tree
+  Packet* result = messages.at(2)->packet(0);
+  ASSERT_TRUE(root->reductionArrival(result, &port));
+  ASSERT_EQ(port, U32_MAX);
+  const MulticastTrees::Tree* tree =
+      network.multicastTrees()->reductionTree(group);
+  ASSERT_EQ(result->getRoutingExtension(), tree);
+  ASSERT_EQ(tree->ports(0), std::vector<u32>({0, 1, 2}));
+  ASSERT_EQ(tree->ports(1), std::vector<u32>({0}));
+  result->setRoutingExtension(nullptr);  // the interfaces clear it
+
+  // the count restarts once a reduction has completed
+  for (u32 c = 0; c < 2; c++) {
+    ASSERT_FALSE(root->reductionArrival(messages.at(c)->packet(0), &port));
+  }
+  ASSERT_FALSE(root->reductionArrival(other->packet(0), &port));
+  ASSERT_TRUE(root->reductionArrival(result, &port));
+  result->setRoutingExtension(nullptr);
+
+  delete leafMessage;
+  delete other;
+  for (Message* message : messages) {
+    delete message;
+  }
+}
+
+TEST(Router, frequencySchedule) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  nlohmann::json settings;
+  settings["clocks"][0]["routers"] = {1};
+  settings["clocks"][0]["cycle_time"] = 2;
+  settings["clocks"][0]["schedule"][0]["time"] = 100;
+  settings["clocks"][0]["schedule"][0]["cycle_time"] = 4;
+  settings["clocks"][0]["schedule"][1]["time"] = 200;
+  settings["clocks"][0]["schedule"][1]["cycle_time"] = 3;
+  TestRouter router0(nullptr, 0, 1, 1, settings);
+  TestRouter router1(nullptr, 1, 1, 1, settings);
+
+  // only the listed router gets its own clock
+  ASSERT_EQ(router0.clockDomain(), gSim->clockDomain(Simulator::Clock::ROUTER));
+  ASSERT_NE(router1.clockDomain(), router0.clockDomain());
+  ASSERT_EQ(router1.clockDomain()->cycleTime(), 2u);
+
+  gSim->initialize();
+  gSim->simulate();
+
+  // 50 cycles of 2, 25 cycles of 4, then cycles of 3
+  const ClockDomain* clock = router1.clockDomain();
+  ASSERT_EQ(clock->cycleTime(), 3u);
+  ASSERT_EQ(clock->cycle(200), 75u);
+  ASSERT_EQ(clock->cycle(230), 85u);
+  ASSERT_EQ(router0.clockDomain()->cycleTime(), 1u);
+}
@@ -20,6 +20,7 @@
 #include "network/Network.h"
 #include "router/inputoutputqueued/Router.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define INJECTED_FLIT (0x33)
@@ -44,6 +45,7 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
       vcaSwaWait_(_vcaSwaWait),
       storeAndForward_(_storeAndForward),
       router_(_router),
+      clock_(_router->clockDomain()),
       routingAlgorithm_(_routingAlgorithm),
       vcScheduler_(_vcScheduler),
       vcSchedulerIndex_(_vcSchedulerIndex),
@@ -86,42 +88,66 @@ void InputQueue::setDepth(u32 _depth) {
   depth_ = _depth;
 }
 
+void InputQueue::waitingFor(
+    std::vector<std::tuple<u32, u32>>* _outputs) const {
+  bool holding = (rfe_.flit != nullptr) || (vca_.flit != nullptr) ||
+                 !buffer_.empty();
+  if (swa_.flit != nullptr) {
+    // waiting for the crossbar or credits
+    _outputs->push_back(
+        std::make_tuple(swa_.allocatedPort, swa_.flit->getVc()));
+  } else if (holding && vca_.allocatedPort != U32_MAX) {
+    // the rest of a packet that has its VC
+    _outputs->push_back(
+        std::make_tuple(vca_.allocatedPort, vca_.allocatedVc));
+  } else if (vca_.flit != nullptr) {
+    // a head flit waiting for a VC
+    for (u32 r = 0; r < vca_.route.size(); r++) {
+      u32 port, vc;
+      vca_.route.get(r, &port, &vc);
+      _outputs->push_back(std::make_tuple(port, vc));
+    }
+  } else if (holding) {
+    _outputs->push_back(std::make_tuple(U32_MAX, U32_MAX));
+  }
+}
+
 void InputQueue::receiveFlit(u32 _port, Flit* _flit) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   // 'port' is unused
-  assert(_port == 0);
+  CHECK_HOT(_port == 0);
 
   // make sure this is the right VC
-  assert(_flit->getVc() == vc_);
+  CHECK_HOT(_flit->getVc() == vc_);
 
   // we can only receive one flit per cycle
-  assert((lastReceivedTime_ == U64_MAX) || (lastReceivedTime_ < gSim->time()));
+  CHECK_HOT((lastReceivedTime_ == U64_MAX) ||
+            (lastReceivedTime_ < gSim->time()));
   lastReceivedTime_ = gSim->time();
 
   // push flit into corresponding buffer
   buffer_.push(_flit);
-  assert(buffer_.size() <= depth_);  // overflow check
+  CHECK_HOT(buffer_.size() <= depth_);  // overflow check
 
   // queue an event to be notified about the injected flit
   //  this synchronized the two clock domains
-  if (gSim->isCycle(Simulator::Clock::ROUTER)) {
+  if (clock_->isCycle()) {
     setPipelineEvent();
   } else {
-    addEvent(gSim->futureCycle(Simulator::Clock::ROUTER, 1), 1, nullptr,
-             INJECTED_FLIT);
+    addEvent(clock_->futureCycle(1), 1, nullptr, INJECTED_FLIT);
   }
 }
 
 void InputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (INJECTED_FLIT):
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       setPipelineEvent();
       break;
 
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
+      CHECK_HOT(gSim->epsilon() == 2);
       processPipeline();
       break;
 
@@ -132,7 +158,7 @@ void InputQueue::processEvent(void* _event, s32 _type) {
 
 void InputQueue::routingAlgorithmResponse(
     RoutingAlgorithm::Response* _response) {
-  assert(rfe_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(rfe_.fsm == ePipelineFsm::kWaitingForResponse);
   rfe_.fsm = ePipelineFsm::kReadyToAdvance;
 
   // ensure an event is set to process the pipeline
@@ -140,8 +166,8 @@ void InputQueue::routingAlgorithmResponse(
 }
 
 void InputQueue::vcSchedulerResponse(u32 _vcIdx) {
-  assert(vca_.flit->isHead());
-  assert(vca_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(vca_.flit->isHead());
+  CHECK_HOT(vca_.fsm == ePipelineFsm::kWaitingForResponse);
 
   if (_vcIdx != U32_MAX) {
     // granted
@@ -165,7 +191,7 @@ void InputQueue::vcSchedulerResponse(u32 _vcIdx) {
 }
 
 void InputQueue::crossbarSchedulerResponse(u32 _port, u32 _vcIdx) {
-  assert(swa_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(swa_.fsm == ePipelineFsm::kWaitingForResponse);
 
   if (_port != U32_MAX) {
     // granted
@@ -188,7 +214,7 @@ void InputQueue::setPipelineEvent() {
 
 void InputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::ROUTER) == 0);
+  CHECK_HOT(clock_->isCycle());
 
   /*
    * attempt to load the crossbar
@@ -226,9 +252,9 @@ void InputQueue::processPipeline() {
     // dbgprintf("loading SWA");
 
     // ensure SWA is empty
-    assert(swa_.flit == nullptr);
-    assert(swa_.allocatedPort == U32_MAX);
-    assert(swa_.allocatedVcIdx == U32_MAX);
+    CHECK_HOT(swa_.flit == nullptr);
+    CHECK_HOT(swa_.allocatedPort == U32_MAX);
+    CHECK_HOT(swa_.allocatedVcIdx == U32_MAX);
 
     // set SWA info
     swa_.flit = vca_.flit;
@@ -266,17 +292,17 @@ void InputQueue::processPipeline() {
     // dbgprintf("loading VCA");
 
     // ensure VCA is empty
-    assert(vca_.flit == nullptr);
+    CHECK_HOT(vca_.flit == nullptr);
     if (rfe_.flit->isHead()) {
       // U32_MAX means cleared
-      assert(vca_.allocatedVcIdx == U32_MAX);
-      assert(vca_.allocatedPort == U32_MAX);
-      assert(vca_.allocatedVc == U32_MAX);
+      CHECK_HOT(vca_.allocatedVcIdx == U32_MAX);
+      CHECK_HOT(vca_.allocatedPort == U32_MAX);
+      CHECK_HOT(vca_.allocatedVc == U32_MAX);
     } else {
       // these should still be valid from the head flit
-      assert(vca_.allocatedVcIdx != U32_MAX);
-      assert(vca_.allocatedPort != U32_MAX);
-      assert(vca_.allocatedVc != U32_MAX);
+      CHECK_HOT(vca_.allocatedVcIdx != U32_MAX);
+      CHECK_HOT(vca_.allocatedPort != U32_MAX);
+      CHECK_HOT(vca_.allocatedVc != U32_MAX);
     }
 
     // set VCA info
@@ -301,14 +327,14 @@ void InputQueue::processPipeline() {
    */
   if ((vca_.fsm == ePipelineFsm::kWaitingToRequest) &&
       (swa_.fsm == ePipelineFsm::kEmpty || !vcaSwaWait_)) {
-    assert(vca_.flit->isHead());
+    CHECK_HOT(vca_.flit->isHead());
 
     // set state machine as waiting for response from VC alloc
     vca_.fsm = ePipelineFsm::kWaitingForResponse;
 
     // request everything of the VC alloc
     u32 responseSize = vca_.route.size();
-    assert(responseSize > 0);
+    CHECK_HOT(responseSize > 0);
     for (u32 r = 0; r < responseSize; r++) {
       u32 requestPort, requestVc;
       vca_.route.get(r, &requestPort, &requestVc);
@@ -325,7 +351,7 @@ void InputQueue::processPipeline() {
     // dbgprintf("loading RFE");
 
     // ensure RFE is empty
-    assert(rfe_.flit == nullptr);
+    CHECK_HOT(rfe_.flit == nullptr);
 
     // get the front flit
     Flit* flit = buffer_.front();
@@ -333,7 +359,7 @@ void InputQueue::processPipeline() {
     // if store and forward is enabled, make sure the packet could actually fit
     // fully in the queue
     if (storeAndForward_) {
-      assert(depth_ >= flit->packet()->numFlits());
+      CHECK_HOT(depth_ >= flit->packet()->numFlits());
     }
 
     // when store and forward is enabled, wait for the whole packet
@@ -357,7 +383,7 @@ void InputQueue::processPipeline() {
       buffer_.pop();
 
       // put it in the routing pipeline stage
-      assert(rfe_.flit == nullptr);
+      CHECK_HOT(rfe_.flit == nullptr);
       rfe_.flit = flit;
 
       // send a credit back
@@ -402,7 +428,7 @@ void InputQueue::processPipeline() {
       (rfe_.fsm == ePipelineFsm::kReadyToAdvance) ||  // body flit
       (buffer_.size() > 0)) {                         // more flits in buffer
     // set a pipeline event for the next cycle
-    eventTime_ = gSim->futureCycle(Simulator::Clock::ROUTER, 1);
+    eventTime_ = clock_->futureCycle(1);
     addEvent(eventTime_, 2, nullptr, PROCESS_PIPELINE);
   }
 }
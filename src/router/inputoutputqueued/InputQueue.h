@@ -17,12 +17,14 @@
 
 #include <queue>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "architecture/CreditWatcher.h"
 #include "architecture/Crossbar.h"
 #include "architecture/CrossbarScheduler.h"
 #include "architecture/VcScheduler.h"
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "prim/prim.h"
 #include "routing/RoutingAlgorithm.h"
@@ -51,6 +53,10 @@ class InputQueue : public Component,
   // set input queue depth (tailor mode)
   void setDepth(u32 _depth);
 
+  // this adds the output (port, VC) pairs the front packet waits for
+  //  (see Router::waitingFor())
+  void waitingFor(std::vector<std::tuple<u32, u32>>* _outputs) const;
+
   // called by next higher router (FlitReceiver)
   void receiveFlit(u32 _port, Flit* _flit) override;
 
@@ -82,6 +88,7 @@ class InputQueue : public Component,
 
   // external devices
   Router* router_;
+  const ClockDomain* clock_;
   RoutingAlgorithm* routingAlgorithm_;
   VcScheduler* vcScheduler_;
   const u32 vcSchedulerIndex_;
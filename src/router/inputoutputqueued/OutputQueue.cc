@@ -21,6 +21,7 @@
 
 #include "router/inputoutputqueued/Router.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define INJECTED_FLIT (0x33)
@@ -66,21 +67,22 @@ OutputQueue::OutputQueue(const std::string& _name, const Component* _parent,
 OutputQueue::~OutputQueue() {}
 
 void OutputQueue::receiveFlit(u32 _port, Flit* _flit) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   // 'port' is unused
-  assert(_port == 0);
+  CHECK_HOT(_port == 0);
 
   // make sure this is the right VC
-  assert(_flit->getVc() == vc_);
+  CHECK_HOT(_flit->getVc() == vc_);
 
   // we can only receive one flit per cycle
-  assert((lastReceivedTime_ == U64_MAX) || (lastReceivedTime_ < gSim->time()));
+  CHECK_HOT((lastReceivedTime_ == U64_MAX) ||
+            (lastReceivedTime_ < gSim->time()));
   lastReceivedTime_ = gSim->time();
 
   // push flit into corresponding buffer
   buffer_.push(_flit);
-  assert(buffer_.size() <= depth_);  // overflow check
+  CHECK_HOT(buffer_.size() <= depth_);  // overflow check
 
   // queue an event to be notified about the injected flit
   //  this synchronized the two clock domains
@@ -95,12 +97,12 @@ void OutputQueue::receiveFlit(u32 _port, Flit* _flit) {
 void OutputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (INJECTED_FLIT):
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       setPipelineEvent();
       break;
 
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
+      CHECK_HOT(gSim->epsilon() == 2);
       processPipeline();
       break;
 
@@ -110,12 +112,12 @@ void OutputQueue::processEvent(void* _event, s32 _type) {
 }
 
 void OutputQueue::crossbarSchedulerResponse(u32 _port, u32 _vc) {
-  assert(swa_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(swa_.fsm == ePipelineFsm::kWaitingForResponse);
 
   if (_port != U32_MAX) {
     // granted
-    assert(_port == 0);  // only one port here
-    assert(_vc == vc_);  // same VC as this
+    CHECK_HOT(_port == 0);  // only one port here
+    CHECK_HOT(_vc == vc_);  // same VC as this
     swa_.fsm = ePipelineFsm::kReadyToAdvance;
   } else {
     // denied
@@ -135,7 +137,7 @@ void OutputQueue::setPipelineEvent() {
 
 void OutputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
+  CHECK_HOT(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
 
   /*
    * attempt to load the crossbar
@@ -162,7 +164,7 @@ void OutputQueue::processPipeline() {
     // dbgprintf("loading SWA");
 
     // ensure SWA is empty
-    assert(swa_.flit == nullptr);
+    CHECK_HOT(swa_.flit == nullptr);
 
     // pull out the front flit
     Flit* flit = buffer_.front();
@@ -24,11 +24,12 @@
 #include "router/inputoutputqueued/Ejector.h"
 #include "router/inputoutputqueued/InputQueue.h"
 #include "router/inputoutputqueued/OutputQueue.h"
+#include "util/invariant.h"
 
 namespace InputOutputQueued {
 
 Router::Router(const std::string& _name, const Component* _parent,
-               Network* _network, u32 _id, const std::vector<u32>& _address,
+               Network* _network, u32 _id, const Address& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
                nlohmann::json _settings)
     : ::Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
@@ -38,7 +39,7 @@ Router::Router(const std::string& _name, const Component* _parent,
   // determine the size of credits
   creditSize_ =
       numVcs_ * (u32)std::ceil((f64)gSim->cycleTime(Simulator::Clock::CHANNEL) /
-                               (f64)gSim->cycleTime(Simulator::Clock::ROUTER));
+                               (f64)clock_->cycleTime());
 
   // queue depths
   outputQueueDepth_ = _settings["output_queue_depth"].get<u32>();
@@ -69,6 +70,16 @@ Router::Router(const std::string& _name, const Component* _parent,
     assert(false);
   }
 
+  // when "input_queue_reserved" is given, the VCs of each input port share a
+  //  single buffer as large as the private buffers would be in total. each VC
+  //  reserves this many slots and the rest are shared on demand.
+  inputQueueReserved_ = 0;
+  if (_settings.contains("input_queue_reserved")) {
+    inputQueueReserved_ = _settings["input_queue_reserved"].get<u32>();
+    assert(inputQueueReserved_ > 0);
+    assert(inputQueueTailored_ || inputQueueReserved_ <= inputQueueDepth_);
+  }
+
   // pipeline control
   assert(_settings.contains("vca_swa_wait") &&
          _settings["vca_swa_wait"].is_boolean());
@@ -81,14 +92,13 @@ Router::Router(const std::string& _name, const Component* _parent,
   // create crossbar and schedulers
   crossbar_ =
       new Crossbar("Crossbar", this, numPorts_ * numVcs_, numPorts_ * numVcs_,
-                   Simulator::Clock::ROUTER, _settings["crossbar"]);
+                   clock_, _settings["crossbar"]);
   vcScheduler_ = new VcScheduler("VcScheduler", this, numPorts_ * numVcs_,
-                                 numPorts_ * numVcs_, Simulator::Clock::ROUTER,
+                                 numPorts_ * numVcs_, clock_,
                                  _settings["vc_scheduler"]);
   crossbarScheduler_ = new CrossbarScheduler(
       "CrossbarScheduler", this, numPorts_ * numVcs_, numPorts_ * numVcs_,
-      numPorts_ * numVcs_, 0, Simulator::Clock::ROUTER,
-      _settings["crossbar_scheduler"]);
+      numPorts_ * numVcs_, 0, clock_, _settings["crossbar_scheduler"]);
 
   // determine the credit updates the input queue will need to provide
   bool iqDecrWatcher =
@@ -150,13 +160,15 @@ Router::Router(const std::string& _name, const Component* _parent,
         "OutputCrossbarScheduler_" + std::to_string(port);
     outputCrossbarSchedulers_.at(port) = new CrossbarScheduler(
         outputCrossbarSchedulerName, this, numVcs_, numVcs_, 1, port * numVcs_,
-        Simulator::Clock::CHANNEL, _settings["output_crossbar_scheduler"]);
+        gSim->clockDomain(Simulator::Clock::CHANNEL),
+        _settings["output_crossbar_scheduler"]);
 
     // output crossbar
     std::string outputCrossbarName = "OutputCrossbar_" + std::to_string(port);
-    outputCrossbars_.at(port) =
-        new Crossbar(outputCrossbarName, this, numVcs_, 1,
-                     Simulator::Clock::CHANNEL, _settings["output_crossbar"]);
+    outputCrossbars_.at(port) = new Crossbar(
+        outputCrossbarName, this, numVcs_, 1,
+        gSim->clockDomain(Simulator::Clock::CHANNEL),
+        _settings["output_crossbar"]);
 
     // ejector
     std::string ejName = "Ejector_" + std::to_string(port);
@@ -252,6 +264,12 @@ void Router::initialize() {
         queueDepth = 0;
       }
     }
+    if (inputQueueReserved_ > 0 && queueDepth > 0) {
+      // a single VC may fill everything but the others' reservations
+      assert(inputQueueReserved_ <= queueDepth);
+      queueDepth = (queueDepth * numVcs_) -
+                   (inputQueueReserved_ * (numVcs_ - 1));
+    }
     for (u32 vc = 0; vc < numVcs_; vc++) {
       // set depth
       u32 vcIdx = vcIndex(port, vc);
@@ -274,6 +292,22 @@ void Router::initialize() {
       }
     }
 
+    // when the downstream VCs share one buffer, a single VC sees at most its
+    //  reservation plus the shared slots
+    bool shared = inputQueueReserved_ > 0 && credits != U32_MAX;
+    u32 sharedCredits = 0;
+    if (shared) {
+      assert(inputQueueReserved_ <= credits);
+      sharedCredits = (credits - inputQueueReserved_) * numVcs_;
+      outputCrossbarSchedulers_.at(port)->initSharedCredits(
+          0, numVcs_, inputQueueReserved_, sharedCredits);
+      if (congestionMode_ == Router::CongestionMode::kDownstream) {
+        congestionSensor_->initSharedCredits(
+            vcIndex(port, 0), numVcs_, inputQueueReserved_, sharedCredits);
+      }
+      credits = inputQueueReserved_ + sharedCredits;
+    }
+
     for (u32 vc = 0; vc < numVcs_; vc++) {
       u32 vcIdx = vcIndex(port, vc);
       // initialize the credit count in the CrossbarScheduler
@@ -281,7 +315,9 @@ void Router::initialize() {
 
       // tell the congestion sensor module of the number of credits
       if (congestionMode_ == Router::CongestionMode::kDownstream) {
-        congestionSensor_->initCredits(vcIdx, credits);
+        if (!shared) {
+          congestionSensor_->initCredits(vcIdx, credits);
+        }
       } else if (congestionMode_ == Router::CongestionMode::kOutput) {
         congestionSensor_->initCredits(vcIdx, outputQueueDepth_);
       } else if (congestionMode_ ==
@@ -293,14 +329,18 @@ void Router::initialize() {
       }
 
       // initialize the credit count in the OutputCrossbarScheduler
-      outputCrossbarSchedulers_.at(port)->initCredits(vc, credits);
+      if (!shared) {
+        outputCrossbarSchedulers_.at(port)->initCredits(vc, credits);
+      }
     }
   }
 }
 
 void Router::receiveFlit(u32 _port, Flit* _flit) {
+  CHECK_HOT(_port < numPorts_);
   u32 vc = _flit->getVc();
-  InputQueue* iq = inputQueues_.at(vcIndex(_port, vc));
+  CHECK_HOT(vc < numVcs_);
+  InputQueue* iq = inputQueues_[vcIndex(_port, vc)];
   iq->receiveFlit(0, _flit);
 
   // inform base class of arrival
@@ -310,11 +350,12 @@ void Router::receiveFlit(u32 _port, Flit* _flit) {
 }
 
 void Router::receiveCredit(u32 _port, Credit* _credit) {
+  CHECK_HOT(_port < numPorts_);
   while (_credit->more()) {
     u32 vc = _credit->getNum();
 
     // give the output crossbar a credit
-    outputCrossbarSchedulers_.at(_port)->incrementCredit(vc);
+    outputCrossbarSchedulers_[_port]->incrementCredit(vc);
 
     // if the downstream credits are part of congestion, give the congestion
     //  status module a credit
@@ -329,11 +370,12 @@ void Router::receiveCredit(u32 _port, Credit* _credit) {
 
 void Router::sendCredit(u32 _port, u32 _vc) {
   // ensure there is an outgoing credit for the next time slot
-  assert(_vc < numVcs_);
-  Credit* credit = inputChannels_.at(_port)->getNextCredit();
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
+  Credit* credit = inputChannels_[_port]->getNextCredit();
   if (credit == nullptr) {
     credit = new Credit(creditSize_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    inputChannels_[_port]->setNextCredit(credit);
   }
 
   // mark the credit with the specified VC
@@ -341,8 +383,9 @@ void Router::sendCredit(u32 _port, u32 _vc) {
 }
 
 void Router::sendFlit(u32 _port, Flit* _flit) {
-  assert(outputChannels_.at(_port)->getNextFlit() == nullptr);
-  outputChannels_.at(_port)->setNextFlit(_flit);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(outputChannels_[_port]->getNextFlit() == nullptr);
+  outputChannels_[_port]->setNextFlit(_flit);
 
   // inform base class of departure
   if (_flit->isHead()) {
@@ -356,6 +399,24 @@ f64 Router::congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                    _outputVc);
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort) const {
+  if (portCongestionResolution()) {
+    return congestionSensor_->portStatus(_inputPort, _inputVc, _outputPort);
+  }
+  return ::Router::portCongestionStatus(_inputPort, _inputVc, _outputPort);
+}
+
+bool Router::portCongestionResolution() const {
+  return congestionSensor_->resolution() ==
+      CongestionSensor::Resolution::kPort;
+}
+
+void Router::waitingFor(u32 _inputPort, u32 _inputVc,
+                        std::vector<std::tuple<u32, u32>>* _outputs) const {
+  inputQueues_.at(vcIndex(_inputPort, _inputVc))->waitingFor(_outputs);
+}
+
 Router::CongestionMode Router::parseCongestionMode(const std::string& _mode) {
   if (_mode == "output") {
     return Router::CongestionMode::kOutput;
@@ -19,7 +19,9 @@
 
 #include "network/Network.h"
 #include "router/inputqueued/Router.h"
+#include "types/Message.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define INJECTED_FLIT (0x33)
@@ -30,6 +32,7 @@ namespace InputQueued {
 InputQueue::InputQueue(const std::string& _name, const Component* _parent,
                        Router* _router, u32 _depth, u32 _port, u32 _numVcs,
                        u32 _vc, bool _vcaSwaWait, bool _storeAndForward,
+                       bool _speculativeSwa,
                        RoutingAlgorithm* _routingAlgorithm,
                        VcScheduler* _vcScheduler, u32 _vcSchedulerIndex,
                        CrossbarScheduler* _crossbarScheduler,
@@ -42,7 +45,11 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
       vc_(_vc),
       vcaSwaWait_(_vcaSwaWait),
       storeAndForward_(_storeAndForward),
+      speculativeSwa_(_speculativeSwa),
+      sourceRouted_(_router->network()->sourceRouted(
+          _router->network()->vcToPc(_vc))),
       router_(_router),
+      clock_(_router->clockDomain()),
       routingAlgorithm_(_routingAlgorithm),
       vcScheduler_(_vcScheduler),
       vcSchedulerIndex_(_vcSchedulerIndex),
@@ -69,10 +76,14 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
   vca_.allocatedPort = U32_MAX;
   vca_.allocatedVc = U32_MAX;
 
-  swa_.fsm = ePipelineFsm::kEmpty;
-  swa_.flit = nullptr;
-  swa_.allocatedPort = U32_MAX;
-  swa_.allocatedVcIdx = U32_MAX;
+  clearSwa();
+  swaStats_ = {0, 0, 0, 0, 0};
+
+  mcast_.ports = nullptr;
+  mcast_.branch = 0;
+  mcast_.flit = 0;
+  mcast_.copy = nullptr;
+  absorb_ = 0;
 
   // no event is set to trigger
   eventTime_ = U64_MAX;
@@ -80,46 +91,74 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
 
 InputQueue::~InputQueue() {}
 
+const InputQueue::SwaStats& InputQueue::swaStats() const {
+  return swaStats_;
+}
+
 void InputQueue::setDepth(u32 _depth) {
   depth_ = _depth;
 }
 
+void InputQueue::waitingFor(
+    std::vector<std::tuple<u32, u32>>* _outputs) const {
+  bool holding = (rfe_.flit != nullptr) || (vca_.flit != nullptr) ||
+                 !buffer_.empty();
+  if (swa_.flit != nullptr && !swa_.speculative) {
+    // waiting for the crossbar or credits
+    _outputs->push_back(
+        std::make_tuple(swa_.allocatedPort, swa_.flit->getVc()));
+  } else if (holding && vca_.allocatedPort != U32_MAX) {
+    // the rest of a packet that has its VC
+    _outputs->push_back(
+        std::make_tuple(vca_.allocatedPort, vca_.allocatedVc));
+  } else if (vca_.flit != nullptr) {
+    // a head flit waiting for a VC
+    for (u32 r = 0; r < vca_.route.size(); r++) {
+      u32 port, vc;
+      vca_.route.get(r, &port, &vc);
+      _outputs->push_back(std::make_tuple(port, vc));
+    }
+  } else if (holding) {
+    _outputs->push_back(std::make_tuple(U32_MAX, U32_MAX));
+  }
+}
+
 void InputQueue::receiveFlit(u32 _port, Flit* _flit) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   // 'port' is unused
-  assert(_port == 0);
+  CHECK_HOT(_port == 0);
 
   // make sure this is the right VC
-  assert(_flit->getVc() == vc_);
+  CHECK_HOT(_flit->getVc() == vc_);
 
   // we can only receive one flit per cycle
-  assert((lastReceivedTime_ == U64_MAX) || (lastReceivedTime_ < gSim->time()));
+  CHECK_HOT((lastReceivedTime_ == U64_MAX) ||
+            (lastReceivedTime_ < gSim->time()));
   lastReceivedTime_ = gSim->time();
 
   // push flit into corresponding buffer
-  buffer_.push(_flit);
-  assert(buffer_.size() <= depth_);  // overflow check
+  buffer_.push_back(_flit);
+  CHECK_HOT(buffer_.size() <= depth_);  // overflow check
 
   // queue an event to be notified about the injected flit
   //  this synchronized the two clock domains
-  if (gSim->isCycle(Simulator::Clock::ROUTER)) {
+  if (clock_->isCycle()) {
     setPipelineEvent();
   } else {
-    addEvent(gSim->futureCycle(Simulator::Clock::ROUTER, 1), 1, nullptr,
-             INJECTED_FLIT);
+    addEvent(clock_->futureCycle(1), 1, nullptr, INJECTED_FLIT);
   }
 }
 
 void InputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (INJECTED_FLIT):
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       setPipelineEvent();
       break;
 
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
+      CHECK_HOT(gSim->epsilon() == 2);
       processPipeline();
       break;
 
@@ -130,7 +169,7 @@ void InputQueue::processEvent(void* _event, s32 _type) {
 
 void InputQueue::routingAlgorithmResponse(
     RoutingAlgorithm::Response* _response) {
-  assert(rfe_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(rfe_.fsm == ePipelineFsm::kWaitingForResponse);
   rfe_.fsm = ePipelineFsm::kReadyToAdvance;
 
   // ensure an event is set to process the pipeline
@@ -138,16 +177,19 @@ void InputQueue::routingAlgorithmResponse(
 }
 
 void InputQueue::vcSchedulerResponse(u32 _vcIdx) {
-  assert(vca_.flit->isHead());
-  assert(vca_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(vca_.flit->isHead());
+  CHECK_HOT(vca_.fsm == ePipelineFsm::kWaitingForResponse);
 
   if (_vcIdx != U32_MAX) {
     // granted
     vca_.fsm = ePipelineFsm::kReadyToAdvance;
     vca_.allocatedVcIdx = _vcIdx;
     router_->vcIndexInv(_vcIdx, &vca_.allocatedPort, &vca_.allocatedVc);
-    routingAlgorithm_->vcScheduled(vca_.flit, vca_.allocatedPort,
-                                   vca_.allocatedVc);
+    if (vca_.flit->packet()->message()->getMulticastGroup() == U32_MAX &&
+        !sourceRouted_) {
+      routingAlgorithm_->vcScheduled(vca_.flit, vca_.allocatedPort,
+                                     vca_.allocatedVc);
+    }
 
     // log traffic
     router_->network()->logTraffic(router_, port_, vc_, vca_.allocatedPort,
@@ -163,10 +205,19 @@ void InputQueue::vcSchedulerResponse(u32 _vcIdx) {
 }
 
 void InputQueue::crossbarSchedulerResponse(u32 _port, u32 _vcIdx) {
-  assert(swa_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(swa_.fsm == ePipelineFsm::kWaitingForResponse);
 
-  if (_port != U32_MAX) {
+  if (swa_.speculative) {
+    // the VCA result is checked when the pipeline is processed
+    if (_port != U32_MAX) {
+      swaStats_.specGrants++;
+      swa_.fsm = ePipelineFsm::kReadyToAdvance;
+    } else {
+      clearSwa();
+    }
+  } else if (_port != U32_MAX) {
     // granted
+    swaStats_.grants++;
     swa_.fsm = ePipelineFsm::kReadyToAdvance;
   } else {
     // denied
@@ -184,9 +235,62 @@ void InputQueue::setPipelineEvent() {
   }
 }
 
+void InputQueue::loadSwa() {
+  // ensure SWA is empty
+  CHECK_HOT(swa_.flit == nullptr);
+  CHECK_HOT(swa_.allocatedPort == U32_MAX);
+  CHECK_HOT(swa_.allocatedVcIdx == U32_MAX);
+
+  // set SWA info
+  swa_.flit = vca_.flit;
+  swa_.flit->setVc(vca_.allocatedVc);
+  swa_.allocatedPort = vca_.allocatedPort;
+  swa_.allocatedVcIdx = vca_.allocatedVcIdx;
+  swa_.fsm = ePipelineFsm::kWaitingToRequest;
+
+  // clear VCA info
+  vca_.fsm = ePipelineFsm::kEmpty;
+  vca_.flit = nullptr;
+  vca_.route.clear();
+  if (swa_.flit->isTail()) {
+    // clear the allocated info only on tail flit
+    vca_.allocatedVcIdx = U32_MAX;
+    vca_.allocatedPort = U32_MAX;
+    vca_.allocatedVc = U32_MAX;
+  }
+}
+
+void InputQueue::clearSwa() {
+  swa_.fsm = ePipelineFsm::kEmpty;
+  swa_.flit = nullptr;
+  swa_.allocatedPort = U32_MAX;
+  swa_.allocatedVcIdx = U32_MAX;
+  swa_.speculative = false;
+}
+
 void InputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::ROUTER) == 0);
+  CHECK_HOT(clock_->isCycle());
+
+  /*
+   * resolve a speculative switch grant, it is only usable if VCA granted a VC
+   *  on the same port and the VC has credits for the flit
+   */
+  if (swa_.fsm == ePipelineFsm::kReadyToAdvance && swa_.speculative) {
+    CHECK_HOT(swa_.flit == vca_.flit);
+    u32 port = swa_.allocatedPort;
+    bool usable = (vca_.fsm == ePipelineFsm::kReadyToAdvance) &&
+                  (vca_.allocatedPort == port) &&
+                  crossbarScheduler_->canSend(vca_.allocatedVcIdx, vca_.flit);
+    clearSwa();
+    if (usable) {
+      swaStats_.specUsed++;
+      loadSwa();
+      swa_.fsm = ePipelineFsm::kReadyToAdvance;
+    } else {
+      crossbarScheduler_->cancelSpeculative(crossbarSchedulerIndex_, port);
+    }
+  }
 
   /*
    * attempt to load the crossbar
@@ -207,10 +311,7 @@ void InputQueue::processPipeline() {
     }
 
     // clear SWA info
-    swa_.fsm = ePipelineFsm::kEmpty;
-    swa_.flit = nullptr;
-    swa_.allocatedPort = U32_MAX;
-    swa_.allocatedVcIdx = U32_MAX;
+    clearSwa();
   }
 
   /*
@@ -220,29 +321,7 @@ void InputQueue::processPipeline() {
   if ((swa_.fsm == ePipelineFsm::kEmpty) &&
       (vca_.fsm == ePipelineFsm::kReadyToAdvance)) {
     // dbgprintf("loading SWA");
-
-    // ensure SWA is empty
-    assert(swa_.flit == nullptr);
-    assert(swa_.allocatedPort == U32_MAX);
-    assert(swa_.allocatedVcIdx == U32_MAX);
-
-    // set SWA info
-    swa_.flit = vca_.flit;
-    swa_.flit->setVc(vca_.allocatedVc);
-    swa_.allocatedPort = vca_.allocatedPort;
-    swa_.allocatedVcIdx = vca_.allocatedVcIdx;
-    swa_.fsm = ePipelineFsm::kWaitingToRequest;
-
-    // clear VCA info
-    vca_.fsm = ePipelineFsm::kEmpty;
-    vca_.flit = nullptr;
-    vca_.route.clear();
-    if (swa_.flit->isTail()) {
-      // clear the allocated info only on tail flit
-      vca_.allocatedVcIdx = U32_MAX;
-      vca_.allocatedPort = U32_MAX;
-      vca_.allocatedVc = U32_MAX;
-    }
+    loadSwa();
   }
 
   /*
@@ -252,6 +331,7 @@ void InputQueue::processPipeline() {
     crossbarScheduler_->request(crossbarSchedulerIndex_, swa_.allocatedPort,
                                 swa_.allocatedVcIdx, swa_.flit);
     swa_.fsm = ePipelineFsm::kWaitingForResponse;
+    swaStats_.requests++;
   }
 
   /*
@@ -262,17 +342,17 @@ void InputQueue::processPipeline() {
     // dbgprintf("loading VCA");
 
     // ensure VCA is empty
-    assert(vca_.flit == nullptr);
+    CHECK_HOT(vca_.flit == nullptr);
     if (rfe_.flit->isHead()) {
       // U32_MAX means cleared
-      assert(vca_.allocatedVcIdx == U32_MAX);
-      assert(vca_.allocatedPort == U32_MAX);
-      assert(vca_.allocatedVc == U32_MAX);
+      CHECK_HOT(vca_.allocatedVcIdx == U32_MAX);
+      CHECK_HOT(vca_.allocatedPort == U32_MAX);
+      CHECK_HOT(vca_.allocatedVc == U32_MAX);
     } else {
       // these should still be valid from the head flit
-      assert(vca_.allocatedVcIdx != U32_MAX);
-      assert(vca_.allocatedPort != U32_MAX);
-      assert(vca_.allocatedVc != U32_MAX);
+      CHECK_HOT(vca_.allocatedVcIdx != U32_MAX);
+      CHECK_HOT(vca_.allocatedPort != U32_MAX);
+      CHECK_HOT(vca_.allocatedVc != U32_MAX);
     }
 
     // set VCA info
@@ -297,44 +377,75 @@ void InputQueue::processPipeline() {
    */
   if ((vca_.fsm == ePipelineFsm::kWaitingToRequest) &&
       (swa_.fsm == ePipelineFsm::kEmpty || !vcaSwaWait_)) {
-    assert(vca_.flit->isHead());
+    CHECK_HOT(vca_.flit->isHead());
 
     // set state machine as waiting for response from VC alloc
     vca_.fsm = ePipelineFsm::kWaitingForResponse;
 
     // request everything of the VC alloc
     u32 responseSize = vca_.route.size();
-    assert(responseSize > 0);
+    CHECK_HOT(responseSize > 0);
     u32 metadata = vca_.flit->packet()->getMetadata();
+    u32 specPort = U32_MAX;
     for (u32 r = 0; r < responseSize; r++) {
       u32 requestPort, requestVc;
       vca_.route.get(r, &requestPort, &requestVc);
       u32 vcIdx = router_->vcIndex(requestPort, requestVc);
       vcScheduler_->request(vcSchedulerIndex_, vcIdx, metadata);
+      specPort = (r == 0 || requestPort == specPort) ? requestPort : U32_MAX;
+    }
+
+    // speculate on the switch when all options share a port
+    if (speculativeSwa_ && specPort != U32_MAX &&
+        swa_.fsm == ePipelineFsm::kEmpty) {
+      swa_.flit = vca_.flit;
+      swa_.allocatedPort = specPort;
+      swa_.speculative = true;
+      swa_.fsm = ePipelineFsm::kWaitingForResponse;
+      crossbarScheduler_->requestSpeculative(crossbarSchedulerIndex_, specPort,
+                                             swa_.flit);
+      swaStats_.specRequests++;
     }
   }
 
   /*
    * attempt to load RFE stage
    */
-  if ((rfe_.fsm == ePipelineFsm::kEmpty) && (buffer_.empty() == false)) {
+  if (absorb_ > 0) {
+    // consume the rest of a reduction packet that was combined
+    buffer_.pop_front();
+    router_->sendCredit(port_, vc_);
+    absorb_--;
+  } else if ((rfe_.fsm == ePipelineFsm::kEmpty) &&
+             (buffer_.size() > mcast_.flit)) {
     // dbgprintf("loading RFE");
 
     // ensure RFE is empty
-    assert(rfe_.flit == nullptr);
+    CHECK_HOT(rfe_.flit == nullptr);
 
-    // get the front flit
-    Flit* flit = buffer_.front();
+    // get the front flit (or the next flit to copy)
+    Flit* flit = buffer_.at(mcast_.flit);
+    Packet* packet = flit->packet();
+
+    // reduction packets on their way up the tree are combined as a whole
+    bool reduction = flit->isHead() && mcast_.ports == nullptr &&
+                     packet->message()->getReductionId() != U64_MAX &&
+                     packet->getRoutingExtension() == nullptr;
 
     // if store and forward is enabled, make sure the packet could actually fit
-    // fully in the queue
+    // fully in the queue, a reduction packet that doesn't would never combine
     if (storeAndForward_) {
-      assert(depth_ >= flit->packet()->numFlits());
+      CHECK_HOT(depth_ >= flit->packet()->numFlits());
+    }
+    if (reduction && packet->numFlits() > depth_) {
+      fprintf(stderr, "%u flit reduction packet exceeds the %u flit "
+              "input queue\n", packet->numFlits(), depth_);
+      assert(false);
     }
 
     // when store and forward is enabled, wait for the whole packet
     bool loadRfe;
-    if (storeAndForward_) {
+    if (storeAndForward_ || reduction) {
       if (flit->isHead()) {
         // make sure the full packet is received
         loadRfe = buffer_.size() >= flit->packet()->numFlits();
@@ -347,20 +458,81 @@ void InputQueue::processPipeline() {
       loadRfe = true;
     }
 
+    // combine reduction packets, only the last contribution moves on
+    u32 fixedPort = U32_MAX;
+    if (loadRfe && reduction &&
+        !router_->reductionArrival(packet, &fixedPort)) {
+      buffer_.pop_front();
+      router_->sendCredit(port_, vc_);
+      absorb_ = packet->numFlits() - 1;
+      loadRfe = false;
+    }
+
     // perform RFE loading
     if (loadRfe) {
-      // pull out the front flit
-      buffer_.pop();
+      // multicast packets are replicated to the ports of their tree
+      if (flit->isHead() && mcast_.ports == nullptr && fixedPort == U32_MAX &&
+          packet->message()->getMulticastGroup() != U32_MAX) {
+        // the packet stays in the buffer until its last branch is sent
+        if (packet->numFlits() > depth_) {
+          fprintf(stderr, "%u flit multicast packet exceeds the %u flit "
+                  "input queue\n", packet->numFlits(), depth_);
+          assert(false);
+        }
+        mcast_.ports = &router_->multicastPorts(packet);
+        CHECK_HOT(mcast_.ports->size() > 0);
+      }
+      if (mcast_.ports != nullptr) {
+        fixedPort = mcast_.ports->at(mcast_.branch);
+      } else if (sourceRouted_ && flit->isHead()) {
+        const std::vector<u32>* path =
+            reinterpret_cast<const std::vector<u32>*>(
+                packet->getRoutingExtension());
+        fixedPort = path->at(packet->getHopCount());
+      }
+
+      if (mcast_.ports != nullptr &&
+          mcast_.branch < mcast_.ports->size() - 1) {
+        // copy the flit, the original stays in the buffer
+        if (flit->isHead()) {
+          mcast_.copy = packet->replicate();
+        }
+        flit = mcast_.copy->getFlit(flit->id());
+        mcast_.flit++;
+        if (flit->isTail()) {
+          mcast_.branch++;
+          mcast_.flit = 0;
+          mcast_.copy = nullptr;
+        }
+      } else {
+        // pull out the front flit
+        buffer_.pop_front();
+
+        // send a credit back
+        router_->sendCredit(port_, vc_);
+
+        if (mcast_.ports != nullptr && flit->isTail()) {
+          mcast_.ports = nullptr;
+          mcast_.branch = 0;
+        }
+      }
 
       // put it in the routing pipeline stage
-      assert(rfe_.flit == nullptr);
+      CHECK_HOT(rfe_.flit == nullptr);
       rfe_.flit = flit;
 
-      // send a credit back
-      router_->sendCredit(port_, vc_);
-
-      // set state as ready to request routing algorithm
-      rfe_.fsm = ePipelineFsm::kWaitingToRequest;
+      if (fixedPort != U32_MAX && flit->isHead()) {
+        // multicast, reduction, and source routes are fixed, the VC is indexed
+        //  by hop count so the channel dependencies can't form a cycle
+        u32 vc = routingAlgorithm_->baseVc() + packet->getHopCount();
+        CHECK_HOT(vc < routingAlgorithm_->baseVc() +
+                  routingAlgorithm_->numVcs());
+        rfe_.route.add(fixedPort, vc);
+        rfe_.fsm = ePipelineFsm::kReadyToAdvance;
+      } else {
+        // set state as ready to request routing algorithm
+        rfe_.fsm = ePipelineFsm::kWaitingToRequest;
+      }
     }
   }
 
@@ -396,9 +568,9 @@ void InputQueue::processPipeline() {
    */
   if ((vca_.fsm == ePipelineFsm::kReadyToAdvance) ||  // body flit
       (rfe_.fsm == ePipelineFsm::kReadyToAdvance) ||  // body flit
-      (buffer_.size() > 0)) {                         // more flits in buffer
+      (buffer_.size() > mcast_.flit)) {               // more flits in buffer
     // set a pipeline event for the next cycle
-    eventTime_ = gSim->futureCycle(Simulator::Clock::ROUTER, 1);
+    eventTime_ = clock_->futureCycle(1);
     addEvent(eventTime_, 2, nullptr, PROCESS_PIPELINE);
   }
 }
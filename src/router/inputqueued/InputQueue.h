@@ -15,16 +15,19 @@
 #ifndef ROUTER_INPUTQUEUED_INPUTQUEUE_H_
 #define ROUTER_INPUTQUEUED_INPUTQUEUE_H_
 
-#include <queue>
+#include <deque>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "architecture/CreditWatcher.h"
 #include "architecture/Crossbar.h"
 #include "architecture/CrossbarScheduler.h"
 #include "architecture/VcScheduler.h"
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "prim/prim.h"
+#include "router/Router.h"
 #include "routing/RoutingAlgorithm.h"
 #include "types/Flit.h"
 #include "types/FlitReceiver.h"
@@ -41,16 +44,24 @@ class InputQueue : public Component,
  public:
   InputQueue(const std::string& _name, const Component* _parent,
              Router* _router, u32 _depth, u32 _port, u32 _numVcs, u32 _vc,
-             bool _vcaSwaWait, bool _storeAndForward,
+             bool _vcaSwaWait, bool _storeAndForward, bool _speculativeSwa,
              RoutingAlgorithm* _routingAlgorithm, VcScheduler* _vcScheduler,
              u32 _vcSchedulerIndex, CrossbarScheduler* _crossbarScheduler,
              u32 _crossbarSchedulerIndex, Crossbar* _crossbar,
              u32 _crossbarIndex, CreditWatcher* _creditWatcher);
   ~InputQueue();
 
+  // switch allocation counts (see ::Router::SwaStats)
+  typedef ::Router::SwaStats SwaStats;
+  const SwaStats& swaStats() const;
+
   // set input queue depth (tailor mode)
   void setDepth(u32 _depth);
 
+  // this adds the output (port, VC) pairs the front packet waits for
+  //  (see Router::waitingFor())
+  void waitingFor(std::vector<std::tuple<u32, u32>>* _outputs) const;
+
   // called by next higher router (FlitReceiver)
   void receiveFlit(u32 _port, Flit* _flit) override;
 
@@ -69,6 +80,8 @@ class InputQueue : public Component,
  private:
   void setPipelineEvent();
   void processPipeline();
+  void loadSwa();
+  void clearSwa();
 
   // attributes
   u32 depth_;
@@ -79,9 +92,12 @@ class InputQueue : public Component,
   // settings
   const bool vcaSwaWait_;  // stall VCA until SWA is empty
   const bool storeAndForward_;
+  const bool speculativeSwa_;  // head flits request SWA during VCA
+  const bool sourceRouted_;  // packets carry their path
 
   // external devices
   Router* router_;
+  const ClockDomain* clock_;
   RoutingAlgorithm* routingAlgorithm_;
   VcScheduler* vcScheduler_;
   const u32 vcSchedulerIndex_;
@@ -108,7 +124,22 @@ class InputQueue : public Component,
   // The following variables represent the pipeline registers
 
   // buffer
-  std::queue<Flit*> buffer_;
+  std::deque<Flit*> buffer_;
+
+  /*
+   * multicast replication. The packet at the front of the buffer is copied
+   *  flit by flit to each branch but the last, then the packet itself takes
+   *  the last branch. Its buffer space is freed only on the last branch.
+   */
+  struct {
+    const std::vector<u32>* ports;  // nullptr unless replicating
+    u32 branch;
+    u32 flit;  // buffer index of the next flit to copy
+    Packet* copy;
+  } mcast_;
+
+  // flits left to consume of a combined reduction packet
+  u32 absorb_;
 
   // routing algorithm execution [rfe_] pipeline stage
   struct {
@@ -135,8 +166,11 @@ class InputQueue : public Component,
     Flit* flit;
     u32 allocatedPort;
     u32 allocatedVcIdx;
+    bool speculative;  // the flit is still in VCA
   } swa_;
 
+  SwaStats swaStats_;
+
   // Crossbar traversal [xtr_] stage (no state needed)
 };
 
@@ -21,6 +21,7 @@
 
 #include "router/inputqueued/Router.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define PROCESS_PIPELINE (0xB7)
@@ -47,18 +48,19 @@ OutputQueue::OutputQueue(const std::string& _name, const Component* _parent,
 OutputQueue::~OutputQueue() {}
 
 void OutputQueue::receiveFlit(u32 _port, Flit* _flit) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   // 'port' is unused
-  assert(_port == 0);
+  CHECK_HOT(_port == 0);
 
   // we can only receive one flit per cycle
-  assert((lastReceivedTime_ == U64_MAX) || (lastReceivedTime_ < gSim->time()));
+  CHECK_HOT((lastReceivedTime_ == U64_MAX) ||
+            (lastReceivedTime_ < gSim->time()));
   lastReceivedTime_ = gSim->time();
 
   // push flit into corresponding buffer
   buffer_.push(_flit);
-  assert(buffer_.size() <= depth_);  // overflow check
+  CHECK_HOT(buffer_.size() <= depth_);  // overflow check
 
   // ensure an event is set to process the pipeline
   if (eventTime_ == U64_MAX) {
@@ -70,7 +72,7 @@ void OutputQueue::receiveFlit(u32 _port, Flit* _flit) {
 void OutputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
+      CHECK_HOT(gSim->epsilon() == 2);
       processPipeline();
       break;
 
@@ -81,7 +83,7 @@ void OutputQueue::processEvent(void* _event, s32 _type) {
 
 void OutputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
+  CHECK_HOT(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
 
   /*
    * Send the next flit on the output channel
@@ -15,6 +15,7 @@
 #include "router/inputqueued/Router.h"
 
 #include <cassert>
+#include <string>
 
 #include "architecture/util.h"
 #include "congestion/CongestionSensor.h"
@@ -22,11 +23,12 @@
 #include "network/Network.h"
 #include "router/inputqueued/InputQueue.h"
 #include "router/inputqueued/OutputQueue.h"
+#include "util/invariant.h"
 
 namespace InputQueued {
 
 Router::Router(const std::string& _name, const Component* _parent,
-               Network* _network, u32 _id, const std::vector<u32>& _address,
+               Network* _network, u32 _id, const Address& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
                nlohmann::json _settings)
     : ::Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
@@ -36,7 +38,7 @@ Router::Router(const std::string& _name, const Component* _parent,
   // determine the size of credits
   creditSize_ =
       numVcs_ * (u32)std::ceil((f64)gSim->cycleTime(Simulator::Clock::CHANNEL) /
-                               (f64)gSim->cycleTime(Simulator::Clock::ROUTER));
+                               (f64)clock_->cycleTime());
 
   // queue depths
   inputQueueDepth_ = 0;
@@ -65,6 +67,16 @@ Router::Router(const std::string& _name, const Component* _parent,
     assert(false);
   }
 
+  // when "input_queue_reserved" is given, the VCs of each input port share a
+  //  single buffer as large as the private buffers would be in total. each VC
+  //  reserves this many slots and the rest are shared on demand.
+  inputQueueReserved_ = 0;
+  if (_settings.contains("input_queue_reserved")) {
+    inputQueueReserved_ = _settings["input_queue_reserved"].get<u32>();
+    assert(inputQueueReserved_ > 0);
+    assert(inputQueueTailored_ || inputQueueReserved_ <= inputQueueDepth_);
+  }
+
   // pipeline control
   assert(_settings.contains("vca_swa_wait") &&
          _settings["vca_swa_wait"].is_boolean());
@@ -87,18 +99,24 @@ Router::Router(const std::string& _name, const Component* _parent,
 
   // create the crossbar and schedulers
   crossbar_ = new Crossbar("Crossbar", this, numPorts_ * numVcs_, numPorts_,
-                           Simulator::Clock::ROUTER, _settings["crossbar"]);
+                           clock_, _settings["crossbar"]);
   vcScheduler_ = new VcScheduler("VcScheduler", this, numPorts_ * numVcs_,
-                                 numPorts_ * numVcs_, Simulator::Clock::ROUTER,
+                                 numPorts_ * numVcs_, clock_,
                                  _settings["vc_scheduler"]);
   crossbarScheduler_ = new CrossbarScheduler(
       "CrossbarScheduler", this, numPorts_ * numVcs_, numPorts_ * numVcs_,
-      numPorts_, 0, Simulator::Clock::ROUTER, _settings["crossbar_scheduler"]);
+      numPorts_, 0, clock_, _settings["crossbar_scheduler"]);
 
   // determine if the router will use store and forward
   assert(_settings.contains("store_and_forward"));
   bool storeAndForward = _settings["store_and_forward"].get<bool>();
 
+  // determine if head flits speculatively request the crossbar during VCA
+  speculativeSwa_ = false;
+  if (_settings.contains("speculative_switch_allocation")) {
+    speculativeSwa_ = _settings["speculative_switch_allocation"].get<bool>();
+  }
+
   // create routing algorithms, input queues, link to routing algorithm,
   //  crossbar, and schedulers
   routingAlgorithms_.resize(numPorts_ * numVcs_);
@@ -124,8 +142,9 @@ Router::Router(const std::string& _name, const Component* _parent,
       std::string iqName = "InputQueue" + nameSuffix;
       InputQueue* iq = new InputQueue(
           iqName, this, this, inputQueueDepth_, port, numVcs_, vc, vcaSwaWait,
-          storeAndForward, rf, vcScheduler_, clientIndex, crossbarScheduler_,
-          clientIndex, crossbar_, clientIndex, congestionSensor_);
+          storeAndForward, speculativeSwa_, rf, vcScheduler_, clientIndex,
+          crossbarScheduler_, clientIndex, crossbar_, clientIndex,
+          congestionSensor_);
       inputQueues_.at(vcIdx) = iq;
 
       // register the input queue with VC and crossbar schedulers
@@ -207,6 +226,12 @@ void Router::initialize() {
         queueDepth = 0;
       }
     }
+    if (inputQueueReserved_ > 0 && queueDepth > 0) {
+      // a single VC may fill everything but the others' reservations
+      assert(inputQueueReserved_ <= queueDepth);
+      queueDepth = (queueDepth * numVcs_) -
+                   (inputQueueReserved_ * (numVcs_ - 1));
+    }
     for (u32 vc = 0; vc < numVcs_; vc++) {
       // set depth
       u32 vcIdx = vcIndex(port, vc);
@@ -229,6 +254,17 @@ void Router::initialize() {
       }
     }
 
+    if (inputQueueReserved_ > 0 && credits != U32_MAX) {
+      // the downstream VCs share one buffer
+      assert(inputQueueReserved_ <= credits);
+      u32 shared = (credits - inputQueueReserved_) * numVcs_;
+      crossbarScheduler_->initSharedCredits(
+          vcIndex(port, 0), numVcs_, inputQueueReserved_, shared);
+      congestionSensor_->initSharedCredits(
+          vcIndex(port, 0), numVcs_, inputQueueReserved_, shared);
+      continue;
+    }
+
     for (u32 vc = 0; vc < numVcs_; vc++) {
       u32 vcIdx = vcIndex(port, vc);
       // initialize the credit count in the CrossbarScheduler
@@ -242,8 +278,10 @@ void Router::initialize() {
 }
 
 void Router::receiveFlit(u32 _port, Flit* _flit) {
+  CHECK_HOT(_port < numPorts_);
   u32 vc = _flit->getVc();
-  InputQueue* iq = inputQueues_.at(vcIndex(_port, vc));
+  CHECK_HOT(vc < numVcs_);
+  InputQueue* iq = inputQueues_[vcIndex(_port, vc)];
   iq->receiveFlit(0, _flit);
 
   // inform base class of arrival
@@ -253,6 +291,7 @@ void Router::receiveFlit(u32 _port, Flit* _flit) {
 }
 
 void Router::receiveCredit(u32 _port, Credit* _credit) {
+  CHECK_HOT(_port < numPorts_);
   while (_credit->more()) {
     u32 vc = _credit->getNum();
     u32 vcIdx = vcIndex(_port, vc);
@@ -266,11 +305,12 @@ void Router::receiveCredit(u32 _port, Credit* _credit) {
 
 void Router::sendCredit(u32 _port, u32 _vc) {
   // ensure there is an outgoing credit for the next time slot
-  assert(_vc < numVcs_);
-  Credit* credit = inputChannels_.at(_port)->getNextCredit();
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
+  Credit* credit = inputChannels_[_port]->getNextCredit();
   if (credit == nullptr) {
     credit = new Credit(creditSize_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    inputChannels_[_port]->setNextCredit(credit);
   }
 
   // mark the credit with the specified VC
@@ -278,8 +318,9 @@ void Router::sendCredit(u32 _port, u32 _vc) {
 }
 
 void Router::sendFlit(u32 _port, Flit* _flit) {
-  assert(outputChannels_.at(_port)->getNextFlit() == nullptr);
-  outputChannels_.at(_port)->setNextFlit(_flit);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(outputChannels_[_port]->getNextFlit() == nullptr);
+  outputChannels_[_port]->setNextFlit(_flit);
 
   // inform base class of departure
   if (_flit->isHead()) {
@@ -293,6 +334,39 @@ f64 Router::congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                    _outputVc);
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort) const {
+  if (portCongestionResolution()) {
+    return congestionSensor_->portStatus(_inputPort, _inputVc, _outputPort);
+  }
+  return ::Router::portCongestionStatus(_inputPort, _inputVc, _outputPort);
+}
+
+bool Router::portCongestionResolution() const {
+  return congestionSensor_->resolution() ==
+      CongestionSensor::Resolution::kPort;
+}
+
+bool Router::addSwaStats(SwaStats* _stats) const {
+  if (!speculativeSwa_) {
+    return false;
+  }
+  for (const InputQueue* iq : inputQueues_) {
+    const InputQueue::SwaStats& stats = iq->swaStats();
+    _stats->requests += stats.requests;
+    _stats->grants += stats.grants;
+    _stats->specRequests += stats.specRequests;
+    _stats->specGrants += stats.specGrants;
+    _stats->specUsed += stats.specUsed;
+  }
+  return true;
+}
+
+void Router::waitingFor(u32 _inputPort, u32 _inputVc,
+                        std::vector<std::tuple<u32, u32>>* _outputs) const {
+  inputQueues_.at(vcIndex(_inputPort, _inputVc))->waitingFor(_outputs);
+}
+
 Router::CongestionMode Router::parseCongestionMode(const std::string& _mode) {
   if (_mode == "output") {
     return Router::CongestionMode::kOutput;
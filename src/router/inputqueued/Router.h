@@ -29,6 +29,7 @@
 #include "prim/prim.h"
 #include "router/Router.h"
 #include "routing/RoutingAlgorithm.h"
+#include "types/Address.h"
 #include "types/Credit.h"
 #include "types/Flit.h"
 
@@ -42,7 +43,7 @@ class OutputQueue;
 class Router : public ::Router {
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
-         u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
+         u32 _id, const Address& _address, u32 _numPorts, u32 _numVcs,
          MetadataHandler* _metadataHandler, nlohmann::json _settings);
   ~Router();
 
@@ -63,6 +64,14 @@ class Router : public ::Router {
 
   f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                        u32 _outputVc) const override;
+  f64 portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                           u32 _outputPort) const override;
+  bool portCongestionResolution() const override;
+
+  bool addSwaStats(SwaStats* _stats) const override;
+
+  void waitingFor(u32 _inputPort, u32 _inputVc,
+                  std::vector<std::tuple<u32, u32>>* _outputs) const override;
 
  private:
   enum class CongestionMode { kOutput, kDownstream };
@@ -77,6 +86,10 @@ class Router : public ::Router {
   f64 inputQueueMult_;
   u32 inputQueueMax_;
   u32 inputQueueMin_;
+  // shared input buffers, 0 when each VC has a private buffer
+  u32 inputQueueReserved_;
+  // head flits request the crossbar during VC allocation
+  bool speculativeSwa_;
 
   std::vector<InputQueue*> inputQueues_;
   std::vector<RoutingAlgorithm*> routingAlgorithms_;
@@ -14,10 +14,10 @@
  */
 #include "router/outputqueued/Ejector.h"
 
-#include <cassert>
 #include <string>
 
 #include "router/outputqueued/Router.h"
+#include "util/invariant.h"
 
 namespace OutputQueued {
 
@@ -31,7 +31,7 @@ Ejector::~Ejector() {}
 void Ejector::receiveFlit(u32 _port, Flit* _flit) {
   // verify one flit per cycle
   u64 nextTime = gSim->time();
-  assert((lastSetTime_ != nextTime) || (lastSetTime_ == U32_MAX));
+  CHECK_HOT((lastSetTime_ != nextTime) || (lastSetTime_ == U32_MAX));
   lastSetTime_ = nextTime;
 
   // send flit using the router
@@ -20,6 +20,7 @@
 #include "network/Network.h"
 #include "router/outputqueued/Router.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define INJECTED_FLIT (0x33)
@@ -38,6 +39,7 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
       vc_(_vc),
       storeAndForward_(_storeAndForward),
       router_(_router),
+      clock_(_router->clockDomain()),
       routingAlgorithm_(_routingAlgorithm) {
   // ensure the buffer is empty
   assert(buffer_.size() == 0);
@@ -47,6 +49,8 @@ InputQueue::InputQueue(const std::string& _name, const Component* _parent,
   rfe_.flit = nullptr;
   rfe_.route.clear();
   rfe_.route.link(routingAlgorithm_);
+  rfe_.outputPort = U32_MAX;
+  rfe_.outputVc = U32_MAX;
 
   // no event is set to trigger
   eventTime_ = U64_MAX;
@@ -58,39 +62,48 @@ void InputQueue::setDepth(u32 _depth) {
   depth_ = _depth;
 }
 
+void InputQueue::waitingFor(
+    std::vector<std::tuple<u32, u32>>* _outputs) const {
+  if (rfe_.fsm == ePipelineFsm::kWaitingForTransfer) {
+    // waiting for space in the output queue
+    _outputs->push_back(std::make_tuple(rfe_.outputPort, rfe_.outputVc));
+  } else if ((rfe_.flit != nullptr) || !buffer_.empty()) {
+    _outputs->push_back(std::make_tuple(U32_MAX, U32_MAX));
+  }
+}
+
 void InputQueue::receiveFlit(u32 _port, Flit* _flit) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   // 'port' is unused
-  assert(_port == 0);
+  CHECK_HOT(_port == 0);
 
   // make sure this is the right VC (only on head flits)
   //  hyperwarp messes this up for other flits
-  assert(!_flit->isHead() || _flit->getVc() == vc_);
+  CHECK_HOT(!_flit->isHead() || _flit->getVc() == vc_);
 
   // push flit into corresponding buffer
   buffer_.push(_flit);
-  assert(buffer_.size() <= depth_);  // overflow check
+  CHECK_HOT(buffer_.size() <= depth_);  // overflow check
 
   // queue an event to be notified about the injected flit
   //  this synchronized the two clock domains
-  if (gSim->isCycle(Simulator::Clock::ROUTER)) {
+  if (clock_->isCycle()) {
     setPipelineEvent();
   } else {
-    addEvent(gSim->futureCycle(Simulator::Clock::ROUTER, 1), 1, nullptr,
-             INJECTED_FLIT);
+    addEvent(clock_->futureCycle(1), 1, nullptr, INJECTED_FLIT);
   }
 }
 
 void InputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (INJECTED_FLIT):
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       setPipelineEvent();
       break;
 
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 3);
+      CHECK_HOT(gSim->epsilon() == 3);
       processPipeline();
       break;
 
@@ -101,14 +114,16 @@ void InputQueue::processEvent(void* _event, s32 _type) {
 
 void InputQueue::routingAlgorithmResponse(
     RoutingAlgorithm::Response* _response) {
-  assert(rfe_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(rfe_.fsm == ePipelineFsm::kWaitingForResponse);
   rfe_.fsm = ePipelineFsm::kWaitingForTransfer;
-  assert(gSim->epsilon() == 0);
+  CHECK_HOT(gSim->epsilon() == 0);
 
   // retrieve the routing algorithm outputs, randomly select one
   u32 routeIndex = gSim->rnd.nextU64(0, rfe_.route.size() - 1);
   u32 outputPort, outputVc;
   rfe_.route.get(routeIndex, &outputPort, &outputVc);
+  rfe_.outputPort = outputPort;
+  rfe_.outputVc = outputVc;
 
   // inform the routing algorithm of vc scheduled
   routingAlgorithm_->vcScheduled(rfe_.flit, outputPort, outputVc);
@@ -125,8 +140,8 @@ void InputQueue::routingAlgorithmResponse(
 }
 
 void InputQueue::pullPacket(Flit* _headFlit) {
-  assert(rfe_.fsm == ePipelineFsm::kWaitingForTransfer);
-  assert(_headFlit == rfe_.flit);
+  CHECK_HOT(rfe_.fsm == ePipelineFsm::kWaitingForTransfer);
+  CHECK_HOT(_headFlit == rfe_.flit);
 
   // tell the pipeline this packet can proceed
   rfe_.fsm = ePipelineFsm::kReadyToAdvance;
@@ -144,7 +159,7 @@ void InputQueue::setPipelineEvent() {
 
 void InputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::ROUTER) == 0);
+  CHECK_HOT(clock_->isCycle());
 
   /*
    * register the packet with the router core and wait for the pull
@@ -154,6 +169,8 @@ void InputQueue::processPipeline() {
     rfe_.fsm = ePipelineFsm::kEmpty;
     rfe_.flit = nullptr;
     rfe_.route.clear();
+    rfe_.outputPort = U32_MAX;
+    rfe_.outputVc = U32_MAX;
   }
 
   /*
@@ -161,7 +178,7 @@ void InputQueue::processPipeline() {
    */
   if ((rfe_.fsm == ePipelineFsm::kEmpty) && (buffer_.empty() == false)) {
     // ensure RFE is empty
-    assert(rfe_.flit == nullptr);
+    CHECK_HOT(rfe_.flit == nullptr);
 
     // get the front flit
     Flit* flit = buffer_.front();
@@ -169,7 +186,7 @@ void InputQueue::processPipeline() {
     // if store and forward is enabled, make sure the packet could actually fit
     // fully in the queue
     if (storeAndForward_) {
-      assert(depth_ >= flit->packet()->numFlits());
+      CHECK_HOT(depth_ >= flit->packet()->numFlits());
     }
 
     // when store and forward is enabled, wait for the whole packet
@@ -233,7 +250,7 @@ void InputQueue::processPipeline() {
       ((buffer_.size() > 0) &&                        // more flits in buffer
        (rfe_.fsm == ePipelineFsm::kEmpty))) {         // RFE empty
     // set a pipeline event for the next cycle
-    eventTime_ = gSim->futureCycle(Simulator::Clock::ROUTER, 1);
+    eventTime_ = clock_->futureCycle(1);
     addEvent(eventTime_, 3, nullptr, PROCESS_PIPELINE);
   }
 }
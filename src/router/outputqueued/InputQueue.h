@@ -17,8 +17,10 @@
 
 #include <queue>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "event/ClockDomain.h"
 #include "event/Component.h"
 #include "prim/prim.h"
 #include "routing/RoutingAlgorithm.h"
@@ -40,6 +42,10 @@ class InputQueue : public Component,
   // set input queue depth (tailor mode)
   void setDepth(u32 _depth);
 
+  // this adds the output (port, VC) pairs the front packet waits for
+  //  (see Router::waitingFor())
+  void waitingFor(std::vector<std::tuple<u32, u32>>* _outputs) const;
+
   // called by next higher router (FlitReceiver)
   void receiveFlit(u32 _port, Flit* _flit) override;
 
@@ -67,6 +73,7 @@ class InputQueue : public Component,
 
   // external devices
   Router* router_;
+  const ClockDomain* clock_;
   RoutingAlgorithm* routingAlgorithm_;
 
   // state machine to represent the single RFE stage
@@ -92,6 +99,8 @@ class InputQueue : public Component,
     Flit* flit;
     // results
     RoutingAlgorithm::Response route;
+    u32 outputPort;  // the selected route
+    u32 outputVc;
   } rfe_;
 };
 
@@ -21,6 +21,7 @@
 
 #include "router/outputqueued/Router.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 // event types
 #define INJECTED_PACKET (0x33)
@@ -65,13 +66,13 @@ OutputQueue::~OutputQueue() {
 }
 
 void OutputQueue::receivePacket(Packet* _packet) {
-  assert(gSim->epsilon() == 1);
+  CHECK_HOT(gSim->epsilon() == 1);
 
   for (u32 f = 0; f < _packet->numFlits(); f++) {
     Flit* flit = _packet->getFlit(f);
 
     // make sure this is the right VC
-    assert(flit->getVc() == vc_);
+    CHECK_HOT(flit->getVc() == vc_);
 
     // push flit into corresponding buffer
     buffer_.push(flit);
@@ -79,7 +80,7 @@ void OutputQueue::receivePacket(Packet* _packet) {
 
   // ensure sync between virtual space and real space
   if (depth_ != U32_MAX) {
-    assert(buffer_.size() <= occupancy_);
+    CHECK_HOT(buffer_.size() <= occupancy_);
   }
 
   // queue an event to be notified about the injected flit
@@ -95,12 +96,12 @@ void OutputQueue::receivePacket(Packet* _packet) {
 void OutputQueue::processEvent(void* _event, s32 _type) {
   switch (_type) {
     case (INJECTED_PACKET):
-      assert(gSim->epsilon() == 1);
+      CHECK_HOT(gSim->epsilon() == 1);
       setPipelineEvent();
       break;
 
     case (PROCESS_PIPELINE):
-      assert(gSim->epsilon() == 2);
+      CHECK_HOT(gSim->epsilon() == 2);
       processPipeline();
       break;
 
@@ -110,12 +111,12 @@ void OutputQueue::processEvent(void* _event, s32 _type) {
 }
 
 void OutputQueue::crossbarSchedulerResponse(u32 _port, u32 _vc) {
-  assert(swa_.fsm == ePipelineFsm::kWaitingForResponse);
+  CHECK_HOT(swa_.fsm == ePipelineFsm::kWaitingForResponse);
 
   if (_port != U32_MAX) {
     // granted
-    assert(_port == 0);  // only one port here
-    assert(_vc == vc_);  // same VC as this
+    CHECK_HOT(_port == 0);  // only one port here
+    CHECK_HOT(_vc == vc_);  // same VC as this
     swa_.fsm = ePipelineFsm::kReadyToAdvance;
   } else {
     // denied
@@ -131,7 +132,7 @@ void OutputQueue::reserveSpace(u32 _flits) {
 
   // check for overrun if buffers are not infinite
   if (depth_ != U32_MAX) {
-    assert(occupancy_ <= depth_);
+    CHECK_HOT(occupancy_ <= depth_);
   }
 }
 
@@ -153,7 +154,7 @@ void OutputQueue::setPipelineEvent() {
 
 void OutputQueue::processPipeline() {
   // make sure the pipeline is being processed on clock cycle boundaries
-  assert(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
+  CHECK_HOT(gSim->time() % gSim->cycleTime(Simulator::Clock::CHANNEL) == 0);
 
   /*
    * attempt to load the crossbar
@@ -179,12 +180,12 @@ void OutputQueue::processPipeline() {
    */
   if ((swa_.fsm == ePipelineFsm::kEmpty) && (buffer_.empty() == false)) {
     // ensure SWA is empty
-    assert(swa_.flit == nullptr);
+    CHECK_HOT(swa_.flit == nullptr);
 
     // pull out the front flit
     Flit* flit = buffer_.front();
     buffer_.pop();
-    assert(occupancy_ > 0);
+    CHECK_HOT(occupancy_ > 0);
     occupancy_--;
     router_->newSpaceAvailable(port_, vc_);
 
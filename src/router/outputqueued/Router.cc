@@ -25,6 +25,7 @@
 #include "router/outputqueued/InputQueue.h"
 #include "router/outputqueued/OutputQueue.h"
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 #define PROCESS_TRANSFERS (0xC5)
 #define TRANSFER_PACKET (0x12)
@@ -32,7 +33,7 @@
 namespace OutputQueued {
 
 Router::Router(const std::string& _name, const Component* _parent,
-               Network* _network, u32 _id, const std::vector<u32>& _address,
+               Network* _network, u32 _id, const Address& _address,
                u32 _numPorts, u32 _numVcs, MetadataHandler* _metadataHandler,
                nlohmann::json _settings)
     : ::Router(_name, _parent, _network, _id, _address, _numPorts, _numVcs,
@@ -46,7 +47,7 @@ Router::Router(const std::string& _name, const Component* _parent,
   // determine the size of credits
   creditSize_ =
       numVcs_ * (u32)std::ceil((f64)gSim->cycleTime(Simulator::Clock::CHANNEL) /
-                               (f64)gSim->cycleTime(Simulator::Clock::ROUTER));
+                               (f64)clock_->cycleTime());
 
   // initialize the port VCs trackers
   portVcs_.resize(numPorts_, U32_MAX);
@@ -153,13 +154,15 @@ Router::Router(const std::string& _name, const Component* _parent,
         "OutputCrossbarScheduler_" + std::to_string(port);
     outputCrossbarSchedulers_.at(port) = new CrossbarScheduler(
         outputCrossbarSchedulerName, this, numVcs_, numVcs_, 1, port * numVcs_,
-        Simulator::Clock::CHANNEL, _settings["output_crossbar_scheduler"]);
+        gSim->clockDomain(Simulator::Clock::CHANNEL),
+        _settings["output_crossbar_scheduler"]);
 
     // output crossbar
     std::string outputCrossbarName = "OutputCrossbar_" + std::to_string(port);
-    outputCrossbars_.at(port) =
-        new Crossbar(outputCrossbarName, this, numVcs_, 1,
-                     Simulator::Clock::CHANNEL, _settings["output_crossbar"]);
+    outputCrossbars_.at(port) = new Crossbar(
+        outputCrossbarName, this, numVcs_, 1,
+        gSim->clockDomain(Simulator::Clock::CHANNEL),
+        _settings["output_crossbar"]);
 
     // ejector
     std::string ejName = "Ejector_" + std::to_string(port);
@@ -294,12 +297,13 @@ void Router::initialize() {
 }
 
 void Router::receiveFlit(u32 _port, Flit* _flit) {
-  u64& expTime = expTimes_.at(_port);
-  Packet*& expPacket = expPackets_.at(_port);
+  CHECK_HOT(_port < numPorts_);
+  u64& expTime = expTimes_[_port];
+  Packet*& expPacket = expPackets_[_port];
 
   // ensure back-to-back flit transmission
   u64 now = gSim->time();
-  assert((expTime == U64_MAX) || (now == expTime));
+  CHECK_HOT((expTime == U64_MAX) || (now == expTime));
   if (_flit->isTail()) {
     expTime = U64_MAX;
   } else {
@@ -308,10 +312,10 @@ void Router::receiveFlit(u32 _port, Flit* _flit) {
 
   // ensure packet buffer flow control
   if (_flit->isHead()) {
-    assert(expPacket == nullptr);
+    CHECK_HOT(expPacket == nullptr);
     expPacket = _flit->packet();
   } else {
-    assert(expPacket == _flit->packet());
+    CHECK_HOT(expPacket == _flit->packet());
   }
   if (_flit->isTail()) {
     expPacket = nullptr;
@@ -321,13 +325,14 @@ void Router::receiveFlit(u32 _port, Flit* _flit) {
   //  this fixes the symptoms of hyperwarping packets
   u32 vc = _flit->getVc();
   if (_flit->isHead()) {
-    portVcs_.at(_port) = vc;
+    portVcs_[_port] = vc;
   } else {
-    vc = portVcs_.at(_port);
+    vc = portVcs_[_port];
   }
 
   // give the flit to the input queue
-  InputQueue* iq = inputQueues_.at(vcIndex(_port, vc));
+  CHECK_HOT(vc < numVcs_);
+  InputQueue* iq = inputQueues_[vcIndex(_port, vc)];
   iq->receiveFlit(0, _flit);
 
   // inform base class of arrival
@@ -337,9 +342,10 @@ void Router::receiveFlit(u32 _port, Flit* _flit) {
 }
 
 void Router::receiveCredit(u32 _port, Credit* _credit) {
+  CHECK_HOT(_port < numPorts_);
   while (_credit->more()) {
     u32 vc = _credit->getNum();
-    outputCrossbarSchedulers_.at(_port)->incrementCredit(vc);
+    outputCrossbarSchedulers_[_port]->incrementCredit(vc);
 
     if ((congestionMode_ == Router::CongestionMode::kDownstream) ||
         (congestionMode_ == Router::CongestionMode::kOutputAndDownstream)) {
@@ -352,11 +358,12 @@ void Router::receiveCredit(u32 _port, Credit* _credit) {
 
 void Router::sendCredit(u32 _port, u32 _vc) {
   // ensure there is an outgoing credit for the next time slot
-  assert(_vc < numVcs_);
-  Credit* credit = inputChannels_.at(_port)->getNextCredit();
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(_vc < numVcs_);
+  Credit* credit = inputChannels_[_port]->getNextCredit();
   if (credit == nullptr) {
     credit = new Credit(creditSize_);
-    inputChannels_.at(_port)->setNextCredit(credit);
+    inputChannels_[_port]->setNextCredit(credit);
   }
 
   // mark the credit with the specified VC
@@ -364,8 +371,9 @@ void Router::sendCredit(u32 _port, u32 _vc) {
 }
 
 void Router::sendFlit(u32 _port, Flit* _flit) {
-  assert(outputChannels_.at(_port)->getNextFlit() == nullptr);
-  outputChannels_.at(_port)->setNextFlit(_flit);
+  CHECK_HOT(_port < numPorts_);
+  CHECK_HOT(outputChannels_[_port]->getNextFlit() == nullptr);
+  outputChannels_[_port]->setNextFlit(_flit);
 
   // inform base class of departure
   if (_flit->isHead()) {
@@ -379,16 +387,35 @@ f64 Router::congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                                    _outputVc);
 }
 
+f64 Router::portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                                 u32 _outputPort) const {
+  if (portCongestionResolution()) {
+    return congestionSensor_->portStatus(_inputPort, _inputVc, _outputPort);
+  }
+  return ::Router::portCongestionStatus(_inputPort, _inputVc, _outputPort);
+}
+
+bool Router::portCongestionResolution() const {
+  return congestionSensor_->resolution() ==
+      CongestionSensor::Resolution::kPort;
+}
+
+void Router::waitingFor(u32 _inputPort, u32 _inputVc,
+                        std::vector<std::tuple<u32, u32>>* _outputs) const {
+  inputQueues_.at(vcIndex(_inputPort, _inputVc))->waitingFor(_outputs);
+}
+
 void Router::registerPacket(u32 _inputPort, u32 _inputVc, Flit* _headFlit,
                             u32 _outputPort, u32 _outputVc) {
-  assert(gSim->epsilon() == 0);
-  assert(_headFlit->packet()->numFlits() <= outputQueueDepth_);
+  CHECK_HOT(gSim->epsilon() == 0);
+  CHECK_HOT(_headFlit->packet()->numFlits() <= outputQueueDepth_);
 
   // get the output queue index
   u32 outputVcIdx = vcIndex(_outputPort, _outputVc);
+  CHECK_HOT(outputVcIdx < waiting_.size());
 
   // put the packet in the waiting list for this
-  waiting_.at(outputVcIdx)
+  waiting_[outputVcIdx]
       .push(std::make_tuple(_inputPort, _inputVc, _headFlit, _outputPort,
                             _outputVc));
 
@@ -422,30 +449,31 @@ void Router::processEvent(void* _event, s32 _type) {
 }
 
 void Router::processTransfers(u32 _outputVcIdx) {
-  assert(gSim->epsilon() == 2);
+  CHECK_HOT(gSim->epsilon() == 2);
+  CHECK_HOT(_outputVcIdx < waiting_.size());
 
   while (true) {
     // see if there is any waiting packets
-    if (waiting_.at(_outputVcIdx).empty()) {
+    if (waiting_[_outputVcIdx].empty()) {
       // nothing to do, just be done
       break;
     }
 
     // get the next waiting packet
     const std::tuple<u32, u32, Flit*, u32, u32> next =
-        waiting_.at(_outputVcIdx).front();
+        waiting_[_outputVcIdx].front();
 
     // determine if it can fit in the output queue
     Flit* headFlit = std::get<2>(next);
     Packet* packet = headFlit->packet();
     u32 pktSize = packet->numFlits();
-    u32 space = outputQueues_.at(_outputVcIdx)->spaceAvailable();
+    u32 space = outputQueues_[_outputVcIdx]->spaceAvailable();
     bool canFit = pktSize <= space;
 
     // if the packet fits, pop and schedule injection, otherwise be done
     if (canFit) {
       // reserve the space
-      outputQueues_.at(_outputVcIdx)->reserveSpace(pktSize);
+      outputQueues_[_outputVcIdx]->reserveSpace(pktSize);
 
       // change VCs and decrement congestion status credits if needed
       u32 outputVc = std::get<4>(next);
@@ -463,15 +491,15 @@ void Router::processTransfers(u32 _outputVcIdx) {
 
       // determine the time of arrival at the output queue
       //  enqueue an event to inject the packet
-      u64 time = gSim->futureCycle(Simulator::Clock::ROUTER, transferLatency_);
+      u64 time = clock_->futureCycle(transferLatency_);
       addEvent(time, 1, packet, static_cast<s32>(_outputVcIdx));
 
       // inform the input queue
       u32 inputVcIdx = vcIndex(std::get<0>(next), std::get<1>(next));
-      inputQueues_.at(inputVcIdx)->pullPacket(headFlit);
+      inputQueues_[inputVcIdx]->pullPacket(headFlit);
 
       // pop the packet out of the waiting list
-      waiting_.at(_outputVcIdx).pop();
+      waiting_[_outputVcIdx].pop();
     } else {
       break;
     }
@@ -479,8 +507,9 @@ void Router::processTransfers(u32 _outputVcIdx) {
 }
 
 void Router::transferPacket(u32 _outputVcIdx, Packet* _packet) {
-  assert(gSim->epsilon() == 1);
-  outputQueues_.at(_outputVcIdx)->receivePacket(_packet);
+  CHECK_HOT(gSim->epsilon() == 1);
+  CHECK_HOT(_outputVcIdx < outputQueues_.size());
+  outputQueues_[_outputVcIdx]->receivePacket(_packet);
 }
 
 Router::CongestionMode Router::parseCongestionMode(const std::string& _mode) {
@@ -30,6 +30,7 @@
 #include "prim/prim.h"
 #include "router/Router.h"
 #include "routing/RoutingAlgorithm.h"
+#include "types/Address.h"
 #include "types/Credit.h"
 #include "types/Flit.h"
 
@@ -44,7 +45,7 @@ class Ejector;
 class Router : public ::Router {
  public:
   Router(const std::string& _name, const Component* _parent, Network* _network,
-         u32 _id, const std::vector<u32>& _address, u32 _numPorts, u32 _numVcs,
+         u32 _id, const Address& _address, u32 _numPorts, u32 _numVcs,
          MetadataHandler* _metadataHandler, nlohmann::json _settings);
   ~Router();
 
@@ -65,6 +66,12 @@ class Router : public ::Router {
 
   f64 congestionStatus(u32 _inputPort, u32 _inputVc, u32 _outputPort,
                        u32 _outputVc) const override;
+  f64 portCongestionStatus(u32 _inputPort, u32 _inputVc,
+                           u32 _outputPort) const override;
+  bool portCongestionResolution() const override;
+
+  void waitingFor(u32 _inputPort, u32 _inputVc,
+                  std::vector<std::tuple<u32, u32>>* _outputs) const override;
 
   // only called on epsilon 0 from IQ
   void registerPacket(u32 _inputPort, u32 _inputVc, Flit* _headFlit,
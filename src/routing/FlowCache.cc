@@ -0,0 +1,77 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "routing/FlowCache.h"
+
+#include <cassert>
+
+FlowCache::FlowCache(u32 _sets, u32 _ways)
+    : sets_(_sets), ways_(_ways), entries_(_sets * _ways, {0, 0, 0}),
+      clock_(0), size_(0) {
+  assert(sets_ > 0);
+  assert(ways_ > 0);
+}
+
+FlowCache::~FlowCache() {}
+
+u32 FlowCache::capacity() const {
+  return sets_ * ways_;
+}
+
+u32 FlowCache::size() const {
+  return size_;
+}
+
+bool FlowCache::lookup(u64 _key, u64* _value) {
+  Entry* entries = set(_key);
+  for (u32 way = 0; way < ways_; way++) {
+    if (entries[way].lastUse != 0 && entries[way].key == _key) {
+      entries[way].lastUse = ++clock_;
+      *_value = entries[way].value;
+      return true;
+    }
+  }
+  return false;
+}
+
+void FlowCache::insert(u64 _key, u64 _value) {
+  Entry* entries = set(_key);
+  Entry* victim = &entries[0];
+  for (u32 way = 0; way < ways_; way++) {
+    if (entries[way].lastUse != 0 && entries[way].key == _key) {
+      // update
+      victim = &entries[way];
+      break;
+    }
+    if (entries[way].lastUse < victim->lastUse) {
+      // invalid entries have the oldest use
+      victim = &entries[way];
+    }
+  }
+  if (victim->lastUse == 0) {
+    size_++;
+  }
+  victim->key = _key;
+  victim->value = _value;
+  victim->lastUse = ++clock_;
+}
+
+FlowCache::Entry* FlowCache::set(u64 _key) {
+  // mix the key so that similar flows spread across the sets
+  u64 hash = _key;
+  hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+  hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+  hash = hash ^ (hash >> 31);
+  return &entries_[(hash % sets_) * ways_];
+}
@@ -0,0 +1,58 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ROUTING_FLOWCACHE_H_
+#define ROUTING_FLOWCACHE_H_
+
+#include <vector>
+
+#include "prim/prim.h"
+
+/*
+ * This is a fixed size, set associative cache that maps flow keys to values.
+ *  Its memory is bounded by sets * ways entries regardless of how many flows
+ *  pass through it. Within a set, the least recently used entry is replaced.
+ */
+class FlowCache {
+ public:
+  FlowCache(u32 _sets, u32 _ways);
+  ~FlowCache();
+
+  u32 capacity() const;
+  u32 size() const;
+
+  // this returns true and sets the value if the key is present
+  bool lookup(u64 _key, u64* _value);
+
+  // this adds or updates a key, evicting the least recently used entry of
+  //  the key's set if needed
+  void insert(u64 _key, u64 _value);
+
+ private:
+  struct Entry {
+    u64 key;
+    u64 value;
+    u64 lastUse;  // 0 is invalid
+  };
+
+  Entry* set(u64 _key);
+
+  const u32 sets_;
+  const u32 ways_;
+  std::vector<Entry> entries_;
+  u64 clock_;
+  u32 size_;
+};
+
+#endif  // ROUTING_FLOWCACHE_H_
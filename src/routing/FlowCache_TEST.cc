@@ -0,0 +1,68 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "routing/FlowCache.h"
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(FlowCache, hitMiss) {
+  FlowCache cache(4, 2);
+  ASSERT_EQ(cache.capacity(), 8u);
+  ASSERT_EQ(cache.size(), 0u);
+
+  u64 value = 0;
+  ASSERT_FALSE(cache.lookup(100, &value));
+  cache.insert(100, 7);
+  ASSERT_TRUE(cache.lookup(100, &value));
+  ASSERT_EQ(value, 7u);
+  ASSERT_EQ(cache.size(), 1u);
+
+  // updates don't add entries
+  cache.insert(100, 9);
+  ASSERT_TRUE(cache.lookup(100, &value));
+  ASSERT_EQ(value, 9u);
+  ASSERT_EQ(cache.size(), 1u);
+}
+
+TEST(FlowCache, bounded) {
+  FlowCache cache(16, 4);
+  for (u64 key = 0; key < 10000; key++) {
+    cache.insert(key, key * 3);
+    ASSERT_LE(cache.size(), cache.capacity());
+  }
+  ASSERT_EQ(cache.size(), cache.capacity());
+
+  // the most recent key of any set is always present
+  u64 value = 0;
+  ASSERT_TRUE(cache.lookup(9999, &value));
+  ASSERT_EQ(value, 9999u * 3);
+}
+
+TEST(FlowCache, leastRecentlyUsed) {
+  // a single set makes the replacement order observable
+  FlowCache cache(1, 3);
+  cache.insert(1, 1);
+  cache.insert(2, 2);
+  cache.insert(3, 3);
+
+  u64 value = 0;
+  ASSERT_TRUE(cache.lookup(1, &value));  // 2 is now the oldest
+  cache.insert(4, 4);
+  ASSERT_FALSE(cache.lookup(2, &value));
+  ASSERT_TRUE(cache.lookup(1, &value));
+  ASSERT_TRUE(cache.lookup(3, &value));
+  ASSERT_TRUE(cache.lookup(4, &value));
+  ASSERT_EQ(cache.size(), 3u);
+}
@@ -18,6 +18,7 @@
 
 #include "event/Simulator.h"
 #include "router/Router.h"
+#include "types/Packet.h"
 
 /* RoutingAlgorithm::Response class */
 
@@ -68,11 +69,22 @@ RoutingAlgorithm::RoutingAlgorithm(const std::string& _name,
       numVcs_(_numVcs),
       inputPort_(_inputPort),
       inputVc_(_inputVc),
-      latency_(_settings["latency"].get<u32>()) {
+      latency_(_settings["latency"].get<u32>()),
+      congestionMarking_(false),
+      congestionMarkThreshold_(F64_POS_INF) {
   assert(router_ != nullptr);
   assert(latency_ > 0);
   assert(numVcs_ <= router_->numVcs());
   assert(baseVc_ <= router_->numVcs() - numVcs_);
+
+  // optional congestion marking for endpoint congestion control
+  if (_settings.contains("congestion_mark_threshold") &&
+      !_settings["congestion_mark_threshold"].is_null()) {
+    congestionMarking_ = true;
+    congestionMarkThreshold_ =
+        _settings["congestion_mark_threshold"].get<f64>();
+    assert(congestionMarkThreshold_ >= 0.0);
+  }
 }
 
 RoutingAlgorithm::~RoutingAlgorithm() {}
@@ -99,7 +111,7 @@ u32 RoutingAlgorithm::inputVc() const {
 
 void RoutingAlgorithm::request(Client* _client, Flit* _flit,
                                Response* _response) {
-  u64 respTime = gSim->futureCycle(Simulator::Clock::ROUTER, latency_);
+  u64 respTime = router_->clockDomain()->futureCycle(latency_);
   EventPackage* evt = new EventPackage();
   evt->client = _client;
   evt->flit = _flit;
@@ -112,6 +124,25 @@ void RoutingAlgorithm::vcScheduled(Flit* _flit, u32 _port, u32 _vc) {}
 void RoutingAlgorithm::processEvent(void* _event, s32 _type) {
   EventPackage* evt = reinterpret_cast<EventPackage*>(_event);
   processRequest(evt->flit, evt->response);
+  if (congestionMarking_) {
+    markCongestion(evt->flit, evt->response);
+  }
   evt->client->routingAlgorithmResponse(evt->response);
   delete evt;
 }
+
+void RoutingAlgorithm::markCongestion(Flit* _flit,
+                                      const Response* _response) const {
+  f64 minStatus = F64_POS_INF;
+  for (u32 idx = 0; idx < _response->size(); idx++) {
+    u32 port, vc;
+    _response->get(idx, &port, &vc);
+    f64 status = router_->congestionStatus(inputPort_, inputVc_, port, vc);
+    if (status < minStatus) {
+      minStatus = status;
+    }
+  }
+  if (minStatus >= congestionMarkThreshold_) {
+    _flit->packet()->setCongestionMark(true);
+  }
+}
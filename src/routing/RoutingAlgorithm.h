@@ -88,6 +88,10 @@ class RoutingAlgorithm : public Component {
  protected:
   virtual void processRequest(Flit* _flit, Response* _response) = 0;
 
+  // this marks the packet as congested when all route options exceed the
+  //  congestion mark threshold
+  void markCongestion(Flit* _flit, const Response* _response) const;
+
   Router* router_;
   const u32 baseVc_;
   const u32 numVcs_;
@@ -103,6 +107,8 @@ class RoutingAlgorithm : public Component {
   };
 
   const u32 latency_;
+  bool congestionMarking_;
+  f64 congestionMarkThreshold_;
 };
 
 #endif  // ROUTING_ROUTINGALGORITHM_H_
@@ -21,16 +21,15 @@
 
 f64 averagePortCongestion(const Router* _router, u32 _inputPort, u32 _inputVc,
                           u32 _outputPort) {
-  const u32 numVcs = _router->numVcs();
-  f64 sum = 0;
-  for (u32 vc = 0; vc < numVcs; vc++) {
-    sum += _router->congestionStatus(_inputPort, _inputVc, _outputPort, vc);
-  }
-  return sum / numVcs;
+  return _router->portCongestionStatus(_inputPort, _inputVc, _outputPort);
 }
 
 f64 minimumPortCongestion(const Router* _router, u32 _inputPort, u32 _inputVc,
                           u32 _outputPort) {
+  // all VCs of a port resolution sensor report the port's status
+  if (_router->portCongestionResolution()) {
+    return _router->portCongestionStatus(_inputPort, _inputVc, _outputPort);
+  }
   const u32 numVcs = _router->numVcs();
   f64 minimum = F64_POS_INF;
   for (u32 vc = 0; vc < numVcs; vc++) {
@@ -42,6 +41,10 @@ f64 minimumPortCongestion(const Router* _router, u32 _inputPort, u32 _inputVc,
 
 f64 maximumPortCongestion(const Router* _router, u32 _inputPort, u32 _inputVc,
                           u32 _outputPort) {
+  // all VCs of a port resolution sensor report the port's status
+  if (_router->portCongestionResolution()) {
+    return _router->portCongestionStatus(_inputPort, _inputVc, _outputPort);
+  }
   const u32 numVcs = _router->numVcs();
   f64 maximum = F64_NEG_INF;
   for (u32 vc = 0; vc < numVcs; vc++) {
@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 DimBisectionStressCTP::DimBisectionStressCTP(const std::string& _name,
                                              const Component* _parent,
@@ -47,7 +48,7 @@ DimBisectionStressCTP::DimBisectionStressCTP(const std::string& _name,
   }
 
   // get self as a vector address
-  std::vector<u32> addr;
+  Address addr;
   Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                       interfacePorts, &addr);
 
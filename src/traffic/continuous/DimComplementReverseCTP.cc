@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 DimComplementReverseCTP::DimComplementReverseCTP(const std::string& _name,
                                                  const Component* _parent,
@@ -46,7 +47,7 @@ DimComplementReverseCTP::DimComplementReverseCTP(const std::string& _name,
   }
 
   // get self as a vector address
-  std::vector<u32> addr;
+  Address addr;
   Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                       interfacePorts, &addr);
 
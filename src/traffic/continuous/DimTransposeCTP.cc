@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 DimTransposeCTP::DimTransposeCTP(const std::string& _name,
                                  const Component* _parent, u32 _numTerminals,
@@ -69,7 +70,7 @@ DimTransposeCTP::DimTransposeCTP(const std::string& _name,
   assert(widths.at(workingDims.at(0)) == widths.at(workingDims.at(1)));
 
   // get self as a vector address
-  std::vector<u32> addr;
+  Address addr;
   Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                       interfacePorts, &addr);
 
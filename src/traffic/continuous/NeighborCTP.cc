@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 NeighborCTP::NeighborCTP(const std::string& _name, const Component* _parent,
                          u32 _numTerminals, u32 _self, nlohmann::json _settings)
@@ -55,7 +56,7 @@ NeighborCTP::NeighborCTP(const std::string& _name, const Component* _parent,
   std::string dir = _settings["direction"].get<std::string>();
 
   // get self as a vector address
-  std::vector<u32> addr;
+  Address addr;
   Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                       interfacePorts, &addr);
 
@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 RandomExchangeNeighborCTP::RandomExchangeNeighborCTP(const std::string& _name,
                                                      const Component* _parent,
@@ -63,7 +64,7 @@ RandomExchangeNeighborCTP::RandomExchangeNeighborCTP(const std::string& _name,
   const u32 interfacesPerRouter = concentration / interfacePorts;
   for (u32 dim = 0; dim < dimensions; ++dim) {
     if (dimMask.at(dim)) {
-      std::vector<u32> addr;
+      Address addr;
       // get self as a vector address
       Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                           interfacePorts, &addr);
@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 Swap2CTP::Swap2CTP(const std::string& _name, const Component* _parent,
                    u32 _numTerminals, u32 _self, nlohmann::json _settings)
@@ -67,7 +68,7 @@ Swap2CTP::Swap2CTP(const std::string& _name, const Component* _parent,
   }
 
   // get self as a vector address
-  std::vector<u32> addr;
+  Address addr;
   Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                       interfacePorts, &addr);
 
@@ -19,6 +19,7 @@
 
 #include "factory/ObjectFactory.h"
 #include "network/cube/util.h"
+#include "types/Address.h"
 
 UniformRandomQuadrantCTP::UniformRandomQuadrantCTP(const std::string& _name,
                                                    const Component* _parent,
@@ -47,7 +48,7 @@ UniformRandomQuadrantCTP::UniformRandomQuadrantCTP(const std::string& _name,
     assert(widths.at(i) % 2 == 0);
   }
 
-  std::vector<u32> addr;
+  Address addr;
   // get self as a vector address
   Cube::translateInterfaceIdToAddress(self_, widths, concentration,
                                       interfacePorts, &addr);
@@ -60,7 +61,7 @@ UniformRandomQuadrantCTP::UniformRandomQuadrantCTP(const std::string& _name,
   }
 
   for (u32 dstIdx = 0; dstIdx < numTerminals_; ++dstIdx) {
-    std::vector<u32> dstAddr;
+    Address dstAddr;
     Cube::translateInterfaceIdToAddress(dstIdx, widths, concentration,
                                         interfacePorts, &dstAddr);
     u32 dstQuadrant = 0;
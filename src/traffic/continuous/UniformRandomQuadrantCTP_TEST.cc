@@ -24,6 +24,7 @@
 #include "prim/prim.h"
 #include "strop/strop.h"
 #include "test/TestSetup_TESTLIB.h"
+#include "types/Address.h"
 
 TEST(UniformRandomQuadrantCTP, evenSpread) {
   TestSetup test(1, 1, 1, 1, 0xBAADF00D);
@@ -65,7 +66,7 @@ TEST(UniformRandomQuadrantCTP, evenSpread) {
     }
 
     u32 idxQuadrant = 0;
-    std::vector<u32> idxAddr;
+    Address idxAddr;
     Cube::translateInterfaceIdToAddress(idx, widths, concentration,
                                         interfacePorts, &idxAddr);
     for (u32 i = 0; i < dimensions; ++i) {
@@ -78,7 +79,7 @@ TEST(UniformRandomQuadrantCTP, evenSpread) {
     f64 sum = 0;
     for (u32 bkt = 0; bkt < numTerminals; bkt++) {
       u32 bktQuadrant = 0;
-      std::vector<u32> bktAddr;
+      Address bktAddr;
       Cube::translateInterfaceIdToAddress(bkt, widths, concentration,
                                           interfacePorts, &bktAddr);
       for (u32 i = 0; i < dimensions; ++i) {
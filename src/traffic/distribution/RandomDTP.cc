@@ -39,24 +39,26 @@ u32 RandomDTP::size() const {
 }
 
 u32 RandomDTP::nextDestination() {
-  assert(!destinations_.empty());
-  u32 dest = destinations_.back();
-  destinations_.pop_back();
+  assert(!complete());
+  u32 dest = permutation_.at(next_);
+  next_++;
+
+  // without self, the permutation skips over self
+  if (!sendToSelf_ && dest >= self_) {
+    dest++;
+  }
   return dest;
 }
 
 bool RandomDTP::complete() const {
-  return destinations_.empty();
+  return next_ == size();
 }
 
 void RandomDTP::reset() {
-  destinations_.clear();
-  for (u32 dest = 0; dest < numTerminals_; dest++) {
-    if (sendToSelf_ || dest != self_) {
-      destinations_.push_back(dest);
-    }
+  next_ = 0;
+  if (size() > 0) {
+    permutation_.reset(size(), gSim->rnd.nextU64(0, U32_MAX));
   }
-  gSim->rnd.shuffle(&destinations_);
 }
 
 registerWithObjectFactory("random", DistributionTrafficPattern, RandomDTP,
@@ -16,12 +16,17 @@
 #define TRAFFIC_DISTRIBUTION_RANDOMDTP_H_
 
 #include <string>
-#include <vector>
 
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "traffic/distribution/DistributionTrafficPattern.h"
+#include "util/Permutation.h"
 
+/*
+ * This sends to every destination once in a random order. The order is a lazy
+ *  permutation, thus the state per terminal is constant in the number of
+ *  terminals.
+ */
 class RandomDTP : public DistributionTrafficPattern {
  public:
   RandomDTP(const std::string& _name, const Component* _parent,
@@ -35,7 +40,8 @@ class RandomDTP : public DistributionTrafficPattern {
 
  private:
   bool sendToSelf_;
-  std::vector<u32> destinations_;
+  Permutation permutation_;
+  u32 next_;
 };
 
 #endif  // TRAFFIC_DISTRIBUTION_RANDOMDTP_H_
@@ -0,0 +1,47 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/BimodalTD.h"
+
+#include <cassert>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+
+BimodalTD::BimodalTD(const std::string& _name, const Component* _parent,
+                     nlohmann::json _settings)
+    : TimeDistribution(_name, _parent, _settings),
+      lowTime_(_settings["low_time"].get<u64>()),
+      highTime_(_settings["high_time"].get<u64>()),
+      highProbability_(_settings["high_probability"].get<f64>()) {
+  assert(lowTime_ <= highTime_);
+  assert(highProbability_ >= 0.0 && highProbability_ <= 1.0);
+}
+
+BimodalTD::~BimodalTD() {}
+
+f64 BimodalTD::meanTime() const {
+  return ((1.0 - highProbability_) * lowTime_) + (highProbability_ * highTime_);
+}
+
+u64 BimodalTD::nextTime() {
+  if (gSim->rnd.nextF64() < highProbability_) {
+    return highTime_;
+  } else {
+    return lowTime_;
+  }
+}
+
+registerWithObjectFactory("bimodal", TimeDistribution, BimodalTD,
+                          TIMEDISTRIBUTION_ARGS);
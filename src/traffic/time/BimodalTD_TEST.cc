@@ -0,0 +1,50 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/BimodalTD.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "test/TestSetup_TESTLIB.h"
+#include "traffic/time/TimeDistribution.h"
+
+TEST(BimodalTD, simple) {
+  TestSetup ts(123, 123, 123, 123, 123);
+
+  const u64 LOW = 10;
+  const u64 HIGH = 1000;
+  const f64 PROB = 0.05;
+
+  nlohmann::json settings;
+  settings["type"] = "bimodal";
+  settings["low_time"] = LOW;
+  settings["high_time"] = HIGH;
+  settings["high_probability"] = PROB;
+
+  TimeDistribution* td = TimeDistribution::create("td", nullptr, settings);
+  ASSERT_NEAR(td->meanTime(), (1.0 - PROB) * LOW + PROB * HIGH, 1e-9);
+
+  const u32 ROUNDS = 1000000;
+  u32 highs = 0;
+  for (u32 round = 0; round < ROUNDS; round++) {
+    u64 time = td->nextTime();
+    ASSERT_TRUE(time == LOW || time == HIGH);
+    if (time == HIGH) {
+      highs++;
+    }
+  }
+  ASSERT_NEAR((f64)highs / ROUNDS, PROB, 0.001);
+
+  delete td;
+}
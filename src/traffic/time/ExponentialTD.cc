@@ -0,0 +1,44 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/ExponentialTD.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+
+ExponentialTD::ExponentialTD(const std::string& _name,
+                             const Component* _parent,
+                             nlohmann::json _settings)
+    : TimeDistribution(_name, _parent, _settings),
+      mean_(_settings["mean"].get<f64>()) {
+  assert(mean_ >= 0.0);
+}
+
+ExponentialTD::~ExponentialTD() {}
+
+f64 ExponentialTD::meanTime() const {
+  return mean_;
+}
+
+u64 ExponentialTD::nextTime() {
+  // inverse transform sampling, 1-U avoids log(0)
+  f64 rnd = 1.0 - gSim->rnd.nextF64();
+  return (u64)std::round(-mean_ * std::log(rnd));
+}
+
+registerWithObjectFactory("exponential", TimeDistribution, ExponentialTD,
+                          TIMEDISTRIBUTION_ARGS);
@@ -0,0 +1,50 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/ExponentialTD.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "test/TestSetup_TESTLIB.h"
+#include "traffic/time/TimeDistribution.h"
+
+TEST(ExponentialTD, mean) {
+  TestSetup ts(123, 123, 123, 123, 123);
+
+  const f64 MEAN = 250.0;
+
+  nlohmann::json settings;
+  settings["type"] = "exponential";
+  settings["mean"] = MEAN;
+
+  TimeDistribution* td = TimeDistribution::create("td", nullptr, settings);
+  ASSERT_EQ(td->meanTime(), MEAN);
+
+  const u32 ROUNDS = 1000000;
+  f64 sum = 0.0;
+  u32 aboveMean = 0;
+  for (u32 round = 0; round < ROUNDS; round++) {
+    u64 time = td->nextTime();
+    sum += time;
+    if (time > MEAN) {
+      aboveMean++;
+    }
+  }
+  ASSERT_NEAR(sum / ROUNDS, MEAN, MEAN * 0.01);
+
+  // P(X > mean) = 1/e
+  ASSERT_NEAR((f64)aboveMean / ROUNDS, 0.3679, 0.005);
+
+  delete td;
+}
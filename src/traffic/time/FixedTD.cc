@@ -0,0 +1,39 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/FixedTD.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+
+FixedTD::FixedTD(const std::string& _name, const Component* _parent,
+                 nlohmann::json _settings)
+    : TimeDistribution(_name, _parent, _settings),
+      time_(_settings["time"].get<u64>()) {
+  assert(_settings.contains("time"));
+}
+
+FixedTD::~FixedTD() {}
+
+f64 FixedTD::meanTime() const {
+  return (f64)time_;
+}
+
+u64 FixedTD::nextTime() {
+  return time_;
+}
+
+registerWithObjectFactory("fixed", TimeDistribution, FixedTD,
+                          TIMEDISTRIBUTION_ARGS);
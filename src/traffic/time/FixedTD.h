@@ -0,0 +1,37 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TRAFFIC_TIME_FIXEDTD_H_
+#define TRAFFIC_TIME_FIXEDTD_H_
+
+#include <string>
+
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "traffic/time/TimeDistribution.h"
+
+class FixedTD : public TimeDistribution {
+ public:
+  FixedTD(const std::string& _name, const Component* _parent,
+          nlohmann::json _settings);
+  ~FixedTD();
+
+  f64 meanTime() const override;
+  u64 nextTime() override;
+
+ private:
+  const u64 time_;
+};
+
+#endif  // TRAFFIC_TIME_FIXEDTD_H_
@@ -0,0 +1,36 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/FixedTD.h"
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "test/TestSetup_TESTLIB.h"
+#include "traffic/time/TimeDistribution.h"
+
+TEST(FixedTD, simple) {
+  TestSetup ts(123, 123, 123, 123, 123);
+
+  nlohmann::json settings;
+  settings["type"] = "fixed";
+  settings["time"] = 37;
+
+  TimeDistribution* td = TimeDistribution::create("td", nullptr, settings);
+  ASSERT_EQ(td->meanTime(), 37.0);
+  for (u32 round = 0; round < 1000; round++) {
+    ASSERT_EQ(td->nextTime(), 37u);
+  }
+
+  delete td;
+}
@@ -0,0 +1,46 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/LognormalTD.h"
+
+#include <cassert>
+#include <cmath>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+
+LognormalTD::LognormalTD(const std::string& _name, const Component* _parent,
+                         nlohmann::json _settings)
+    : TimeDistribution(_name, _parent, _settings),
+      mu_(_settings["mu"].get<f64>()),
+      sigma_(_settings["sigma"].get<f64>()) {
+  assert(sigma_ >= 0.0);
+}
+
+LognormalTD::~LognormalTD() {}
+
+f64 LognormalTD::meanTime() const {
+  return std::exp(mu_ + ((sigma_ * sigma_) / 2.0));
+}
+
+u64 LognormalTD::nextTime() {
+  // Box-Muller transform to generate a standard normal, 1-U avoids log(0)
+  f64 u1 = 1.0 - gSim->rnd.nextF64();
+  f64 u2 = gSim->rnd.nextF64();
+  f64 z = std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2);
+  return (u64)std::round(std::exp(mu_ + sigma_ * z));
+}
+
+registerWithObjectFactory("lognormal", TimeDistribution, LognormalTD,
+                          TIMEDISTRIBUTION_ARGS);
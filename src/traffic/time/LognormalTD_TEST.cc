@@ -0,0 +1,53 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/LognormalTD.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "nlohmann/json.hpp"
+#include "test/TestSetup_TESTLIB.h"
+#include "traffic/time/TimeDistribution.h"
+
+TEST(LognormalTD, mean) {
+  TestSetup ts(123, 123, 123, 123, 123);
+
+  const f64 MU = 5.0;
+  const f64 SIGMA = 0.5;
+
+  nlohmann::json settings;
+  settings["type"] = "lognormal";
+  settings["mu"] = MU;
+  settings["sigma"] = SIGMA;
+
+  TimeDistribution* td = TimeDistribution::create("td", nullptr, settings);
+  f64 mean = std::exp(MU + (SIGMA * SIGMA) / 2.0);
+  ASSERT_NEAR(td->meanTime(), mean, 1e-9);
+
+  const u32 ROUNDS = 1000000;
+  f64 sum = 0.0;
+  u32 belowMedian = 0;
+  for (u32 round = 0; round < ROUNDS; round++) {
+    u64 time = td->nextTime();
+    sum += time;
+    if (time < std::exp(MU)) {
+      belowMedian++;
+    }
+  }
+  ASSERT_NEAR(sum / ROUNDS, mean, mean * 0.01);
+  ASSERT_NEAR((f64)belowMedian / ROUNDS, 0.5, 0.01);
+
+  delete td;
+}
@@ -0,0 +1,45 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "traffic/time/TimeDistribution.h"
+
+#include <cassert>
+
+#include "factory/ObjectFactory.h"
+
+TimeDistribution::TimeDistribution(const std::string& _name,
+                                   const Component* _parent,
+                                   nlohmann::json _settings)
+    : Component(_name, _parent) {}
+
+TimeDistribution::~TimeDistribution() {}
+
+TimeDistribution* TimeDistribution::create(const std::string& _name,
+                                           const Component* _parent,
+                                           nlohmann::json _settings) {
+  // retrieve the type
+  const std::string& type = _settings["type"].get<std::string>();
+
+  // attempt to build the time distribution
+  TimeDistribution* td =
+      factory::ObjectFactory<TimeDistribution, TIMEDISTRIBUTION_ARGS>::create(
+          type, _name, _parent, _settings);
+
+  // check that the factory had this type
+  if (td == nullptr) {
+    fprintf(stderr, "unknown time distribution type: %s\n", type.c_str());
+    assert(false);
+  }
+  return td;
+}
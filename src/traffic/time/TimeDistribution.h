@@ -0,0 +1,43 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TRAFFIC_TIME_TIMEDISTRIBUTION_H_
+#define TRAFFIC_TIME_TIMEDISTRIBUTION_H_
+
+#include <string>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+
+#define TIMEDISTRIBUTION_ARGS \
+  const std::string&, const Component*, nlohmann::json
+
+class TimeDistribution : public Component {
+ public:
+  TimeDistribution(const std::string& _name, const Component* _parent,
+                   nlohmann::json _settings);
+  virtual ~TimeDistribution();
+
+  // this is the time distribution factory
+  static TimeDistribution* create(TIMEDISTRIBUTION_ARGS);
+
+  // the expected value of the distribution (cycles)
+  virtual f64 meanTime() const = 0;
+
+  // generates a new time (cycles)
+  virtual u64 nextTime() = 0;
+};
+
+#endif  // TRAFFIC_TIME_TIMEDISTRIBUTION_H_
@@ -0,0 +1,87 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "types/Address.h"
+
+#include <algorithm>
+
+const u32 Address::kMaxDimensions;
+const u32 Address::kCapacity;
+
+Address::Address() : size_(0) {}
+
+Address::Address(u32 _size, u32 _value) : size_(0) {
+  resize(_size, _value);
+}
+
+Address::Address(std::initializer_list<u32> _elements) : size_(0) {
+  CHECK_STRUCTURAL(_elements.size() <= kCapacity);
+  for (u32 element : _elements) {
+    elements_[size_++] = element;
+  }
+}
+
+Address::Address(const std::vector<u32>& _elements) : size_(0) {
+  CHECK_STRUCTURAL(_elements.size() <= kCapacity);
+  for (u32 element : _elements) {
+    elements_[size_++] = element;
+  }
+}
+
+std::vector<u32> Address::toVector() const {
+  return std::vector<u32>(begin(), end());
+}
+
+std::string Address::toString(char _delim) const {
+  std::string str;
+  for (u32 i = 0; i < size_; i++) {
+    if (i > 0) {
+      str += _delim;
+    }
+    str += std::to_string(elements_[i]);
+  }
+  return str;
+}
+
+void Address::resize(u32 _size, u32 _value) {
+  CHECK_STRUCTURAL(_size <= kCapacity);
+  for (u32 i = size_; i < _size; i++) {
+    elements_[i] = _value;
+  }
+  size_ = _size;
+}
+
+void Address::clear() {
+  size_ = 0;
+}
+
+void Address::push_back(u32 _element) {
+  CHECK_STRUCTURAL(size_ < kCapacity);
+  elements_[size_++] = _element;
+}
+
+bool Address::operator<(const Address& _other) const {
+  return std::lexicographical_compare(begin(), end(), _other.begin(),
+                                      _other.end());
+}
+
+u64 Address::hash() const {
+  // FNV-1a over the size and the used elements
+  u64 hash = 0xCBF29CE484222325ull;
+  hash = (hash ^ size_) * 0x100000001B3ull;
+  for (u32 i = 0; i < size_; i++) {
+    hash = (hash ^ elements_[i]) * 0x100000001B3ull;
+  }
+  return hash;
+}
@@ -0,0 +1,141 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TYPES_ADDRESS_H_
+#define TYPES_ADDRESS_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "prim/prim.h"
+#include "util/invariant.h"
+
+// This is a fixed-capacity router/interface address. The elements are stored
+//  inline so copies, comparisons, and hashing never touch the heap. The
+//  capacity covers kMaxDimensions topology dimensions plus one extra element
+//  for the terminal/concentration index used by interface addresses.
+class Address {
+ public:
+  static const u32 kMaxDimensions = 8;
+  static const u32 kCapacity = kMaxDimensions + 1;
+
+  Address();
+  explicit Address(u32 _size, u32 _value = 0);
+  Address(std::initializer_list<u32> _elements);
+
+  // conversion shim for code that still uses std::vector<u32> addresses
+  Address(const std::vector<u32>& _elements);  // NOLINT
+  std::vector<u32> toVector() const;
+
+  // formats the elements as "e0<delim>e1<delim>..."
+  std::string toString(char _delim = ',') const;
+
+  u32 size() const;
+  bool empty() const;
+  void resize(u32 _size, u32 _value = 0);
+  void clear();
+  void push_back(u32 _element);  // NOLINT
+
+  u32& at(u32 _index);
+  const u32& at(u32 _index) const;
+  u32& operator[](u32 _index);
+  const u32& operator[](u32 _index) const;
+
+  u32* begin();
+  u32* end();
+  const u32* begin() const;
+  const u32* end() const;
+
+  bool operator==(const Address& _other) const;
+  bool operator!=(const Address& _other) const;
+  bool operator<(const Address& _other) const;
+
+  u64 hash() const;
+
+ private:
+  u32 elements_[kCapacity];
+  u8 size_;
+};
+
+inline u32 Address::size() const {
+  return size_;
+}
+
+inline bool Address::empty() const {
+  return size_ == 0;
+}
+
+inline u32& Address::at(u32 _index) {
+  CHECK_HOT(_index < size_);
+  return elements_[_index];
+}
+
+inline const u32& Address::at(u32 _index) const {
+  CHECK_HOT(_index < size_);
+  return elements_[_index];
+}
+
+inline u32& Address::operator[](u32 _index) {
+  return elements_[_index];
+}
+
+inline const u32& Address::operator[](u32 _index) const {
+  return elements_[_index];
+}
+
+inline u32* Address::begin() {
+  return elements_;
+}
+
+inline u32* Address::end() {
+  return elements_ + size_;
+}
+
+inline const u32* Address::begin() const {
+  return elements_;
+}
+
+inline const u32* Address::end() const {
+  return elements_ + size_;
+}
+
+inline bool Address::operator==(const Address& _other) const {
+  if (size_ != _other.size_) {
+    return false;
+  }
+  for (u32 i = 0; i < size_; i++) {
+    if (elements_[i] != _other.elements_[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline bool Address::operator!=(const Address& _other) const {
+  return !(*this == _other);
+}
+
+namespace std {
+template <>
+struct hash<Address> {
+  size_t operator()(const Address& _address) const {
+    return _address.hash();
+  }
+};
+}  // namespace std
+
+#endif  // TYPES_ADDRESS_H_
@@ -0,0 +1,121 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "types/Address.h"
+
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(Address, construct) {
+  Address a;
+  ASSERT_EQ(a.size(), 0u);
+  ASSERT_TRUE(a.empty());
+
+  Address b(3);
+  ASSERT_EQ(b.size(), 3u);
+  for (u32 i = 0; i < b.size(); i++) {
+    ASSERT_EQ(b.at(i), 0u);
+  }
+
+  Address c(2, 7);
+  ASSERT_EQ(c.size(), 2u);
+  ASSERT_EQ(c.at(0), 7u);
+  ASSERT_EQ(c.at(1), 7u);
+
+  Address d = {4, 5, 6};
+  ASSERT_EQ(d.size(), 3u);
+  ASSERT_EQ(d.at(0), 4u);
+  ASSERT_EQ(d.at(1), 5u);
+  ASSERT_EQ(d.at(2), 6u);
+
+  Address e(Address::kCapacity, 1);
+  ASSERT_EQ(e.size(), Address::kCapacity);
+}
+
+TEST(Address, modify) {
+  Address a(2);
+  a.at(0) = 3;
+  a[1] = 9;
+  a.push_back(12);
+  ASSERT_EQ(a.size(), 3u);
+  ASSERT_EQ(a.at(0), 3u);
+  ASSERT_EQ(a.at(1), 9u);
+  ASSERT_EQ(a.at(2), 12u);
+
+  a.resize(5, 1);
+  ASSERT_EQ(a.size(), 5u);
+  ASSERT_EQ(a.at(2), 12u);
+  ASSERT_EQ(a.at(3), 1u);
+  ASSERT_EQ(a.at(4), 1u);
+
+  a.resize(1);
+  ASSERT_EQ(a.size(), 1u);
+  ASSERT_EQ(a.at(0), 3u);
+
+  a.clear();
+  ASSERT_TRUE(a.empty());
+
+  u32 sum = 0;
+  Address b = {1, 2, 3, 4};
+  for (u32 v : b) {
+    sum += v;
+  }
+  ASSERT_EQ(sum, 10u);
+}
+
+TEST(Address, compare) {
+  Address a = {1, 2, 3};
+  Address b = {1, 2, 3};
+  Address c = {1, 2, 4};
+  Address d = {1, 2};
+  ASSERT_TRUE(a == b);
+  ASSERT_FALSE(a != b);
+  ASSERT_FALSE(a == c);
+  ASSERT_FALSE(a == d);
+  ASSERT_TRUE(a < c);
+  ASSERT_TRUE(d < a);
+  ASSERT_FALSE(c < a);
+
+  // stale elements beyond the size don't affect equality or hashing
+  Address e = {1, 2, 9};
+  e.resize(2);
+  ASSERT_TRUE(d == e);
+  ASSERT_EQ(d.hash(), e.hash());
+}
+
+TEST(Address, hash) {
+  std::unordered_set<Address> set;
+  for (u32 x = 0; x < 4; x++) {
+    for (u32 y = 0; y < 4; y++) {
+      set.insert(Address({x, y}));
+      set.insert(Address({x, y}));
+    }
+  }
+  ASSERT_EQ(set.size(), 16u);
+  ASSERT_EQ(set.count(Address({2, 3})), 1u);
+  ASSERT_EQ(set.count(Address({2, 3, 0})), 0u);
+}
+
+TEST(Address, vectorShim) {
+  std::vector<u32> v = {5, 0, 2, 8};
+  Address a = v;
+  ASSERT_EQ(a.size(), 4u);
+  ASSERT_EQ(a.toVector(), v);
+  ASSERT_EQ(a.toString(), "5,0,2,8");
+  ASSERT_EQ(a.toString('-'), "5-0-2-8");
+  ASSERT_EQ(Address().toString(), "");
+}
@@ -16,6 +16,8 @@
 
 #include <cassert>
 
+#include "util/invariant.h"
+
 Credit::Credit(u32 _nums) {
   assert(_nums > 0);
   numNums_ = _nums;
@@ -33,11 +35,11 @@ bool Credit::more() const {
 }
 
 void Credit::putNum(u32 _num) {
-  assert(putPos_ < numNums_);
+  CHECK_HOT(putPos_ < numNums_);
   nums_[putPos_++] = _num;
 }
 
 u32 Credit::getNum() {
-  assert(getPos_ < numNums_);
+  CHECK_HOT(getPos_ < numNums_);
   return nums_[getPos_++];
 }
@@ -14,9 +14,8 @@
  */
 #include "types/Flit.h"
 
-#include <cassert>
-
 #include "types/Packet.h"
+#include "util/invariant.h"
 
 Flit::Flit(u32 _id, bool _isHead, bool _isTail, Packet* _packet)
     : id_(_id),
@@ -58,21 +57,25 @@ u32 Flit::getProtocolClass() const {
 }
 
 void Flit::setSendTime(u64 _time) {
-  assert(_time != U64_MAX);
+  CHECK_HOT(_time != U64_MAX);
   sendTime_ = _time;
 }
 
 u64 Flit::getSendTime() const {
-  assert(sendTime_ != U64_MAX);
+  CHECK_HOT(sendTime_ != U64_MAX);
   return sendTime_;
 }
 
 void Flit::setReceiveTime(u64 _time) {
-  assert(_time != U64_MAX);
+  CHECK_HOT(_time != U64_MAX);
   receiveTime_ = _time;
 }
 
 u64 Flit::getReceiveTime() const {
-  assert(receiveTime_ != U64_MAX);
+  CHECK_HOT(receiveTime_ != U64_MAX);
   return receiveTime_;
 }
+
+bool Flit::received() const {
+  return receiveTime_ != U64_MAX;
+}
@@ -37,6 +37,7 @@ class Flit {
   u64 getSendTime() const;
   void setReceiveTime(u64 time);
   u64 getReceiveTime() const;
+  bool received() const;  // the receive time is set
 
  private:
   u32 id_;
@@ -16,6 +16,7 @@
 
 #include <cassert>
 
+#include "types/Flit.h"
 #include "types/Packet.h"
 #include "workload/Terminal.h"
 
@@ -24,7 +25,11 @@ Message::Message(u32 _numPackets, void* _data)
       transaction_(U32_MAX),
       protocolClass_(U32_MAX),
       sourceId_(U32_MAX),
-      destinationId_(U32_MAX) {
+      destinationId_(U32_MAX),
+      multicastGroup_(U32_MAX),
+      reductionId_(U64_MAX),
+      multicastPending_(0),
+      multicastOrigin_(nullptr) {
   packets_.resize(_numPackets);
 }
 
@@ -128,18 +133,78 @@ void Message::setMinimalHopCount(u32 _minimalHopCount) {
   minimalHopCount_ = _minimalHopCount;
 }
 
-void Message::setSourceAddress(const std::vector<u32>* _address) {
+void Message::setSourceAddress(const Address* _address) {
   sourceAddress_ = _address;
 }
 
-const std::vector<u32>* Message::getSourceAddress() const {
+const Address* Message::getSourceAddress() const {
   return sourceAddress_;
 }
 
-void Message::setDestinationAddress(const std::vector<u32>* _address) {
+void Message::setDestinationAddress(const Address* _address) {
   destinationAddress_ = _address;
 }
 
-const std::vector<u32>* Message::getDestinationAddress() const {
+const Address* Message::getDestinationAddress() const {
   return destinationAddress_;
 }
+
+u32 Message::getMulticastGroup() const {
+  return multicastGroup_;
+}
+
+void Message::setMulticastGroup(u32 _group) {
+  multicastGroup_ = _group;
+}
+
+void Message::setMulticastPending(u32 _copies) {
+  multicastPending_ = _copies;
+}
+
+Message* Message::multicastOrigin() const {
+  return multicastOrigin_;
+}
+
+u64 Message::getReductionId() const {
+  return reductionId_;
+}
+
+void Message::setReductionId(u64 _reductionId) {
+  reductionId_ = _reductionId;
+}
+
+Message* Message::multicastCopy() {
+  assert(multicastGroup_ != U32_MAX);
+  Message* copy = new Message(packets_.size(), data_);
+  copy->owner_ = owner_;
+  copy->id_ = id_;
+  copy->transaction_ = transaction_;
+  copy->protocolClass_ = protocolClass_;
+  copy->opCode_ = opCode_;
+  copy->sourceId_ = sourceId_;
+  copy->minimalHopCount_ = minimalHopCount_;
+  copy->sourceAddress_ = sourceAddress_;
+  copy->destinationAddress_ = nullptr;
+  copy->multicastGroup_ = multicastGroup_;
+  copy->reductionId_ = reductionId_;
+  copy->multicastOrigin_ = this;
+  return copy;
+}
+
+bool Message::multicastCopyReceived(const Message* _copy) {
+  assert(_copy->multicastOrigin_ == this);
+  assert(multicastPending_ > 0);
+  for (u32 p = 0; p < packets_.size(); p++) {
+    Packet* packet = packets_.at(p);
+    const Packet* other = _copy->packets_.at(p);
+    for (u32 f = 0; f < packet->numFlits(); f++) {
+      Flit* flit = packet->getFlit(f);
+      u64 time = other->getFlit(f)->getReceiveTime();
+      if (!flit->received() || flit->getReceiveTime() < time) {
+        flit->setReceiveTime(time);
+      }
+    }
+  }
+  multicastPending_--;
+  return multicastPending_ == 0;
+}
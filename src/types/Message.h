@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 class Packet;
 class Terminal;
@@ -61,11 +62,37 @@ class Message {
   u32 getMinimalHopCount() const;
   void setMinimalHopCount(u32 _minimalHopCount);
 
-  void setSourceAddress(const std::vector<u32>* _address);
-  const std::vector<u32>* getSourceAddress() const;
-
-  void setDestinationAddress(const std::vector<u32>* _address);
-  const std::vector<u32>* getDestinationAddress() const;
+  void setSourceAddress(const Address* _address);
+  const Address* getSourceAddress() const;
+
+  void setDestinationAddress(const Address* _address);
+  const Address* getDestinationAddress() const;
+
+  /*
+   * Multicast messages are sent to a group (see MulticastTrees) instead of a
+   *  destination. The network carries copies of the message's packets and
+   *  each destination receives its own copy of the message. The original is
+   *  delivered to its owner once every copy has been received.
+   */
+  u32 getMulticastGroup() const;  // U32_MAX for unicast
+  void setMulticastGroup(u32 _group);
+  void setMulticastPending(u32 _copies);
+  Message* multicastOrigin() const;  // nullptr unless this is a copy
+
+  /*
+   * Reduction messages are contributions to a reduction over their multicast
+   *  group. Routers combine the contributions with the same reduction ID, the
+   *  result is multicast to the group.
+   */
+  u64 getReductionId() const;  // U64_MAX unless a reduction
+  void setReductionId(u64 _reductionId);
+
+  // this creates a copy without packets, the data pointer is shared
+  Message* multicastCopy();
+
+  // this records that a copy was received and returns true if it was the last
+  //  one. the original's flits take the latest receive times of the copies.
+  bool multicastCopyReceived(const Message* _copy);
 
  private:
   Terminal* owner_;
@@ -80,8 +107,13 @@ class Message {
   u32 destinationId_;
   u32 minimalHopCount_;
 
-  const std::vector<u32>* sourceAddress_;
-  const std::vector<u32>* destinationAddress_;
+  const Address* sourceAddress_;
+  const Address* destinationAddress_;
+
+  u32 multicastGroup_;
+  u64 reductionId_;
+  u32 multicastPending_;
+  Message* multicastOrigin_;
 };
 
 #endif  // TYPES_MESSAGE_H_
@@ -18,11 +18,13 @@
 
 #include "types/Flit.h"
 #include "types/Message.h"
+#include "util/invariant.h"
 
 Packet::Packet(u32 _id, u32 _numFlits, Message* _message)
     : id_(_id),
       message_(_message),
       hopCount_(0),
+      congestionMark_(false),
       metadata_(U64_MAX),
       routingExtension_(nullptr) {
   flits_.resize(_numFlits);
@@ -61,6 +63,29 @@ Message* Packet::message() const {
   return message_;
 }
 
+void Packet::setMessage(Message* _message) {
+  message_ = _message;
+}
+
+Packet* Packet::replicate() const {
+  Packet* packet = new Packet(id_, flits_.size(), message_);
+  packet->hopCount_ = hopCount_;
+  packet->congestionMark_ = congestionMark_;
+  packet->metadata_ = metadata_;
+  packet->routingExtension_ = routingExtension_;
+  for (u32 f = 0; f < flits_.size(); f++) {
+    const Flit* flit = flits_.at(f);
+    Flit* copy = new Flit(flit->id(), flit->isHead(), flit->isTail(), packet);
+    copy->setVc(flit->getVc());
+    copy->setSendTime(flit->getSendTime());
+    if (flit->received()) {
+      copy->setReceiveTime(flit->getReceiveTime());
+    }
+    packet->flits_.at(f) = copy;
+  }
+  return packet;
+}
+
 void Packet::incrementHopCount() {
   hopCount_++;
 }
@@ -69,6 +94,14 @@ u32 Packet::getHopCount() const {
   return hopCount_;
 }
 
+bool Packet::getCongestionMark() const {
+  return congestionMark_;
+}
+
+void Packet::setCongestionMark(bool _mark) {
+  congestionMark_ = _mark;
+}
+
 u64 Packet::headLatency() const {
   Flit* head = flits_.at(0);
   return head->getReceiveTime() - head->getSendTime();
@@ -87,12 +120,12 @@ u64 Packet::totalLatency() const {
 }
 
 u64 Packet::getMetadata() const {
-  assert(metadata_ != U64_MAX);
+  CHECK_HOT(metadata_ != U64_MAX);
   return metadata_;
 }
 
 void Packet::setMetadata(u64 _metadata) {
-  assert(_metadata != U64_MAX);
+  CHECK_HOT(_metadata != U64_MAX);
   metadata_ = _metadata;
 }
 
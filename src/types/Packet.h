@@ -38,10 +38,19 @@ class Packet {
   u32 getProtocolClass() const;
 
   Message* message() const;
+  void setMessage(Message* _message);
+
+  // this creates a copy of the packet and its flits for multicast. the copy
+  //  belongs to the same message and shares the routing extension.
+  Packet* replicate() const;
 
   void incrementHopCount();
   u32 getHopCount() const;
 
+  // set by routers when the packet experiences congestion
+  bool getCongestionMark() const;
+  void setCongestionMark(bool _mark);
+
   u64 headLatency() const;
   u64 serializationLatency() const;
   u64 totalLatency() const;
@@ -58,6 +67,7 @@ class Packet {
   Message* message_;
 
   u32 hopCount_;
+  bool congestionMark_;
   u64 metadata_;
 
   void* routingExtension_;
@@ -0,0 +1,106 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "types/Packet.h"
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+
+static Message* createMessage(u32 _numPackets, u32 _numFlits) {
+  Message* message = new Message(_numPackets, nullptr);
+  for (u32 p = 0; p < _numPackets; p++) {
+    Packet* packet = new Packet(p, _numFlits, message);
+    message->setPacket(p, packet);
+    for (u32 f = 0; f < _numFlits; f++) {
+      packet->setFlit(f, new Flit(f, f == 0, f == _numFlits - 1, packet));
+    }
+  }
+  return message;
+}
+
+TEST(Packet, replicate) {
+  Message* message = createMessage(1, 3);
+  message->setMulticastGroup(2);
+  Packet* packet = message->packet(0);
+  packet->incrementHopCount();
+  packet->incrementHopCount();
+  packet->setCongestionMark(true);
+  packet->setMetadata(17);
+  for (u32 f = 0; f < packet->numFlits(); f++) {
+    packet->getFlit(f)->setVc(4);
+    packet->getFlit(f)->setSendTime(100 + f);
+  }
+
+  // routers copy the packet flit by flit to each branch of the tree
+  Packet* copy = packet->replicate();
+  ASSERT_NE(copy, packet);
+  ASSERT_EQ(copy->id(), packet->id());
+  ASSERT_EQ(copy->message(), message);
+  ASSERT_EQ(copy->getHopCount(), 2u);
+  ASSERT_TRUE(copy->getCongestionMark());
+  ASSERT_EQ(copy->getMetadata(), 17u);
+  ASSERT_EQ(copy->numFlits(), 3u);
+  for (u32 f = 0; f < copy->numFlits(); f++) {
+    Flit* flit = copy->getFlit(f);
+    ASSERT_NE(flit, packet->getFlit(f));
+    ASSERT_EQ(flit->packet(), copy);
+    ASSERT_EQ(flit->id(), f);
+    ASSERT_EQ(flit->isHead(), f == 0);
+    ASSERT_EQ(flit->isTail(), f == 2);
+    ASSERT_EQ(flit->getVc(), 4u);
+    ASSERT_EQ(flit->getSendTime(), 100u + f);
+    ASSERT_FALSE(flit->received());  // flits in routers aren't received yet
+  }
+
+  // the copy moves on independently
+  copy->incrementHopCount();
+  ASSERT_EQ(packet->getHopCount(), 2u);
+
+  delete copy;
+  delete message;
+}
+
+TEST(Packet, multicastCopies) {
+  Message* origin = createMessage(2, 2);
+  origin->setMulticastGroup(0);
+  origin->setMulticastPending(2);
+
+  // each member receives its own copy, the origin keeps the latest times
+  Message* first = origin->multicastCopy();
+  Message* second = origin->multicastCopy();
+  ASSERT_EQ(first->multicastOrigin(), origin);
+  ASSERT_EQ(first->getMulticastGroup(), 0u);
+  for (Message* copy : {first, second}) {
+    for (u32 p = 0; p < 2; p++) {
+      Packet* packet = new Packet(p, 2, copy);
+      copy->setPacket(p, packet);
+      for (u32 f = 0; f < 2; f++) {
+        packet->setFlit(f, new Flit(f, f == 0, f == 1, packet));
+        packet->getFlit(f)->setReceiveTime(copy == first ? 10 + f : 5 + p);
+      }
+    }
+  }
+  ASSERT_FALSE(origin->multicastCopyReceived(first));
+  ASSERT_TRUE(origin->multicastCopyReceived(second));
+  ASSERT_EQ(origin->packet(0)->getFlit(0)->getReceiveTime(), 10u);
+  ASSERT_EQ(origin->packet(0)->getFlit(1)->getReceiveTime(), 11u);
+  ASSERT_EQ(origin->packet(1)->getFlit(0)->getReceiveTime(), 10u);
+  ASSERT_EQ(origin->packet(1)->getFlit(1)->getReceiveTime(), 11u);
+
+  delete first;
+  delete second;
+  delete origin;
+}
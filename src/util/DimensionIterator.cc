@@ -26,7 +26,7 @@ DimensionIterator::DimensionIterator(std::vector<u32> _widths)
 
 DimensionIterator::~DimensionIterator() {}
 
-bool DimensionIterator::next(std::vector<u32>* _address) {
+bool DimensionIterator::next(Address* _address) {
   assert(_address->size() == widths_.size());
   bool retVal = more_;
 
@@ -18,17 +18,18 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 class DimensionIterator {
  public:
   explicit DimensionIterator(std::vector<u32> _widths);
   ~DimensionIterator();
-  bool next(std::vector<u32>* _address);
+  bool next(Address* _address);
   void reset();
 
  private:
   std::vector<u32> widths_;
-  std::vector<u32> state_;
+  Address state_;
   bool more_;
 };
 
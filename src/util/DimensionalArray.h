@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "prim/prim.h"
+#include "types/Address.h"
 
 template <typename T>
 class DimensionalArray {
@@ -31,8 +32,15 @@ class DimensionalArray {
   u32 size() const;
   u32 dimensionSize(u32 _dimension) const;
 
-  u32 index(const std::vector<u32>& _index) const;
-  T& at(const std::vector<u32>& _index);
+  // this is the distance between flat indices of neighbors in a dimension
+  u32 stride(u32 _dimension) const;
+
+  // these translate between flat indices and addresses (little endian)
+  u32 index(const Address& _index) const;
+  void address(u32 _index, Address* _address) const;
+
+  T& at(const Address& _index);
+  const T& at(const Address& _index) const;
   T& at(u32 _index);
   const T& at(u32 _index) const;
 
@@ -22,6 +22,8 @@
 #include <stdexcept>
 #include <vector>
 
+#include "util/invariant.h"
+
 template <typename T>
 DimensionalArray<T>::DimensionalArray() {}
 
@@ -67,7 +69,12 @@ u32 DimensionalArray<T>::dimensionSize(u32 _dimension) const {
 }
 
 template <typename T>
-u32 DimensionalArray<T>::index(const std::vector<u32>& _index) const {
+u32 DimensionalArray<T>::stride(u32 _dimension) const {
+  return dimensionScale_.at(_dimension);
+}
+
+template <typename T>
+u32 DimensionalArray<T>::index(const Address& _index) const {
   if (elements_.size() == 0) {
     throw std::out_of_range("there are no elements in the DimensionalArray");
   }
@@ -75,21 +82,40 @@ u32 DimensionalArray<T>::index(const std::vector<u32>& _index) const {
     throw std::out_of_range("'index' size must match number of dimensions");
   }
 
+  // the widths and scales are read without bounds checks below
+  CHECK_HOT(_index.size() == dimensionWidths_.size());
   u32 element = 0;
-  for (s32 i = _index.size() - 1; i >= 0; --i) {
-    if (_index.at(i) >= dimensionWidths_.at(i)) {
+  for (u32 i = 0; i < _index.size(); i++) {
+    if (_index[i] >= dimensionWidths_[i]) {
       throw std::out_of_range("'index' out of bounds");
     }
-    u32 dimScale = dimensionScale_.at(i);
-    u32 dimIndex = _index.at(i);
-    element += dimScale * dimIndex;
+    element += dimensionScale_[i] * _index[i];
   }
   return element;
 }
 
 template <typename T>
-T& DimensionalArray<T>::at(const std::vector<u32>& _index) {
-  return elements_.at(index(_index));
+void DimensionalArray<T>::address(u32 _index, Address* _address) const {
+  if (_index >= elements_.size()) {
+    throw std::out_of_range("'index' out of bounds");
+  }
+
+  u32 dimensions = dimensionWidths_.size();
+  _address->resize(dimensions);
+  for (u32 i = 0; i < dimensions; i++) {
+    (*_address)[i] = _index % dimensionWidths_[i];
+    _index /= dimensionWidths_[i];
+  }
+}
+
+template <typename T>
+T& DimensionalArray<T>::at(const Address& _index) {
+  return elements_[index(_index)];
+}
+
+template <typename T>
+const T& DimensionalArray<T>::at(const Address& _index) const {
+  return elements_[index(_index)];
 }
 
 template <typename T>
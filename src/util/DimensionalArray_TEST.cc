@@ -18,6 +18,7 @@
 
 #include "gtest/gtest.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "util/DimensionIterator.h"
 
 TEST(DimensionalArray, index) {
@@ -53,7 +54,7 @@ TEST(DimensionalArray, store) {
   std::vector<u32> dimWidths{3, 2, 3};
   da->setSize(dimWidths);
 
-  std::vector<u32> index{0, 0, 0};
+  Address index{0, 0, 0};
   DimensionIterator it(dimWidths);
   u64 count = 1000;
   while (it.next(&index)) {
@@ -81,7 +82,7 @@ TEST(DimensionalArray, order1) {
     da->at(i) = i;
   }
 
-  std::vector<u32> index{0, 0, 0};
+  Address index{0, 0, 0};
   DimensionIterator it(dimWidths);
   for (u32 i = 0; it.next(&index); i++) {
     ASSERT_EQ(da->at(index), da->at(i));
@@ -90,3 +91,33 @@ TEST(DimensionalArray, order1) {
 
   delete da;
 }
+
+TEST(DimensionalArray, stride) {
+  DimensionalArray<u64>* da = new DimensionalArray<u64>();
+
+  std::vector<u32> dimWidths{2, 3, 4};
+  da->setSize(dimWidths);
+  ASSERT_EQ(da->stride(0), 1u);
+  ASSERT_EQ(da->stride(1), 2u);
+  ASSERT_EQ(da->stride(2), 6u);
+
+  Address index{0, 0, 0};
+  Address address;
+  DimensionIterator it(dimWidths);
+  for (u32 i = 0; it.next(&index); i++) {
+    da->address(i, &address);
+    ASSERT_EQ(address, index);
+    ASSERT_EQ(da->index(address), i);
+
+    // neighbors in each dimension are one stride apart
+    for (u32 dim = 0; dim < dimWidths.size(); dim++) {
+      if (address.at(dim) + 1 < dimWidths.at(dim)) {
+        Address neighbor(address);
+        neighbor.at(dim)++;
+        ASSERT_EQ(da->index(neighbor), i + da->stride(dim));
+      }
+    }
+  }
+
+  delete da;
+}
@@ -0,0 +1,86 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/Permutation.h"
+
+#include <cassert>
+
+#include "util/invariant.h"
+
+const u32 Permutation::kRounds;
+
+// 64-bit mixing function (splitmix64 finalizer)
+static u64 mix(u64 _value) {
+  _value ^= _value >> 30;
+  _value *= 0xBF58476D1CE4E5B9ull;
+  _value ^= _value >> 27;
+  _value *= 0x94D049BB133111EBull;
+  _value ^= _value >> 31;
+  return _value;
+}
+
+Permutation::Permutation() {
+  reset(1, 0);
+}
+
+Permutation::~Permutation() {}
+
+void Permutation::reset(u32 _size, u64 _key) {
+  assert(_size > 0);
+  size_ = _size;
+
+  // the domain is split into two halves of equal width
+  u32 bits = 0;
+  while (bits < 64 && (1ull << bits) < size_) {
+    bits++;
+  }
+  halfBits_ = (bits + 1) / 2;
+  if (halfBits_ == 0) {
+    halfBits_ = 1;
+  }
+  halfMask_ = (1ull << halfBits_) - 1;
+
+  // derive independent round keys
+  for (u32 round = 0; round < kRounds; round++) {
+    _key += 0x9E3779B97F4A7C15ull;
+    keys_[round] = mix(_key);
+  }
+}
+
+u32 Permutation::size() const {
+  return size_;
+}
+
+u32 Permutation::at(u32 _index) const {
+  CHECK_HOT(_index < size_);
+
+  // cycle walk until the value is back within range, the domain is less
+  //  than four times the size thus this takes few steps on average
+  u64 value = _index;
+  do {
+    value = encrypt(value);
+  } while (value >= size_);
+  return (u32)value;
+}
+
+u64 Permutation::encrypt(u64 _value) const {
+  u64 left = _value >> halfBits_;
+  u64 right = _value & halfMask_;
+  for (u32 round = 0; round < kRounds; round++) {
+    u64 next = left ^ (mix(right ^ keys_[round]) & halfMask_);
+    left = right;
+    right = next;
+  }
+  return (left << halfBits_) | right;
+}
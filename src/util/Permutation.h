@@ -0,0 +1,51 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_PERMUTATION_H_
+#define UTIL_PERMUTATION_H_
+
+#include "prim/prim.h"
+
+/*
+ * This is a lazily evaluated pseudo-random permutation of [0, size). The
+ *  permutation is a keyed Feistel network over the smallest even power of two
+ *  covering the size and indices that land outside the range are walked
+ *  through the cycle until they land inside. The state is constant in size
+ *  thus a full permutation never needs to be materialized.
+ */
+class Permutation {
+ public:
+  Permutation();
+  ~Permutation();
+
+  // this selects the permutation, a new key gives a new permutation
+  void reset(u32 _size, u64 _key);
+
+  u32 size() const;
+
+  // this returns the element at the given index of the permutation
+  u32 at(u32 _index) const;
+
+ private:
+  static const u32 kRounds = 4;
+
+  u64 encrypt(u64 _value) const;
+
+  u32 size_;
+  u32 halfBits_;
+  u64 halfMask_;
+  u64 keys_[kRounds];
+};
+
+#endif  // UTIL_PERMUTATION_H_
@@ -0,0 +1,66 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "util/Permutation.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "prim/prim.h"
+
+TEST(Permutation, bijection) {
+  Permutation perm;
+  for (u32 size = 1; size < 300; size++) {
+    for (u64 key = 0; key < 4; key++) {
+      perm.reset(size, key * 1234567);
+      ASSERT_EQ(perm.size(), size);
+      std::vector<bool> seen(size, false);
+      for (u32 idx = 0; idx < size; idx++) {
+        u32 val = perm.at(idx);
+        ASSERT_LT(val, size);
+        ASSERT_FALSE(seen.at(val));
+        seen.at(val) = true;
+      }
+    }
+  }
+}
+
+TEST(Permutation, keys) {
+  // different keys give different permutations
+  const u32 SIZE = 1000;
+  Permutation a;
+  Permutation b;
+  a.reset(SIZE, 1);
+  b.reset(SIZE, 2);
+  u32 same = 0;
+  for (u32 idx = 0; idx < SIZE; idx++) {
+    if (a.at(idx) == b.at(idx)) {
+      same++;
+    }
+  }
+  ASSERT_LT(same, SIZE / 50);
+
+  // elements are spread evenly across positions
+  const u32 KEYS = 2000;
+  const u32 BUCKETS = 10;
+  std::vector<u32> counts(BUCKETS, 0);
+  for (u64 key = 0; key < KEYS; key++) {
+    a.reset(SIZE, key);
+    counts.at(a.at(0) / (SIZE / BUCKETS))++;
+  }
+  for (u32 count : counts) {
+    ASSERT_GT(count, KEYS / BUCKETS * 3 / 4);
+    ASSERT_LT(count, KEYS / BUCKETS * 5 / 4);
+  }
+}
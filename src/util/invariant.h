@@ -0,0 +1,52 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef UTIL_INVARIANT_H_
+#define UTIL_INVARIANT_H_
+
+#include <cassert>
+
+// Invariants are split into three tiers:
+//  CHECK_STRUCTURAL - cheap checks of construction and configuration, these are
+//                     always enabled (plain assert() is equivalent).
+//  CHECK_HOT        - checks on the per-flit/per-cycle path, these are enabled
+//                     when SUPERSIM_HOT_CHECKS is non-zero.
+//  CHECK_EXPENSIVE  - consistency checks that sweep whole structures, these are
+//                     enabled when SUPERSIM_EXPENSIVE_CHECKS is non-zero.
+// Both optional tiers default to enabled. A disabled check does not evaluate
+// its condition but still references it so no unused variable warnings arise.
+
+#ifndef SUPERSIM_HOT_CHECKS
+#define SUPERSIM_HOT_CHECKS 1
+#endif
+
+#ifndef SUPERSIM_EXPENSIVE_CHECKS
+#define SUPERSIM_EXPENSIVE_CHECKS 1
+#endif
+
+#define CHECK_STRUCTURAL(cond) assert(cond)
+
+#if SUPERSIM_HOT_CHECKS
+#define CHECK_HOT(cond) assert(cond)
+#else
+#define CHECK_HOT(cond) ((void)sizeof(!(cond)))
+#endif
+
+#if SUPERSIM_EXPENSIVE_CHECKS
+#define CHECK_EXPENSIVE(cond) assert(cond)
+#else
+#define CHECK_EXPENSIVE(cond) ((void)sizeof(!(cond)))
+#endif
+
+#endif  // UTIL_INVARIANT_H_
@@ -16,6 +16,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <string>
 #include <utility>
 
 #include "factory/ObjectFactory.h"
@@ -48,6 +49,21 @@ Application::Application(const std::string& _name, const Component* _parent,
 
   // create the rate log
   rateLog_ = new RateLog(_settings["rate_log"]);
+
+  // traffic class used by the metadata handler for QoS
+  trafficClass_ = _settings.value("traffic_class", 0u);
+
+  // optional throughput and latency of this application when run alone, used
+  //  to compute the slowdown caused by co-located applications
+  soloThroughput_ = F64_NAN;
+  soloLatency_ = F64_NAN;
+  if (_settings.contains("solo_baseline") &&
+      !_settings["solo_baseline"].is_null()) {
+    soloThroughput_ = _settings["solo_baseline"]["throughput"].get<f64>();
+    soloLatency_ = _settings["solo_baseline"]["latency"].get<f64>();
+    assert(soloThroughput_ > 0.0);
+    assert(soloLatency_ > 0.0);
+  }
 }
 
 Application::~Application() {
@@ -94,6 +110,10 @@ Terminal* Application::getTerminal(u32 _id) const {
   return terminals_.at(_id);
 }
 
+u32 Application::trafficClass() const {
+  return trafficClass_;
+}
+
 MetadataHandler* Application::metadataHandler() const {
   return metadataHandler_;
 }
@@ -128,6 +148,32 @@ void Application::endMonitoring() {
   for (u32 i = 0; i < terminals_.size(); i++) {
     terminals_.at(i)->logRates(rateLog_);
   }
+
+  // compute the application's throughput (flits/cycle/terminal) and mean
+  //  message latency (cycles)
+  f64 throughput = 0.0;
+  u64 count = 0;
+  f64 sum = 0.0;
+  for (u32 i = 0; i < terminals_.size(); i++) {
+    throughput += terminals_.at(i)->ejectionMonitor()->rate();
+    count += terminals_.at(i)->latencyMonitor()->count();
+    sum += terminals_.at(i)->latencyMonitor()->sum();
+  }
+  throughput /= terminals_.size();
+  f64 latency = count > 0 ? sum / count : F64_NAN;
+  dbgprintf("throughput=%f latency=%f", throughput, latency);
+  gSim->infoLog.logInfo(fullName() + " throughput", std::to_string(throughput));
+  gSim->infoLog.logInfo(fullName() + " latency", std::to_string(latency));
+
+  // compare against the solo run
+  if (!std::isnan(soloLatency_)) {
+    f64 slowdown = latency / soloLatency_;
+    f64 throughputRatio = throughput / soloThroughput_;
+    dbgprintf("slowdown=%f throughput_ratio=%f", slowdown, throughputRatio);
+    gSim->infoLog.logInfo(fullName() + " slowdown", std::to_string(slowdown));
+    gSim->infoLog.logInfo(fullName() + " throughput ratio",
+                          std::to_string(throughputRatio));
+  }
 }
 
 void Application::setTerminal(u32 _id, Terminal* _terminal) {
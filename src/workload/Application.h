@@ -45,6 +45,7 @@ class Application : public Component {
   u32 numTerminals() const;
   u32 id() const;
   Workload* workload() const;
+  u32 trafficClass() const;
 
   Terminal* getTerminal(u32 _id) const;
   MetadataHandler* metadataHandler() const;
@@ -73,6 +74,9 @@ class Application : public Component {
  private:
   std::vector<Terminal*> terminals_;
   RateLog* rateLog_;
+  u32 trafficClass_;
+  f64 soloThroughput_;
+  f64 soloLatency_;
   MetadataHandler* metadataHandler_;
   std::unordered_map<u64, u64> transactions_;
 };
@@ -0,0 +1,67 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/LatencyMonitor.h"
+
+#include "types/Flit.h"
+#include "types/Packet.h"
+
+LatencyMonitor::LatencyMonitor(const std::string& _name,
+                               const Component* _parent)
+    : Component(_name, _parent), count_(0), sum_(0.0), running_(false) {}
+
+LatencyMonitor::~LatencyMonitor() {}
+
+void LatencyMonitor::monitorMessage(const Message* _message) {
+  if (running_) {
+    // message latency spans the first flit sent to the last flit received
+    u64 sendTime = U64_MAX;
+    u64 receiveTime = 0;
+    for (u32 p = 0; p < _message->numPackets(); p++) {
+      const Packet* packet = _message->packet(p);
+      for (u32 f = 0; f < packet->numFlits(); f++) {
+        const Flit* flit = packet->getFlit(f);
+        if (flit->getSendTime() < sendTime) {
+          sendTime = flit->getSendTime();
+        }
+        if (flit->getReceiveTime() > receiveTime) {
+          receiveTime = flit->getReceiveTime();
+        }
+      }
+    }
+    count_++;
+    sum_ += (f64)(receiveTime - sendTime) /
+            gSim->cycleTime(Simulator::Clock::TERMINAL);
+  }
+}
+
+void LatencyMonitor::start() {
+  if (!running_) {
+    count_ = 0;
+    sum_ = 0.0;
+  }
+  running_ = true;
+}
+
+void LatencyMonitor::end() {
+  running_ = false;
+}
+
+u64 LatencyMonitor::count() const {
+  return count_;
+}
+
+f64 LatencyMonitor::sum() const {
+  return sum_;
+}
@@ -0,0 +1,46 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WORKLOAD_LATENCYMONITOR_H_
+#define WORKLOAD_LATENCYMONITOR_H_
+
+#include <string>
+
+#include "event/Component.h"
+#include "prim/prim.h"
+#include "types/Message.h"
+
+class LatencyMonitor : public Component {
+ public:
+  LatencyMonitor(const std::string& _name, const Component* _parent);
+  ~LatencyMonitor();
+
+  // this must be called after the message has been fully received
+  void monitorMessage(const Message* _message);
+  void start();
+  void end();
+
+  // returns the number of messages monitored and the sum of their latencies
+  //  (in terminal cycles)
+  u64 count() const;
+  f64 sum() const;
+
+ private:
+  u64 count_;
+  f64 sum_;
+
+  bool running_;
+};
+
+#endif  // WORKLOAD_LATENCYMONITOR_H_
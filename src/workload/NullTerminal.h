@@ -20,12 +20,13 @@
 
 #include "event/Component.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class NullTerminal : public Terminal {
  public:
   NullTerminal(const std::string& _name, const Component* _parent, u32 _id,
-               const std::vector<u32>& _address, Application* _app);
+               const Address& _address, Application* _app);
   virtual ~NullTerminal();
 
  protected:
@@ -14,15 +14,30 @@
  */
 #include "workload/Terminal.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "event/Simulator.h"
 #include "metadata/MetadataHandler.h"
 #include "network/Network.h"
+#include "types/Flit.h"
+#include "types/Packet.h"
 #include "workload/Application.h"
 
+static void copyReceiveTimes(const Message* _from, Message* _to) {
+  assert(_from->numPackets() == _to->numPackets());
+  for (u32 p = 0; p < _to->numPackets(); p++) {
+    const Packet* from = _from->packet(p);
+    Packet* to = _to->packet(p);
+    assert(from->numFlits() == to->numFlits());
+    for (u32 f = 0; f < to->numFlits(); f++) {
+      to->getFlit(f)->setReceiveTime(from->getFlit(f)->getReceiveTime());
+    }
+  }
+}
+
 Terminal::Terminal(const std::string& _name, const Component* _parent, u32 _id,
-                   const std::vector<u32>& _address, Application* _app)
+                   const Address& _address, Application* _app)
     : Component(_name, _parent),
       id_(_id),
       address_(_address),
@@ -35,6 +50,9 @@ Terminal::Terminal(const std::string& _name, const Component* _parent, u32 _id,
   injectionMonitor_ = new RateMonitor("InjectionMonitor", this);
   deliveredMonitor_ = new RateMonitor("DeliveredMonitor", this);
   ejectionMonitor_ = new RateMonitor("EjectionMonitor", this);
+
+  // create the latency monitor
+  latencyMonitor_ = new LatencyMonitor("LatencyMonitor", this);
 }
 
 Terminal::~Terminal() {
@@ -45,13 +63,14 @@ Terminal::~Terminal() {
   delete injectionMonitor_;
   delete deliveredMonitor_;
   delete ejectionMonitor_;
+  delete latencyMonitor_;
 }
 
 u32 Terminal::id() const {
   return id_;
 }
 
-const std::vector<u32>& Terminal::address() const {
+const Address& Terminal::address() const {
   return address_;
 }
 
@@ -63,12 +82,14 @@ void Terminal::startRateMonitors() {
   injectionMonitor_->start();
   deliveredMonitor_->start();
   ejectionMonitor_->start();
+  latencyMonitor_->start();
 }
 
 void Terminal::endRateMonitors() {
   injectionMonitor_->end();
   deliveredMonitor_->end();
   ejectionMonitor_->end();
+  latencyMonitor_->end();
 }
 
 void Terminal::logRates(RateLog* _rateLog) {
@@ -76,6 +97,14 @@ void Terminal::logRates(RateLog* _rateLog) {
                      deliveredMonitor_->rate(), ejectionMonitor_->rate());
 }
 
+const RateMonitor* Terminal::ejectionMonitor() const {
+  return ejectionMonitor_;
+}
+
+const LatencyMonitor* Terminal::latencyMonitor() const {
+  return latencyMonitor_;
+}
+
 u32 Terminal::messagesSent() const {
   return messagesSent_;
 }
@@ -114,12 +143,38 @@ void Terminal::messageDelivered(Message* _message) {
 void Terminal::receiveMessage(Message* _message) {
   // log this occurrence
   ejectionMonitor_->monitorMessage(_message);
+  latencyMonitor_->monitorMessage(_message);
 
   // count the message received
   messagesReceived_++;
 
-  // notify the owner of delivery
-  _message->getOwner()->messageDelivered(_message);
+  // notify the owner of delivery, multicast messages are delivered when the
+  //  last copy is received and nobody else owns them
+  Message* origin = _message->multicastOrigin();
+  if (origin == nullptr) {
+    _message->getOwner()->messageDelivered(_message);
+  } else if (_message->getReductionId() == U64_MAX) {
+    if (origin->multicastCopyReceived(_message)) {
+      origin->getOwner()->messageDelivered(origin);
+      delete origin;
+    }
+  } else {
+    // the result delivers this terminal's contribution, the contribution
+    //  that carried the result is deleted after its last copy
+    auto it = outstandingReductions_.find(_message->getReductionId());
+    assert(it != outstandingReductions_.end());
+    Message* contribution = it->second;
+    outstandingReductions_.erase(it);
+    copyReceiveTimes(_message, contribution);
+    messageDelivered(contribution);
+    bool last = origin->multicastCopyReceived(_message);
+    if (contribution != origin) {
+      delete contribution;
+    }
+    if (last) {
+      delete origin;
+    }
+  }
 
   // change the owner of the message to this terminal
   _message->setOwner(this);
@@ -176,6 +231,59 @@ u32 Terminal::sendMessage(Message* _message, u32 _destinationId) {
   return msgId;
 }
 
+u32 Terminal::sendMulticastMessage(Message* _message, u32 _group) {
+  // log this occurrence
+  injectionMonitor_->monitorMessage(_message);
+
+  // set each packet's metadata
+  u32 numPackets = _message->numPackets();
+  for (u32 pkt = 0; pkt < numPackets; pkt++) {
+    Packet* packet = _message->packet(pkt);
+    app_->metadataHandler()->packetInjection(app_, packet);
+  }
+
+  // set up the message for transmission, the minimal hop count is that of
+  //  the farthest member
+  Network* network = gSim->getNetwork();
+  const std::vector<u32>& members = network->multicastTrees()->group(_group);
+  u32 msgId = messagesSent_;
+  messagesSent_++;
+  _message->setOwner(this);
+  _message->setId(msgId);
+  _message->setSourceId(id_);
+  _message->setSourceAddress(&address_);
+  _message->setDestinationId(U32_MAX);
+  _message->setDestinationAddress(nullptr);
+  _message->setMulticastGroup(_group);
+  _message->setMulticastPending(members.size());
+  u32 hops = 0;
+  for (u32 member : members) {
+    Terminal* dest = application()->getTerminal(member);
+    hops = std::max(hops, network->computeMinimalHops(&address_,
+                                                      &dest->address_));
+  }
+  _message->setMinimalHopCount(hops);
+
+  // track the message as an outstanding message
+  bool res = outstandingMessages_.insert(_message).second;
+  assert(res);
+
+  // pass the message to the next stage
+  messageReceiver_->receiveMessage(_message);
+
+  // return the msgId incase the application logic needs it
+  return msgId;
+}
+
+u32 Terminal::sendReductionMessage(Message* _message, u32 _group,
+                                   u64 _reductionId) {
+  assert(_reductionId != U64_MAX);
+  bool res = outstandingReductions_.insert({_reductionId, _message}).second;
+  assert(res);
+  _message->setReductionId(_reductionId);
+  return sendMulticastMessage(_message, _group);
+}
+
 u64 Terminal::createTransaction() {
   u32 count = transactionsCreated_;
   assert(transactionsCreated_ < U32_MAX);
@@ -16,14 +16,17 @@
 #define WORKLOAD_TERMINAL_H_
 
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "event/Component.h"
 #include "prim/prim.h"
 #include "stats/RateLog.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "types/MessageReceiver.h"
+#include "workload/LatencyMonitor.h"
 #include "workload/RateMonitor.h"
 
 class Application;
@@ -31,14 +34,16 @@ class Application;
 class Terminal : public Component, public MessageReceiver {
  public:
   Terminal(const std::string& _name, const Component* _parent, u32 _id,
-           const std::vector<u32>& _address, Application* _app);
+           const Address& _address, Application* _app);
   virtual ~Terminal();
   u32 id() const;
-  const std::vector<u32>& address() const;
+  const Address& address() const;
   Application* application() const;
   void startRateMonitors();
   void endRateMonitors();
   void logRates(RateLog* _rateLog);
+  const RateMonitor* ejectionMonitor() const;
+  const LatencyMonitor* latencyMonitor() const;
   u32 messagesSent() const;
   u32 messagesDelivered() const;
   u32 messagesReceived() const;
@@ -80,6 +85,23 @@ class Terminal : public Component, public MessageReceiver {
    */
   u32 sendMessage(Message* _message, u32 _destinationId);
 
+  /*
+   * This is the same as sendMessage() but sends the message to every member
+   *  of a multicast group (see MulticastTrees). Each member receives its own
+   *  copy of the message. This message is delivered once all copies have
+   *  been received, then it is deleted by the network.
+   * NOTE: the message data pointer is shared by all copies.
+   */
+  u32 sendMulticastMessage(Message* _message, u32 _group);
+
+  /*
+   * This sends a contribution to a reduction over a multicast group. Every
+   *  member must contribute a message with the same reduction ID and the same
+   *  packet sizes. Each member receives a copy of the result, at which time
+   *  its own contribution is delivered.
+   */
+  u32 sendReductionMessage(Message* _message, u32 _group, u64 _reductionId);
+
   /*
    * Subclass implementations can use this to generate new transaction IDs.
    */
@@ -98,14 +120,14 @@ class Terminal : public Component, public MessageReceiver {
 
   /*
    * This is called when a message is received from the network to this
-   *  terminal.
+   *  terminal. For multicast this is a copy (see Message::multicastOrigin()).
    * NOTE: This function is responsible for deleting the message.
    */
   virtual void handleReceivedMessage(Message* _message) = 0;
 
   // members for subclasses
   const u32 id_;
-  const std::vector<u32> address_;
+  const Address address_;
 
  private:
   Application* app_;
@@ -114,12 +136,14 @@ class Terminal : public Component, public MessageReceiver {
   RateMonitor* injectionMonitor_;
   RateMonitor* deliveredMonitor_;
   RateMonitor* ejectionMonitor_;
+  LatencyMonitor* latencyMonitor_;
 
   u32 messagesSent_;
   u32 messagesDelivered_;
   u32 messagesReceived_;
   u32 transactionsCreated_;
   std::unordered_set<Message*> outstandingMessages_;
+  std::unordered_map<u64, Message*> outstandingReductions_;
 };
 
 #endif  // WORKLOAD_TERMINAL_H_
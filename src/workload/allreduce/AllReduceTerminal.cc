@@ -0,0 +1,153 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/allreduce/AllReduceTerminal.h"
+
+#include <cassert>
+
+#include "stats/MessageLog.h"
+#include "types/Flit.h"
+#include "types/Packet.h"
+#include "workload/allreduce/Application.h"
+
+namespace AllReduce {
+
+AllReduceTerminal::AllReduceTerminal(const std::string& _name,
+                                     const Component* _parent, u32 _id,
+                                     const Address& _address,
+                                     ::Application* _app,
+                                     nlohmann::json _settings)
+    : Terminal(_name, _parent, _id, _address, _app) {
+  // protocol class of injection
+  assert(_settings.contains("protocol_class"));
+  protocolClass_ = _settings["protocol_class"].get<u32>();
+
+  // every contribution and result is the same size
+  numReductions_ = _settings["num_reductions"].get<u32>();
+  messageSize_ = _settings["message_size"].get<u32>();
+  maxPacketSize_ = _settings["max_packet_size"].get<u32>();
+  assert(messageSize_ > 0);
+  assert(maxPacketSize_ > 0);
+
+  reduction_ = 0;
+  contributions_ = 0;
+}
+
+AllReduceTerminal::~AllReduceTerminal() {}
+
+void AllReduceTerminal::processEvent(void* _event, s32 _type) {
+  assert(false);
+}
+
+void AllReduceTerminal::start() {
+  if (numReductions_ > 0) {
+    startReduction();
+  }
+}
+
+void AllReduceTerminal::handleDeliveredMessage(Message* _message) {
+  // log the message and end the transaction
+  Application* app = reinterpret_cast<Application*>(application());
+  app->workload()->messageLog()->logMessage(_message);
+  endTransaction(_message->getTransaction());
+  app->workload()->messageLog()->endTransaction(_message->getTransaction());
+}
+
+void AllReduceTerminal::handleReceivedMessage(Message* _message) {
+  Application* app = reinterpret_cast<Application*>(application());
+  delete _message;  // don't need this anymore
+
+  if (!app->inNetwork() && id_ == kRootTerminal) {
+    // a contribution
+    contributions_++;
+    checkContributions();
+  } else {
+    // the result
+    finishReduction();
+  }
+}
+
+Message* AllReduceTerminal::createMessage() {
+  u32 numPackets = messageSize_ / maxPacketSize_;
+  if ((messageSize_ % maxPacketSize_) > 0) {
+    numPackets++;
+  }
+
+  // create the message object
+  Message* message = new Message(numPackets, nullptr);
+  message->setProtocolClass(protocolClass_);
+  u64 trans = createTransaction();
+  message->setTransaction(trans);
+  Application* app = reinterpret_cast<Application*>(application());
+  app->workload()->messageLog()->startTransaction(trans);
+
+  // create the packets
+  u32 flitsLeft = messageSize_;
+  for (u32 p = 0; p < numPackets; p++) {
+    u32 packetLength = flitsLeft > maxPacketSize_ ? maxPacketSize_ : flitsLeft;
+
+    Packet* packet = new Packet(p, packetLength, message);
+    message->setPacket(p, packet);
+
+    // create flits
+    for (u32 f = 0; f < packetLength; f++) {
+      bool headFlit = f == 0;
+      bool tailFlit = f == (packetLength - 1);
+      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
+      packet->setFlit(f, flit);
+    }
+    flitsLeft -= packetLength;
+  }
+  return message;
+}
+
+void AllReduceTerminal::startReduction() {
+  Application* app = reinterpret_cast<Application*>(application());
+  app->reductionStarted(reduction_);
+  if (app->inNetwork()) {
+    // reduction IDs are unique across applications
+    u64 reductionId = ((u64)app->id() << 32) | reduction_;
+    sendReductionMessage(createMessage(), app->multicastGroup(), reductionId);
+  } else if (id_ != kRootTerminal) {
+    sendMessage(createMessage(), kRootTerminal);
+  } else {
+    checkContributions();
+  }
+}
+
+void AllReduceTerminal::finishReduction() {
+  Application* app = reinterpret_cast<Application*>(application());
+  app->reductionReceived(reduction_);
+  reduction_++;
+  if (reduction_ < numReductions_) {
+    startReduction();
+  }
+}
+
+void AllReduceTerminal::checkContributions() {
+  // the root sends the result once it has every other contribution
+  Application* app = reinterpret_cast<Application*>(application());
+  if (contributions_ < app->numTerminals() - 1) {
+    return;
+  }
+  contributions_ = 0;
+  for (u32 t = 0; t < app->numTerminals(); t++) {
+    if (t != id_) {
+      sendMessage(createMessage(), t);
+    }
+  }
+  finishReduction();
+}
+
+}  // namespace AllReduce
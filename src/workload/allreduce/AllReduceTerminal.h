@@ -0,0 +1,64 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WORKLOAD_ALLREDUCE_ALLREDUCETERMINAL_H_
+#define WORKLOAD_ALLREDUCE_ALLREDUCETERMINAL_H_
+
+#include <string>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "types/Address.h"
+#include "workload/Terminal.h"
+
+class Application;
+
+namespace AllReduce {
+
+class Application;
+
+class AllReduceTerminal : public Terminal {
+ public:
+  AllReduceTerminal(const std::string& _name, const Component* _parent,
+                    u32 _id, const Address& _address, ::Application* _app,
+                    nlohmann::json _settings);
+  ~AllReduceTerminal();
+  void processEvent(void* _event, s32 _type) override;
+  void start();
+
+ protected:
+  void handleDeliveredMessage(Message* _message) override;
+  void handleReceivedMessage(Message* _message) override;
+
+ private:
+  static const u32 kRootTerminal = 0;  // host algorithm
+
+  Message* createMessage();
+  void startReduction();
+  void finishReduction();
+  void checkContributions();
+
+  u32 protocolClass_;
+  u32 numReductions_;
+  u32 messageSize_;  // flits
+  u32 maxPacketSize_;  // flits
+
+  u32 reduction_;  // the current reduction
+  u32 contributions_;  // received by the root (host algorithm)
+};
+
+}  // namespace AllReduce
+
+#endif  // WORKLOAD_ALLREDUCE_ALLREDUCETERMINAL_H_
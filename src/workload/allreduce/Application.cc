@@ -0,0 +1,148 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/allreduce/Application.h"
+
+#include <cassert>
+#include <vector>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+#include "network/Network.h"
+#include "types/Address.h"
+#include "workload/allreduce/AllReduceTerminal.h"
+
+namespace AllReduce {
+
+Application::Application(const std::string& _name, const Component* _parent,
+                         u32 _id, Workload* _workload,
+                         MetadataHandler* _metadataHandler,
+                         nlohmann::json _settings)
+    : ::Application(_name, _parent, _id, _workload, _metadataHandler,
+                    _settings),
+      completedReductions_(0), reductionTimeSum_(0) {
+  // the reduction algorithm
+  const std::string& algorithm = _settings["algorithm"].get<std::string>();
+  if (algorithm == "in_network") {
+    inNetwork_ = true;
+  } else if (algorithm == "host") {
+    inNetwork_ = false;
+    assert(numTerminals() > 1);
+  } else {
+    fprintf(stderr, "unknown allreduce algorithm: %s\n", algorithm.c_str());
+    assert(false);
+  }
+
+  // in-network reductions are performed over a group of all terminals
+  multicastGroup_ = U32_MAX;
+  if (inNetwork_) {
+    std::vector<u32> members;
+    for (u32 t = 0; t < numTerminals(); t++) {
+      members.push_back(t);
+    }
+    multicastGroup_ =
+        gSim->getNetwork()->multicastTrees()->createGroup(members);
+  }
+
+  numReductions_ = _settings["allreduce_terminal"]["num_reductions"].get<u32>();
+  startTimes_.resize(numReductions_, U64_MAX);
+  receivedCounts_.resize(numReductions_, 0);
+
+  // all terminals are the same
+  for (u32 t = 0; t < numTerminals(); t++) {
+    std::string tname = "AllReduceTerminal_" + std::to_string(t);
+    Address address;
+    gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
+    AllReduceTerminal* terminal = new AllReduceTerminal(
+        tname, this, t, address, this, _settings["allreduce_terminal"]);
+    setTerminal(t, terminal);
+  }
+
+  // this application is immediately ready
+  addEvent(0, 0, nullptr, 0);
+}
+
+Application::~Application() {}
+
+f64 Application::percentComplete() const {
+  if (numReductions_ == 0) {
+    return 1.0;
+  }
+  return (f64)completedReductions_ / (f64)numReductions_;
+}
+
+void Application::start() {
+  if (numReductions_ == 0) {
+    workload_->applicationComplete(id_);
+    return;
+  }
+  for (u32 idx = 0; idx < numTerminals(); idx++) {
+    AllReduceTerminal* t =
+        reinterpret_cast<AllReduceTerminal*>(getTerminal(idx));
+    t->start();
+  }
+}
+
+void Application::stop() {
+  // this application is done
+  workload_->applicationDone(id_);
+}
+
+void Application::kill() {}
+
+bool Application::inNetwork() const {
+  return inNetwork_;
+}
+
+u32 Application::multicastGroup() const {
+  return multicastGroup_;
+}
+
+void Application::reductionStarted(u32 _reduction) {
+  if (startTimes_.at(_reduction) == U64_MAX) {
+    startTimes_.at(_reduction) = gSim->time();
+  }
+}
+
+void Application::reductionReceived(u32 _reduction) {
+  receivedCounts_.at(_reduction)++;
+  assert(receivedCounts_.at(_reduction) <= numTerminals());
+  if (receivedCounts_.at(_reduction) < numTerminals()) {
+    return;
+  }
+
+  // the last terminal has the result
+  u64 time = (gSim->time() - startTimes_.at(_reduction)) /
+             gSim->cycleTime(Simulator::Clock::TERMINAL);
+  dbgprintf("reduction %u took %lu", _reduction, time);
+  reductionTimeSum_ += time;
+  completedReductions_++;
+  if (completedReductions_ == numReductions_) {
+    f64 mean = (f64)reductionTimeSum_ / numReductions_;
+    gSim->infoLog.logInfo(fullName() + " reduction time",
+                          std::to_string(mean));
+    dbgprintf("all reductions are done");
+    workload_->applicationComplete(id_);
+  }
+}
+
+void Application::processEvent(void* _event, s32 _type) {
+  dbgprintf("application ready");
+  workload_->applicationReady(id_);
+}
+
+}  // namespace AllReduce
+
+registerWithObjectFactory("allreduce", ::Application, AllReduce::Application,
+                          APPLICATION_ARGS);
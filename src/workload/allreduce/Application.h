@@ -0,0 +1,74 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WORKLOAD_ALLREDUCE_APPLICATION_H_
+#define WORKLOAD_ALLREDUCE_APPLICATION_H_
+
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "workload/Application.h"
+#include "workload/Workload.h"
+
+class MetadataHandler;
+
+namespace AllReduce {
+
+/*
+ * This application performs a series of allreduce operations over all
+ *  terminals. Each terminal starts the next reduction once it has the result
+ *  of the previous one. The "algorithm" is either:
+ *   "in_network": contributions are reduction messages, the routers combine
+ *     them up the group's tree and multicast the result back down.
+ *   "host": terminals send their contributions to terminal 0, which sends
+ *     the result to every other terminal once it has all contributions.
+ * The mean number of terminal cycles from the first contribution to the last
+ *  result of each reduction is logged as the "reduction time".
+ */
+class Application : public ::Application {
+ public:
+  Application(const std::string& _name, const Component* _parent, u32 _id,
+              Workload* _workload, MetadataHandler* _metadataHandler,
+              nlohmann::json _settings);
+  ~Application();
+  f64 percentComplete() const override;
+  void start() override;
+  void stop() override;
+  void kill() override;
+
+  bool inNetwork() const;
+  u32 multicastGroup() const;  // U32_MAX unless in-network
+
+  // these are called by the terminals to time each reduction
+  void reductionStarted(u32 _reduction);
+  void reductionReceived(u32 _reduction);
+
+  void processEvent(void* _event, s32 _type) override;
+
+ private:
+  bool inNetwork_;
+  u32 multicastGroup_;
+  u32 numReductions_;
+  std::vector<u64> startTimes_;
+  std::vector<u32> receivedCounts_;
+  u32 completedReductions_;
+  u64 reductionTimeSum_;
+};
+
+}  // namespace AllReduce
+
+#endif  // WORKLOAD_ALLREDUCE_APPLICATION_H_
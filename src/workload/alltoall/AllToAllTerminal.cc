@@ -46,7 +46,7 @@ namespace AllToAll {
 
 AllToAllTerminal::AllToAllTerminal(const std::string& _name,
                                    const Component* _parent, u32 _id,
-                                   const std::vector<u32>& _address,
+                                   const Address& _address,
                                    ::Application* _app,
                                    nlohmann::json _settings)
     : ::Terminal(_name, _parent, _id, _address, _app) {
@@ -25,6 +25,7 @@
 #include "prim/prim.h"
 #include "traffic/distribution/DistributionTrafficPattern.h"
 #include "traffic/size/MessageSizeDistribution.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class Application;
@@ -36,7 +37,7 @@ class Application;
 class AllToAllTerminal : public Terminal {
  public:
   AllToAllTerminal(const std::string& _name, const Component* _parent, u32 _id,
-                   const std::vector<u32>& _address, ::Application* _app,
+                   const Address& _address, ::Application* _app,
                    nlohmann::json _settings);
   ~AllToAllTerminal();
   void processEvent(void* _event, s32 _type) override;
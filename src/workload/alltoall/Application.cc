@@ -20,6 +20,7 @@
 #include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
 #include "network/Network.h"
+#include "types/Address.h"
 #include "workload/alltoall/AllToAllTerminal.h"
 
 namespace AllToAll {
@@ -34,7 +35,7 @@ Application::Application(const std::string& _name, const Component* _parent,
   activeTerminals_ = numTerminals();
   for (u32 t = 0; t < numTerminals(); t++) {
     std::string tname = "AllToAllTerminal_" + std::to_string(t);
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     AllToAllTerminal* terminal = new AllToAllTerminal(
         tname, this, t, address, this, _settings["alltoall_terminal"]);
@@ -20,6 +20,7 @@
 #include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
 #include "network/Network.h"
+#include "types/Address.h"
 #include "workload/blast/BlastTerminal.h"
 
 #define kForceWarmed (0x123)
@@ -51,7 +52,7 @@ Application::Application(const std::string& _name, const Component* _parent,
   activeTerminals_ = numTerminals();
   for (u32 t = 0; t < numTerminals(); t++) {
     std::string tname = "BlastTerminal_" + std::to_string(t);
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     BlastTerminal* terminal = new BlastTerminal(tname, this, t, address, this,
                                                 _settings["blast_terminal"]);
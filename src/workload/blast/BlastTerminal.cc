@@ -40,7 +40,7 @@ static const u32 kResponseMsg = kResponseEvt;
 namespace Blast {
 
 BlastTerminal::BlastTerminal(const std::string& _name, const Component* _parent,
-                             u32 _id, const std::vector<u32>& _address,
+                             u32 _id, const Address& _address,
                              ::Application* _app, nlohmann::json _settings)
     : ::Terminal(_name, _parent, _id, _address, _app) {
   // get the injection rate
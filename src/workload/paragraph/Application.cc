@@ -22,6 +22,7 @@
 
 #include "event/Simulator.h"
 #include "network/Network.h"
+#include "types/Address.h"
 #include "workload/paragraph/GraphTerminal.h"
 
 namespace ParaGraph {
@@ -36,7 +37,7 @@ Application::Application(const std::string& _name, const Component* _parent,
   remainingTerminals_ = numTerminals();
   u64 seed = gSim->rnd.nextU64();
   for (u32 t = 0; t < numTerminals(); t++) {
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     std::string tname = "GraphTerminal_" + std::to_string(t);
     GraphTerminal* terminal = new GraphTerminal(
@@ -32,7 +32,7 @@
 namespace ParaGraph {
 
 GraphTerminal::GraphTerminal(const std::string& _name, const Component* _parent,
-                             u32 _id, const std::vector<u32>& _address,
+                             u32 _id, const Address& _address,
                              ::Application* _app, u64 _seed,
                              nlohmann::json _settings)
     : Terminal(_name, _parent, _id, _address, _app) {
@@ -28,6 +28,7 @@
 #include "nlohmann/json.hpp"
 #include "paragraph/scheduling/graph_scheduler.h"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "types/Message.h"
 #include "workload/Terminal.h"
 
@@ -38,7 +39,7 @@ namespace ParaGraph {
 class GraphTerminal : public Terminal {
  public:
   GraphTerminal(const std::string& _name, const Component* _parent, u32 _id,
-                const std::vector<u32>& _address, ::Application* _app,
+                const Address& _address, ::Application* _app,
                 u64 _seed, nlohmann::json _settings);
   ~GraphTerminal();
   void processEvent(void* _event, s32 _type) override;
@@ -14,13 +14,17 @@
  */
 #include "workload/pulse/Application.h"
 
+#include <algorithm>
 #include <cassert>
+#include <sstream>
 #include <vector>
 
 #include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
 #include "network/Network.h"
+#include "types/Address.h"
 #include "workload/pulse/PulseTerminal.h"
+#include "workload/util.h"
 
 namespace Pulse {
 
@@ -29,48 +33,88 @@ Application::Application(const std::string& _name, const Component* _parent,
                          MetadataHandler* _metadataHandler,
                          nlohmann::json _settings)
     : ::Application(_name, _parent, _id, _workload, _metadataHandler,
-                    _settings) {
+                    _settings),
+      phaseLog_(nullptr) {
   // all terminals are the same
-  activeTerminals_ = numTerminals();
+  numPhases_ = 0;
   for (u32 t = 0; t < numTerminals(); t++) {
     std::string tname = "PulseTerminal_" + std::to_string(t);
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     PulseTerminal* terminal = new PulseTerminal(tname, this, t, address, this,
                                                 _settings["pulse_terminal"]);
     setTerminal(t, terminal);
 
-    // remove terminals with no injection
-    if (terminal->requestInjectionRate() == 0.0) {
-      activeTerminals_--;
+    // all terminals run the same phases
+    if (t == 0) {
+      numPhases_ = terminal->numPhases();
+      activeTerminals_.resize(numPhases_, 0);
     }
+    assert(terminal->numPhases() == numPhases_);
+
+    // only count terminals with injection in each phase
+    for (u32 p = 0; p < numPhases_; p++) {
+      if (terminal->activeInPhase(p)) {
+        activeTerminals_.at(p)++;
+      }
+    }
+  }
+  for (u32 p = 0; p < numPhases_; p++) {
+    dbgprintf("phase %u has %u active terminals", p, activeTerminals_.at(p));
+  }
+
+  // preallocate the per-phase completion times
+  completionTimes_.resize(numPhases_);
+  for (u32 p = 0; p < numPhases_; p++) {
+    completionTimes_.at(p).reserve(activeTerminals_.at(p));
+  }
+
+  // create the phase log
+  if (_settings.contains("phase_log") &&
+      !_settings["phase_log"]["file"].is_null()) {
+    phaseLog_ = new fio::OutFile(
+        _settings["phase_log"]["file"].get<std::string>());
+    phaseLog_->write("phase,terminals,start,end,min,mean,p50,p90,p99,max\n");
   }
-  dbgprintf("%u active terminals", activeTerminals_);
 
   // initialize counters
+  phase_ = 0;
+  phaseStartTime_ = 0;
   completedTerminals_ = 0;
-  doneTerminals_ = 0;
 
   // this application is immediately ready
   addEvent(0, 0, nullptr, 0);
 }
 
-Application::~Application() {}
+Application::~Application() {
+  if (phaseLog_) {
+    delete phaseLog_;
+  }
+}
 
 f64 Application::percentComplete() const {
-  f64 percentSum = 0.0;
-  for (u32 idx = 0; idx < numTerminals(); idx++) {
-    PulseTerminal* t = reinterpret_cast<PulseTerminal*>(getTerminal(idx));
-    percentSum += t->percentComplete();
+  if (phase_ >= numPhases_) {
+    return 1.0;
+  }
+
+  // completed phases count fully, the current phase counts its active
+  //  terminals
+  f64 phasePercent = 1.0;
+  if (activeTerminals_.at(phase_) > 0) {
+    f64 percentSum = 0.0;
+    for (u32 idx = 0; idx < numTerminals(); idx++) {
+      PulseTerminal* t = reinterpret_cast<PulseTerminal*>(getTerminal(idx));
+      if (t->activeInPhase(phase_)) {
+        percentSum += t->percentComplete();
+      }
+    }
+    phasePercent = percentSum / activeTerminals_.at(phase_);
   }
-  return percentSum / activeTerminals_;
+  return (phase_ + phasePercent) / numPhases_;
 }
 
 void Application::start() {
-  for (u32 idx = 0; idx < numTerminals(); idx++) {
-    PulseTerminal* t = reinterpret_cast<PulseTerminal*>(getTerminal(idx));
-    t->start();
-  }
+  startPhase(0);
 }
 
 void Application::stop() {
@@ -81,10 +125,71 @@ void Application::stop() {
 void Application::kill() {}
 
 void Application::terminalComplete(u32 _id) {
+  // record the time this terminal took to complete the phase
+  u64 cycles = (gSim->time() - phaseStartTime_) /
+               gSim->cycleTime(Simulator::Clock::TERMINAL);
+  completionTimes_.at(phase_).push_back(cycles);
+
   completedTerminals_++;
-  assert(completedTerminals_ <= activeTerminals_);
-  if (completedTerminals_ == activeTerminals_) {
-    dbgprintf("all terminals are done");
+  assert(completedTerminals_ <= activeTerminals_.at(phase_));
+  if (completedTerminals_ == activeTerminals_.at(phase_)) {
+    dbgprintf("all terminals are done with phase %u", phase_);
+    finishPhase();
+  }
+}
+
+void Application::startPhase(u32 _phase) {
+  dbgprintf("starting phase %u", _phase);
+  phase_ = _phase;
+  phaseStartTime_ = gSim->time();
+  completedTerminals_ = 0;
+  for (u32 idx = 0; idx < numTerminals(); idx++) {
+    PulseTerminal* t = reinterpret_cast<PulseTerminal*>(getTerminal(idx));
+    t->startPhase(phase_);
+  }
+
+  // a phase without any active terminals is immediately finished
+  if (activeTerminals_.at(phase_) == 0) {
+    finishPhase();
+  }
+}
+
+void Application::finishPhase() {
+  // sort the completion times in place for the distribution
+  std::vector<u64>& times = completionTimes_.at(phase_);
+  std::sort(times.begin(), times.end());
+  f64 min = 0.0, mean = 0.0, p50 = 0.0, p90 = 0.0, p99 = 0.0, max = 0.0;
+  if (times.size() > 0) {
+    f64 sum = 0.0;
+    for (u64 time : times) {
+      sum += time;
+    }
+    min = times.front();
+    mean = sum / times.size();
+    p50 = percentile(times, 50.0);
+    p90 = percentile(times, 90.0);
+    p99 = percentile(times, 99.0);
+    max = times.back();
+  }
+  dbgprintf("phase %u completion: min=%f mean=%f p50=%f p90=%f p99=%f max=%f",
+            phase_, min, mean, p50, p90, p99, max);
+
+  if (phaseLog_) {
+    std::stringstream ss;
+    ss.precision(6);
+    ss.setf(std::ios::fixed, std::ios::floatfield);
+    ss << phase_ << ',' << times.size() << ',' << phaseStartTime_ << ','
+       << gSim->time() << ',' << min << ',' << mean << ',' << p50 << ','
+       << p90 << ',' << p99 << ',' << max << '\n';
+    phaseLog_->write(ss.str());
+  }
+
+  // the barrier releases all terminals into the next phase
+  if (phase_ + 1 < numPhases_) {
+    startPhase(phase_ + 1);
+  } else {
+    phase_ = numPhases_;
+    dbgprintf("all phases are done");
     workload_->applicationComplete(id_);
   }
 }
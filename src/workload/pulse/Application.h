@@ -16,8 +16,10 @@
 #define WORKLOAD_PULSE_APPLICATION_H_
 
 #include <string>
+#include <vector>
 
 #include "event/Component.h"
+#include "fio/OutFile.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "workload/Application.h"
@@ -43,9 +45,19 @@ class Application : public ::Application {
   void processEvent(void* _event, s32 _type) override;
 
  private:
-  u32 activeTerminals_;
+  void startPhase(u32 _phase);
+  void finishPhase();
+
+  u32 numPhases_;
+  u32 phase_;
+  u64 phaseStartTime_;
+  std::vector<u32> activeTerminals_;  // [phase]
   u32 completedTerminals_;
-  u32 doneTerminals_;
+
+  // completion time of each active terminal (in terminal cycles)
+  std::vector<std::vector<u64>> completionTimes_;  // [phase][terminal]
+
+  fio::OutFile* phaseLog_;
 };
 
 }  // namespace Pulse
@@ -0,0 +1,165 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/pulse/Application.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "event/Simulator.h"
+#include "gtest/gtest.h"
+#include "metadata/ZeroMetadataHandler.h"
+#include "network/Network_TESTLIB.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "test/TestSetup_TESTLIB.h"
+#include "types/Flit.h"
+#include "types/Message.h"
+#include "types/Packet.h"
+#include "workload/Workload.h"
+
+namespace {
+
+const u32 kLatency = 10;  // cycles from send to delivery
+
+// this delivers each message to its destination interface after a fixed
+//  latency and records when it was sent and delivered
+class LatencyInterface : public TestInterface {
+ public:
+  struct Send {
+    u32 transaction;  // per terminal transaction number
+    u64 sendCycle;
+    u64 deliverCycle;
+  };
+
+  LatencyInterface(Network* _network, u32 _id)
+      : TestInterface(_network, _id, 1, 1) {}
+  ~LatencyInterface() {}
+
+  void receiveMessage(Message* _message) override {
+    u64 now = gSim->time();
+    for (u32 p = 0; p < _message->numPackets(); p++) {
+      Packet* packet = _message->packet(p);
+      for (u32 f = 0; f < packet->numFlits(); f++) {
+        packet->getFlit(f)->setSendTime(now);
+      }
+    }
+    sends_.push_back({(u32)_message->getTransaction(),
+                      gSim->cycle(Simulator::Clock::TERMINAL), U64_MAX});
+    addEvent(gSim->futureCycle(Simulator::Clock::TERMINAL, kLatency), 0,
+             _message, 0);
+  }
+
+  void processEvent(void* _event, s32 _type) override {
+    Message* message = reinterpret_cast<Message*>(_event);
+    u64 now = gSim->time();
+    for (u32 p = 0; p < message->numPackets(); p++) {
+      Packet* packet = message->packet(p);
+      for (u32 f = 0; f < packet->numFlits(); f++) {
+        packet->getFlit(f)->setReceiveTime(now);
+      }
+    }
+    for (Send& send : sends_) {
+      if (send.transaction == (u32)message->getTransaction()) {
+        send.deliverCycle = gSim->cycle(Simulator::Clock::TERMINAL);
+      }
+    }
+    network_->getInterface(message->getDestinationId())->messageReceiver()
+        ->receiveMessage(message);
+  }
+
+  const std::vector<Send>& sends() const {
+    return sends_;
+  }
+
+ private:
+  std::vector<Send> sends_;
+};
+
+}  // namespace
+
+TEST(PulseApplication, phases) {
+  TestSetup ts(1, 1, 1, 1, 0xBAADF00D);
+  const u32 kTerminals = 4;
+  TestNetwork network(TestNetwork::makeJSON(1));
+  std::vector<LatencyInterface*> interfaces;
+  for (u32 id = 0; id < kTerminals; id++) {
+    interfaces.push_back(new LatencyInterface(&network, id));
+    network.addInterface(interfaces.back());
+  }
+  gSim->setNetwork(&network);
+  ZeroMetadataHandler metadataHandler((nlohmann::json()));
+
+  // each phase sends 4 flit messages at its own rate, the second phase
+  //  overrides the rate, the number of transactions, and the delay
+  nlohmann::json terminal;
+  terminal["request_protocol_class"] = 0;
+  terminal["request_injection_rate"] = 0.5;
+  terminal["enable_responses"] = false;
+  terminal["delay"] = 0;
+  terminal["num_transactions"] = 10;
+  terminal["max_packet_size"] = 4;
+  terminal["transaction_size"] = 1;
+  terminal["traffic_pattern"]["type"] = "uniform_random";
+  terminal["traffic_pattern"]["send_to_self"] = true;
+  terminal["message_size_distribution"]["type"] = "single";
+  terminal["message_size_distribution"]["message_size"] = 4;
+  terminal["phases"][0] = nlohmann::json::object();
+  terminal["phases"][1]["request_injection_rate"] = 0.125;
+  terminal["phases"][1]["num_transactions"] = 6;
+  terminal["phases"][1]["delay"] = 100;
+  nlohmann::json settings;
+  settings["applications"][0]["type"] = "pulse";
+  settings["applications"][0]["pulse_terminal"] = terminal;
+  Workload workload("Workload", nullptr, &metadataHandler, settings);
+  gSim->setWorkload(&workload);
+
+  gSim->initialize();
+  gSim->simulate();
+  ASSERT_EQ(workload.application(0)->percentComplete(), 1.0);
+
+  // the second phase starts once every message of the first was delivered
+  u64 firstDone = 0;
+  for (u32 id = 0; id < kTerminals; id++) {
+    for (const LatencyInterface::Send& send : interfaces.at(id)->sends()) {
+      ASSERT_NE(send.deliverCycle, U64_MAX);
+      if (send.transaction < 10) {
+        firstDone = std::max(firstDone, send.deliverCycle);
+      }
+    }
+  }
+
+  for (u32 id = 0; id < kTerminals; id++) {
+    const std::vector<LatencyInterface::Send>& sends =
+        interfaces.at(id)->sends();
+    ASSERT_EQ(sends.size(), 10u + 6u);
+    for (u32 s = 0; s < sends.size(); s++) {
+      ASSERT_EQ(sends.at(s).transaction, s);
+    }
+
+    // 4 flits at 0.5 flits per cycle
+    for (u32 s = 1; s < 10; s++) {
+      ASSERT_EQ(sends.at(s).sendCycle - sends.at(s - 1).sendCycle, 8u);
+    }
+
+    // the second phase begins within three message times after its delay
+    ASSERT_GE(sends.at(10).sendCycle, firstDone + 100);
+    ASSERT_LE(sends.at(10).sendCycle, firstDone + 100 + 3 * 32);
+
+    // 4 flits at 0.125 flits per cycle
+    for (u32 s = 11; s < 16; s++) {
+      ASSERT_EQ(sends.at(s).sendCycle - sends.at(s - 1).sendCycle, 32u);
+    }
+  }
+}
@@ -17,7 +17,6 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <utility>
 
 #include "fio/InFile.h"
 #include "mut/mut.h"
@@ -40,16 +39,11 @@ static const u32 kResponseMsg = kResponseEvt;
 namespace Pulse {
 
 PulseTerminal::PulseTerminal(const std::string& _name, const Component* _parent,
-                             u32 _id, const std::vector<u32>& _address,
+                             u32 _id, const Address& _address,
                              ::Application* _app, nlohmann::json _settings)
     : ::Terminal(_name, _parent, _id, _address, _app) {
-  // get the injection rate
-  assert(_settings.contains("request_injection_rate") &&
-         _settings["request_injection_rate"].is_number_float());
-  requestInjectionRate_ = _settings["request_injection_rate"].get<f64>();
-  assert(requestInjectionRate_ >= 0.0 && requestInjectionRate_ <= 1.0);
-
   // if relative injection is specified, modify the injection accordingly
+  f64 relativeInjection = 1.0;
   if (_settings.contains("relative_injection")) {
     // if a file is given, it is a csv of injection rates
     fio::InFile inf(_settings["relative_injection"].get<std::string>());
@@ -67,7 +61,7 @@ PulseTerminal::PulseTerminal(const std::string& _name, const Component* _parent,
           f64 ri = std::stod(strs.at(0));
           assert(ri >= 0.0);
           if (lineNum == id_) {
-            requestInjectionRate_ *= ri;
+            relativeInjection = ri;
             foundMe = true;
             break;
           }
@@ -78,9 +72,63 @@ PulseTerminal::PulseTerminal(const std::string& _name, const Component* _parent,
     assert(foundMe);
   }
 
-  // transaction quantity limitation
-  assert(_settings.contains("num_transactions"));
-  numTransactions_ = _settings["num_transactions"].get<u32>();
+  // the phases default to the single phase described by the settings, when
+  //  phases are given each one replaces the top level settings it specifies
+  std::vector<nlohmann::json> phaseSettings;
+  if (_settings.contains("phases")) {
+    assert(_settings["phases"].is_array());
+    assert(_settings["phases"].size() > 0);
+    nlohmann::json defaults = _settings;
+    defaults.erase("phases");
+    for (u32 p = 0; p < _settings["phases"].size(); p++) {
+      nlohmann::json settings = defaults;
+      for (const auto& item : _settings["phases"][p].items()) {
+        settings[item.key()] = item.value();
+      }
+      phaseSettings.push_back(settings);
+    }
+  } else {
+    phaseSettings.push_back(_settings);
+  }
+
+  // create the phases
+  u32 maxTransactions = 0;
+  for (u32 p = 0; p < phaseSettings.size(); p++) {
+    const nlohmann::json& settings = phaseSettings.at(p);
+    std::string suffix =
+        phaseSettings.size() == 1 ? "" : "_" + std::to_string(p);
+    Phase phase;
+
+    // get the injection rate
+    assert(settings.contains("request_injection_rate") &&
+           settings["request_injection_rate"].is_number_float());
+    phase.requestInjectionRate = settings["request_injection_rate"].get<f64>();
+    assert(phase.requestInjectionRate >= 0.0 &&
+           phase.requestInjectionRate <= 1.0);
+    phase.requestInjectionRate *= relativeInjection;
+
+    // transaction quantity limitation
+    assert(settings.contains("num_transactions"));
+    phase.numTransactions = settings["num_transactions"].get<u32>();
+    maxTransactions = std::max(maxTransactions, phase.numTransactions);
+
+    // start time delay
+    assert(settings.contains("delay"));
+    phase.delay = settings["delay"].get<u32>();
+
+    // create a traffic pattern
+    phase.trafficPattern = ContinuousTrafficPattern::create(
+        "TrafficPattern" + suffix, this, application()->numTerminals(), id_,
+        settings["traffic_pattern"]);
+
+    // create a message size distribution
+    phase.messageSizeDistribution = MessageSizeDistribution::create(
+        "MessageSizeDistribution" + suffix, this,
+        settings["message_size_distribution"]);
+
+    phases_.push_back(phase);
+  }
+  phase_ = 0;
 
   // max packet size
   maxPacketSize_ = _settings["max_packet_size"].get<u32>();
@@ -99,15 +147,6 @@ PulseTerminal::PulseTerminal(const std::string& _name, const Component* _parent,
         _settings["multi_destination_transactions"].get<bool>();
   }
 
-  // create a traffic pattern
-  trafficPattern_ = ContinuousTrafficPattern::create(
-      "TrafficPattern", this, application()->numTerminals(), id_,
-      _settings["traffic_pattern"]);
-
-  // create a message size distribution
-  messageSizeDistribution_ = MessageSizeDistribution::create(
-      "MessageSizeDistribution", this, _settings["message_size_distribution"]);
-
   // protocol class of injection of requests
   assert(_settings.contains("request_protocol_class"));
   requestProtocolClass_ = _settings["request_protocol_class"].get<u32>();
@@ -125,9 +164,10 @@ PulseTerminal::PulseTerminal(const std::string& _name, const Component* _parent,
   assert(!enableResponses_ || _settings.contains("response_protocol_class"));
   responseProtocolClass_ = _settings.value("response_protocol_class", 0);
 
-  // start time delay
-  assert(_settings.contains("delay"));
-  delay_ = _settings["delay"].get<u32>();
+  // size the transaction tracking for the largest phase
+  outstandingTransactions_.reserve(maxTransactions);
+  phaseFirstTransaction_ = 0;
+  outstandingCount_ = 0;
 
   // initialize the counters
   transactionsSent_ = 0;
@@ -135,10 +175,12 @@ PulseTerminal::PulseTerminal(const std::string& _name, const Component* _parent,
 }
 
 PulseTerminal::~PulseTerminal() {
-  assert(outstandingTransactions_.size() == 0);
+  assert(outstandingCount_ == 0);
 
-  delete trafficPattern_;
-  delete messageSizeDistribution_;
+  for (const Phase& phase : phases_) {
+    delete phase.trafficPattern;
+    delete phase.messageSizeDistribution;
+  }
 }
 
 void PulseTerminal::processEvent(void* _event, s32 _type) {
@@ -159,39 +201,52 @@ void PulseTerminal::processEvent(void* _event, s32 _type) {
 }
 
 f64 PulseTerminal::percentComplete() const {
-  if (numTransactions_ == 0) {
+  u32 numTransactions = phases_.at(phase_).numTransactions;
+  if (numTransactions == 0) {
     return 1.0;
   } else {
-    u32 count = std::min(loggableCompleteCount_, numTransactions_);
-    return (f64)count / (f64)numTransactions_;
+    u32 count = std::min(loggableCompleteCount_, numTransactions);
+    return (f64)count / (f64)numTransactions;
   }
 }
 
-f64 PulseTerminal::requestInjectionRate() const {
-  return requestInjectionRate_;
+u32 PulseTerminal::numPhases() const {
+  return phases_.size();
 }
 
-void PulseTerminal::start() {
-  Application* app = reinterpret_cast<Application*>(application());
+f64 PulseTerminal::requestInjectionRate(u32 _phase) const {
+  return phases_.at(_phase).requestInjectionRate;
+}
 
-  if (numTransactions_ == 0) {
-    dbgprintf("complete");
-    app->terminalComplete(id_);
+bool PulseTerminal::activeInPhase(u32 _phase) const {
+  const Phase& phase = phases_.at(_phase);
+  return (phase.requestInjectionRate > 0.0) && (phase.numTransactions > 0);
+}
+
+void PulseTerminal::startPhase(u32 _phase) {
+  assert(outstandingCount_ == 0);
+
+  // reset the phase bookkeeping (this doesn't allocate)
+  phase_ = _phase;
+  const Phase& phase = phases_.at(phase_);
+  phaseFirstTransaction_ = transactionsCreated();
+  outstandingTransactions_.assign(phase.numTransactions, 0);
+  transactionsSent_ = 0;
+  loggableCompleteCount_ = 0;
+
+  // choose a random number of cycles in the future to start
+  // make an event to start the PulseTerminal in the future
+  if (activeInPhase(phase_)) {
+    u32 maxMsg = phase.messageSizeDistribution->maxMessageSize();
+    u32 maxTrans = maxMsg * transactionSize_;
+    u64 cycles = cyclesToSend(phase.requestInjectionRate, maxTrans);
+    cycles = gSim->rnd.nextU64(phase.delay, phase.delay + cycles * 3);
+    u64 time = gSim->futureCycle(Simulator::Clock::TERMINAL, 1) +
+               ((cycles - 1) * gSim->cycleTime(Simulator::Clock::TERMINAL));
+    dbgprintf("phase %u start time is %lu", phase_, time);
+    addEvent(time, 0, nullptr, kRequestEvt);
   } else {
-    // choose a random number of cycles in the future to start
-    // make an event to start the PulseTerminal in the future
-    if (requestInjectionRate_ > 0.0) {
-      u32 maxMsg = messageSizeDistribution_->maxMessageSize();
-      u32 maxTrans = maxMsg * transactionSize_;
-      u64 cycles = cyclesToSend(requestInjectionRate_, maxTrans);
-      cycles = gSim->rnd.nextU64(delay_, delay_ + cycles * 3);
-      u64 time = gSim->futureCycle(Simulator::Clock::TERMINAL, 1) +
-                 ((cycles - 1) * gSim->cycleTime(Simulator::Clock::TERMINAL));
-      dbgprintf("start time is %lu", time);
-      addEvent(time, 0, nullptr, kRequestEvt);
-    } else {
-      dbgprintf("not running");
-    }
+    dbgprintf("not running in phase %u", phase_);
   }
 }
 
@@ -206,15 +261,13 @@ void PulseTerminal::handleDeliveredMessage(Message* _message) {
       lastOfTrans = completeTracking(transId);
     }
 
-    // log message if tagged
-    if (transactionsToLog_.count(transId) == 1) {
-      Application* app = reinterpret_cast<Application*>(application());
-      app->workload()->messageLog()->logMessage(_message);
+    // log message
+    Application* app = reinterpret_cast<Application*>(application());
+    app->workload()->messageLog()->logMessage(_message);
 
-      // end this transaction in the log if appropriate
-      if (!enableResponses_ && lastOfTrans) {
-        completeLoggable(transId);
-      }
+    // end this transaction in the log if appropriate
+    if (!enableResponses_ && lastOfTrans) {
+      completeLoggable(transId);
     }
   }
 }
@@ -231,15 +284,12 @@ void PulseTerminal::handleReceivedMessage(Message* _message) {
     // complete the tracking of this transaction
     bool lastOfTrans = completeTracking(transId);
 
-    // log message if tagged
-    if (transactionsToLog_.count(transId) == 1) {
-      // log the message
-      app->workload()->messageLog()->logMessage(_message);
+    // log the message
+    app->workload()->messageLog()->logMessage(_message);
 
-      // end this transaction in the log if this is the last message
-      if (lastOfTrans) {
-        completeLoggable(transId);
-      }
+    // end this transaction in the log if this is the last message
+    if (lastOfTrans) {
+      completeLoggable(transId);
     }
   }
 
@@ -262,16 +312,24 @@ void PulseTerminal::handleReceivedMessage(Message* _message) {
   }
 }
 
+u32 PulseTerminal::transactionIndex(u64 _transId) const {
+  // the lower 32 bits of the transaction ID is the transaction number
+  u32 index = (u32)_transId - phaseFirstTransaction_;
+  assert(index < outstandingTransactions_.size());
+  return index;
+}
+
 bool PulseTerminal::completeTracking(u64 _transId) {
   // decrement the counter for this transaction
-  assert(outstandingTransactions_.at(_transId) > 0);
-  outstandingTransactions_.at(_transId)--;
+  u32 index = transactionIndex(_transId);
+  assert(outstandingTransactions_.at(index) > 0);
+  outstandingTransactions_.at(index)--;
 
   // if this is the last expected message, end tracking of this transaction,
   // and end the transaction
-  if (outstandingTransactions_.at(_transId) == 0) {
-    u32 res = outstandingTransactions_.erase(_transId);
-    assert(res == 1);
+  if (outstandingTransactions_.at(index) == 0) {
+    assert(outstandingCount_ > 0);
+    outstandingCount_--;
 
     // end the transaction
     endTransaction(_transId);
@@ -281,11 +339,7 @@ bool PulseTerminal::completeTracking(u64 _transId) {
 }
 
 void PulseTerminal::completeLoggable(u64 _transId) {
-  // clear the logging entry
-  assert(outstandingTransactions_.find(_transId) ==
-         outstandingTransactions_.end());
-  u64 res = transactionsToLog_.erase(_transId);
-  assert(res == 1);
+  assert(outstandingTransactions_.at(transactionIndex(_transId)) == 0);
 
   // log the message/transaction
   Application* app = reinterpret_cast<Application*>(application());
@@ -293,15 +347,16 @@ void PulseTerminal::completeLoggable(u64 _transId) {
   loggableCompleteCount_++;
 
   // detect when logging complete
-  //  this also completes the terminal
-  if (loggableCompleteCount_ == numTransactions_) {
-    dbgprintf("complete");
+  //  this also completes the terminal's phase
+  if (loggableCompleteCount_ == phases_.at(phase_).numTransactions) {
+    dbgprintf("phase %u complete", phase_);
     app->terminalComplete(id_);
   }
 }
 
 void PulseTerminal::startTransaction() {
   Application* app = reinterpret_cast<Application*>(application());
+  const Phase& phase = phases_.at(phase_);
 
   // start a new transaction
   u32 protocolClass = requestProtocolClass_;
@@ -309,14 +364,12 @@ void PulseTerminal::startTransaction() {
   u32 msgType = kRequestMsg;
 
   // start tracking the transaction
-  bool res = outstandingTransactions_
-                 .insert(std::make_pair(transaction, transactionSize_))
-                 .second;
-  assert(res);
+  u32 index = transactionIndex(transaction);
+  assert(outstandingTransactions_.at(index) == 0);
+  outstandingTransactions_.at(index) = transactionSize_;
+  outstandingCount_++;
 
   // register the transaction for logging
-  bool res2 = transactionsToLog_.insert(transaction).second;
-  assert(res2);
   app->workload()->messageLog()->startTransaction(transaction);
 
   // create N requests for this transaction
@@ -326,9 +379,9 @@ void PulseTerminal::startTransaction() {
     // the destination and message size either stay the same or are varied with
     // each request of the transaction based on multiDestinationTransactions_.
     if (destination == U32_MAX || multiDestinationTransactions_) {
-      destination = trafficPattern_->nextDestination();
+      destination = phase.trafficPattern->nextDestination();
       assert(destination != U32_MAX);
-      messageSize = messageSizeDistribution_->nextMessageSize();
+      messageSize = phase.messageSizeDistribution->nextMessageSize();
     }
 
     // determine the number of packets
@@ -369,9 +422,9 @@ void PulseTerminal::startTransaction() {
 
   // determine when to send the next transaction
   transactionsSent_++;
-  if (transactionsSent_ < numTransactions_) {
+  if (transactionsSent_ < phase.numTransactions) {
     u64 transSize = messageSize * transactionSize_;
-    u64 cycles = cyclesToSend(requestInjectionRate_, transSize);
+    u64 cycles = cyclesToSend(phase.requestInjectionRate, transSize);
     u64 time = gSim->futureCycle(Simulator::Clock::TERMINAL, cycles);
     if (time == gSim->time()) {
       startTransaction();
@@ -386,7 +439,8 @@ void PulseTerminal::sendResponse(Message* _request) {
 
   // process the request received to make a response
   u32 destination = _request->getSourceId();
-  u32 messageSize = messageSizeDistribution_->nextMessageSize(_request);
+  u32 messageSize =
+      phases_.at(phase_).messageSizeDistribution->nextMessageSize(_request);
   u32 protocolClass = responseProtocolClass_;
   u64 transaction = _request->getTransaction();
   u32 msgType = kResponseMsg;
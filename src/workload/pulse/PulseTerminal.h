@@ -16,8 +16,6 @@
 #define WORKLOAD_PULSE_PULSETERMINAL_H_
 
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "event/Component.h"
@@ -25,6 +23,7 @@
 #include "prim/prim.h"
 #include "traffic/continuous/ContinuousTrafficPattern.h"
 #include "traffic/size/MessageSizeDistribution.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class Application;
@@ -36,47 +35,59 @@ class Application;
 class PulseTerminal : public Terminal {
  public:
   PulseTerminal(const std::string& _name, const Component* _parent, u32 _id,
-                const std::vector<u32>& _address, ::Application* _app,
+                const Address& _address, ::Application* _app,
                 nlohmann::json _settings);
   ~PulseTerminal();
   void processEvent(void* _event, s32 _type) override;
   f64 percentComplete() const;
-  f64 requestInjectionRate() const;
-  void start();
+  u32 numPhases() const;
+  f64 requestInjectionRate(u32 _phase) const;
+  bool activeInPhase(u32 _phase) const;
+  void startPhase(u32 _phase);
 
  protected:
   void handleDeliveredMessage(Message* _message) override;
   void handleReceivedMessage(Message* _message) override;
 
  private:
+  // each phase has its own traffic generation
+  struct Phase {
+    f64 requestInjectionRate;
+    u32 numTransactions;
+    u64 delay;  // start time delay
+    ContinuousTrafficPattern* trafficPattern;
+    MessageSizeDistribution* messageSizeDistribution;
+  };
+
+  u32 transactionIndex(u64 _transId) const;
   bool completeTracking(u64 _transId);
   void completeLoggable(u64 _transId);
   void startTransaction();
   void sendResponse(Message* _request);
 
   // traffic generation
-  f64 requestInjectionRate_;
-  u32 numTransactions_;
+  std::vector<Phase> phases_;
+  u32 phase_;
   u32 maxPacketSize_;    // flits
   u32 transactionSize_;  // requests
   bool multiDestinationTransactions_;
-  ContinuousTrafficPattern* trafficPattern_;
-  MessageSizeDistribution* messageSizeDistribution_;
 
   // requests
   u32 requestProtocolClass_;
 
   // responses
   bool enableResponses_;
-  std::unordered_map<u64, u32> outstandingTransactions_;  // recv count
   u32 responseProtocolClass_;
   u64 requestProcessingLatency_;  // cycles
 
-  // start time delay
-  u64 delay_;
+  // transaction tracking of the current phase, indexed by the transaction
+  //  number relative to the first transaction of the phase. this is sized for
+  //  the largest phase up front so phases don't allocate.
+  std::vector<u32> outstandingTransactions_;  // recv count
+  u32 phaseFirstTransaction_;
+  u32 outstandingCount_;
 
   // logging and message generation
-  std::unordered_set<u32> transactionsToLog_;
   u32 transactionsSent_;
   u32 loggableCompleteCount_;
 };
@@ -0,0 +1,167 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/rpc/Application.h"
+
+#include <cassert>
+#include <sstream>
+#include <vector>
+
+#include "event/Simulator.h"
+#include "factory/ObjectFactory.h"
+#include "network/Network.h"
+#include "types/Address.h"
+#include "workload/rpc/ClientTerminal.h"
+#include "workload/rpc/ServerTerminal.h"
+
+namespace Rpc {
+
+Application::Application(const std::string& _name, const Component* _parent,
+                         u32 _id, Workload* _workload,
+                         MetadataHandler* _metadataHandler,
+                         nlohmann::json _settings)
+    : ::Application(_name, _parent, _id, _workload, _metadataHandler,
+                    _settings),
+      latencyLog_(nullptr) {
+  // determine the servers, evenly spread across the terminal ID space
+  assert(_settings.contains("num_servers"));
+  u32 numServers = _settings["num_servers"].get<u32>();
+  assert(numServers > 0);
+  assert(numServers < numTerminals());
+  std::vector<bool> isServer(numTerminals(), false);
+  for (u32 s = 0; s < numServers; s++) {
+    u32 t = (u32)(((u64)s * numTerminals()) / numServers);
+    assert(!isServer.at(t));
+    isServer.at(t) = true;
+  }
+
+  // create terminals
+  for (u32 t = 0; t < numTerminals(); t++) {
+    Address address;
+    gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
+    if (isServer.at(t)) {
+      std::string tname = "ServerTerminal_" + std::to_string(servers_.size());
+      ServerTerminal* terminal = new ServerTerminal(
+          tname, this, t, address, this, _settings["server_terminal"]);
+      setTerminal(t, terminal);
+      servers_.push_back(t);
+    } else {
+      std::string tname = "ClientTerminal_" + std::to_string(clients_.size());
+      ClientTerminal* terminal = new ClientTerminal(
+          tname, this, t, address, this, _settings["client_terminal"]);
+      setTerminal(t, terminal);
+      clients_.push_back(t);
+    }
+  }
+  dbgprintf("%u servers and %u clients", (u32)servers_.size(),
+            (u32)clients_.size());
+
+  // create the latency log
+  if (_settings.contains("latency_log") &&
+      !_settings["latency_log"]["file"].is_null()) {
+    latencyLog_ = new fio::OutFile(
+        _settings["latency_log"]["file"].get<std::string>());
+    latencyLog_->write("id,name,count,mean,p50,p90,p99,p999,max\n");
+  }
+
+  // initialize counters
+  completedClients_ = 0;
+
+  // this application is immediately ready
+  addEvent(0, 0, nullptr, 0);
+}
+
+Application::~Application() {
+  if (latencyLog_) {
+    delete latencyLog_;
+  }
+}
+
+f64 Application::percentComplete() const {
+  f64 percentSum = 0.0;
+  for (u32 client : clients_) {
+    ClientTerminal* t = reinterpret_cast<ClientTerminal*>(getTerminal(client));
+    percentSum += t->percentComplete();
+  }
+  return percentSum / clients_.size();
+}
+
+void Application::start() {
+  for (u32 client : clients_) {
+    ClientTerminal* t = reinterpret_cast<ClientTerminal*>(getTerminal(client));
+    t->start();
+  }
+}
+
+void Application::stop() {
+  // clients keep the servers loaded until all applications are done
+  workload_->applicationDone(id_);
+}
+
+void Application::kill() {
+  for (u32 client : clients_) {
+    ClientTerminal* t = reinterpret_cast<ClientTerminal*>(getTerminal(client));
+    t->stopSending();
+  }
+  logLatencies();
+}
+
+u32 Application::numServers() const {
+  return servers_.size();
+}
+
+u32 Application::server(u32 _index) const {
+  return servers_.at(_index);
+}
+
+void Application::clientComplete(u32 _id) {
+  completedClients_++;
+  dbgprintf("Client %u is complete (%u of %u)", _id, completedClients_,
+            (u32)clients_.size());
+  assert(completedClients_ <= clients_.size());
+  if (completedClients_ == clients_.size()) {
+    dbgprintf("all clients are complete");
+    workload_->applicationComplete(id_);
+  }
+}
+
+void Application::processEvent(void* _event, s32 _type) {
+  dbgprintf("application ready");
+  workload_->applicationReady(id_);
+}
+
+void Application::logLatencies() {
+  if (latencyLog_ == nullptr) {
+    return;
+  }
+
+  std::stringstream ss;
+  ss.precision(6);
+  ss.setf(std::ios::fixed, std::ios::floatfield);
+  for (u32 client : clients_) {
+    ClientTerminal* t = reinterpret_cast<ClientTerminal*>(getTerminal(client));
+    f64 mean, p50, p90, p99, p999;
+    u64 count, max;
+    t->latencyPercentiles(&count, &mean, &p50, &p90, &p99, &p999, &max);
+    ss << client << ',' << t->name() << ',' << count << ',' << mean << ','
+       << p50 << ',' << p90 << ',' << p99 << ',' << p999 << ',' << max
+       << '\n';
+  }
+  latencyLog_->write(ss.str());
+}
+
+}  // namespace Rpc
+
+registerWithObjectFactory("rpc", ::Application, Rpc::Application,
+                          APPLICATION_ARGS);
@@ -0,0 +1,62 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WORKLOAD_RPC_APPLICATION_H_
+#define WORKLOAD_RPC_APPLICATION_H_
+
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "fio/OutFile.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "workload/Application.h"
+#include "workload/Workload.h"
+
+class MetadataHandler;
+
+namespace Rpc {
+
+class Application : public ::Application {
+ public:
+  Application(const std::string& _name, const Component* _parent, u32 _id,
+              Workload* _workload, MetadataHandler* _metadataHandler,
+              nlohmann::json _settings);
+  ~Application();
+  f64 percentComplete() const override;
+  void start() override;
+  void stop() override;
+  void kill() override;
+
+  u32 numServers() const;
+  u32 server(u32 _index) const;
+
+  void clientComplete(u32 _id);
+
+  void processEvent(void* _event, s32 _type) override;
+
+ private:
+  void logLatencies();
+
+  std::vector<u32> servers_;
+  std::vector<u32> clients_;
+  u32 completedClients_;
+
+  fio::OutFile* latencyLog_;
+};
+
+}  // namespace Rpc
+
+#endif  // WORKLOAD_RPC_APPLICATION_H_
@@ -0,0 +1,256 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/rpc/ClientTerminal.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "network/Network.h"
+#include "stats/MessageLog.h"
+#include "types/Flit.h"
+#include "types/Packet.h"
+#include "workload/rpc/Application.h"
+#include "workload/util.h"
+
+// these are event types
+#define kRequestEvt (0xFA)
+
+// this app defines the following message OpCodes
+static const u32 kRequestMsg = kRequestEvt;
+static const u32 kResponseMsg = 0x82;
+
+namespace Rpc {
+
+ClientTerminal::ClientTerminal(const std::string& _name,
+                               const Component* _parent, u32 _id,
+                               const Address& _address,
+                               ::Application* _app, nlohmann::json _settings)
+    : ::Terminal(_name, _parent, _id, _address, _app) {
+  // closed-loop window size
+  assert(_settings.contains("max_outstanding"));
+  maxOutstanding_ = _settings["max_outstanding"].get<u32>();
+  assert(maxOutstanding_ > 0);
+  outstanding_ = 0;
+
+  // think time between a response and the next request
+  assert(_settings.contains("think_time"));
+  thinkTime_ =
+      TimeDistribution::create("ThinkTime", this, _settings["think_time"]);
+
+  // max packet size
+  maxPacketSize_ = _settings["max_packet_size"].get<u32>();
+  assert(maxPacketSize_ > 0);
+
+  // create a message size distribution
+  messageSizeDistribution_ = MessageSizeDistribution::create(
+      "MessageSizeDistribution", this, _settings["message_size_distribution"]);
+
+  // protocol class of injection of requests
+  assert(_settings.contains("request_protocol_class"));
+  requestProtocolClass_ = _settings["request_protocol_class"].get<u32>();
+
+  // logging window
+  assert(_settings.contains("num_requests"));
+  numRequests_ = _settings["num_requests"].get<u32>();
+  warmupRequests_ = _settings.value("warmup_requests", 0);
+  requestsSent_ = 0;
+  latencies_.reserve(numRequests_);
+
+  sending_ = false;
+}
+
+ClientTerminal::~ClientTerminal() {
+  delete thinkTime_;
+  delete messageSizeDistribution_;
+}
+
+void ClientTerminal::processEvent(void* _event, s32 _type) {
+  switch (_type) {
+    case kRequestEvt:
+      assert(_event == nullptr);
+      if (sending_) {
+        sendRequest();
+      }
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+f64 ClientTerminal::percentComplete() const {
+  if (numRequests_ == 0) {
+    return 1.0;
+  } else {
+    return (f64)latencies_.size() / (f64)numRequests_;
+  }
+}
+
+void ClientTerminal::start() {
+  Application* app = reinterpret_cast<Application*>(application());
+  sending_ = true;
+
+  if (numRequests_ == 0) {
+    dbgprintf("complete");
+    app->clientComplete(id_);
+  }
+
+  // fill the window, each slot starting after an independent think time
+  for (u32 slot = 0; slot < maxOutstanding_; slot++) {
+    think();
+  }
+}
+
+void ClientTerminal::stopSending() {
+  sending_ = false;
+}
+
+void ClientTerminal::latencyPercentiles(u64* _count, f64* _mean, f64* _p50,
+                                        f64* _p90, f64* _p99, f64* _p999,
+                                        u64* _max) const {
+  *_count = latencies_.size();
+  if (latencies_.empty()) {
+    *_mean = 0.0;
+    *_p50 = 0.0;
+    *_p90 = 0.0;
+    *_p99 = 0.0;
+    *_p999 = 0.0;
+    *_max = 0;
+    return;
+  }
+
+  std::vector<u64> sorted(latencies_);
+  std::sort(sorted.begin(), sorted.end());
+  f64 sum = 0.0;
+  for (u64 latency : sorted) {
+    sum += latency;
+  }
+  *_mean = sum / sorted.size();
+  *_p50 = percentile(sorted, 50.0);
+  *_p90 = percentile(sorted, 90.0);
+  *_p99 = percentile(sorted, 99.0);
+  *_p999 = percentile(sorted, 99.9);
+  *_max = sorted.back();
+}
+
+void ClientTerminal::handleDeliveredMessage(Message* _message) {
+  // log the request if tagged
+  assert(_message->getOpCode() == kRequestMsg);
+  if (transactionsToLog_.count(_message->getTransaction()) == 1) {
+    Application* app = reinterpret_cast<Application*>(application());
+    app->workload()->messageLog()->logMessage(_message);
+  }
+}
+
+void ClientTerminal::handleReceivedMessage(Message* _message) {
+  Application* app = reinterpret_cast<Application*>(application());
+  assert(_message->getOpCode() == kResponseMsg);
+  u64 transId = _message->getTransaction();
+
+  // the response completes the request
+  assert(outstanding_ > 0);
+  outstanding_--;
+
+  // log the completion time if tagged
+  if (transactionsToLog_.erase(transId) == 1) {
+    app->workload()->messageLog()->logMessage(_message);
+    app->workload()->messageLog()->endTransaction(transId);
+    u64 cycles = (gSim->time() - app->transactionCreationTime(transId)) /
+                 gSim->cycleTime(Simulator::Clock::TERMINAL);
+    latencies_.push_back(cycles);
+
+    // detect when logging complete
+    if (latencies_.size() == numRequests_) {
+      dbgprintf("complete");
+      app->clientComplete(id_);
+    }
+  }
+  endTransaction(transId);
+  delete _message;
+
+  // the freed slot issues its next request after the think time
+  think();
+}
+
+void ClientTerminal::think() {
+  if (!sending_) {
+    return;
+  }
+  // messages can only be sent at epsilon 0, thus the think time is at least
+  //  one cycle
+  u64 cycles = std::max(thinkTime_->nextTime(), (u64)1);
+  u64 time = gSim->futureCycle(Simulator::Clock::TERMINAL, cycles);
+  addEvent(time, 0, nullptr, kRequestEvt);
+}
+
+void ClientTerminal::sendRequest() {
+  Application* app = reinterpret_cast<Application*>(application());
+  assert(outstanding_ < maxOutstanding_);
+  outstanding_++;
+
+  // start a new transaction
+  u64 transaction = createTransaction();
+
+  // only requests within the logging window are logged
+  if (requestsSent_ >= warmupRequests_ &&
+      requestsSent_ < (warmupRequests_ + numRequests_)) {
+    bool res = transactionsToLog_.insert(transaction).second;
+    assert(res);
+    app->workload()->messageLog()->startTransaction(transaction);
+  }
+  requestsSent_++;
+
+  // choose a server
+  u32 destination =
+      app->server(gSim->rnd.nextU64(0, app->numServers() - 1));
+  u32 messageSize = messageSizeDistribution_->nextMessageSize();
+
+  // determine the number of packets
+  u32 numPackets = messageSize / maxPacketSize_;
+  if ((messageSize % maxPacketSize_) > 0) {
+    numPackets++;
+  }
+
+  // create the message object
+  Message* message = new Message(numPackets, nullptr);
+  message->setProtocolClass(requestProtocolClass_);
+  message->setTransaction(transaction);
+  message->setOpCode(kRequestMsg);
+
+  // create the packets
+  u32 flitsLeft = messageSize;
+  for (u32 p = 0; p < numPackets; p++) {
+    u32 packetLength = flitsLeft > maxPacketSize_ ? maxPacketSize_ : flitsLeft;
+
+    Packet* packet = new Packet(p, packetLength, message);
+    message->setPacket(p, packet);
+
+    // create flits
+    for (u32 f = 0; f < packetLength; f++) {
+      bool headFlit = f == 0;
+      bool tailFlit = f == (packetLength - 1);
+      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
+      packet->setFlit(f, flit);
+    }
+    flitsLeft -= packetLength;
+  }
+
+  // send the message
+  u32 msgId = sendMessage(message, destination);
+  (void)msgId;  // unused
+}
+
+}  // namespace Rpc
@@ -0,0 +1,85 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WORKLOAD_RPC_CLIENTTERMINAL_H_
+#define WORKLOAD_RPC_CLIENTTERMINAL_H_
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "traffic/size/MessageSizeDistribution.h"
+#include "traffic/time/TimeDistribution.h"
+#include "types/Address.h"
+#include "workload/Terminal.h"
+
+class Application;
+
+namespace Rpc {
+
+class Application;
+
+/*
+ * This is a closed-loop RPC client. It keeps at most 'max_outstanding'
+ *  requests in flight. Each completed request is followed by a think time
+ *  before the next request is issued.
+ */
+class ClientTerminal : public Terminal {
+ public:
+  ClientTerminal(const std::string& _name, const Component* _parent, u32 _id,
+                 const Address& _address, ::Application* _app,
+                 nlohmann::json _settings);
+  ~ClientTerminal();
+  void processEvent(void* _event, s32 _type) override;
+  f64 percentComplete() const;
+  void start();
+  void stopSending();
+
+  // computes the completion time statistics of the logged requests
+  void latencyPercentiles(u64* _count, f64* _mean, f64* _p50, f64* _p90,
+                          f64* _p99, f64* _p999, u64* _max) const;
+
+ protected:
+  void handleDeliveredMessage(Message* _message) override;
+  void handleReceivedMessage(Message* _message) override;
+
+ private:
+  void think();
+  void sendRequest();
+
+  // closed-loop generation
+  u32 maxOutstanding_;
+  u32 outstanding_;
+  TimeDistribution* thinkTime_;
+  bool sending_;
+
+  // requests
+  u32 maxPacketSize_;  // flits
+  MessageSizeDistribution* messageSizeDistribution_;
+  u32 requestProtocolClass_;
+
+  // logging
+  u32 warmupRequests_;
+  u32 numRequests_;
+  u32 requestsSent_;
+  std::unordered_set<u64> transactionsToLog_;
+  std::vector<u64> latencies_;  // cycles
+};
+
+}  // namespace Rpc
+
+#endif  // WORKLOAD_RPC_CLIENTTERMINAL_H_
@@ -0,0 +1,164 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "workload/rpc/ServerTerminal.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "network/Network.h"
+#include "types/Flit.h"
+#include "types/Packet.h"
+#include "workload/rpc/Application.h"
+
+// these are event types
+#define kServiceEvt (0x5E)
+
+// this app defines the following message OpCodes
+static const u32 kRequestMsg = 0xFA;
+static const u32 kResponseMsg = 0x82;
+
+namespace Rpc {
+
+ServerTerminal::ServerTerminal(const std::string& _name,
+                               const Component* _parent, u32 _id,
+                               const Address& _address,
+                               ::Application* _app, nlohmann::json _settings)
+    : ::Terminal(_name, _parent, _id, _address, _app) {
+  // worker pool
+  assert(_settings.contains("num_workers"));
+  numWorkers_ = _settings["num_workers"].get<u32>();
+  assert(numWorkers_ > 0);
+  busyWorkers_ = 0;
+  maxQueueDepth_ = 0;
+
+  // service time of each request
+  assert(_settings.contains("service_time"));
+  serviceTime_ =
+      TimeDistribution::create("ServiceTime", this, _settings["service_time"]);
+
+  // max packet size
+  maxPacketSize_ = _settings["max_packet_size"].get<u32>();
+  assert(maxPacketSize_ > 0);
+
+  // create a message size distribution, responses use the dependent size
+  messageSizeDistribution_ = MessageSizeDistribution::create(
+      "MessageSizeDistribution", this, _settings["message_size_distribution"]);
+
+  // protocol class of injection of responses
+  assert(_settings.contains("response_protocol_class"));
+  responseProtocolClass_ = _settings["response_protocol_class"].get<u32>();
+}
+
+ServerTerminal::~ServerTerminal() {
+  dbgprintf("max queue depth %u", maxQueueDepth_);
+  while (!requestQueue_.empty()) {
+    delete requestQueue_.front();
+    requestQueue_.pop();
+  }
+  delete serviceTime_;
+  delete messageSizeDistribution_;
+}
+
+void ServerTerminal::processEvent(void* _event, s32 _type) {
+  switch (_type) {
+    case kServiceEvt:
+      // the worker is done with this request
+      sendResponse(reinterpret_cast<Message*>(_event));
+      assert(busyWorkers_ > 0);
+      busyWorkers_--;
+      serveNext();
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+void ServerTerminal::handleDeliveredMessage(Message* _message) {
+  // responses need no further action
+  assert(_message->getOpCode() == kResponseMsg);
+}
+
+void ServerTerminal::handleReceivedMessage(Message* _message) {
+  assert(_message->getOpCode() == kRequestMsg);
+
+  // queue the request for the next free worker
+  requestQueue_.push(_message);
+  if (requestQueue_.size() > maxQueueDepth_) {
+    maxQueueDepth_ = requestQueue_.size();
+  }
+  serveNext();
+}
+
+void ServerTerminal::serveNext() {
+  while (busyWorkers_ < numWorkers_ && !requestQueue_.empty()) {
+    Message* request = requestQueue_.front();
+    requestQueue_.pop();
+
+    // messages can only be sent at epsilon 0, thus the service time is at
+    //  least one cycle
+    busyWorkers_++;
+    u64 cycles = std::max(serviceTime_->nextTime(), (u64)1);
+    u64 time = gSim->futureCycle(Simulator::Clock::TERMINAL, cycles);
+    addEvent(time, 0, request, kServiceEvt);
+  }
+}
+
+void ServerTerminal::sendResponse(Message* _request) {
+  // process the request received to make a response
+  u32 destination = _request->getSourceId();
+  u32 messageSize = messageSizeDistribution_->nextMessageSize(_request);
+  u64 transaction = _request->getTransaction();
+
+  // delete the request
+  delete _request;
+
+  // determine the number of packets
+  u32 numPackets = messageSize / maxPacketSize_;
+  if ((messageSize % maxPacketSize_) > 0) {
+    numPackets++;
+  }
+
+  // create the message object
+  Message* message = new Message(numPackets, nullptr);
+  message->setProtocolClass(responseProtocolClass_);
+  message->setTransaction(transaction);
+  message->setOpCode(kResponseMsg);
+
+  // create the packets
+  u32 flitsLeft = messageSize;
+  for (u32 p = 0; p < numPackets; p++) {
+    u32 packetLength = flitsLeft > maxPacketSize_ ? maxPacketSize_ : flitsLeft;
+
+    Packet* packet = new Packet(p, packetLength, message);
+    message->setPacket(p, packet);
+
+    // create flits
+    for (u32 f = 0; f < packetLength; f++) {
+      bool headFlit = f == 0;
+      bool tailFlit = f == (packetLength - 1);
+      Flit* flit = new Flit(f, headFlit, tailFlit, packet);
+      packet->setFlit(f, flit);
+    }
+    flitsLeft -= packetLength;
+  }
+
+  // send the message
+  u32 msgId = sendMessage(message, destination);
+  (void)msgId;  // unused
+}
+
+}  // namespace Rpc
@@ -0,0 +1,73 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the 'License');
+ * you may not use this file except in compliance with the License.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef WORKLOAD_RPC_SERVERTERMINAL_H_
+#define WORKLOAD_RPC_SERVERTERMINAL_H_
+
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "event/Component.h"
+#include "nlohmann/json.hpp"
+#include "prim/prim.h"
+#include "traffic/size/MessageSizeDistribution.h"
+#include "traffic/time/TimeDistribution.h"
+#include "types/Address.h"
+#include "workload/Terminal.h"
+
+class Application;
+
+namespace Rpc {
+
+class Application;
+
+/*
+ * This is an RPC server. Received requests wait in a FIFO queue until one of
+ *  the 'num_workers' workers is free. Each request occupies its worker for a
+ *  service time drawn from the service time distribution, then the response
+ *  is sent back to the client.
+ */
+class ServerTerminal : public Terminal {
+ public:
+  ServerTerminal(const std::string& _name, const Component* _parent, u32 _id,
+                 const Address& _address, ::Application* _app,
+                 nlohmann::json _settings);
+  ~ServerTerminal();
+  void processEvent(void* _event, s32 _type) override;
+
+ protected:
+  void handleDeliveredMessage(Message* _message) override;
+  void handleReceivedMessage(Message* _message) override;
+
+ private:
+  void serveNext();
+  void sendResponse(Message* _request);
+
+  // request processing
+  u32 numWorkers_;
+  u32 busyWorkers_;
+  TimeDistribution* serviceTime_;
+  std::queue<Message*> requestQueue_;
+  u32 maxQueueDepth_;
+
+  // responses
+  u32 maxPacketSize_;  // flits
+  MessageSizeDistribution* messageSizeDistribution_;
+  u32 responseProtocolClass_;
+};
+
+}  // namespace Rpc
+
+#endif  // WORKLOAD_RPC_SERVERTERMINAL_H_
@@ -21,6 +21,7 @@
 #include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
 #include "network/Network.h"
+#include "types/Address.h"
 #include "workload/simplemem/MemoryTerminal.h"
 #include "workload/simplemem/ProcessorTerminal.h"
 
@@ -47,7 +48,7 @@ Application::Application(const std::string& _name, const Component* _parent,
   // create terminals
   remainingProcessors_ = 0;
   for (u32 t = 0; t < numTerminals(); t++) {
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     std::string idStr = std::to_string(t / 2);
     if ((t & 0x1) == 0) {
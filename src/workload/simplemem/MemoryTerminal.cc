@@ -28,7 +28,7 @@ namespace SimpleMem {
 
 MemoryTerminal::MemoryTerminal(const std::string& _name,
                                const Component* _parent, u32 _id,
-                               const std::vector<u32>& _address,
+                               const Address& _address,
                                u32 _memorySlice, ::Application* _app,
                                nlohmann::json _settings)
     : ::Terminal(_name, _parent, _id, _address, _app), fsm_(eState::kWaiting) {
@@ -22,6 +22,7 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class Application;
@@ -31,7 +32,7 @@ namespace SimpleMem {
 class MemoryTerminal : public Terminal {
  public:
   MemoryTerminal(const std::string& _name, const Component* _parent, u32 _id,
-                 const std::vector<u32>& _address, u32 _memorySlice,
+                 const Address& _address, u32 _memorySlice,
                  ::Application* _app, nlohmann::json _settings);
   ~MemoryTerminal();
   void processEvent(void* _event, s32 _type) override;
@@ -21,6 +21,7 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class Application;
@@ -30,7 +31,7 @@ namespace SimpleMem {
 class ProcessorTerminal : public Terminal {
  public:
   ProcessorTerminal(const std::string& _name, const Component* _parent, u32 _id,
-                    const std::vector<u32>& _address, ::Application* _app,
+                    const Address& _address, ::Application* _app,
                     nlohmann::json _settings);
   ~ProcessorTerminal();
   void processEvent(void* _event, s32 _type) override;
@@ -23,6 +23,7 @@
 #include "fio/InFile.h"
 #include "network/Network.h"
 #include "strop/strop.h"
+#include "types/Address.h"
 #include "workload/stencil/StencilTerminal.h"
 
 namespace Stencil {
@@ -133,7 +134,7 @@ Application::Application(const std::string& _name, const Component* _parent,
   // all terminals are the same
   for (u32 t = 0; t < numTerminals(); t++) {
     std::string tname = "StencilTerminal_" + std::to_string(t);
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     StencilTerminal* terminal =
         new StencilTerminal(tname, this, t, address, &termToProc_, &procToTerm_,
@@ -35,7 +35,7 @@ namespace Stencil {
 
 StencilTerminal::StencilTerminal(
     const std::string& _name, const Component* _parent, u32 _id,
-    const std::vector<u32>& _address, const std::vector<u32>* _termToProc,
+    const Address& _address, const std::vector<u32>* _termToProc,
     const std::vector<u32>* _procToTerm,
     const std::vector<std::tuple<u32, u32>>& _exchangeSendMessages,
     u32 _exchangeRecvMessages, ::Application* _app, nlohmann::json _settings)
@@ -24,6 +24,7 @@
 #include "event/Component.h"
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class Application;
@@ -36,7 +37,7 @@ class StencilTerminal : public Terminal {
  public:
   StencilTerminal(
       const std::string& _name, const Component* _parent, u32 _id,
-      const std::vector<u32>& _address, const std::vector<u32>* _termToProc,
+      const Address& _address, const std::vector<u32>* _termToProc,
       const std::vector<u32>* _procToTerm,
       const std::vector<std::tuple<u32, u32>>& _exchangeSendMessages,
       u32 _exchangeRecvMessages, ::Application* _app, nlohmann::json _settings);
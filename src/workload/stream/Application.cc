@@ -20,6 +20,7 @@
 #include "event/Simulator.h"
 #include "factory/ObjectFactory.h"
 #include "network/Network.h"
+#include "types/Address.h"
 #include "workload/NullTerminal.h"
 #include "workload/stream/StreamTerminal.h"
 
@@ -54,13 +55,28 @@ Application::Application(const std::string& _name, const Component* _parent,
   assert(sourceTerminal_ < numTerminals());
   assert(destinationTerminal_ < numTerminals());
 
+  // optionally multicast to all other terminals, the destination terminal
+  //  still tracks the progress
+  multicastGroup_ = U32_MAX;
+  if (_settings.contains("multicast") && _settings["multicast"].get<bool>()) {
+    std::vector<u32> members;
+    for (u32 t = 0; t < numTerminals(); t++) {
+      if (t != sourceTerminal_) {
+        members.push_back(t);
+      }
+    }
+    multicastGroup_ =
+        gSim->getNetwork()->multicastTrees()->createGroup(members);
+  }
+
   // all terminals are the same
   for (u32 t = 0; t < numTerminals(); t++) {
     std::string tname = "Terminal_" + std::to_string(t);
-    std::vector<u32> address;
+    Address address;
     gSim->getNetwork()->translateInterfaceIdToAddress(t, &address);
     Terminal* terminal;
-    if (t == sourceTerminal_ || t == destinationTerminal_) {
+    if (t == sourceTerminal_ || t == destinationTerminal_ ||
+        multicastGroup_ != U32_MAX) {
       terminal = new StreamTerminal(tname, this, t, address, this,
                                     _settings["stream_terminal"]);
     } else {
@@ -80,6 +96,10 @@ u32 Application::getDestination() const {
   return destinationTerminal_;
 }
 
+u32 Application::getMulticastGroup() const {
+  return multicastGroup_;
+}
+
 f64 Application::percentComplete() const {
   StreamTerminal* t =
       reinterpret_cast<StreamTerminal*>(getTerminal(destinationTerminal_));
@@ -35,6 +35,7 @@ class Application : public ::Application {
   ~Application();
   u32 getSource() const;
   u32 getDestination() const;
+  u32 getMulticastGroup() const;  // U32_MAX unless multicasting
 
   f64 percentComplete() const override;
 
@@ -48,6 +49,7 @@ class Application : public ::Application {
  private:
   u32 sourceTerminal_;
   u32 destinationTerminal_;
+  u32 multicastGroup_;
   bool doMonitoring_;
 };
 
@@ -29,7 +29,7 @@ namespace Stream {
 
 StreamTerminal::StreamTerminal(const std::string& _name,
                                const Component* _parent, u32 _id,
-                               const std::vector<u32>& _address,
+                               const Address& _address,
                                ::Application* _app, nlohmann::json _settings)
     : Terminal(_name, _parent, _id, _address, _app) {
   // create a message size distribution
@@ -106,15 +106,29 @@ void StreamTerminal::handleDeliveredMessage(Message* _message) {
   // log the message
   Application* app = reinterpret_cast<Application*>(application());
   app->workload()->messageLog()->logMessage(_message);
+
+  // multicast transactions end once every copy has been received
+  if (_message->getMulticastGroup() != U32_MAX) {
+    endTransaction(_message->getTransaction());
+    app->workload()->messageLog()->endTransaction(_message->getTransaction());
+  }
 }
 
 void StreamTerminal::handleReceivedMessage(Message* _message) {
   dbgprintf("received message %u", _message->id());
 
-  // end the transaction
-  endTransaction(_message->getTransaction());
+  // end the transaction (multicast copies leave this to the source)
   Application* app = reinterpret_cast<Application*>(application());
-  app->workload()->messageLog()->endTransaction(_message->getTransaction());
+  if (_message->multicastOrigin() == nullptr) {
+    endTransaction(_message->getTransaction());
+    app->workload()->messageLog()->endTransaction(_message->getTransaction());
+  }
+
+  // only the destination terminal tracks progress
+  if (id_ != app->getDestination()) {
+    delete _message;
+    return;
+  }
 
   // signal the app if this is the first receive
   if (!destReady_) {
@@ -177,7 +191,11 @@ void StreamTerminal::sendNextMessage() {
   }
 
   // send the message
-  sendMessage(message, destination);
+  if (app->getMulticastGroup() == U32_MAX) {
+    sendMessage(message, destination);
+  } else {
+    sendMulticastMessage(message, app->getMulticastGroup());
+  }
 
   // compute when to send next time
   u64 cycles = cyclesToSend(injectionRate_, messageLength);
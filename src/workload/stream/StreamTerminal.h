@@ -22,6 +22,7 @@
 #include "nlohmann/json.hpp"
 #include "prim/prim.h"
 #include "traffic/size/MessageSizeDistribution.h"
+#include "types/Address.h"
 #include "workload/Terminal.h"
 
 class Application;
@@ -33,7 +34,7 @@ class Application;
 class StreamTerminal : public Terminal {
  public:
   StreamTerminal(const std::string& _name, const Component* _parent, u32 _id,
-                 const std::vector<u32>& _address, ::Application* _app,
+                 const Address& _address, ::Application* _app,
                  nlohmann::json _settings);
   ~StreamTerminal();
   void processEvent(void* _event, s32 _type) override;
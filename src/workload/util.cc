@@ -14,7 +14,9 @@
  */
 #include "workload/util.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include "event/Simulator.h"
 
@@ -45,3 +47,10 @@ u64 cyclesToSend(f64 _injectionRate, u32 _numFlits) {
   }
   return (u64)cycles;
 }
+
+f64 percentile(const std::vector<u64>& _sorted, f64 _percent) {
+  assert(_sorted.size() > 0);
+  u64 rank = (u64)std::ceil((_percent / 100.0) * _sorted.size());
+  rank = std::max(rank, (u64)1);
+  return (f64)_sorted.at(rank - 1);
+}
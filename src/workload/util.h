@@ -15,6 +15,8 @@
 #ifndef WORKLOAD_UTIL_H_
 #define WORKLOAD_UTIL_H_
 
+#include <vector>
+
 #include "prim/prim.h"
 
 /*
@@ -34,4 +36,10 @@ u32 appId(u64 _transId);
  */
 u64 cyclesToSend(f64 _injectionRate, u32 _numFlits);
 
+/*
+ * This returns the percentile of a sorted, non-empty list of values using the
+ *  nearest-rank method.
+ */
+f64 percentile(const std::vector<u64>& _sorted, f64 _percent);
+
 #endif  // WORKLOAD_UTIL_H_
@@ -14,6 +14,8 @@
  */
 #include "workload/util.h"
 
+#include <vector>
+
 #include "event/Simulator.h"
 #include "gtest/gtest.h"
 #include "prim/prim.h"
@@ -111,3 +113,18 @@ TEST(WorkloadUtil, cyclesToSend_probabilistic) {
     ASSERT_NEAR(act, exp, 0.002);
   }
 }
+
+TEST(WorkloadUtil, percentile) {
+  // the nearest rank is the smallest value at or above the percentile
+  std::vector<u64> sorted = {15, 20, 35, 40, 50};
+  ASSERT_EQ(percentile(sorted, 0.0), 15.0);
+  ASSERT_EQ(percentile(sorted, 5.0), 15.0);
+  ASSERT_EQ(percentile(sorted, 30.0), 20.0);
+  ASSERT_EQ(percentile(sorted, 40.0), 20.0);
+  ASSERT_EQ(percentile(sorted, 50.0), 35.0);
+  ASSERT_EQ(percentile(sorted, 99.9), 50.0);
+  ASSERT_EQ(percentile(sorted, 100.0), 50.0);
+
+  std::vector<u64> single = {7};
+  ASSERT_EQ(percentile(single, 50.0), 7.0);
+}